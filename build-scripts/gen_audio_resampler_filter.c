@@ -46,6 +46,11 @@ gcc -o genfilter build-scripts/gen_audio_resampler_filter.c -lm && ./genfilter >
 #define RESAMPLER_SAMPLES_PER_ZERO_CROSSING  (1 << ((RESAMPLER_BITS_PER_SAMPLE / 2) + 1))
 #define RESAMPLER_FILTER_SIZE ((RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_ZERO_CROSSINGS) + 1)
 
+/* The high quality filter is longer, with a stronger window, for music */
+#define RESAMPLER_HQ_ZERO_CROSSINGS 16
+#define RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING 256
+#define RESAMPLER_HQ_FILTER_SIZE ((RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_HQ_ZERO_CROSSINGS) + 1)
+
 /* This is a "modified" bessel function, so you can't use POSIX j0() */
 static double
 bessel(const double x)
@@ -70,7 +75,7 @@ bessel(const double x)
 
 /* build kaiser table with cardinal sine applied to it, and array of differences between elements. */
 static void
-kaiser_and_sinc(float *table, float *diffs, const int tablelen, const double beta)
+kaiser_and_sinc(float *table, float *diffs, const int tablelen, const int samples_per_zero_crossing, const double beta)
 {
     const int lenm1 = tablelen - 1;
     const int lenm1div2 = lenm1 / 2;
@@ -84,7 +89,7 @@ kaiser_and_sinc(float *table, float *diffs, const int tablelen, const double bet
     }
 
     for (i = 1; i < tablelen; i++) {
-        const float x = (((float) i) / ((float) RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) * ((float) M_PI);
+        const float x = (((float) i) / ((float) samples_per_zero_crossing)) * ((float) M_PI);
         table[i] *= sinf(x) / x;
         diffs[i - 1] = table[i] - table[i - 1];
     }
@@ -94,6 +99,8 @@ kaiser_and_sinc(float *table, float *diffs, const int tablelen, const double bet
 
 static float ResamplerFilter[RESAMPLER_FILTER_SIZE];
 static float ResamplerFilterDifference[RESAMPLER_FILTER_SIZE];
+static float ResamplerFilterHQ[RESAMPLER_HQ_FILTER_SIZE];
+static float ResamplerFilterHQDifference[RESAMPLER_HQ_FILTER_SIZE];
 
 static void
 PrepareResampleFilter(void)
@@ -101,13 +108,27 @@ PrepareResampleFilter(void)
     /* if dB > 50, beta=(0.1102 * (dB - 8.7)), according to Matlab. */
     const double dB = 80.0;
     const double beta = 0.1102 * (dB - 8.7);
-    kaiser_and_sinc(ResamplerFilter, ResamplerFilterDifference, RESAMPLER_FILTER_SIZE, beta);
+    const double hq_dB = 120.0;
+    const double hq_beta = 0.1102 * (hq_dB - 8.7);
+    kaiser_and_sinc(ResamplerFilter, ResamplerFilterDifference, RESAMPLER_FILTER_SIZE, RESAMPLER_SAMPLES_PER_ZERO_CROSSING, beta);
+    kaiser_and_sinc(ResamplerFilterHQ, ResamplerFilterHQDifference, RESAMPLER_HQ_FILTER_SIZE, RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING, hq_beta);
 }
 
-int main(void)
+static void
+PrintTable(const char *name, const char *size, const float *table, const int tablelen)
 {
     int i;
 
+    printf("static const float %s[%s] = {\n", name, size);
+    printf("    %.9ff", table[0]);
+    for (i = 0; i < tablelen-1; i++) {
+        printf("%s%.9ff", ((i % 5) == 4) ? ",\n    " : ", ", table[i+1]);
+    }
+    printf("\n};\n\n");
+}
+
+int main(void)
+{
     PrepareResampleFilter();
 
     printf(
@@ -134,26 +155,25 @@ int main(void)
         "\n"
         "/* DO NOT EDIT, THIS FILE WAS GENERATED BY build-scripts/gen_audio_resampler_filter.c */\n"
         "\n"
-        "#define RESAMPLER_ZERO_CROSSINGS %d\n"
-        "#define RESAMPLER_BITS_PER_SAMPLE %d\n"
+        "#define RESAMPLER_ZERO_CROSSINGS            %d\n"
+        "#define RESAMPLER_BITS_PER_SAMPLE           %d\n"
         "#define RESAMPLER_SAMPLES_PER_ZERO_CROSSING (1 << ((RESAMPLER_BITS_PER_SAMPLE / 2) + 1))\n"
-        "#define RESAMPLER_FILTER_SIZE ((RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_ZERO_CROSSINGS) + 1)\n"
+        "#define RESAMPLER_FILTER_SIZE               ((RESAMPLER_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_ZERO_CROSSINGS) + 1)\n"
         "\n", RESAMPLER_ZERO_CROSSINGS, RESAMPLER_BITS_PER_SAMPLE
     );
 
-    printf("static const float ResamplerFilter[RESAMPLER_FILTER_SIZE] = {\n");
-    printf("    %.9ff", ResamplerFilter[0]);
-    for (i = 0; i < RESAMPLER_FILTER_SIZE-1; i++) {
-        printf("%s%.9ff", ((i % 5) == 4) ? ",\n    " : ", ", ResamplerFilter[i+1]);
-    }
-    printf("\n};\n\n");
+    PrintTable("ResamplerFilter", "RESAMPLER_FILTER_SIZE", ResamplerFilter, RESAMPLER_FILTER_SIZE);
+    PrintTable("ResamplerFilterDifference", "RESAMPLER_FILTER_SIZE", ResamplerFilterDifference, RESAMPLER_FILTER_SIZE);
 
-    printf("static const float ResamplerFilterDifference[RESAMPLER_FILTER_SIZE] = {\n");
-    printf("    %.9ff", ResamplerFilterDifference[0]);
-    for (i = 0; i < RESAMPLER_FILTER_SIZE-1; i++) {
-        printf("%s%.9ff", ((i % 5) == 4) ? ",\n    " : ", ", ResamplerFilterDifference[i+1]);
-    }
-    printf("\n};\n\n");
+    printf(
+        "#define RESAMPLER_HQ_ZERO_CROSSINGS            %d\n"
+        "#define RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING %d\n"
+        "#define RESAMPLER_HQ_FILTER_SIZE               ((RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_HQ_ZERO_CROSSINGS) + 1)\n"
+        "\n", RESAMPLER_HQ_ZERO_CROSSINGS, RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING
+    );
+
+    PrintTable("ResamplerFilterHQ", "RESAMPLER_HQ_FILTER_SIZE", ResamplerFilterHQ, RESAMPLER_HQ_FILTER_SIZE);
+    PrintTable("ResamplerFilterHQDifference", "RESAMPLER_HQ_FILTER_SIZE", ResamplerFilterHQDifference, RESAMPLER_HQ_FILTER_SIZE);
     printf("/* vi: set ts=4 sw=4 expandtab: */\n\n");
 
     return 0;
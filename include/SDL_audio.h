@@ -720,6 +720,117 @@ extern DECLSPEC SDL_AudioStatus SDLCALL SDL_GetAudioStatus(void);
  * \sa SDL_PauseAudioDevice
  */
 extern DECLSPEC SDL_AudioStatus SDLCALL SDL_GetAudioDeviceStatus(SDL_AudioDeviceID dev);
+
+/**
+ * Get the number of sample frames an audio device has played.
+ *
+ * This counts the frames handed to the device since it was opened, in the
+ * device's own format (the `freq` of the spec returned by
+ * SDL_OpenAudioDevice()). Buffers played while the device is paused are not
+ * counted. Dividing by the frequency gives the playback position in seconds.
+ *
+ * The "disk" audio driver in offline mode (see SDL_HINT_AUDIO_DISK_OFFLINE)
+ * runs faster than real time, so this is the clock to use for the audio it
+ * renders instead of SDL_GetTicks().
+ *
+ * Capture devices, and devices whose driver calls the audio callback from
+ * its own thread instead of SDL's audio thread, always report 0.
+ *
+ * \param dev the ID of an audio device previously opened with
+ *            SDL_OpenAudioDevice()
+ * \returns the number of sample frames played, or 0 if `dev` is not a valid
+ *          device.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_OpenAudioDevice
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_GetAudioDeviceFramesPlayed(SDL_AudioDeviceID dev);
+
+/**
+ * The number of buckets in SDL_AudioDeviceStats::callback_histogram.
+ */
+#define SDL_AUDIO_STATS_HISTOGRAM_BUCKETS 20
+
+/**
+ * Timing statistics for an audio device.
+ *
+ * Times are in nanoseconds, as measured on SDL's audio thread.
+ *
+ * Bucket 0 of `callback_histogram` counts callbacks that took less than a
+ * microsecond, bucket `i` counts callbacks that took from 2^(i-1) up to 2^i
+ * microseconds, and the last bucket counts everything longer.
+ *
+ * \since This struct is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetAudioDeviceStats
+ */
+typedef struct SDL_AudioDeviceStats
+{
+    Uint64 periods;             /**< Buffers handed to the device */
+    Uint64 underruns;           /**< Buffers handed over after the device ran out of audio */
+    Uint64 late_callbacks;      /**< Callbacks that took longer than the audio they produced */
+    Uint64 callbacks;           /**< Calls to the audio callback, not counting paused periods */
+    Uint64 callback_ns_total;   /**< Time spent in the audio callback */
+    Uint64 callback_ns_max;     /**< Longest audio callback */
+    Uint64 callback_histogram[SDL_AUDIO_STATS_HISTOGRAM_BUCKETS]; /**< Audio callbacks by duration */
+    Uint64 jitter_ns_total;     /**< Sum of how far each time the device asked for audio was from one device buffer after the previous time */
+    Uint64 jitter_ns_max;       /**< Largest of those differences */
+    Uint64 silence_fills;       /**< Device buffers filled with silence because converted audio wasn't ready */
+    Uint64 resample_ns_total;   /**< Time spent converting and resampling the callback's audio */
+    int stream_queued;          /**< Bytes of converted audio waiting for the device after the last callback */
+    int stream_queued_max;      /**< Most bytes of converted audio waiting for the device */
+} SDL_AudioDeviceStats;
+
+/**
+ * Get timing statistics for an audio device.
+ *
+ * SDL's audio thread keeps a deadline for every buffer it hands to the
+ * device, based on when playback started and the buffer size. A buffer that
+ * misses its deadline by more than one buffer is counted as an underrun, and
+ * the schedule restarts from there. A callback, including volume and format
+ * conversion, that takes longer to run than the audio it produces takes to
+ * play is counted as late, even if it didn't cause an underrun.
+ *
+ * The statistics are always collected; it costs a few reads of the
+ * performance counter per buffer. They are meant to help pick the `samples`
+ * value for a device: frequent underruns or long callbacks call for larger
+ * buffers, and a histogram well under the buffer duration leaves room for
+ * smaller ones. The stream fields stay 0 if the device needs no conversion.
+ *
+ * The counters start at zero when the device is opened, and can be cleared
+ * with SDL_ResetAudioDeviceStats(). Capture devices, and devices whose driver
+ * calls the audio callback from its own thread instead of SDL's audio thread,
+ * don't update them.
+ *
+ * \param dev the ID of an audio device previously opened with
+ *            SDL_OpenAudioDevice()
+ * \param stats a pointer filled in with the statistics
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_HINT_AUDIO_PREFILL
+ * \sa SDL_ResetAudioDeviceStats
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDeviceStats(SDL_AudioDeviceID dev, SDL_AudioDeviceStats *stats);
+
+/**
+ * Clear the timing statistics of an audio device.
+ *
+ * This doesn't reset the clock returned by SDL_GetAudioDeviceFramesPlayed().
+ *
+ * \param dev the ID of an audio device previously opened with
+ *            SDL_OpenAudioDevice()
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetAudioDeviceStats
+ */
+extern DECLSPEC int SDLCALL SDL_ResetAudioDeviceStats(SDL_AudioDeviceID dev);
 /* @} *//* Audio State */
 
 /**
@@ -775,6 +886,10 @@ extern DECLSPEC void SDLCALL SDL_PauseAudio(int pause_on);
  * callback, you shouldn't pause the audio device, as it will lead to dropouts
  * in the audio playback. Instead, you should use SDL_LockAudioDevice().
  *
+ * If the device was opened with SDL_HINT_AUDIO_CALLBACK_LOCKFREE enabled,
+ * this returns without waiting for the audio thread, and the new state takes
+ * effect before the next callback.
+ *
  * \param dev a device opened by SDL_OpenAudioDevice()
  * \param pause_on non-zero to pause, 0 to unpause
  *
@@ -784,6 +899,30 @@ extern DECLSPEC void SDLCALL SDL_PauseAudio(int pause_on);
  */
 extern DECLSPEC void SDLCALL SDL_PauseAudioDevice(SDL_AudioDeviceID dev,
                                                   int pause_on);
+
+/**
+ * Set the volume of a playback device.
+ *
+ * The output of the audio callback is scaled by this volume before it is
+ * converted to the device's format, as if by SDL_MixAudioFormat(). Newly
+ * opened devices start at SDL_MIX_MAXVOLUME, which leaves the output alone.
+ * Devices whose driver calls the audio callback from its own thread instead
+ * of SDL's audio thread don't support this.
+ *
+ * If the device was opened with SDL_HINT_AUDIO_CALLBACK_LOCKFREE enabled,
+ * this returns without waiting for the audio thread, and the new volume
+ * takes effect before the next callback.
+ *
+ * \param dev a playback device opened by SDL_OpenAudioDevice()
+ * \param volume the volume, from 0 (silence) to SDL_MIX_MAXVOLUME
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_PauseAudioDevice
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioDeviceVolume(SDL_AudioDeviceID dev, int volume);
 /* @} *//* Pause audio functions */
 
 /**
@@ -828,6 +967,9 @@ extern DECLSPEC void SDLCALL SDL_PauseAudioDevice(SDL_AudioDeviceID dev,
  *
  * It is required that the data source supports seeking.
  *
+ * Large ADPCM files are decoded on several threads. To decode a file a piece
+ * at a time instead of all at once, use SDL_OpenWAVStream_RW().
+ *
  * Example:
  *
  * ```c
@@ -866,6 +1008,7 @@ extern DECLSPEC void SDLCALL SDL_PauseAudioDevice(SDL_AudioDeviceID dev,
  *
  * \sa SDL_FreeWAV
  * \sa SDL_LoadWAV
+ * \sa SDL_OpenWAVStream_RW
  */
 extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
                                                       int freesrc,
@@ -897,6 +1040,123 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
  */
 extern DECLSPEC void SDLCALL SDL_FreeWAV(Uint8 * audio_buf);
 
+/**
+ * A WAVE file that is decoded a piece at a time.
+ *
+ * \since This struct is available since SDL 2.32.0.
+ *
+ * \sa SDL_OpenWAVStream_RW
+ * \sa SDL_ReadWAVStream
+ * \sa SDL_CloseWAVStream
+ */
+struct _SDL_WAVStream;
+typedef struct _SDL_WAVStream SDL_WAVStream;
+
+/**
+ * Open a WAVE data source for reading a piece at a time.
+ *
+ * This reads the headers of the WAVE file, but none of its audio data. The
+ * data is read and decoded as the application asks for it with
+ * SDL_ReadWAVStream(), so only a small part of the file is ever held in
+ * memory. This is a better fit than SDL_LoadWAV_RW() for long files, or for
+ * feeding an SDL_AudioStream as the audio is needed.
+ *
+ * The same formats and hints as with SDL_LoadWAV_RW() are supported, and the
+ * decoded data is the same, in the format written to `spec`. If the file is
+ * shorter than its headers claim, reading ends early.
+ *
+ * The data source must stay valid and support seeking until the stream is
+ * closed. If `freesrc` is non-zero, it is closed along with the stream, or
+ * right away if this function fails.
+ *
+ * Example:
+ *
+ * ```c
+ * SDL_WAVStream *wav = SDL_OpenWAVStream("voice.wav", &spec, NULL);
+ * Uint8 buf[4096];
+ * int len;
+ * while ((len = SDL_ReadWAVStream(wav, buf, sizeof(buf))) > 0) {
+ *     SDL_AudioStreamPut(stream, buf, len);
+ * }
+ * SDL_CloseWAVStream(wav);
+ * ```
+ *
+ * \param src The data source for the WAVE data
+ * \param freesrc If non-zero, SDL will _always_ free the data source
+ * \param spec An SDL_AudioSpec that will be filled in with the format of the
+ *             decoded data
+ * \param audio_len A pointer filled with the length of all the decoded audio
+ *                  data in bytes, may be NULL
+ * \returns a new SDL_WAVStream, or NULL on error; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_CloseWAVStream
+ * \sa SDL_LoadWAV_RW
+ * \sa SDL_ReadWAVStream
+ * \sa SDL_RewindWAVStream
+ */
+extern DECLSPEC SDL_WAVStream *SDLCALL SDL_OpenWAVStream_RW(SDL_RWops * src,
+                                                            int freesrc,
+                                                            SDL_AudioSpec * spec,
+                                                            Uint32 * audio_len);
+
+/**
+ *  Opens a WAV file for streaming.
+ *  Convenience macro, like SDL_LoadWAV().
+ */
+#define SDL_OpenWAVStream(file, spec, audio_len) \
+    SDL_OpenWAVStream_RW(SDL_RWFromFile(file, "rb"), 1, spec, audio_len)
+
+/**
+ * Read and decode audio data from a WAVE stream.
+ *
+ * Only whole sample frames are read; `len` is rounded down to a multiple of
+ * the frame size.
+ *
+ * \param stream the stream returned by SDL_OpenWAVStream_RW()
+ * \param buf a buffer to fill with decoded audio data
+ * \param len the maximum number of bytes to fill
+ * \returns the number of bytes read, 0 at the end of the data, or -1 on
+ *          error; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_OpenWAVStream_RW
+ * \sa SDL_RewindWAVStream
+ */
+extern DECLSPEC int SDLCALL SDL_ReadWAVStream(SDL_WAVStream * stream, void *buf, int len);
+
+/**
+ * Restart reading a WAVE stream from the beginning of its audio data.
+ *
+ * \param stream the stream returned by SDL_OpenWAVStream_RW()
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_ReadWAVStream
+ */
+extern DECLSPEC int SDLCALL SDL_RewindWAVStream(SDL_WAVStream * stream);
+
+/**
+ * Close a WAVE stream.
+ *
+ * If the stream was opened with `freesrc` set, this closes the data source as
+ * well. Otherwise the data source is left at the end of the WAVE data, like
+ * SDL_LoadWAV_RW() leaves it. It is safe to call this function with a NULL
+ * pointer.
+ *
+ * \param stream the stream returned by SDL_OpenWAVStream_RW()
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_OpenWAVStream_RW
+ */
+extern DECLSPEC void SDLCALL SDL_CloseWAVStream(SDL_WAVStream * stream);
+
 /**
  * Initialize an SDL_AudioCVT structure for conversion.
  *
@@ -1071,6 +1331,41 @@ extern DECLSPEC int SDLCALL SDL_AudioStreamGet(SDL_AudioStream *stream, void *bu
  */
 extern DECLSPEC int SDLCALL SDL_AudioStreamAvailable(SDL_AudioStream *stream);
 
+/**
+ * Look at converted/resampled data in the stream without copying it.
+ *
+ * This returns a pointer to the oldest converted data in the stream, which
+ * stays valid until the stream is next used. Only part of the available data
+ * may be returned at once; call SDL_AudioStreamCommitRead() to remove what
+ * you've used and then peek again to get the rest. The data is always a
+ * whole number of sample frames.
+ *
+ * \param stream The stream the audio is being requested from
+ * \param data A pointer filled in with the address of the data, or NULL if
+ *             no data is available
+ * \returns the number of bytes available at `*data`, or -1 on error
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_AudioStreamCommitRead
+ * \sa SDL_AudioStreamGet
+ * \sa SDL_AudioStreamAvailable
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamPeek(SDL_AudioStream *stream, const void **data);
+
+/**
+ * Remove data previously returned by SDL_AudioStreamPeek() from the stream.
+ *
+ * \param stream The stream the audio was requested from
+ * \param len The number of bytes to remove
+ * \returns the number of bytes removed from the stream, or -1 on error
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_AudioStreamPeek
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamCommitRead(SDL_AudioStream *stream, int len);
+
 /**
  * Tell the stream that you're done sending data, and anything being buffered
  * should be converted/resampled and made available immediately.
@@ -1104,6 +1399,40 @@ extern DECLSPEC int SDLCALL SDL_AudioStreamFlush(SDL_AudioStream *stream);
  */
 extern DECLSPEC void SDLCALL SDL_AudioStreamClear(SDL_AudioStream *stream);
 
+/**
+ * The quality levels of SDL's built-in resampler.
+ *
+ * \since This enum is available since SDL 2.32.0.
+ *
+ * \sa SDL_SetAudioStreamResamplingQuality
+ */
+typedef enum
+{
+    SDL_AUDIO_RESAMPLING_LINEAR,  /**< Linear interpolation, cheapest and lowest quality */
+    SDL_AUDIO_RESAMPLING_MEDIUM,  /**< Short windowed sinc filter, the default */
+    SDL_AUDIO_RESAMPLING_HIGH     /**< Long Kaiser windowed sinc filter, band limited when downsampling */
+} SDL_AudioResamplingQuality;
+
+/**
+ * Set the quality of the resampler used by an audio stream.
+ *
+ * New streams use the quality set by SDL_HINT_AUDIO_RESAMPLING_QUALITY.
+ * Setting the quality explicitly makes the stream use SDL's built-in
+ * resampler, even if libsamplerate was selected with
+ * SDL_HINT_AUDIO_RESAMPLING_MODE. The quality can be changed at any time;
+ * data already converted isn't affected.
+ *
+ * \param stream The stream to change
+ * \param quality The new resampling quality
+ * \returns 0 on success, or -1 on error; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_NewAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioStreamResamplingQuality(SDL_AudioStream *stream, SDL_AudioResamplingQuality quality);
+
 /**
  * Free an audio stream
  *
@@ -1118,6 +1447,82 @@ extern DECLSPEC void SDLCALL SDL_AudioStreamClear(SDL_AudioStream *stream);
  */
 extern DECLSPEC void SDLCALL SDL_FreeAudioStream(SDL_AudioStream *stream);
 
+/**
+ * Mix an audio stream into the output of a playback device.
+ *
+ * Every time the device needs audio, SDL's audio thread gets a buffer from
+ * each bound stream and mixes it into the output of the audio callback, or
+ * of the queue if the device uses SDL_QueueAudio(). The streams are summed
+ * as floats, and only clipped when the sum is added to the callback's
+ * output. A stream that has less than a buffer available contributes what
+ * it has, so flush a stream at the end of a sound with
+ * SDL_AudioStreamFlush(). Nothing is mixed while the device is paused.
+ *
+ * Each stream can take any input format and rate, but it must produce
+ * AUDIO_F32SYS with the channels and frequency of the spec returned by
+ * SDL_OpenAudioDevice(). Audio streams have no lock of their own, and the
+ * audio thread gets from the bound streams while holding the device lock,
+ * so while a stream is bound, every call on it (SDL_AudioStreamPut(),
+ * SDL_AudioStreamGet(), SDL_AudioStreamAvailable(), SDL_AudioStreamFlush(),
+ * SDL_AudioStreamClear()) must be made between SDL_LockAudioDevice() and
+ * SDL_UnlockAudioDevice(). This is the case even with
+ * SDL_HINT_AUDIO_CALLBACK_LOCKFREE enabled.
+ *
+ * A stream can only be bound to one device at a time. It stays owned by the
+ * application: unbind it before freeing it. Closing the device unbinds all
+ * of its streams.
+ *
+ * Devices whose driver calls the audio callback from its own thread instead
+ * of SDL's audio thread don't support this.
+ *
+ * \param dev a playback device opened by SDL_OpenAudioDevice()
+ * \param stream the audio stream to mix
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_NewAudioStream
+ * \sa SDL_SetBoundAudioStreamGain
+ * \sa SDL_UnbindAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_BindAudioStream(SDL_AudioDeviceID dev, SDL_AudioStream *stream);
+
+/**
+ * Stop mixing an audio stream into the output of a playback device.
+ *
+ * Data left in the stream stays there.
+ *
+ * \param dev the device the stream was bound to
+ * \param stream the audio stream to unbind
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_BindAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_UnbindAudioStream(SDL_AudioDeviceID dev, SDL_AudioStream *stream);
+
+/**
+ * Set the gain of an audio stream bound to a playback device.
+ *
+ * The gain moves linearly from its current value to the new one over the
+ * next buffer the device plays, so changing it doesn't click. Streams are
+ * bound with a gain of 1.0.
+ *
+ * \param dev the device the stream is bound to
+ * \param stream the bound audio stream
+ * \param gain the new gain, 0.0 for silence, 1.0 to leave the audio alone
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_BindAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_SetBoundAudioStreamGain(SDL_AudioDeviceID dev, SDL_AudioStream *stream, float gain);
+
 #define SDL_MIX_MAXVOLUME 128
 
 /**
@@ -1276,6 +1681,47 @@ extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev, const void *da
  */
 extern DECLSPEC Uint32 SDLCALL SDL_DequeueAudio(SDL_AudioDeviceID dev, void *data, Uint32 len);
 
+/**
+ * Dequeue captured audio together with the time it was captured.
+ *
+ * This works like SDL_DequeueAudio(), but also reports when the returned
+ * audio was recorded, so it can be lined up with playback, for example for
+ * echo cancellation.
+ *
+ * When the capture device was opened without a callback and with
+ * SDL_HINT_AUDIO_CAPTURE_LOCKFREE enabled, SDL's capture thread puts every
+ * buffer it records into a fixed size ring without taking the device lock,
+ * stamped with a sequence number and the time its first sample frame was
+ * captured. If the ring is full because the application doesn't dequeue
+ * fast enough, the capture thread drops the new buffer instead of waiting,
+ * and the sequence numbers skip it.
+ *
+ * The data returned by one call is always contiguous: it stops early at a
+ * dropped buffer. `*timestamp` is the capture time of the first sample
+ * frame returned, and each following frame is one sample period later.
+ * Timestamps are in nanoseconds, on the same clock as
+ * SDL_GetPerformanceCounter(), and are estimated from when SDL received the
+ * audio from the driver; latency inside the driver isn't included.
+ *
+ * On devices that aren't in that mode, this is the same as
+ * SDL_DequeueAudio() and the timestamp and sequence number are set to 0.
+ *
+ * \param dev the device ID from which we will dequeue audio
+ * \param data a pointer into where audio data should be copied
+ * \param len the number of bytes (not samples!) to which (data) points
+ * \param timestamp a pointer filled in with the capture time of the first
+ *                  sample frame, in nanoseconds, may be NULL
+ * \param sequence a pointer filled in with the sequence number of the
+ *                 buffer the first sample frame came from, may be NULL
+ * \returns the number of bytes dequeued, which could be less than requested.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_DequeueAudio
+ * \sa SDL_HINT_AUDIO_CAPTURE_LOCKFREE
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_DequeueAudioTimestamped(SDL_AudioDeviceID dev, void *data, Uint32 len, Uint64 *timestamp, Uint32 *sequence);
+
 /**
  * Get the number of bytes of still-queued audio.
  *
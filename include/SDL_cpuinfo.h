@@ -477,6 +477,99 @@ extern DECLSPEC SDL_bool SDLCALL SDL_HasLASX(void);
  */
 extern DECLSPEC int SDLCALL SDL_GetSystemRAM(void);
 
+/**
+ * The kind of a CPU core, on CPUs that mix cores of different performance.
+ *
+ * \since This enum is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetLogicalCPUs
+ */
+typedef enum
+{
+    SDL_CPU_CORE_UNKNOWN,       /**< All cores are alike, or SDL can't tell them apart */
+    SDL_CPU_CORE_PERFORMANCE,   /**< A faster, more power hungry core */
+    SDL_CPU_CORE_EFFICIENCY     /**< A slower, more power efficient core */
+} SDL_CPUCoreType;
+
+/**
+ * Where a logical CPU sits in the CPU topology.
+ *
+ * Logical CPUs with the same `core` are SMT siblings (hyperthreads) sharing
+ * one physical core. Cores, packages and NUMA nodes are numbered from 0.
+ *
+ * \since This struct is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetLogicalCPUs
+ */
+typedef struct SDL_LogicalCPU
+{
+    int id;                     /**< The CPU number used by SDL_SetThreadAffinity() */
+    int core;                   /**< The physical core this CPU belongs to */
+    int package;                /**< The physical package (socket) this CPU belongs to */
+    int numa_node;              /**< The NUMA node this CPU belongs to */
+    SDL_CPUCoreType core_type;  /**< The kind of core this CPU belongs to */
+} SDL_LogicalCPU;
+
+/**
+ * A summary of the CPU topology.
+ *
+ * Cache sizes are 0 if they couldn't be determined.
+ *
+ * \since This struct is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetCPUTopology
+ */
+typedef struct SDL_CPUTopology
+{
+    int num_cpus;       /**< The number of logical CPUs */
+    int num_cores;      /**< The number of physical cores */
+    int num_packages;   /**< The number of physical packages (sockets) */
+    int num_numa_nodes; /**< The number of NUMA nodes */
+    int l1d_cache_size; /**< The size of each core's L1 data cache, in bytes */
+    int l2_cache_size;  /**< The size of each L2 cache, in bytes */
+    int l3_cache_size;  /**< The size of each L3 cache, in bytes */
+} SDL_CPUTopology;
+
+/**
+ * Get a summary of the CPU topology.
+ *
+ * On platforms where SDL can't read the topology, each logical CPU is
+ * reported as its own core in a single package and NUMA node.
+ *
+ * The topology is read the first time it's needed and cached until
+ * SDL_Quit(), so CPUs brought online or offline later aren't reflected.
+ *
+ * \param topology a pointer filled in with the topology
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetLogicalCPUs
+ */
+extern DECLSPEC int SDLCALL SDL_GetCPUTopology(SDL_CPUTopology *topology);
+
+/**
+ * Get the topology of each logical CPU.
+ *
+ * CPUs are reported in order of their `id`. The ids are not necessarily
+ * contiguous, since CPUs may be offline. Like SDL_GetCPUTopology(), this
+ * reports the topology cached when it was first read.
+ *
+ * \param cpus an array filled in with up to `max_cpus` logical CPUs, or
+ *             NULL to only get the number of CPUs
+ * \param max_cpus the number of elements in `cpus`
+ * \returns the number of logical CPUs, which may be more than `max_cpus`,
+ *          or a negative error code on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetCPUTopology
+ * \sa SDL_SetThreadAffinity
+ */
+extern DECLSPEC int SDLCALL SDL_GetLogicalCPUs(SDL_LogicalCPU *cpus, int max_cpus);
+
 /**
  * Report the alignment this system needs for SIMD allocations.
  *
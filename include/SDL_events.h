@@ -941,6 +941,14 @@ extern DECLSPEC int SDLCALL SDL_WaitEventTimeout(SDL_Event * event,
  * Note: Events pushed onto the queue with SDL_PushEvent() get passed through
  * the event filter but events added with SDL_PeepEvents() do not.
  *
+ * If SDL_HINT_EVENT_INGRESS_QUEUE is enabled, events pushed from a thread
+ * other than the one that initialized the event subsystem go into a lock-free
+ * queue instead, so that worker threads don't contend with the thread reading
+ * events. That queue is merged into the event queue the next time it's pumped
+ * or read, and the event filter and event watchers run on the reading thread
+ * at that point, so this function returns 1 even if the filter later drops
+ * the event. See SDL_HINT_EVENT_INGRESS_QUEUE for the ordering guarantees.
+ *
  * For pushing application-specific events, please use SDL_RegisterEvents() to
  * get an event type that does not conflict with other code that also wants
  * its own custom event types.
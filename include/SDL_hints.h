@@ -193,6 +193,50 @@ extern "C" {
  */
 #define SDL_HINT_APPLE_TV_REMOTE_ALLOW_ROTATION "SDL_APPLE_TV_REMOTE_ALLOW_ROTATION"
 
+/**
+ *  \brief  A variable controlling whether the audio thread calls the audio callback without locking.
+ *
+ *  By default the audio thread holds the device lock while it calls the
+ *  audio callback, so a thread holding SDL_LockAudioDevice() for too long
+ *  makes the device run dry. When this is enabled the callback runs without
+ *  the lock, and SDL_PauseAudioDevice() and SDL_SetAudioDeviceVolume() post
+ *  commands that the audio thread applies before its next callback instead
+ *  of waiting for it. SDL_LockAudioDevice() then no longer keeps the callback
+ *  from running, so the application has to synchronize with it by itself.
+ *
+ *  This only applies to playback devices with an audio callback that are
+ *  fed by SDL's audio thread, and not to devices using SDL_QueueAudio().
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Lock the device around the audio callback (default)
+ *    "1"       - Call the audio callback without locking
+ *
+ *  This hint is checked when the audio device is opened.
+ */
+#define SDL_HINT_AUDIO_CALLBACK_LOCKFREE "SDL_AUDIO_CALLBACK_LOCKFREE"
+
+/**
+ *  \brief  A variable controlling whether captured audio is queued in a lock-free, timestamped ring.
+ *
+ *  By default a capture device opened without a callback queues its audio
+ *  in an unbounded queue, under the device lock. When this is enabled SDL's
+ *  capture thread writes every buffer into a fixed size ring instead, with a
+ *  sequence number and a capture timestamp, and never waits for the
+ *  application. The ring holds about half a second of audio; if it is full,
+ *  new buffers are dropped. Use SDL_DequeueAudioTimestamped() to read the
+ *  audio with its capture time.
+ *
+ *  This only applies to capture devices without a callback that are read by
+ *  SDL's capture thread.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Queue captured audio under the device lock (default)
+ *    "1"       - Queue captured audio in a lock-free ring with timestamps
+ *
+ *  This hint is checked when the audio device is opened.
+ */
+#define SDL_HINT_AUDIO_CAPTURE_LOCKFREE "SDL_AUDIO_CAPTURE_LOCKFREE"
+
 /**
  *  \brief  A variable controlling the audio category on iOS and Mac OS X
  *
@@ -268,6 +312,72 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_STREAM_ROLE "SDL_AUDIO_DEVICE_STREAM_ROLE"
 
+/**
+ *  \brief  A variable controlling how long the "disk" audio driver waits per buffer, in milliseconds.
+ *
+ *  By default the driver waits as long as a buffer would take to play on a
+ *  real device. This is ignored in offline mode, see SDL_HINT_AUDIO_DISK_OFFLINE.
+ *
+ *  This hint is checked when the audio device is opened.
+ */
+#define SDL_HINT_AUDIO_DISK_DELAY "SDL_DISKAUDIODELAY"
+
+/**
+ *  \brief  A variable specifying the file the "disk" audio driver reads captured audio from.
+ *
+ *  The file contains raw audio data in the format of the opened device.
+ *  The default is "sdlaudio-in.raw".
+ *
+ *  This hint is checked when the audio device is opened.
+ */
+#define SDL_HINT_AUDIO_DISK_INPUT_FILE "SDL_DISKAUDIOFILEIN"
+
+/**
+ *  \brief  A variable controlling whether the "disk" audio driver renders faster than real time.
+ *
+ *  In offline mode the driver never sleeps: the audio callback is called
+ *  back to back, with the same buffer size it would get on a real device,
+ *  and every buffer is written to the output file. Use
+ *  SDL_GetAudioDeviceFramesPlayed() as the clock for the rendered audio.
+ *  While the device is paused nothing is written and the clock stops.
+ *
+ *  In offline mode the output file defaults to "sdlaudio.wav".
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Throttle output to real time (default)
+ *    "1"       - Render as fast as possible
+ *
+ *  This hint is checked when the audio device is opened.
+ */
+#define SDL_HINT_AUDIO_DISK_OFFLINE "SDL_AUDIO_DISK_OFFLINE"
+
+/**
+ *  \brief  A variable specifying the file the "disk" audio driver writes to.
+ *
+ *  If the name ends in ".wav" the file is written as a WAVE file, otherwise
+ *  it contains raw audio data in the format of the opened device. The
+ *  default is "sdlaudio.raw", or "sdlaudio.wav" in offline mode.
+ *
+ *  This hint is checked when the audio device is opened.
+ */
+#define SDL_HINT_AUDIO_DISK_OUTPUT_FILE "SDL_DISKAUDIOFILE"
+
+/**
+ *  \brief  A variable controlling whether the audio thread queues an extra buffer ahead.
+ *
+ *  When enabled, the audio thread fills two buffers before it starts waiting
+ *  on the device, and again after an underrun, which adds one buffer of
+ *  latency but leaves more headroom for a slow audio callback. See
+ *  SDL_GetAudioDeviceStats() for the underrun count.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Queue one buffer at a time (default)
+ *    "1"       - Queue one buffer ahead
+ *
+ *  This hint is checked when the audio device is opened.
+ */
+#define SDL_HINT_AUDIO_PREFILL "SDL_AUDIO_PREFILL"
+
 /**
  *  \brief  A variable controlling speed/quality tradeoff of audio resampling.
  *
@@ -291,6 +401,22 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_RESAMPLING_MODE   "SDL_AUDIO_RESAMPLING_MODE"
 
+/**
+ *  \brief  A variable controlling the quality of SDL's internal resampler.
+ *
+ *  This is used by SDL_ConvertAudio() and new audio streams when SDL's
+ *  internal resampler is used, see SDL_HINT_AUDIO_RESAMPLING_MODE.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0" or "linear" - Linear interpolation, fastest
+ *    "1" or "medium" - Short windowed sinc filter (default)
+ *    "2" or "high"   - Long Kaiser windowed sinc filter, best quality
+ *
+ *  This hint is checked when a converter or audio stream is created.
+ */
+#define SDL_HINT_AUDIO_RESAMPLING_QUALITY   "SDL_AUDIO_RESAMPLING_QUALITY"
+
 /**
  *  \brief  A variable controlling whether SDL updates joystick state when getting input events
  *
@@ -334,6 +460,27 @@ extern "C" {
  */
 #define SDL_HINT_BMP_SAVE_LEGACY_FORMAT "SDL_BMP_SAVE_LEGACY_FORMAT"
 
+/**
+ *  \brief  A variable that limits which CPU features SDL reports and uses.
+ *
+ *  The variable is a comma separated list of CPU features, processed from
+ *  left to right. A feature prefixed with '-' is disabled, a feature with no
+ *  prefix or a '+' prefix is enabled again, if the CPU supports it. "all"
+ *  stands for every feature.
+ *
+ *  The features are: "altivec", "mmx", "3dnow", "sse", "sse2", "sse3",
+ *  "sse41", "sse42", "avx", "avx2", "avx512f", "arm-simd", "neon", "lsx" and
+ *  "lasx".
+ *
+ *  For example "-all,+sse2" only leaves SSE2 enabled and "-avx2" keeps SDL
+ *  from using AVX2. This is mostly useful for testing and benchmarking code
+ *  paths that would otherwise not be taken on this CPU.
+ *
+ *  This hint can be changed at any time, but code paths that were already
+ *  chosen (for example in an existing SDL_AudioCVT) are not affected.
+ */
+#define SDL_HINT_CPU_FEATURE_MASK "SDL_CPU_FEATURE_MASK"
+
 /**
  *  \brief Override for SDL_GetDisplayUsableBounds()
  *
@@ -399,6 +546,27 @@ extern "C" {
  */
 #define SDL_HINT_ENABLE_STEAM_CONTROLLERS "SDL_ENABLE_STEAM_CONTROLLERS"
 
+/**
+ *  \brief  A variable controlling whether SDL_PushEvent() from other threads goes through a lock-free queue.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Every thread adds events to the event queue directly, running the event filter and watchers as it does (the default)
+ *    "1"       - Threads other than the one that initialized the event subsystem push events into a lock-free queue,
+ *                which is merged into the event queue when it's next pumped or read
+ *
+ *  With the lock-free queue, the event filter and event watchers for events
+ *  pushed from other threads run on the thread that reads the event queue,
+ *  when the events are merged, so SDL_PushEvent() returns 1 for them even if
+ *  the filter later drops them. Events pushed by one thread stay in the order
+ *  they were pushed, but there is no ordering between threads, and they may be
+ *  delivered after events that the reading thread added later. If another
+ *  thread is already merging the queue, SDL_PumpEvents() returns without
+ *  waiting for it, so events it is still merging may not be visible yet.
+ *
+ *  This hint must be set before the event subsystem is initialized.
+ */
+#define SDL_HINT_EVENT_INGRESS_QUEUE "SDL_EVENT_INGRESS_QUEUE"
+
 /**
  *  \brief  A variable controlling verbosity of the logging of SDL events pushed onto the internal queue.
  *
@@ -618,6 +786,20 @@ extern "C" {
  */
 #define SDL_HINT_IOS_HIDE_HOME_INDICATOR "SDL_IOS_HIDE_HOME_INDICATOR"
 
+/**
+ *  \brief  A variable controlling the number of worker threads in the job system.
+ *
+ *  The variable can be set to a number of threads, from 0 up to 256. Threads
+ *  that wait on jobs help run them, so "0" runs every job on the threads that
+ *  submit and wait for them.
+ *
+ *  By default SDL starts one worker less than the number of CPU cores.
+ *
+ *  This hint is read when the job system starts, the first time it's used
+ *  after the program starts or after SDL_Quit().
+ */
+#define SDL_HINT_JOB_WORKERS "SDL_JOB_WORKERS"
+
 /**
  *  \brief  A variable that lets you enable joystick (and gamecontroller) events even when your app is in the background.
  *
@@ -1282,6 +1464,19 @@ extern "C" {
   */
 #define SDL_HINT_LINUX_JOYSTICK_DEADZONES "SDL_LINUX_JOYSTICK_DEADZONES"
 
+/**
+ *  \brief  A variable controlling whether SDL keeps lock contention statistics.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Don't keep statistics (the default)
+ *    "1"       - Count acquisitions, contention and wait times of SDL locks
+ *
+ *  Statistics can be read with SDL_GetLockStats() and SDL_LogLockStats().
+ *
+ *  This hint can be enabled or disabled at any time.
+ */
+#define SDL_HINT_LOCK_STATS "SDL_LOCK_STATS"
+
 /**
  *  \brief A variable controlling the default SDL log levels.
  *
@@ -1332,6 +1527,21 @@ extern "C" {
  */
 #define SDL_HINT_MAC_OPENGL_ASYNC_DISPATCH "SDL_MAC_OPENGL_ASYNC_DISPATCH"
 
+/**
+ *  \brief  A variable controlling whether SDL profiles its heap allocations.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Don't profile allocations (the default)
+ *    "1"       - Track the live bytes, peak bytes and allocation rate of each subsystem
+ *
+ *  Statistics can be read with SDL_GetMemoryStats() and SDL_LogMemoryStats().
+ *  Turning profiling on starts the statistics from zero, and only memory
+ *  allocated while it is on is counted.
+ *
+ *  This hint can be enabled or disabled at any time.
+ */
+#define SDL_HINT_MEMORY_PROFILE "SDL_MEMORY_PROFILE"
+
 /**
  *  \brief  A variable setting the double click radius, in pixels.
  */
@@ -1788,6 +1998,41 @@ extern "C" {
  */
 #define SDL_HINT_SCREENSAVER_INHIBIT_ACTIVITY_NAME "SDL_SCREENSAVER_INHIBIT_ACTIVITY_NAME"
 
+/**
+ *  \brief  A variable controlling dithering when blitting truecolor surfaces to 8-bit palettized surfaces
+ *
+ *  This variable can be set to the following values:
+ *    "0" or "none"    - Map each pixel to the closest palette entry
+ *    "1" or "ordered" - Apply a 4x4 ordered (Bayer) dither before mapping to the palette
+ *
+ *  By default no dithering is done.
+ *
+ *  This hint is checked when a blit mapping is created, e.g. the first time
+ *  a surface is blitted to a new destination or by SDL_ConvertSurface().
+ */
+#define SDL_HINT_SURFACE_PALETTE_DITHER "SDL_SURFACE_PALETTE_DITHER"
+
+/**
+ *  \brief A variable that pins threads to CPUs by thread name.
+ *
+ *  This applies to threads created by SDL, including SDL's own threads like
+ *  "SDLTimer", the audio threads ("SDLAudioP1", "SDLAudioC1", ...) and the
+ *  job system workers, as well as threads created by the application with
+ *  SDL_CreateThread(). It's applied when the thread starts.
+ *
+ *  The value is a list of entries separated by semicolons. Each entry is a
+ *  thread name, which may end in '*' to match any name starting with it,
+ *  then '=', then the CPUs the thread may run on. The CPUs are a comma
+ *  separated list of CPU numbers and ranges, or "performance" or "efficiency"
+ *  for the cores of that type from SDL_GetLogicalCPUs(). The first matching
+ *  entry is used.
+ *
+ *  For example: "SDLAudio*=2-3;SDLTimer=1;*=performance"
+ *
+ *  By default threads may run on any CPU.
+ */
+#define SDL_HINT_THREAD_AFFINITY "SDL_THREAD_AFFINITY"
+
 /**
  *  \brief Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as realtime.
  *
@@ -1807,6 +2052,19 @@ extern "C" {
  */
 #define SDL_HINT_THREAD_FORCE_REALTIME_TIME_CRITICAL "SDL_THREAD_FORCE_REALTIME_TIME_CRITICAL"
 
+/**
+ *  \brief A variable that sets thread priorities by thread name.
+ *
+ *  This applies to the same threads as SDL_HINT_THREAD_AFFINITY and uses
+ *  the same format, except each thread name is followed by one of "low",
+ *  "normal", "high" or "time_critical", which is passed to
+ *  SDL_SetThreadPriority() when the thread starts. A thread that later sets
+ *  its own priority, as the audio threads do, overrides this.
+ *
+ *  For example: "SDLJobWorker*=low;MyDecoder=high"
+ */
+#define SDL_HINT_THREAD_PRIORITIES "SDL_THREAD_PRIORITIES"
+
 /**
 *  \brief  A string specifying additional information to use with SDL_SetThreadPriority.
 *
@@ -1854,6 +2112,19 @@ extern "C" {
  */
 #define SDL_HINT_TIMER_RESOLUTION "SDL_TIMER_RESOLUTION"
 
+/**
+ *  \brief A variable that controls how late timers may fire, in microseconds.
+ *
+ *  The timer thread may wait up to this long past a timer's deadline, so that
+ *  timers with nearby deadlines fire together in a single wakeup. Timers are
+ *  never fired early. Larger values mean fewer wakeups and less power use on
+ *  mostly idle systems, at the cost of timer accuracy.
+ *
+ *  The default value is "0", which wakes for every deadline. This hint may be
+ *  set at any time.
+ */
+#define SDL_HINT_TIMER_SLACK "SDL_TIMER_SLACK"
+
 /**
  *  \brief  A variable controlling whether touch events should generate synthetic mouse events
  *
@@ -2798,6 +3069,9 @@ extern DECLSPEC void SDLCALL SDL_ResetHints(void);
 /**
  * Get the value of a hint.
  *
+ * The returned string is owned by SDL and stays valid until the hint is
+ * changed or reset, possibly by another thread.
+ *
  * \param name the hint to query
  * \returns the string value of a hint or NULL if the hint isn't set.
  *
@@ -238,6 +238,162 @@ extern DECLSPEC void SDLCALL SDL_DestroyMutex(SDL_mutex * mutex);
 /* @} *//* Mutex functions */
 
 
+/**
+ *  \name Read/write lock functions
+ */
+/* @{ */
+
+/* The SDL read/write lock structure, defined in SDL_sysrwlock.c */
+struct SDL_RWLock;
+typedef struct SDL_RWLock SDL_RWLock;
+
+/**
+ * Create a new read/write lock.
+ *
+ * A read/write lock is useful for situations where you have multiple threads
+ * trying to access a resource that is rarely updated. All threads requesting
+ * a read-only lock will be allowed to run in parallel; if a thread requests a
+ * write lock, it will be provided exclusive access. This makes it safe for
+ * multiple threads to use a resource at the same time if they promise not to
+ * change it, and when it has to be changed, the rwlock will serve as a
+ * gateway to make sure those changes can be made safely.
+ *
+ * In the right situation, a rwlock can be more efficient than a mutex, which
+ * only lets a single thread proceed at a time, even if it won't be modifying
+ * the data.
+ *
+ * All newly-created read/write locks begin in the _unlocked_ state.
+ *
+ * Unlike SDL mutexes, read/write locks are not reentrant: a thread holding
+ * the lock for writing must not lock it again, and a thread holding it for
+ * reading must not lock it for writing. Locking it for reading again while
+ * another thread waits to write may deadlock.
+ *
+ * \returns the initialized and unlocked read/write lock or NULL on failure;
+ *          call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_DestroyRWLock
+ * \sa SDL_LockRWLockForReading
+ * \sa SDL_LockRWLockForWriting
+ * \sa SDL_TryLockRWLockForReading
+ * \sa SDL_TryLockRWLockForWriting
+ * \sa SDL_UnlockRWLock
+ */
+extern DECLSPEC SDL_RWLock *SDLCALL SDL_CreateRWLock(void);
+
+/**
+ * Lock the read/write lock for _read only_ operations.
+ *
+ * This will block until the rwlock is available, which is to say it is not
+ * locked for writing by any other thread. Of all threads waiting to lock the
+ * rwlock, all may do so at the same time as long as they are requesting
+ * read-only access; if a thread wants to lock for writing, only one may do so
+ * at a time, and no other threads, read-only or not, may hold the lock at the
+ * same time.
+ *
+ * \param rwlock the read/write lock to lock
+ * \returns 0, or -1 on error.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_LockRWLockForWriting
+ * \sa SDL_UnlockRWLock
+ */
+extern DECLSPEC int SDLCALL SDL_LockRWLockForReading(SDL_RWLock *rwlock) SDL_ACQUIRE_SHARED(rwlock);
+
+/**
+ * Lock the read/write lock for _write_ operations.
+ *
+ * This will block until the rwlock is available, which is to say it is not
+ * locked for reading or writing by any other thread. Only one thread may hold
+ * the lock when it requests write access; all other threads, whether they
+ * also want to write or only want read-only access, must wait until the
+ * writer thread has released the lock.
+ *
+ * \param rwlock the read/write lock to lock
+ * \returns 0, or -1 on error.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_LockRWLockForReading
+ * \sa SDL_UnlockRWLock
+ */
+extern DECLSPEC int SDLCALL SDL_LockRWLockForWriting(SDL_RWLock *rwlock) SDL_ACQUIRE(rwlock);
+
+/**
+ * Try to lock a read/write lock _for reading_ without blocking.
+ *
+ * This works just like SDL_LockRWLockForReading(), but if the rwlock is not
+ * available, then this function returns `SDL_MUTEX_TIMEDOUT` immediately.
+ *
+ * \param rwlock the rwlock to try to lock
+ * \returns 0, `SDL_MUTEX_TIMEDOUT`, or -1 on error; call SDL_GetError() for
+ *          more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_LockRWLockForReading
+ * \sa SDL_TryLockRWLockForWriting
+ * \sa SDL_UnlockRWLock
+ */
+extern DECLSPEC int SDLCALL SDL_TryLockRWLockForReading(SDL_RWLock *rwlock) SDL_TRY_ACQUIRE_SHARED(0, rwlock);
+
+/**
+ * Try to lock a read/write lock _for writing_ without blocking.
+ *
+ * This works just like SDL_LockRWLockForWriting(), but if the rwlock is not
+ * available, then this function returns `SDL_MUTEX_TIMEDOUT` immediately.
+ *
+ * \param rwlock the rwlock to try to lock
+ * \returns 0, `SDL_MUTEX_TIMEDOUT`, or -1 on error; call SDL_GetError() for
+ *          more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_LockRWLockForWriting
+ * \sa SDL_TryLockRWLockForReading
+ * \sa SDL_UnlockRWLock
+ */
+extern DECLSPEC int SDLCALL SDL_TryLockRWLockForWriting(SDL_RWLock *rwlock) SDL_TRY_ACQUIRE(0, rwlock);
+
+/**
+ * Unlock the read/write lock.
+ *
+ * Use this function to unlock the rwlock, whether it was locked for
+ * read-only or write operations.
+ *
+ * It is an error to unlock a rwlock that is not locked by the calling thread,
+ * and doing so results in undefined behavior.
+ *
+ * \param rwlock the rwlock to unlock
+ * \returns 0, or -1 on error.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_LockRWLockForReading
+ * \sa SDL_LockRWLockForWriting
+ */
+extern DECLSPEC int SDLCALL SDL_UnlockRWLock(SDL_RWLock *rwlock) SDL_RELEASE_GENERIC(rwlock);
+
+/**
+ * Destroy a read/write lock created with SDL_CreateRWLock().
+ *
+ * This function must be called on any read/write lock that is no longer
+ * needed. It is not safe to destroy a rwlock that is locked.
+ *
+ * \param rwlock the rwlock to destroy
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_CreateRWLock
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyRWLock(SDL_RWLock *rwlock);
+
+/* @} *//* Read/write lock functions */
+
+
 /**
  *  \name Semaphore functions
  */
@@ -534,6 +690,119 @@ extern DECLSPEC int SDLCALL SDL_CondWaitTimeout(SDL_cond * cond,
 /* @} *//* Condition variable functions */
 
 
+/**
+ *  \name Lock statistics
+ *
+ *  When the SDL_HINT_LOCK_STATS hint is enabled, SDL counts how often each
+ *  mutex, semaphore, condition variable and spinlock is acquired, and how
+ *  long threads wait for it. This helps find the lock behind a stall.
+ */
+/* @{ */
+
+/**
+ * The kinds of lock that SDL keeps statistics for.
+ *
+ * \since This enum is available since SDL 2.32.0.
+ */
+typedef enum
+{
+    SDL_LOCKTYPE_MUTEX,
+    SDL_LOCKTYPE_SEMAPHORE,
+    SDL_LOCKTYPE_CONDITION,
+    SDL_LOCKTYPE_SPINLOCK
+} SDL_LockType;
+
+/**
+ * Contention statistics for a single lock.
+ *
+ * Semaphores and condition variables are made for waiting, so for those
+ * `contended`, `wait_ns` and `max_wait_ns` count the waits that blocked and
+ * the time spent waiting to be signaled. That is not contention, so they are
+ * reported after the mutexes and spinlocks, and `holder` is always empty.
+ *
+ * \since This struct is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetLockStats
+ */
+typedef struct SDL_LockStats
+{
+    char name[32];          /**< The name given with SDL_SetLockName(), or an empty string */
+    const void *lock;       /**< The lock, or NULL if it has been destroyed */
+    SDL_LockType type;      /**< The kind of lock */
+    Uint64 acquisitions;    /**< The number of times the lock was acquired */
+    Uint64 contended;       /**< The number of acquisitions that had to wait */
+    Uint64 wait_ns;         /**< The total time spent waiting, in nanoseconds */
+    Uint64 max_wait_ns;     /**< The longest single wait, in nanoseconds */
+    char holder[32];        /**< The thread that had the lock the last time another thread had to wait for it */
+} SDL_LockStats;
+
+/**
+ * Give a lock a name to identify it in lock statistics.
+ *
+ * SDL names its own locks, so they can be told apart from the ones the
+ * application creates. Names are kept whether or not statistics are enabled.
+ *
+ * \param lock a pointer to an SDL_mutex, SDL_sem, SDL_cond or SDL_SpinLock
+ * \param name the name of the lock, truncated to 31 characters
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetLockStats
+ */
+extern DECLSPEC int SDLCALL SDL_SetLockName(const void *lock, const char *name);
+
+/**
+ * Get statistics for the most contended locks.
+ *
+ * Mutexes and spinlocks come first, sorted by the total time threads spent
+ * waiting for them, the longest first. Semaphores and condition variables
+ * follow, sorted the same way. Locks that have been destroyed are included if
+ * they were named and ever contended.
+ *
+ * \param stats an array to fill in, or NULL to get the number of locks
+ * \param count the number of entries in `stats`
+ * \returns the number of entries filled in, or the number of locks with
+ *          statistics if `stats` is NULL.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_LogLockStats
+ * \sa SDL_ResetLockStats
+ * \sa SDL_SetLockName
+ */
+extern DECLSPEC int SDLCALL SDL_GetLockStats(SDL_LockStats *stats, int count);
+
+/**
+ * Log statistics for the most contended locks.
+ *
+ * This logs one line per lock with SDL_Log(), the most contended first.
+ * Waits on semaphores and condition variables are logged separately, after
+ * the contention of the other locks.
+ *
+ * \param count the maximum number of locks to log
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetLockStats
+ */
+extern DECLSPEC void SDLCALL SDL_LogLockStats(int count);
+
+/**
+ * Clear the statistics of all locks.
+ *
+ * Lock names are kept.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetLockStats
+ */
+extern DECLSPEC void SDLCALL SDL_ResetLockStats(void);
+
+/* @} *//* Lock statistics */
+
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
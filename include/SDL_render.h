@@ -1913,6 +1913,49 @@ extern DECLSPEC void *SDLCALL SDL_RenderGetMetalCommandEncoder(SDL_Renderer * re
  */
 extern DECLSPEC int SDLCALL SDL_RenderSetVSync(SDL_Renderer* renderer, int vsync);
 
+/**
+ * Pacing statistics for a renderer's simulated vsync.
+ *
+ * \since This struct is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderGetVSyncStats
+ */
+typedef struct SDL_RenderVSyncStats
+{
+    Uint64 frames;      /**< Presents paced by simulated vsync */
+    Uint64 missed;      /**< Presents that came after the refresh they were due for */
+    Uint64 skipped;     /**< Whole refresh intervals skipped by late presents */
+    Uint64 late_ns_max; /**< Longest time a present was late, in nanoseconds */
+} SDL_RenderVSyncStats;
+
+/**
+ * Get pacing statistics for a renderer's simulated vsync.
+ *
+ * When vsync is requested but the renderer can't provide it, or a present
+ * fails, SDL_RenderPresent() waits for the next refresh of the window's
+ * display itself. The refreshes are scheduled on the performance counter,
+ * starting from the first paced present, and the wait sleeps and then spins
+ * with SDL_DelayNS() to return close to the refresh.
+ *
+ * A present that comes after its refresh doesn't wait; it's counted as
+ * missed, along with any whole refresh intervals it skipped, and the next
+ * present is due at the following refresh. After a pause of more than a
+ * second the schedule restarts.
+ *
+ * The counters are all 0 if the renderer's vsync has never been simulated.
+ *
+ * \param renderer the renderer to query
+ * \param stats a pointer filled in with the statistics
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderPresent
+ * \sa SDL_RenderSetVSync
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetVSyncStats(SDL_Renderer *renderer, SDL_RenderVSyncStats *stats);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -491,6 +491,89 @@ extern DECLSPEC int SDLCALL SDL_SetMemoryFunctions(SDL_malloc_func malloc_func,
  */
 extern DECLSPEC int SDLCALL SDL_GetNumAllocations(void);
 
+/**
+ * The subsystems that heap allocations are charged to by the memory profiler.
+ *
+ * Memory allocated by SDL outside the listed subsystems is charged to
+ * SDL_MEMORY_TAG_OTHER, and memory the application allocates with
+ * SDL_malloc(), SDL_calloc() or SDL_realloc() to SDL_MEMORY_TAG_APPLICATION.
+ *
+ * \since This enum is available since SDL 2.32.0.
+ */
+typedef enum
+{
+    SDL_MEMORY_TAG_OTHER,
+    SDL_MEMORY_TAG_APPLICATION,
+    SDL_MEMORY_TAG_RENDER,
+    SDL_MEMORY_TAG_VIDEO,
+    SDL_MEMORY_TAG_AUDIO,
+    SDL_MEMORY_TAG_EVENTS,
+    SDL_MEMORY_TAG_JOYSTICK,
+    SDL_NUM_MEMORY_TAGS
+} SDL_MemoryTag;
+
+/**
+ * Heap statistics for one subsystem, collected while the
+ * SDL_HINT_MEMORY_PROFILE hint is enabled.
+ *
+ * \since This struct is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetMemoryStats
+ */
+typedef struct SDL_MemoryStats
+{
+    SDL_MemoryTag tag;              /**< The subsystem */
+    const char *name;               /**< The name of the subsystem, e.g. "render" */
+    Uint64 live_bytes;              /**< The bytes currently allocated */
+    Uint64 peak_bytes;              /**< The most bytes allocated at once */
+    Uint64 live_allocations;        /**< The number of allocations not yet freed */
+    Uint64 allocations;             /**< The number of allocations and reallocations */
+    float allocations_per_second;   /**< The allocation rate over the last second or so */
+} SDL_MemoryStats;
+
+/**
+ * Get heap statistics for each subsystem.
+ *
+ * Entries are in SDL_MemoryTag order. The statistics start from zero when
+ * the SDL_HINT_MEMORY_PROFILE hint is enabled, and stay readable, but stop
+ * changing, after it is disabled.
+ *
+ * \param stats an array to fill in, or NULL to get the number of subsystems
+ * \param count the number of entries in `stats`
+ * \returns the number of entries filled in, or the number of subsystems if
+ *          `stats` is NULL.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_LogMemoryStats
+ * \sa SDL_ResetMemoryStats
+ */
+extern DECLSPEC int SDLCALL SDL_GetMemoryStats(SDL_MemoryStats *stats, int count);
+
+/**
+ * Log heap statistics for each subsystem.
+ *
+ * This logs one line per subsystem that has allocated memory with SDL_Log(),
+ * followed by a total.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetMemoryStats
+ */
+extern DECLSPEC void SDLCALL SDL_LogMemoryStats(void);
+
+/**
+ * Restart the peak and allocation counts of the heap statistics.
+ *
+ * Peaks are reset to the bytes currently allocated. Live bytes and
+ * allocations are kept, since that memory is still in use.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetMemoryStats
+ */
+extern DECLSPEC void SDLCALL SDL_ResetMemoryStats(void);
+
 extern DECLSPEC char *SDLCALL SDL_getenv(const char *name);
 extern DECLSPEC int SDLCALL SDL_setenv(const char *name, const char *value, int overwrite);
 
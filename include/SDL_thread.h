@@ -321,6 +321,46 @@ extern DECLSPEC SDL_threadID SDLCALL SDL_GetThreadID(SDL_Thread * thread);
  */
 extern DECLSPEC int SDLCALL SDL_SetThreadPriority(SDL_ThreadPriority priority);
 
+/**
+ * Restrict the current thread to run on a set of CPUs.
+ *
+ * The CPU numbers are the `id` values from SDL_GetLogicalCPUs(). Pinning a
+ * latency sensitive thread, like one feeding audio, keeps the scheduler from
+ * moving it between cores or sockets. Threads created by SDL can also be
+ * pinned by name with SDL_HINT_THREAD_AFFINITY.
+ *
+ * This is currently supported on Linux, Android and Windows. On Windows,
+ * only the CPUs in the thread's processor group can be used.
+ *
+ * \param cpus an array of the CPUs the thread may run on
+ * \param num_cpus the number of elements in `cpus`, or 0 to let the thread
+ *                 run on any CPU again
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_GetLogicalCPUs
+ * \sa SDL_GetThreadAffinity
+ */
+extern DECLSPEC int SDLCALL SDL_SetThreadAffinity(const int *cpus, int num_cpus);
+
+/**
+ * Get the CPUs the current thread may run on.
+ *
+ * \param cpus an array filled in with up to `max_cpus` CPU numbers, or NULL
+ *             to only get the number of CPUs
+ * \param max_cpus the number of elements in `cpus`
+ * \returns the number of CPUs the thread may run on, which may be more than
+ *          `max_cpus`, or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_SetThreadAffinity
+ */
+extern DECLSPEC int SDLCALL SDL_GetThreadAffinity(int *cpus, int max_cpus);
+
 /**
  * Wait for a thread to finish.
  *
@@ -453,6 +493,141 @@ extern DECLSPEC int SDLCALL SDL_TLSSet(SDL_TLSID id, const void *value, void (SD
  */
 extern DECLSPEC void SDLCALL SDL_TLSCleanup(void);
 
+/**
+ * A set of jobs that can be waited on together.
+ *
+ * \since This struct is available since SDL 2.32.0.
+ *
+ * \sa SDL_CreateJobGroup
+ */
+typedef struct SDL_JobGroup SDL_JobGroup;
+
+/**
+ * The function run by a job.
+ *
+ * \param data what was passed as `data` to SDL_SubmitJob()
+ *
+ * \since This datatype is available since SDL 2.32.0.
+ */
+typedef void (SDLCALL * SDL_JobFunction) (void *data);
+
+/**
+ * The function run by SDL_ParallelFor() for each range of items.
+ *
+ * \param data what was passed as `data` to SDL_ParallelFor()
+ * \param start the first item in the range
+ * \param end one past the last item in the range
+ *
+ * \since This datatype is available since SDL 2.32.0.
+ */
+typedef void (SDLCALL * SDL_ParallelForFunction) (void *data, int start, int end);
+
+/**
+ * Create a group to submit jobs to.
+ *
+ * SDL keeps a pool of worker threads that run submitted jobs. Each worker
+ * has its own queue of jobs; a worker that runs out takes jobs from the
+ * others, and a thread waiting on a group runs jobs too instead of blocking.
+ * The pool is started the first time a job is submitted, with the number of
+ * workers from SDL_HINT_JOB_WORKERS, and stopped by SDL_Quit(). SDL_Quit()
+ * runs the jobs that are still queued on the calling thread before it
+ * returns, so every group is complete afterwards; job groups can be
+ * destroyed after SDL_Quit().
+ *
+ * \returns the new job group, or NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_DestroyJobGroup
+ * \sa SDL_SubmitJob
+ * \sa SDL_WaitJobGroup
+ */
+extern DECLSPEC SDL_JobGroup *SDLCALL SDL_CreateJobGroup(void);
+
+/**
+ * Submit a job to run on the job system.
+ *
+ * The job may run on any thread, in any order relative to other jobs, and
+ * possibly before this function returns. Jobs may submit more jobs, to
+ * their own group or others. A job must not block on anything that only
+ * another job will release, since there may be no other thread to run it.
+ *
+ * \param group the group the job belongs to
+ * \param fn the function to run
+ * \param data a pointer that is passed to `fn`
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_ParallelFor
+ * \sa SDL_WaitJobGroup
+ */
+extern DECLSPEC int SDLCALL SDL_SubmitJob(SDL_JobGroup *group, SDL_JobFunction fn, void *data);
+
+/**
+ * Wait for every job in a group to finish.
+ *
+ * The calling thread runs queued jobs, from this group or any other, while
+ * it waits. It's safe to call this from within a job.
+ *
+ * \param group the group to wait on
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern DECLSPEC void SDLCALL SDL_WaitJobGroup(SDL_JobGroup *group);
+
+/**
+ * Wait for the jobs in a group to finish and free it.
+ *
+ * \param group the group to destroy
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_CreateJobGroup
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyJobGroup(SDL_JobGroup *group);
+
+/**
+ * Run a function over a range of items on the job system.
+ *
+ * The items from 0 to `count - 1` are handed out to `fn` in consecutive
+ * ranges of at most `grain` items, which run in parallel on the worker
+ * threads and the calling thread. This returns once every item has been
+ * processed.
+ *
+ * \param count the number of items
+ * \param grain the most items to pass to `fn` at once, or 0 to pick a size
+ *              that splits the items evenly over the threads available
+ * \param fn the function to run
+ * \param data a pointer that is passed to `fn`
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern DECLSPEC int SDLCALL SDL_ParallelFor(int count, int grain, SDL_ParallelForFunction fn, void *data);
+
+/**
+ * Get the number of worker threads in the job system.
+ *
+ * This starts the job system if it isn't running yet. Threads that wait on
+ * jobs help run them, so 0 workers is a valid, serial configuration.
+ *
+ * \returns the number of worker threads, or a negative error code on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_HINT_JOB_WORKERS
+ */
+extern DECLSPEC int SDLCALL SDL_GetNumJobWorkers(void);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -146,6 +146,26 @@ extern DECLSPEC Uint64 SDLCALL SDL_GetPerformanceFrequency(void);
  */
 extern DECLSPEC void SDLCALL SDL_Delay(Uint32 ms);
 
+/**
+ * Wait a specified number of nanoseconds before returning.
+ *
+ * This function sleeps for most of the requested time and spins for the
+ * last fraction of a millisecond, so it returns much closer to the requested
+ * time than SDL_Delay() can. It waits at least the specified time, measured
+ * with SDL_GetPerformanceCounter(), but possibly longer if the thread is
+ * preempted while spinning.
+ *
+ * The spin keeps a CPU core busy, so this is meant for short waits where
+ * accuracy matters, such as pacing frames, not for idling.
+ *
+ * \param ns the number of nanoseconds to delay
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_Delay
+ */
+extern DECLSPEC void SDLCALL SDL_DelayNS(Uint64 ns);
+
 /**
  * Function prototype for the timer callback function.
  *
@@ -198,7 +218,50 @@ extern DECLSPEC SDL_TimerID SDLCALL SDL_AddTimer(Uint32 interval,
                                                  void *param);
 
 /**
- * Remove a timer created with SDL_AddTimer().
+ * Function prototype for the nanosecond timer callback function.
+ *
+ * The callback function is passed the current timer interval, in
+ * nanoseconds, and returns the next timer interval. If the callback returns
+ * 0, the periodic alarm is cancelled.
+ *
+ * \since This datatype is available since SDL 2.32.0.
+ */
+typedef Uint64 (SDLCALL * SDL_NSTimerCallback) (Uint64 interval, void *param);
+
+/**
+ * Call a callback function at a future time, with nanosecond precision.
+ *
+ * This works like SDL_AddTimer(), but the interval is measured in
+ * nanoseconds with SDL_GetPerformanceCounter(), so it can express periods
+ * shorter than a millisecond. Unlike SDL_AddTimer(), a periodic timer stays
+ * on its original schedule: each deadline is the previous deadline plus the
+ * interval, so lateness in one callback doesn't push back the ones after it.
+ * Deadlines that have already passed by the time the callback returns are
+ * skipped.
+ *
+ * The callback is run on the same thread as SDL_AddTimer() callbacks, so a
+ * slow callback delays every other timer. How closely deadlines are met
+ * depends on the platform's sleep precision, and timers may be allowed to
+ * fire later to save power, see SDL_HINT_TIMER_SLACK.
+ *
+ * \param interval the timer delay, in nanoseconds, passed to `callback`
+ * \param callback the SDL_NSTimerCallback function to call when the specified
+ *                 `interval` elapses
+ * \param param a pointer that is passed to `callback`
+ * \returns a timer ID or 0 if an error occurs; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_AddTimer
+ * \sa SDL_RemoveTimer
+ */
+extern DECLSPEC SDL_TimerID SDLCALL SDL_AddTimerNS(Uint64 interval,
+                                                   SDL_NSTimerCallback callback,
+                                                   void *param);
+
+/**
+ * Remove a timer created with SDL_AddTimer() or SDL_AddTimerNS().
  *
  * \param id the ID of the timer to remove
  * \returns SDL_TRUE if the timer is removed or SDL_FALSE if the timer wasn't
@@ -207,6 +270,7 @@ extern DECLSPEC SDL_TimerID SDLCALL SDL_AddTimer(Uint32 interval,
  * \since This function is available since SDL 2.0.0.
  *
  * \sa SDL_AddTimer
+ * \sa SDL_AddTimerNS
  */
 extern DECLSPEC SDL_bool SDLCALL SDL_RemoveTimer(SDL_TimerID id);
 
@@ -47,12 +47,16 @@
 #include "SDL_bits.h"
 #include "SDL_revision.h"
 #include "SDL_assert_c.h"
+#include "SDL_hints_c.h"
 #include "SDL_log_c.h"
 #include "events/SDL_events_c.h"
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
 #include "sensor/SDL_sensor_c.h"
 #include "thread/SDL_thread_c.h"
+#include "cpuinfo/SDL_cpuinfo_c.h"
+#include "thread/SDL_lockstats_c.h"
+#include "stdlib/SDL_memprofile_c.h"
 
 /* Initialization/Cleanup routines */
 #ifndef SDL_TIMERS_DISABLED
@@ -190,10 +194,14 @@ void SDL_InitMainThread(void)
     }
 
     SDL_InitTLSData();
+    SDL_InitHints();
 #ifndef SDL_TIMERS_DISABLED
     SDL_TicksInit();
 #endif
     SDL_LogInit();
+    SDL_InitCPUFeatureMask();
+    SDL_InitLockStats();
+    SDL_InitMemoryProfile();
 
     SDL_main_thread_initialized = SDL_TRUE;
 }
@@ -204,10 +212,15 @@ static void SDL_QuitMainThread(void)
         return;
     }
 
+    SDL_QuitMemoryProfile();
+    SDL_QuitLockStats();
+    SDL_QuitCPUTopology();
+    SDL_QuitCPUFeatureMask();
     SDL_LogQuit();
 #ifndef SDL_TIMERS_DISABLED
     SDL_TicksQuit();
 #endif
+    SDL_QuitHints();
     SDL_QuitTLSData();
 
     SDL_main_thread_initialized = SDL_FALSE;
@@ -225,6 +238,8 @@ int SDL_InitSubSystem(Uint32 flags)
         return SDL_SetError("Application didn't initialize properly, did you include SDL_main.h in the file containing your main() function?");
     }
 
+    SDL_InitMainThread();
+
     /* Clear the error message */
     SDL_ClearError();
 
@@ -527,6 +542,8 @@ void SDL_Quit(void)
 #endif
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
 
+    SDL_QuitJobs();
+
 #ifdef SDL_USE_LIBDBUS
     SDL_DBus_Quit();
 #endif
@@ -23,29 +23,50 @@
 #include "SDL.h"
 #include "./SDL_dataqueue.h"
 
+/* Space handed out by SDL_ReserveSpaceInDataQueue() starts on this boundary */
+#define SDL_DATAQUEUE_ALIGNMENT 16
+
 typedef struct SDL_DataQueuePacket
 {
     size_t datalen;                        /* bytes currently in use in this packet. */
     size_t startpos;                       /* bytes currently consumed in this packet. */
+    size_t capacity;                       /* bytes available in this packet. */
     struct SDL_DataQueuePacket *next;      /* next item in linked list. */
-    Uint8 data[SDL_VARIABLE_LENGTH_ARRAY]; /* packet data */
+    Uint8 data[SDL_VARIABLE_LENGTH_ARRAY]; /* packet data, SIMD aligned */
 } SDL_DataQueuePacket;
 
+SDL_COMPILE_TIME_ASSERT(packet_data_alignment, (offsetof(SDL_DataQueuePacket, data) % SDL_DATAQUEUE_ALIGNMENT) == 0);
+
 struct SDL_DataQueue
 {
     SDL_mutex *lock;
     SDL_DataQueuePacket *head; /* device fed from here. */
     SDL_DataQueuePacket *tail; /* queue fills to here. */
     SDL_DataQueuePacket *pool; /* these are unused packets. */
+    SDL_DataQueuePacket *reserved_prev; /* tail before the last reservation, if it added a packet. */
+    SDL_bool reserved_new;     /* SDL_TRUE if the last reservation added a packet. */
+    size_t reserved_pad;       /* bytes skipped to align the last reservation in the tail packet. */
     size_t packet_size;        /* size of new packets */
     size_t queued_bytes;       /* number of bytes of data in the queue. */
 };
 
+static SDL_DataQueuePacket *SDL_NewDataQueuePacket(size_t capacity)
+{
+    SDL_DataQueuePacket *packet = (SDL_DataQueuePacket *)SDL_SIMDAlloc(sizeof(SDL_DataQueuePacket) + capacity);
+    if (packet) {
+        packet->datalen = 0;
+        packet->startpos = 0;
+        packet->capacity = capacity;
+        packet->next = NULL;
+    }
+    return packet;
+}
+
 static void SDL_FreeDataQueueList(SDL_DataQueuePacket *packet)
 {
     while (packet) {
         SDL_DataQueuePacket *next = packet->next;
-        SDL_free(packet);
+        SDL_SIMDFree(packet);
         packet = next;
     }
 }
@@ -68,12 +89,11 @@ SDL_DataQueue *SDL_NewDataQueue(const size_t _packetlen, const size_t initialsla
             SDL_free(queue);
             return NULL;
         }
+        SDL_SetLockName(queue->lock, "SDL_DataQueue lock");
 
         for (i = 0; i < wantpackets; i++) {
-            SDL_DataQueuePacket *packet = (SDL_DataQueuePacket *)SDL_malloc(sizeof(SDL_DataQueuePacket) + packetlen);
+            SDL_DataQueuePacket *packet = SDL_NewDataQueuePacket(packetlen);
             if (packet) { /* don't care if this fails, we'll deal later. */
-                packet->datalen = 0;
-                packet->startpos = 0;
                 packet->next = queue->pool;
                 queue->pool = packet;
             }
@@ -140,19 +160,19 @@ void SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack)
 }
 
 /* You must hold queue->lock before calling this! */
-static SDL_DataQueuePacket *AllocateDataQueuePacket(SDL_DataQueue *queue)
+static SDL_DataQueuePacket *AllocateDataQueuePacket(SDL_DataQueue *queue, size_t minsize)
 {
     SDL_DataQueuePacket *packet;
 
     SDL_assert(queue != NULL);
 
     packet = queue->pool;
-    if (packet) {
+    if (packet && packet->capacity >= minsize) {
         /* we have one available in the pool. */
         queue->pool = packet->next;
     } else {
         /* Have to allocate a new one! */
-        packet = (SDL_DataQueuePacket *)SDL_malloc(sizeof(SDL_DataQueuePacket) + queue->packet_size);
+        packet = SDL_NewDataQueuePacket(SDL_max(minsize, queue->packet_size));
         if (!packet) {
             return NULL;
         }
@@ -176,7 +196,6 @@ int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _
 {
     size_t len = _len;
     const Uint8 *data = (const Uint8 *)_data;
-    const size_t packet_size = queue ? queue->packet_size : 0;
     SDL_DataQueuePacket *orighead;
     SDL_DataQueuePacket *origtail;
     size_t origlen;
@@ -194,10 +213,10 @@ int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _
 
     while (len > 0) {
         SDL_DataQueuePacket *packet = queue->tail;
-        SDL_assert(packet == NULL || (packet->datalen <= packet_size));
-        if (!packet || (packet->datalen >= packet_size)) {
+        SDL_assert(packet == NULL || (packet->datalen <= packet->capacity));
+        if (!packet || (packet->datalen >= packet->capacity)) {
             /* tail packet missing or completely full; we need a new packet. */
-            packet = AllocateDataQueuePacket(queue);
+            packet = AllocateDataQueuePacket(queue, 0);
             if (!packet) {
                 /* uhoh, reset so we've queued nothing new, free what we can. */
                 if (!origtail) {
@@ -217,7 +236,7 @@ int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *_data, const size_t _
             }
         }
 
-        datalen = SDL_min(len, packet_size - packet->datalen);
+        datalen = SDL_min(len, packet->capacity - packet->datalen);
         SDL_memcpy(packet->data + packet->datalen, data, datalen);
         data += datalen;
         len -= datalen;
@@ -278,7 +297,9 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
         const size_t cpy = SDL_min(len, avail);
         SDL_assert(queue->queued_bytes >= avail);
 
-        SDL_memcpy(ptr, packet->data + packet->startpos, cpy);
+        if (buf) {
+            SDL_memcpy(ptr, packet->data + packet->startpos, cpy);
+        }
         packet->startpos += cpy;
         ptr += cpy;
         queue->queued_bytes -= cpy;
@@ -303,6 +324,108 @@ SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *_buf, const size_t _len)
     return (size_t)(ptr - buf);
 }
 
+size_t
+SDL_PeekDataQueueBuffer(SDL_DataQueue *queue, const void **buf)
+{
+    size_t retval = 0;
+
+    *buf = NULL;
+    if (!queue) {
+        return 0;
+    }
+
+    SDL_LockMutex(queue->lock);
+    if (queue->head) {
+        *buf = queue->head->data + queue->head->startpos;
+        retval = queue->head->datalen - queue->head->startpos;
+    }
+    SDL_UnlockMutex(queue->lock);
+
+    return retval;
+}
+
+void *SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len)
+{
+    SDL_DataQueuePacket *packet;
+    size_t pad = 0;
+
+    if (!queue) {
+        SDL_InvalidParamError("queue");
+        return NULL;
+    }
+
+    SDL_LockMutex(queue->lock);
+
+    /* Use the end of the tail packet if it's big enough, skipping up to the
+       next aligned offset, otherwise start a new packet and leave the rest
+       of the tail unused. */
+    packet = queue->tail;
+    if (packet) {
+        const size_t misalign = packet->datalen % SDL_DATAQUEUE_ALIGNMENT;
+        pad = misalign ? (SDL_DATAQUEUE_ALIGNMENT - misalign) : 0;
+    }
+    if (packet && (packet->capacity - packet->datalen) >= pad &&
+        (packet->capacity - packet->datalen - pad) >= len) {
+        queue->reserved_new = SDL_FALSE;
+        queue->reserved_pad = pad;
+    } else {
+        queue->reserved_prev = queue->tail;
+        packet = AllocateDataQueuePacket(queue, len);
+        if (!packet) {
+            SDL_UnlockMutex(queue->lock);
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        queue->reserved_new = SDL_TRUE;
+        queue->reserved_pad = 0;
+    }
+
+    SDL_UnlockMutex(queue->lock);
+
+    return packet->data + packet->datalen + queue->reserved_pad;
+}
+
+void SDL_CommitDataQueueSpace(SDL_DataQueue *queue, const size_t len)
+{
+    SDL_DataQueuePacket *packet;
+
+    if (!queue) {
+        return;
+    }
+
+    SDL_LockMutex(queue->lock);
+
+    packet = queue->tail;
+    SDL_assert(packet != NULL);
+    SDL_assert(len <= (packet->capacity - packet->datalen - queue->reserved_pad));
+
+    if (len == 0 && queue->reserved_new) {
+        /* Nothing was written, give the packet back to the pool. */
+        queue->tail = queue->reserved_prev;
+        if (queue->tail) {
+            queue->tail->next = NULL;
+        } else {
+            queue->head = NULL;
+        }
+        packet->next = queue->pool;
+        queue->pool = packet;
+    } else {
+        if (queue->reserved_pad && len) {
+            /* Close the alignment gap, so the queued data stays contiguous.
+               Nothing outside the reservation has seen these bytes yet. */
+            Uint8 *dst = packet->data + packet->datalen;
+            SDL_memmove(dst, dst + queue->reserved_pad, len);
+        }
+        packet->datalen += len;
+        queue->queued_bytes += len;
+    }
+    queue->reserved_new = SDL_FALSE;
+    queue->reserved_prev = NULL;
+    queue->reserved_pad = 0;
+
+    SDL_UnlockMutex(queue->lock);
+}
+
 size_t
 SDL_CountDataQueue(SDL_DataQueue *queue)
 {
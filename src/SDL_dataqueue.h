@@ -30,8 +30,25 @@ SDL_DataQueue *SDL_NewDataQueue(const size_t packetlen, const size_t initialslac
 void SDL_FreeDataQueue(SDL_DataQueue *queue);
 void SDL_ClearDataQueue(SDL_DataQueue *queue, const size_t slack);
 int SDL_WriteToDataQueue(SDL_DataQueue *queue, const void *data, const size_t len);
-size_t SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *buf, const size_t len);
+size_t SDL_ReadFromDataQueue(SDL_DataQueue *queue, void *buf, const size_t len); /* buf may be NULL to discard data. */
 size_t SDL_PeekIntoDataQueue(SDL_DataQueue *queue, void *buf, const size_t len);
+
+/* Get the data at the front of the queue without copying it. This returns
+   the number of contiguous bytes at *buf, which may be less than the amount
+   queued. Remove them with SDL_ReadFromDataQueue(queue, NULL, len). */
+size_t SDL_PeekDataQueueBuffer(SDL_DataQueue *queue, const void **buf);
+
+/* Get a pointer to at least len bytes of contiguous, 16 byte aligned space at
+   the end of the queue, to be filled in place. The data isn't queued until
+   SDL_CommitDataQueueSpace() is called with the number of bytes written,
+   which may be less than len. Only one reservation may be outstanding, and
+   nothing else may be written to the queue until it's committed.
+   If the queued data doesn't end on an aligned boundary, the space is padded
+   to one inside the last packet, and committing moves the data back down
+   over the padding, so this costs a copy of what was written but no new
+   packet. */
+void *SDL_ReserveSpaceInDataQueue(SDL_DataQueue *queue, const size_t len);
+void SDL_CommitDataQueueSpace(SDL_DataQueue *queue, const size_t len);
 size_t SDL_CountDataQueue(SDL_DataQueue *queue);
 SDL_mutex *SDL_GetDataQueueMutex(SDL_DataQueue *queue);  /* don't destroy this, obviously. */
 
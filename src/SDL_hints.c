@@ -22,10 +22,25 @@
 
 #include "SDL_hints.h"
 #include "SDL_error.h"
+#include "SDL_atomic.h"
+#include "SDL_mutex.h"
 #include "SDL_hints_c.h"
 
-/* Assuming there aren't many hints set and they aren't being queried in
-   critical performance paths, we'll just use linked lists here.
+/* Hints are kept in a linked list for iteration and indexed by a small
+   hash table on the name, so lookups don't need to walk every hint that
+   has been set or watched. Hint names are copied once when the entry is
+   created and the entry is never freed until SDL_ClearHints().
+
+   Values are interned in a second hash table and reference counted by the
+   hints that use them, so hints with the same value share one string. A value
+   is freed once no hint uses it, so the string SDL_GetHint() returns stays
+   valid until the hint is changed or reset, as it always has. Hint callbacks
+   hold a reference to the old value while they run.
+
+   Each hint also keeps an interned copy of its environment variable, so
+   lookups don't call SDL_getenv(). It's read when the hint is created or
+   reset, and again after SDL_setenv() has been called. Looking up a hint
+   that has never been set creates an entry for it to hold the cached copy.
  */
 typedef struct SDL_HintWatch
 {
@@ -34,121 +49,453 @@ typedef struct SDL_HintWatch
     struct SDL_HintWatch *next;
 } SDL_HintWatch;
 
+typedef struct SDL_HintValue
+{
+    struct SDL_HintValue *next;
+    Uint32 hash;
+    int refcount; /* guarded by the hint lock, held for writing */
+    char value[1]; /* the rest of the string follows */
+} SDL_HintValue;
+
 typedef struct SDL_Hint
 {
     char *name;
-    char *value;
+    Uint32 hash;
+    const char *value; /* points into an SDL_HintValue */
+    const char *env;   /* the environment variable, points into an SDL_HintValue */
+    int env_generation; /* SDL_hint_env_generation when env was read */
     SDL_HintPriority priority;
     SDL_HintWatch *callbacks;
     struct SDL_Hint *next;
+    struct SDL_Hint *hash_next;
 } SDL_Hint;
 
+#define SDL_HINT_BUCKETS 64
+
 static SDL_Hint *SDL_hints;
+static SDL_Hint *SDL_hint_buckets[SDL_HINT_BUCKETS];
+static SDL_HintValue *SDL_hint_values[SDL_HINT_BUCKETS];
+
+/* Hints are looked up from any thread, far more often than they change, so
+   the table is guarded by a read/write lock. Hint callbacks are called with
+   the lock released, since they often look up hints themselves.
+
+   The lock is created by SDL_InitMainThread(), which runs before SDL_Init()
+   or SDL_CreateThread() return. Hints set before that are only used by the
+   thread setting them, so they go unlocked. */
+static SDL_RWLock *SDL_hint_lock;
+
+/* Bumped whenever any hint changes, so cached hints know to refresh.
+   Starts at 1 so that zero-initialized cached hints are always stale. */
+static SDL_atomic_t SDL_hint_generation = { 1 };
+
+/* Bumped by SDL_setenv(), so hints know to reread their environment variables */
+static SDL_atomic_t SDL_hint_env_generation = { 1 };
+
+static Uint32 SDL_HashHintName(const char *name)
+{
+    /* FNV-1a */
+    Uint32 hash = 2166136261u;
+    while (*name) {
+        hash ^= (Uint8)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static SDL_RWLock *SDL_GetHintLock(void)
+{
+    return (SDL_RWLock *)SDL_AtomicGetPtr((void **)&SDL_hint_lock);
+}
+
+void SDL_InitHints(void)
+{
+    if (!SDL_GetHintLock()) {
+        /* Creating the lock may look up hints itself (the Windows mutex
+           implementation is chosen by a hint), those go unlocked */
+        SDL_AtomicSetPtr((void **)&SDL_hint_lock, SDL_CreateRWLock());
+    }
+}
+
+void SDL_QuitHints(void)
+{
+    SDL_RWLock *lock = SDL_GetHintLock();
+
+    if (lock) {
+        SDL_AtomicSetPtr((void **)&SDL_hint_lock, NULL);
+        SDL_DestroyRWLock(lock);
+    }
+}
+
+static SDL_HintValue *SDL_GetHintValueEntry(const char *value)
+{
+    return (SDL_HintValue *)(value - offsetof(SDL_HintValue, value));
+}
+
+/* Returns a new reference to the interned copy of value, or NULL if we're out of memory.
+   The hint lock must be held for writing. */
+static const char *SDL_InternHintValue(const char *value)
+{
+    const Uint32 hash = SDL_HashHintName(value);
+    const size_t len = SDL_strlen(value);
+    SDL_HintValue *entry;
+
+    for (entry = SDL_hint_values[hash % SDL_HINT_BUCKETS]; entry; entry = entry->next) {
+        if (entry->hash == hash && SDL_strcmp(entry->value, value) == 0) {
+            ++entry->refcount;
+            return entry->value;
+        }
+    }
+
+    entry = (SDL_HintValue *)SDL_malloc(sizeof(*entry) + len);
+    if (!entry) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    entry->hash = hash;
+    entry->refcount = 1;
+    SDL_memcpy(entry->value, value, len + 1);
+    entry->next = SDL_hint_values[hash % SDL_HINT_BUCKETS];
+    SDL_hint_values[hash % SDL_HINT_BUCKETS] = entry;
+    return entry->value;
+}
+
+/* Adds a reference to an interned value, the hint lock must be held for writing */
+static void SDL_RetainHintValue(const char *value)
+{
+    if (value) {
+        ++SDL_GetHintValueEntry(value)->refcount;
+    }
+}
+
+/* Drops a reference to an interned value, the hint lock must be held for writing */
+static void SDL_ReleaseHintValue(const char *value)
+{
+    SDL_HintValue *entry, **prev;
+
+    if (!value) {
+        return;
+    }
+    entry = SDL_GetHintValueEntry(value);
+    if (--entry->refcount > 0) {
+        return;
+    }
+    for (prev = &SDL_hint_values[entry->hash % SDL_HINT_BUCKETS]; *prev; prev = &(*prev)->next) {
+        if (*prev == entry) {
+            *prev = entry->next;
+            break;
+        }
+    }
+    SDL_free(entry);
+}
+
+/* Copies the callbacks of a hint, so they can be called with the lock released.
+   Returns the number of callbacks, which may be more than max_callbacks. */
+static int SDL_CopyHintCallbacks(const SDL_Hint *hint, SDL_HintWatch *callbacks, int max_callbacks)
+{
+    const SDL_HintWatch *entry;
+    int count = 0;
+
+    for (entry = hint->callbacks; entry; entry = entry->next) {
+        if (count < max_callbacks) {
+            callbacks[count] = *entry;
+        }
+        ++count;
+    }
+    return count;
+}
+
+/* Takes a snapshot of the callbacks of a hint and its current value, under the lock,
+   then calls them with the lock released. The lock must be held for writing
+   and is released on return. */
+static void SDL_CallHintCallbacks(SDL_RWLock *lock, const SDL_Hint *hint, const char *name, const char *value)
+{
+    const char *old_value = hint->value;
+    SDL_HintWatch *callbacks;
+    SDL_bool isstack;
+    int count, i;
+
+    count = SDL_CopyHintCallbacks(hint, NULL, 0);
+    if (count == 0) {
+        SDL_UnlockRWLock(lock);
+        return;
+    }
+    callbacks = SDL_small_alloc(SDL_HintWatch, count, &isstack);
+    if (!callbacks) {
+        SDL_UnlockRWLock(lock);
+        SDL_OutOfMemory();
+        return;
+    }
+    SDL_CopyHintCallbacks(hint, callbacks, count);
+
+    /* Another thread may change the hint again while the callbacks run */
+    SDL_RetainHintValue(old_value);
+    SDL_UnlockRWLock(lock);
+
+    for (i = 0; i < count; ++i) {
+        callbacks[i].callback(callbacks[i].userdata, name, old_value, value);
+    }
+    SDL_small_free(callbacks, isstack);
+
+    if (old_value) {
+        SDL_LockRWLockForWriting(lock);
+        SDL_ReleaseHintValue(old_value);
+        SDL_UnlockRWLock(lock);
+    }
+}
+
+static SDL_Hint *SDL_FindHint(const char *name, Uint32 hash)
+{
+    SDL_Hint *hint;
+
+    for (hint = SDL_hint_buckets[hash % SDL_HINT_BUCKETS]; hint; hint = hint->hash_next) {
+        if (hint->hash == hash && SDL_strcmp(name, hint->name) == 0) {
+            return hint;
+        }
+    }
+    return NULL;
+}
+
+static SDL_Hint *SDL_CreateHint(const char *name, Uint32 hash)
+{
+    SDL_Hint *hint = (SDL_Hint *)SDL_malloc(sizeof(*hint));
+    if (!hint) {
+        return NULL;
+    }
+    hint->name = SDL_strdup(name);
+    if (!hint->name) {
+        SDL_free(hint);
+        return NULL;
+    }
+    hint->hash = hash;
+    hint->value = NULL;
+    hint->env = NULL;
+    hint->env_generation = 0;
+    hint->priority = SDL_HINT_DEFAULT;
+    hint->callbacks = NULL;
+    hint->next = SDL_hints;
+    SDL_hints = hint;
+    hint->hash_next = SDL_hint_buckets[hash % SDL_HINT_BUCKETS];
+    SDL_hint_buckets[hash % SDL_HINT_BUCKETS] = hint;
+    return hint;
+}
+
+/* Rereads the environment variable for a hint, the hint lock must be held for writing */
+static void SDL_UpdateHintEnvironment(SDL_Hint *hint)
+{
+    const int generation = SDL_AtomicGet(&SDL_hint_env_generation);
+    const char *env = SDL_getenv(hint->name);
+    const char *interned = NULL;
+
+    if (env) {
+        if (hint->env && SDL_strcmp(hint->env, env) == 0) {
+            hint->env_generation = generation;
+            return;
+        }
+        interned = SDL_InternHintValue(env);
+        if (!interned) {
+            /* Keep the old copy and try again next time */
+            return;
+        }
+    }
+    SDL_ReleaseHintValue(hint->env);
+    hint->env = interned;
+    hint->env_generation = generation;
+}
+
+/* Returns the current value of a hint, the hint lock must be held */
+static const char *SDL_GetHintValue(const SDL_Hint *hint)
+{
+    if (!hint->env || hint->priority == SDL_HINT_OVERRIDE) {
+        return hint->value;
+    }
+    return hint->env;
+}
+
+/* Finds a hint for reading, creating it or rereading its environment variable if needed.
+   Returns with the hint lock held, and NULL if we ran out of memory. */
+static SDL_Hint *SDL_LockHint(SDL_RWLock *lock, const char *name)
+{
+    const Uint32 hash = SDL_HashHintName(name);
+    SDL_Hint *hint;
+
+    SDL_LockRWLockForReading(lock);
+    hint = SDL_FindHint(name, hash);
+    if (hint && hint->env_generation == SDL_AtomicGet(&SDL_hint_env_generation)) {
+        return hint;
+    }
+    SDL_UnlockRWLock(lock);
+
+    SDL_LockRWLockForWriting(lock);
+    hint = SDL_FindHint(name, hash);
+    if (!hint) {
+        hint = SDL_CreateHint(name, hash);
+    }
+    if (hint) {
+        SDL_UpdateHintEnvironment(hint);
+    }
+    return hint;
+}
+
+static void SDL_HintsChanged(void)
+{
+    SDL_AtomicIncRef(&SDL_hint_generation);
+}
+
+void SDL_HintsEnvironmentChanged(void)
+{
+    SDL_AtomicIncRef(&SDL_hint_env_generation);
+    SDL_HintsChanged();
+}
 
 SDL_bool SDL_SetHintWithPriority(const char *name, const char *value, SDL_HintPriority priority)
 {
     const char *env;
+    const char *interned = NULL;
+    const char *old_value;
+    Uint32 hash;
+    SDL_RWLock *lock;
     SDL_Hint *hint;
-    SDL_HintWatch *entry;
+    SDL_bool changed;
 
     if (!name) {
         return SDL_FALSE;
     }
 
-    env = SDL_getenv(name);
+    hash = SDL_HashHintName(name);
+    lock = SDL_GetHintLock();
+    SDL_LockRWLockForWriting(lock);
+    hint = SDL_FindHint(name, hash);
+    if (hint) {
+        SDL_UpdateHintEnvironment(hint);
+        env = hint->env;
+    } else {
+        env = SDL_getenv(name);
+    }
     if (env && priority < SDL_HINT_OVERRIDE) {
+        SDL_UnlockRWLock(lock);
         return SDL_FALSE;
     }
-
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            if (priority < hint->priority) {
+    if (!hint) {
+        /* Couldn't find the hint, add a new one */
+        if (value) {
+            interned = SDL_InternHintValue(value);
+            if (!interned) {
+                SDL_UnlockRWLock(lock);
                 return SDL_FALSE;
             }
-            if (hint->value != value &&
-                (!value || !hint->value || SDL_strcmp(hint->value, value) != 0)) {
-                for (entry = hint->callbacks; entry;) {
-                    /* Save the next entry in case this one is deleted */
-                    SDL_HintWatch *next = entry->next;
-                    entry->callback(entry->userdata, name, hint->value, value);
-                    entry = next;
-                }
-                SDL_free(hint->value);
-                hint->value = value ? SDL_strdup(value) : NULL;
-            }
+        }
+        hint = SDL_CreateHint(name, hash);
+        if (hint) {
+            SDL_UpdateHintEnvironment(hint);
+            hint->value = interned;
             hint->priority = priority;
-            return SDL_TRUE;
+        } else {
+            SDL_ReleaseHintValue(interned);
         }
+        SDL_UnlockRWLock(lock);
+        if (!hint) {
+            return SDL_FALSE;
+        }
+        SDL_HintsChanged();
+        return SDL_TRUE;
     }
-
-    /* Couldn't find the hint, add a new one */
-    hint = (SDL_Hint *)SDL_malloc(sizeof(*hint));
-    if (!hint) {
+    if (priority < hint->priority) {
+        SDL_UnlockRWLock(lock);
         return SDL_FALSE;
     }
-    hint->name = SDL_strdup(name);
-    hint->value = value ? SDL_strdup(value) : NULL;
+    changed = (hint->value != value &&
+               (!value || !hint->value || SDL_strcmp(hint->value, value) != 0));
+    if (changed && value) {
+        /* Intern the new value up front, so running out of memory leaves the hint as it was */
+        interned = SDL_InternHintValue(value);
+        if (!interned) {
+            SDL_UnlockRWLock(lock);
+            return SDL_FALSE;
+        }
+    }
+    if (changed) {
+        SDL_CallHintCallbacks(lock, hint, name, value);
+    } else {
+        SDL_UnlockRWLock(lock);
+    }
+
+    SDL_LockRWLockForWriting(lock);
+    if (changed) {
+        old_value = hint->value;
+        hint->value = interned;
+        SDL_ReleaseHintValue(old_value);
+    }
     hint->priority = priority;
-    hint->callbacks = NULL;
-    hint->next = SDL_hints;
-    SDL_hints = hint;
+    SDL_UnlockRWLock(lock);
+
+    SDL_HintsChanged();
     return SDL_TRUE;
 }
 
-SDL_bool SDL_ResetHint(const char *name)
+/* Reset a hint to its environment value, calling its callbacks if that changes it */
+static void SDL_ResetHintValue(SDL_RWLock *lock, SDL_Hint *hint)
 {
     const char *env;
+
+    SDL_LockRWLockForWriting(lock);
+    hint->env_generation = 0;
+    SDL_UpdateHintEnvironment(hint);
+    env = hint->env;
+    SDL_RetainHintValue(env);
+    if ((!env && hint->value) ||
+        (env && !hint->value) ||
+        (env && SDL_strcmp(env, hint->value) != 0)) {
+        SDL_CallHintCallbacks(lock, hint, hint->name, env);
+    } else {
+        SDL_UnlockRWLock(lock);
+    }
+
+    SDL_LockRWLockForWriting(lock);
+    SDL_ReleaseHintValue(env);
+    SDL_ReleaseHintValue(hint->value);
+    hint->value = NULL;
+    hint->priority = SDL_HINT_DEFAULT;
+    SDL_UnlockRWLock(lock);
+}
+
+SDL_bool SDL_ResetHint(const char *name)
+{
+    SDL_RWLock *lock;
     SDL_Hint *hint;
-    SDL_HintWatch *entry;
 
     if (!name) {
         return SDL_FALSE;
     }
 
-    env = SDL_getenv(name);
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            if ((!env && hint->value) ||
-                (env && !hint->value) ||
-                (env && SDL_strcmp(env, hint->value) != 0)) {
-                for (entry = hint->callbacks; entry;) {
-                    /* Save the next entry in case this one is deleted */
-                    SDL_HintWatch *next = entry->next;
-                    entry->callback(entry->userdata, name, hint->value, env);
-                    entry = next;
-                }
-            }
-            SDL_free(hint->value);
-            hint->value = NULL;
-            hint->priority = SDL_HINT_DEFAULT;
-            return SDL_TRUE;
-        }
+    lock = SDL_GetHintLock();
+    SDL_LockRWLockForReading(lock);
+    hint = SDL_FindHint(name, SDL_HashHintName(name));
+    SDL_UnlockRWLock(lock);
+
+    if (hint) {
+        SDL_ResetHintValue(lock, hint);
+        SDL_HintsChanged();
+        return SDL_TRUE;
     }
     return SDL_FALSE;
 }
 
 void SDL_ResetHints(void)
 {
-    const char *env;
+    SDL_RWLock *lock = SDL_GetHintLock();
     SDL_Hint *hint;
-    SDL_HintWatch *entry;
 
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        env = SDL_getenv(hint->name);
-        if ((!env && hint->value) ||
-            (env && !hint->value) ||
-            (env && SDL_strcmp(env, hint->value) != 0)) {
-            for (entry = hint->callbacks; entry;) {
-                /* Save the next entry in case this one is deleted */
-                SDL_HintWatch *next = entry->next;
-                entry->callback(entry->userdata, hint->name, hint->value, env);
-                entry = next;
-            }
-        }
-        SDL_free(hint->value);
-        hint->value = NULL;
-        hint->priority = SDL_HINT_DEFAULT;
+    /* Hints are only added at the head of the list and are never freed
+       before SDL_ClearHints(), so the rest of the list can be walked unlocked */
+    SDL_LockRWLockForReading(lock);
+    hint = SDL_hints;
+    SDL_UnlockRWLock(lock);
+
+    for (; hint; hint = hint->next) {
+        SDL_ResetHintValue(lock, hint);
     }
+    SDL_HintsChanged();
 }
 
 SDL_bool SDL_SetHint(const char *name, const char *value)
@@ -156,25 +503,30 @@ SDL_bool SDL_SetHint(const char *name, const char *value)
     return SDL_SetHintWithPriority(name, value, SDL_HINT_NORMAL);
 }
 
+/* Returns the current value of a hint, the hint lock must be held */
+static const char *SDL_LookupHint(SDL_Hint *hint, const char *name)
+{
+    if (!hint) {
+        /* We couldn't cache it, the string may change on the next SDL_setenv() */
+        return SDL_getenv(name);
+    }
+    return SDL_GetHintValue(hint);
+}
+
 const char *SDL_GetHint(const char *name)
 {
-    const char *env;
-    SDL_Hint *hint;
+    const char *value;
+    SDL_RWLock *lock;
 
     if (!name) {
         return NULL;
     }
 
-    env = SDL_getenv(name);
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            if (!env || hint->priority == SDL_HINT_OVERRIDE) {
-                return hint->value;
-            }
-            break;
-        }
-    }
-    return env;
+    lock = SDL_GetHintLock();
+    value = SDL_LookupHint(SDL_LockHint(lock, name), name);
+    SDL_UnlockRWLock(lock);
+
+    return value;
 }
 
 SDL_bool SDL_GetStringBoolean(const char *value, SDL_bool default_value)
@@ -190,15 +542,29 @@ SDL_bool SDL_GetStringBoolean(const char *value, SDL_bool default_value)
 
 SDL_bool SDL_GetHintBoolean(const char *name, SDL_bool default_value)
 {
-    const char *hint = SDL_GetHint(name);
-    return SDL_GetStringBoolean(hint, default_value);
+    SDL_RWLock *lock;
+    SDL_bool result;
+
+    if (!name) {
+        return default_value;
+    }
+
+    /* Parse it under the lock, since another thread may free the value once it changes */
+    lock = SDL_GetHintLock();
+    result = SDL_GetStringBoolean(SDL_LookupHint(SDL_LockHint(lock, name), name), default_value);
+    SDL_UnlockRWLock(lock);
+
+    return result;
 }
 
 void SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
 {
+    Uint32 hash;
+    SDL_RWLock *lock;
     SDL_Hint *hint;
     SDL_HintWatch *entry;
     const char *value;
+    SDL_bool retained;
 
     if (!name || !*name) {
         SDL_InvalidParamError("name");
@@ -219,78 +585,82 @@ void SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *user
     entry->callback = callback;
     entry->userdata = userdata;
 
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            break;
-        }
-    }
+    hash = SDL_HashHintName(name);
+    lock = SDL_GetHintLock();
+    SDL_LockRWLockForWriting(lock);
+    hint = SDL_FindHint(name, hash);
     if (!hint) {
         /* Need to add a hint entry for this watcher */
-        hint = (SDL_Hint *)SDL_malloc(sizeof(*hint));
+        hint = SDL_CreateHint(name, hash);
         if (!hint) {
+            SDL_UnlockRWLock(lock);
             SDL_OutOfMemory();
             SDL_free(entry);
             return;
         }
-        hint->name = SDL_strdup(name);
-        if (!hint->name) {
-            SDL_free(entry);
-            SDL_free(hint);
-            SDL_OutOfMemory();
-            return;
-        }
-        hint->value = NULL;
-        hint->priority = SDL_HINT_DEFAULT;
-        hint->callbacks = NULL;
-        hint->next = SDL_hints;
-        SDL_hints = hint;
     }
+    SDL_UpdateHintEnvironment(hint);
 
     /* Add it to the callbacks for this hint */
     entry->next = hint->callbacks;
     hint->callbacks = entry;
 
-    /* Now call it with the current value */
-    value = SDL_GetHint(name);
+    /* Now call it with the current value, which has to outlive the lock */
+    value = SDL_GetHintValue(hint);
+    retained = (value != NULL);
+    if (retained) {
+        SDL_RetainHintValue(value);
+    }
+    SDL_UnlockRWLock(lock);
+
     callback(userdata, name, value, value);
+
+    if (retained) {
+        SDL_LockRWLockForWriting(lock);
+        SDL_ReleaseHintValue(value);
+        SDL_UnlockRWLock(lock);
+    }
 }
 
 void SDL_DelHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
 {
+    SDL_RWLock *lock = SDL_GetHintLock();
     SDL_Hint *hint;
     SDL_HintWatch *entry, *prev;
 
-    for (hint = SDL_hints; hint; hint = hint->next) {
-        if (SDL_strcmp(name, hint->name) == 0) {
-            prev = NULL;
-            for (entry = hint->callbacks; entry; entry = entry->next) {
-                if (callback == entry->callback && userdata == entry->userdata) {
-                    if (prev) {
-                        prev->next = entry->next;
-                    } else {
-                        hint->callbacks = entry->next;
-                    }
-                    SDL_free(entry);
-                    break;
+    SDL_LockRWLockForWriting(lock);
+    hint = SDL_FindHint(name, SDL_HashHintName(name));
+    if (hint) {
+        prev = NULL;
+        for (entry = hint->callbacks; entry; entry = entry->next) {
+            if (callback == entry->callback && userdata == entry->userdata) {
+                if (prev) {
+                    prev->next = entry->next;
+                } else {
+                    hint->callbacks = entry->next;
                 }
-                prev = entry;
+                SDL_free(entry);
+                break;
             }
-            return;
+            prev = entry;
         }
     }
+    SDL_UnlockRWLock(lock);
 }
 
 void SDL_ClearHints(void)
 {
     SDL_Hint *hint;
     SDL_HintWatch *entry;
+    SDL_HintValue *value;
+    int i;
 
+    /* This is called from SDL_Quit(), when no other thread should be using hints */
     while (SDL_hints) {
         hint = SDL_hints;
         SDL_hints = hint->next;
 
         SDL_free(hint->name);
-        SDL_free(hint->value);
         for (entry = hint->callbacks; entry;) {
             SDL_HintWatch *freeable = entry;
             entry = entry->next;
@@ -298,6 +668,86 @@ void SDL_ClearHints(void)
         }
         SDL_free(hint);
     }
+    SDL_zeroa(SDL_hint_buckets);
+
+    for (i = 0; i < SDL_arraysize(SDL_hint_values); ++i) {
+        while (SDL_hint_values[i]) {
+            value = SDL_hint_values[i];
+            SDL_hint_values[i] = value->next;
+            SDL_free(value);
+        }
+    }
+    SDL_HintsChanged();
+}
+
+/* Looks up and parses a cached hint, then publishes the result unless another thread is already doing that */
+static void SDL_RefreshCachedHint(SDL_CachedHint *hint, int sequence, int generation, const char **value, int *parsed)
+{
+    SDL_RWLock *lock = SDL_GetHintLock();
+
+    /* Parse it under the lock, since another thread may free the value once it changes */
+    *value = SDL_LookupHint(SDL_LockHint(lock, hint->name), hint->name);
+    if (hint->parse) {
+        *parsed = hint->parse(*value);
+    } else if (!*value || !**value) {
+        *parsed = -1;
+    } else {
+        *parsed = SDL_GetStringBoolean(*value, SDL_TRUE);
+    }
+    SDL_UnlockRWLock(lock);
+
+    /* An odd sequence number means the cache is being written */
+    if (!(sequence & 1) && SDL_AtomicCAS(&hint->sequence, sequence, sequence + 1)) {
+        hint->generation = generation;
+        hint->value = *value;
+        hint->parsed = *parsed;
+        SDL_AtomicAdd(&hint->sequence, 1); /* full barrier, releases the fields above */
+    }
+}
+
+static void SDL_ReadCachedHint(SDL_CachedHint *hint, const char **value, int *parsed)
+{
+    const int generation = SDL_AtomicGet(&SDL_hint_generation);
+    const int sequence = SDL_AtomicGet(&hint->sequence);
+
+    if (!(sequence & 1) && hint->generation == generation) {
+        *value = hint->value;
+        *parsed = hint->parsed;
+
+        /* Make sure the fields were read before checking they weren't being rewritten */
+        SDL_MemoryBarrierAcquire();
+        if (SDL_AtomicGet(&hint->sequence) == sequence) {
+            return;
+        }
+    }
+    SDL_RefreshCachedHint(hint, sequence, generation, value, parsed);
+}
+
+const char *SDL_GetCachedHint(SDL_CachedHint *hint)
+{
+    const char *value;
+    int parsed;
+
+    SDL_ReadCachedHint(hint, &value, &parsed);
+    return value;
+}
+
+int SDL_GetCachedHintValue(SDL_CachedHint *hint)
+{
+    const char *value;
+    int parsed;
+
+    SDL_ReadCachedHint(hint, &value, &parsed);
+    return parsed;
+}
+
+SDL_bool SDL_GetCachedHintBoolean(SDL_CachedHint *hint, SDL_bool default_value)
+{
+    int value = SDL_GetCachedHintValue(hint);
+    if (value < 0) {
+        return default_value;
+    }
+    return value ? SDL_TRUE : SDL_FALSE;
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -20,6 +20,8 @@
 */
 #include "./SDL_internal.h"
 
+#include "SDL_atomic.h"
+
 /* This file defines useful function for working with SDL hints */
 
 #ifndef SDL_hints_c_h_
@@ -27,6 +29,44 @@
 
 extern SDL_bool SDL_GetStringBoolean(const char *value, SDL_bool default_value);
 
+/* Create and destroy the lock that makes hints thread-safe */
+extern void SDL_InitHints(void);
+extern void SDL_QuitHints(void);
+
+/* Called by SDL_setenv(), so hints reread their environment variables */
+extern void SDL_HintsEnvironmentChanged(void);
+
+/* A cached hint lets code that reads a hint on a hot path skip the lookup
+   and any string parsing. The parsed value is recomputed only after some
+   hint has been set or reset, or SDL_setenv() called, since the last read.
+   Changing the environment without SDL_setenv() isn't noticed until then.
+
+   The generation, value and parsed fields are published together under a
+   sequence number, so readers on other threads always see a matching set.
+   The string is only valid until the hint changes, like SDL_GetHint().
+
+   If parse is NULL the hint is treated as a boolean and the parsed value
+   is -1 when the hint isn't set, otherwise 0 or 1. It's called with the
+   hint lock held, so it must not look up or change hints itself.
+
+   Declare these static and initialize them with SDL_CACHED_HINT().
+ */
+typedef struct SDL_CachedHint
+{
+    const char *name;
+    int (*parse)(const char *value);
+    SDL_atomic_t sequence; /* odd while the fields below are being written */
+    int generation;
+    const char *value;
+    int parsed;
+} SDL_CachedHint;
+
+#define SDL_CACHED_HINT(name, parse) { name, parse, { 0 }, 0, NULL, 0 }
+
+extern const char *SDL_GetCachedHint(SDL_CachedHint *hint);
+extern int SDL_GetCachedHintValue(SDL_CachedHint *hint);
+extern SDL_bool SDL_GetCachedHintBoolean(SDL_CachedHint *hint, SDL_bool default_value);
+
 #endif /* SDL_hints_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
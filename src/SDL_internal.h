@@ -206,8 +206,33 @@
 #endif
 
 #include "SDL_assert.h"
+#include "SDL_cpuinfo.h"
 #include "SDL_log.h"
 
+/* Allocations made inside SDL pass along the file they were made from, so
+   that the memory profiler can charge them to a subsystem. Allocations made
+   through the public functions are charged to the application. */
+extern void *SDL_TaggedMalloc(size_t size, const char *file);
+extern void *SDL_TaggedCalloc(size_t nmemb, size_t size, const char *file);
+extern void *SDL_TaggedRealloc(void *mem, size_t size, const char *file);
+extern void *SDL_TaggedSIMDAlloc(const size_t len, const char *file);
+extern void *SDL_TaggedSIMDRealloc(void *mem, const size_t len, const char *file);
+
+#if !defined(SDL_DISABLE_ALLOCATION_TAGS) && !(defined(__clang_analyzer__) && !defined(SDL_DISABLE_ANALYZE_MACROS))
+#undef SDL_malloc
+#undef SDL_calloc
+#undef SDL_realloc
+#define SDL_malloc(size)        SDL_TaggedMalloc(size, __FILE__)
+#define SDL_calloc(nmemb, size) SDL_TaggedCalloc(nmemb, size, __FILE__)
+#define SDL_realloc(mem, size)  SDL_TaggedRealloc(mem, size, __FILE__)
+#ifndef SDL_DISABLE_SIMD_ALLOCATION_TAGS
+#undef SDL_SIMDAlloc
+#undef SDL_SIMDRealloc
+#define SDL_SIMDAlloc(len)        SDL_TaggedSIMDAlloc(len, __FILE__)
+#define SDL_SIMDRealloc(mem, len) SDL_TaggedSIMDRealloc(mem, len, __FILE__)
+#endif
+#endif
+
 extern void SDL_InitMainThread(void);
 
 #endif /* SDL_internal_h_ */
@@ -0,0 +1,186 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "./SDL_internal.h"
+
+#include "SDL_atomic.h"
+#include "SDL_thread.h"
+#include "SDL_scratch_c.h"
+
+/* Allocations are aligned to this, which covers every SIMD instruction set */
+#define SCRATCH_ALIGNMENT 64
+
+/* Each thread's arena starts with a block this size. When the arena is
+   emptied after outgrowing its first block, that block is replaced with one
+   big enough for everything, up to SCRATCH_MAX_RETAINED. Anything past that
+   gets blocks of its own, which are freed when they're released. */
+#define SCRATCH_BLOCK_SIZE   (64 * 1024)
+#define SCRATCH_MAX_RETAINED (1024 * 1024)
+
+typedef struct SDL_ScratchBlock
+{
+    struct SDL_ScratchBlock *prev;
+    size_t base; /* arena offset of data[0] */
+    size_t size;
+    Uint8 *data;
+} SDL_ScratchBlock;
+
+typedef struct
+{
+    SDL_ScratchBlock *block; /* the newest block, older ones are still in use */
+    size_t top;
+    size_t high_water;
+} SDL_ScratchArena;
+
+static void SDLCALL SDL_FreeScratchArena(void *data)
+{
+    SDL_ScratchArena *arena = (SDL_ScratchArena *)data;
+
+    while (arena->block) {
+        SDL_ScratchBlock *block = arena->block;
+        arena->block = block->prev;
+        SDL_free(block);
+    }
+    SDL_free(arena);
+}
+
+static SDL_ScratchArena *SDL_GetScratchArena(SDL_bool create)
+{
+    static SDL_SpinLock tls_lock;
+    static SDL_TLSID tls_scratch;
+    SDL_ScratchArena *arena;
+
+    if (!tls_scratch) {
+        if (!create) {
+            return NULL;
+        }
+        SDL_AtomicLock(&tls_lock);
+        if (!tls_scratch) {
+            const SDL_TLSID slot = SDL_TLSCreate();
+            SDL_MemoryBarrierRelease();
+            tls_scratch = slot;
+        }
+        SDL_AtomicUnlock(&tls_lock);
+    }
+
+    SDL_MemoryBarrierAcquire();
+    arena = (SDL_ScratchArena *)SDL_TLSGet(tls_scratch);
+    if (!arena && create) {
+        arena = (SDL_ScratchArena *)SDL_calloc(1, sizeof(*arena));
+        if (arena && SDL_TLSSet(tls_scratch, arena, SDL_FreeScratchArena) < 0) {
+            SDL_free(arena);
+            arena = NULL;
+        }
+    }
+    return arena;
+}
+
+static SDL_ScratchBlock *SDL_CreateScratchBlock(size_t size)
+{
+    SDL_ScratchBlock *block;
+
+    if (size > SDL_SIZE_MAX - sizeof(*block) - SCRATCH_ALIGNMENT) {
+        return NULL;
+    }
+    block = (SDL_ScratchBlock *)SDL_malloc(sizeof(*block) + SCRATCH_ALIGNMENT - 1 + size);
+    if (!block) {
+        return NULL;
+    }
+    block->prev = NULL;
+    block->base = 0;
+    block->size = size;
+    block->data = (Uint8 *)(((uintptr_t)(block + 1) + SCRATCH_ALIGNMENT - 1) & ~(uintptr_t)(SCRATCH_ALIGNMENT - 1));
+    return block;
+}
+
+size_t SDL_GetScratchMark(void)
+{
+    SDL_ScratchArena *arena = SDL_GetScratchArena(SDL_FALSE);
+
+    return arena ? arena->top : 0;
+}
+
+void *SDL_AllocScratch(size_t size)
+{
+    SDL_ScratchArena *arena = SDL_GetScratchArena(SDL_TRUE);
+    SDL_ScratchBlock *block;
+    void *mem;
+
+    if (!arena || size > SDL_SIZE_MAX - SCRATCH_ALIGNMENT) {
+        return NULL;
+    }
+    size = (SDL_max(size, 1) + SCRATCH_ALIGNMENT - 1) & ~(size_t)(SCRATCH_ALIGNMENT - 1);
+
+    block = arena->block;
+    if (!block || (arena->top - block->base) + size > block->size) {
+        block = SDL_CreateScratchBlock(SDL_max(size, SCRATCH_BLOCK_SIZE));
+        if (!block) {
+            return NULL;
+        }
+        block->prev = arena->block;
+        block->base = arena->top;
+        arena->block = block;
+    }
+
+    mem = block->data + (arena->top - block->base);
+    arena->top += size;
+    arena->high_water = SDL_max(arena->high_water, arena->top);
+    return mem;
+}
+
+void SDL_ReleaseScratch(size_t mark)
+{
+    SDL_ScratchArena *arena = SDL_GetScratchArena(SDL_FALSE);
+    SDL_ScratchBlock *block;
+
+    if (!arena) {
+        return;
+    }
+    SDL_assert(mark <= arena->top);
+
+    /* Free the blocks that only hold memory from after the mark */
+    while (arena->block && arena->block->prev && arena->block->base >= mark) {
+        block = arena->block;
+        arena->block = block->prev;
+        SDL_free(block);
+    }
+    arena->top = mark;
+
+    if (mark == 0 && arena->block) {
+        /* The arena is empty, so make sure the next time round fits in one block */
+        block = arena->block;
+        if (block->size > SCRATCH_MAX_RETAINED) {
+            SDL_free(block);
+            arena->block = NULL;
+        } else if (arena->high_water > block->size) {
+            const size_t size = SDL_min((arena->high_water + SCRATCH_BLOCK_SIZE - 1) & ~(size_t)(SCRATCH_BLOCK_SIZE - 1), SCRATCH_MAX_RETAINED);
+            if (size > block->size) {
+                SDL_ScratchBlock *bigger = SDL_CreateScratchBlock(size);
+                if (bigger) {
+                    SDL_free(block);
+                    arena->block = bigger;
+                }
+            }
+        }
+        arena->high_water = 0;
+    }
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,50 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "./SDL_internal.h"
+
+#ifndef SDL_scratch_c_h_
+#define SDL_scratch_c_h_
+
+/* A per-thread scratch arena for short-lived internal allocations.
+
+   Take a mark, allocate as much as you need, and release back to the mark
+   when you're done, which frees everything allocated since it in one go:
+
+       const size_t scratch = SDL_GetScratchMark();
+       float *xy = (float *)SDL_AllocScratch(count * 2 * sizeof(*xy));
+       ...
+       SDL_ReleaseScratch(scratch);
+
+   Scopes nest like a stack, so a function can use the arena while its
+   caller has memory in it. Memory must not be kept past the release or
+   passed to another thread. Allocations are aligned for SIMD use, and like
+   SDL_malloc() a failed allocation returns NULL without setting an error.
+
+   Once a thread's arena has grown to fit its usual working set, allocating
+   from it doesn't touch the heap at all. */
+
+extern size_t SDL_GetScratchMark(void);
+extern void *SDL_AllocScratch(size_t size);
+extern void SDL_ReleaseScratch(size_t mark);
+
+#endif /* SDL_scratch_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -27,6 +27,7 @@
 #include "SDL_atomic.h"
 #include "SDL_mutex.h"
 #include "SDL_timer.h"
+#include "../thread/SDL_lockstats_c.h"
 
 #if !defined(HAVE_GCC_ATOMICS) && defined(__SOLARIS__)
 #include <atomic.h>
@@ -172,8 +173,13 @@ SDL_bool SDL_AtomicTryLock(SDL_SpinLock *lock)
 void SDL_AtomicLock(SDL_SpinLock *lock)
 {
     int iterations = 0;
+    Uint64 wait_start = 0;
+
     /* FIXME: Should we have an eventual timeout? */
     while (!SDL_AtomicTryLock(lock)) {
+        if (SDL_lock_stats_enabled && !wait_start) {
+            wait_start = SDL_LockStatsWaitBegin(lock, SDL_LOCKTYPE_SPINLOCK);
+        }
         if (iterations < 32) {
             iterations++;
             SDL_CPUPauseInstruction();
@@ -182,6 +188,9 @@ void SDL_AtomicLock(SDL_SpinLock *lock)
             SDL_Delay(0);
         }
     }
+    if (SDL_lock_stats_enabled) {
+        SDL_LockStatsAcquired(lock, SDL_LOCKTYPE_SPINLOCK, wait_start);
+    }
 }
 
 void SDL_AtomicUnlock(SDL_SpinLock *lock)
@@ -27,6 +27,7 @@
 #include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
 #include "../thread/SDL_systhread.h"
+#include "../timer/SDL_timer_c.h"
 #include "../SDL_utils_c.h"
 
 #define _THIS SDL_AudioDevice *_this
@@ -590,6 +591,66 @@ static void SDLCALL SDL_BufferQueueFillCallback(void *userdata, Uint8 *stream, i
     SDL_WriteToDataQueue(device->buffer_queue, stream, len);
 }
 
+/* Push a buffer of captured audio into the capture ring. Only called from
+   the capture thread, which never waits for the reader: if the ring is full,
+   the buffer is dropped and its sequence number is skipped. */
+static void push_capture_packet(SDL_AudioDevice *device, const Uint8 *data, Uint64 timestamp)
+{
+    const Uint32 head = (Uint32)SDL_AtomicGet(&device->capture_head);
+    const Uint32 tail = (Uint32)SDL_AtomicGet(&device->capture_tail);
+    const Uint32 sequence = device->capture_sequence++;
+
+    if ((head - tail) < (Uint32)device->capture_ring_size) {
+        SDL_CapturePacket *packet = &device->capture_ring[head & (device->capture_ring_size - 1)];
+        SDL_memcpy(packet->data, data, device->callbackspec.size);
+        packet->timestamp = timestamp;
+        packet->sequence = sequence;
+        SDL_AtomicSet(&device->capture_head, (int)(head + 1)); /* publish */
+    }
+}
+
+/* Read contiguous audio from the capture ring, stopping at a dropped packet.
+   Always called with the device lock held, so there is only one reader. */
+static Uint32 read_capture_ring(SDL_AudioDevice *device, Uint8 *data, Uint32 len, Uint64 *timestamp, Uint32 *sequence)
+{
+    const Uint32 packetlen = device->callbackspec.size;
+    const Uint32 framelen = (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8) * device->callbackspec.channels;
+    const Uint32 head = (Uint32)SDL_AtomicGet(&device->capture_head);
+    Uint32 tail = (Uint32)SDL_AtomicGet(&device->capture_tail);
+    Uint32 next_sequence = 0;
+    Uint32 retval = 0;
+
+    len -= len % framelen;
+    while (tail != head && retval < len) {
+        const SDL_CapturePacket *packet = &device->capture_ring[tail & (device->capture_ring_size - 1)];
+        const Uint32 offset = device->capture_read_offset;
+        const Uint32 cpy = SDL_min(packetlen - offset, len - retval);
+
+        if (retval == 0) {
+            if (timestamp) {
+                *timestamp = packet->timestamp + ((Uint64)(offset / framelen) * 1000000000) / device->callbackspec.freq;
+            }
+            if (sequence) {
+                *sequence = packet->sequence;
+            }
+        } else if (packet->sequence != next_sequence) {
+            break; /* the capture thread dropped audio here. */
+        }
+        next_sequence = packet->sequence + 1;
+
+        SDL_memcpy(data + retval, packet->data + offset, cpy);
+        retval += cpy;
+        device->capture_read_offset += cpy;
+        if (device->capture_read_offset == packetlen) {
+            device->capture_read_offset = 0;
+            tail++;
+            SDL_AtomicSet(&device->capture_tail, (int)tail); /* give the packet back */
+        }
+    }
+
+    return retval;
+}
+
 int SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
 {
     SDL_AudioDevice *device = get_audio_device(devid);
@@ -625,7 +686,36 @@ Uint32 SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
     }
 
     current_audio.impl.LockDevice(device);
-    rc = (Uint32)SDL_ReadFromDataQueue(device->buffer_queue, data, len);
+    if (device->capture_ring) {
+        rc = read_capture_ring(device, (Uint8 *)data, len, NULL, NULL);
+    } else {
+        rc = (Uint32)SDL_ReadFromDataQueue(device->buffer_queue, data, len);
+    }
+    current_audio.impl.UnlockDevice(device);
+    return rc;
+}
+
+Uint32 SDL_DequeueAudioTimestamped(SDL_AudioDeviceID devid, void *data, Uint32 len, Uint64 *timestamp, Uint32 *sequence)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    Uint32 rc;
+
+    if (timestamp) {
+        *timestamp = 0;
+    }
+    if (sequence) {
+        *sequence = 0;
+    }
+
+    if (!device || !device->capture_ring) {
+        return SDL_DequeueAudio(devid, data, len);
+    }
+    if (len == 0) {
+        return 0;
+    }
+
+    current_audio.impl.LockDevice(device);
+    rc = read_capture_ring(device, (Uint8 *)data, len, timestamp, sequence);
     current_audio.impl.UnlockDevice(device);
     return rc;
 }
@@ -640,7 +730,12 @@ Uint32 SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
     }
 
     /* Nothing to do unless we're set up for queueing. */
-    if (device->callbackspec.callback == SDL_BufferQueueDrainCallback ||
+    if (device->capture_ring) {
+        current_audio.impl.LockDevice(device);
+        retval = (((Uint32)SDL_AtomicGet(&device->capture_head) - (Uint32)SDL_AtomicGet(&device->capture_tail)) *
+                  device->callbackspec.size) - device->capture_read_offset;
+        current_audio.impl.UnlockDevice(device);
+    } else if (device->callbackspec.callback == SDL_BufferQueueDrainCallback ||
         device->callbackspec.callback == SDL_BufferQueueFillCallback) {
         current_audio.impl.LockDevice(device);
         retval = (Uint32)SDL_CountDataQueue(device->buffer_queue);
@@ -661,8 +756,13 @@ void SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
     /* Blank out the device and release the mutex. Free it afterwards. */
     current_audio.impl.LockDevice(device);
 
-    /* Keep up to two packets in the pool to reduce future memory allocation pressure. */
-    SDL_ClearDataQueue(device->buffer_queue, SDL_AUDIOBUFFERQUEUE_PACKETLEN * 2);
+    if (device->capture_ring) {
+        SDL_AtomicSet(&device->capture_tail, SDL_AtomicGet(&device->capture_head));
+        device->capture_read_offset = 0;
+    } else {
+        /* Keep up to two packets in the pool to reduce future memory allocation pressure. */
+        SDL_ClearDataQueue(device->buffer_queue, SDL_AUDIOBUFFERQUEUE_PACKETLEN * 2);
+    }
 
     current_audio.impl.UnlockDevice(device);
 }
@@ -671,6 +771,269 @@ void SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
 extern void Android_JNI_AudioSetThreadPriority(int, int);
 #endif
 
+/* Claim a slot in the device's command ring and publish a command to the
+   audio thread. Several threads may post at once; only the audio thread reads. */
+static int post_audio_command(SDL_AudioDevice *device, SDL_AudioCommandType type)
+{
+    Uint64 timeout = 0;
+
+    while (!SDL_AtomicGet(&device->shutdown)) {
+        const int pos = SDL_AtomicGet(&device->command_head);
+        SDL_AudioCommand *cmd = &device->commands[pos & (SDL_AUDIO_COMMAND_RING_SIZE - 1)];
+        const int diff = SDL_AtomicGet(&cmd->sequence) - pos;
+
+        if (diff == 0) {
+            if (SDL_AtomicCAS(&device->command_head, pos, pos + 1)) {
+                cmd->type = type;
+                SDL_AtomicSet(&cmd->sequence, pos + 1); /* publish */
+                return 0;
+            }
+        } else if (diff < 0) {
+            /* The ring is full, give the audio thread a chance to drain it,
+               but don't wait forever on an audio thread that's stuck. */
+            if (!timeout) {
+                timeout = SDL_GetTicks64() + SDL_AUDIO_COMMAND_TIMEOUT;
+            } else if (SDL_GetTicks64() >= timeout) {
+                return SDL_SetError("Timed out waiting for the audio thread");
+            }
+            SDL_Delay(1);
+        }
+    }
+    return SDL_SetError("Audio device is shutting down");
+}
+
+/* Apply the latest requested value for a command. */
+static void apply_audio_command(SDL_AudioDevice *device, SDL_AudioCommandType type)
+{
+    switch (type) {
+    case SDL_AUDIO_COMMAND_PAUSE:
+        SDL_AtomicSet(&device->paused, SDL_AtomicGet(&device->requested_paused));
+        break;
+    case SDL_AUDIO_COMMAND_SET_VOLUME:
+        SDL_AtomicSet(&device->volume, SDL_AtomicGet(&device->requested_volume));
+        break;
+    }
+}
+
+/* Apply any posted commands. Only called from the audio thread. */
+static void drain_audio_commands(SDL_AudioDevice *device)
+{
+    for (;;) {
+        const Uint32 pos = device->command_tail;
+        SDL_AudioCommand *cmd = &device->commands[pos & (SDL_AUDIO_COMMAND_RING_SIZE - 1)];
+
+        if (SDL_AtomicGet(&cmd->sequence) != (int)(pos + 1)) {
+            break; /* empty, or the producer hasn't published yet */
+        }
+
+        apply_audio_command(device, cmd->type);
+
+        SDL_AtomicSet(&cmd->sequence, (int)(pos + SDL_AUDIO_COMMAND_RING_SIZE)); /* release the slot */
+        device->command_tail = pos + 1;
+    }
+}
+
+/* Post a command to a lock-free audio thread. If the ring stays full or the
+   device is shutting down, apply the request directly under the device lock
+   instead of dropping it. The requested value is re-read until it is stable,
+   so a racing request from another thread is never overwritten. */
+static void send_audio_command(SDL_AudioDevice *device, SDL_AudioCommandType type)
+{
+    if (post_audio_command(device, type) < 0) {
+        SDL_atomic_t *requested = (type == SDL_AUDIO_COMMAND_PAUSE) ? &device->requested_paused : &device->requested_volume;
+        int value;
+
+        current_audio.impl.LockDevice(device);
+        do {
+            value = SDL_AtomicGet(requested);
+            apply_audio_command(device, type);
+        } while (SDL_AtomicGet(requested) != value);
+        current_audio.impl.UnlockDevice(device);
+    }
+}
+
+/* Scale a buffer the callback produced by the device volume. */
+static void apply_audio_volume(SDL_AudioDevice *device, Uint8 *data, int len)
+{
+    const int volume = SDL_AtomicGet(&device->volume);
+
+    if (volume >= SDL_MIX_MAXVOLUME) {
+        return;
+    }
+    if (volume > 0) {
+        SDL_memcpy(device->volume_buffer, data, len);
+    }
+    SDL_memset(data, device->callbackspec.silence, len);
+    if (volume > 0) {
+        SDL_MixAudioFormat(data, device->volume_buffer, device->callbackspec.format, len, volume);
+    }
+}
+
+/* Mix the bound streams into a buffer the callback produced. The streams
+   are summed in float, and only clipped when the sum is added to the buffer.
+   Called with the device locked; the application holds the same lock for
+   every call on a bound stream, see SDL_BindAudioStream(). */
+static void mix_bound_streams(SDL_AudioDevice *device, Uint8 *data, int len)
+{
+    const int channels = device->callbackspec.channels;
+    const int num_frames = device->callbackspec.samples;
+    const int frame_size = channels * (int)sizeof(float);
+    const SDL_bool direct = (device->callbackspec.format == AUDIO_F32SYS);
+    float *accumulator = direct ? (float *)data : device->mix_buffer;
+    SDL_bool mixed = SDL_FALSE;
+    int i;
+
+    for (i = 0; i < device->num_bound_streams; ++i) {
+        SDL_BoundAudioStream *bound = &device->bound_streams[i];
+        const int got = SDL_AudioStreamGet(bound->stream, device->mix_stream_buffer, num_frames * frame_size);
+        const int frames = (got > 0) ? (got / frame_size) : 0;
+        float gain_end;
+
+        if (frames == 0) {
+            continue; /* starved or drained; the ramp waits for more data. */
+        }
+
+        if (frames == num_frames) {
+            gain_end = bound->target_gain;
+        } else {
+            gain_end = bound->gain + ((bound->target_gain - bound->gain) * frames) / num_frames;
+        }
+
+        if (!mixed && !direct) {
+            SDL_memset(accumulator, 0, (size_t)num_frames * frame_size);
+        }
+        SDL_MixAudioF32Gain(accumulator, device->mix_stream_buffer, frames, channels, bound->gain, gain_end);
+        bound->gain = gain_end;
+        mixed = SDL_TRUE;
+    }
+
+    if (mixed && !direct) {
+        device->mix_cvt.buf = (Uint8 *)accumulator;
+        device->mix_cvt.len = num_frames * frame_size;
+        if (SDL_ConvertAudio(&device->mix_cvt) == 0) {
+            SDL_MixAudioFormat(data, device->mix_cvt.buf, device->callbackspec.format, len, SDL_MIX_MAXVOLUME);
+        }
+    }
+}
+
+/* Hand the device buffer to the driver, advance the device's frame clock
+   and check it against the deadline of this period. The frames only count
+   as played if the period wasn't rendered as paused. */
+static void play_audio_buffer(SDL_AudioDevice *device, Uint64 period, SDL_bool paused)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+    SDL_bool underrun = SDL_FALSE;
+
+    if (device->schedule_periods == 0) {
+        /* Playback (re)started, the last wakeup is no reference */
+        device->schedule_start = now;
+        device->last_wakeup = 0;
+    } else {
+        /* The driver holds one period while we produce the next one, plus
+           one more if we prefilled. Anything after that means it ran dry. */
+        const Uint64 ahead = device->prefill ? 2 : 1;
+        const Uint64 deadline = device->schedule_start + (device->schedule_periods + ahead) * period;
+        if (now > deadline) {
+            underrun = SDL_TRUE;
+            device->schedule_start = now;
+            device->schedule_periods = 0;
+        }
+    }
+
+    current_audio.impl.PlayDevice(device);
+    ++device->schedule_periods;
+
+    SDL_AtomicLock(&device->stats_lock);
+    ++device->stats.periods;
+    if (underrun) {
+        ++device->stats.underruns;
+    }
+    if (!paused) {
+        device->frames_played += device->spec.samples;
+    }
+    SDL_AtomicUnlock(&device->stats_lock);
+}
+
+/* What one pass of the playback thread measured, see update_audio_stats(). */
+typedef struct AudioThreadTimings
+{
+    Uint64 callback_start;
+    Uint64 callback_ticks;
+    SDL_bool callback_ran;
+    SDL_bool late;
+    Uint64 resample_ticks;
+    Uint32 silence_fills;
+    int stream_queued;
+} AudioThreadTimings;
+
+/* Fold one pass of the playback thread into the device statistics.
+   This takes stats_lock once, so it is cheap enough to always run. */
+static void update_audio_stats(SDL_AudioDevice *device, const AudioThreadTimings *timings)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    const Uint64 callback_ns = SDL_PerformanceCounterToNS(timings->callback_ticks, freq);
+    int bucket = 0;
+
+    if (timings->callback_ran) {
+        Uint64 us = callback_ns / 1000;
+        while (us > 0 && bucket < SDL_AUDIO_STATS_HISTOGRAM_BUCKETS - 1) {
+            us >>= 1;
+            ++bucket;
+        }
+    }
+
+    SDL_AtomicLock(&device->stats_lock);
+    if (timings->callback_ran) {
+        ++device->stats.callbacks;
+        ++device->stats.callback_histogram[bucket];
+        device->stats.callback_ns_total += callback_ns;
+        if (callback_ns > device->stats.callback_ns_max) {
+            device->stats.callback_ns_max = callback_ns;
+        }
+    }
+    if (timings->late) {
+        ++device->stats.late_callbacks;
+    }
+    device->stats.silence_fills += timings->silence_fills;
+    device->stats.resample_ns_total += SDL_PerformanceCounterToNS(timings->resample_ticks, freq);
+    device->stats.stream_queued = timings->stream_queued;
+    if (timings->stream_queued > device->stats.stream_queued_max) {
+        device->stats.stream_queued_max = timings->stream_queued;
+    }
+    SDL_AtomicUnlock(&device->stats_lock);
+}
+
+/* Wait for the driver to want more data, unless we are prefilling the
+   first period after the schedule (re)started.
+
+   Jitter is measured here, between consecutive wakeups, against the
+   device period. The callback can't be used for that: with a conversion
+   stream it runs as often as the stream needs input, which can be several
+   times per device period or not at all. */
+static void wait_audio_device(SDL_AudioDevice *device, Uint64 period)
+{
+    Uint64 now;
+
+    if (device->prefill && device->schedule_periods == 1) {
+        return;
+    }
+    current_audio.impl.WaitDevice(device);
+
+    now = SDL_GetPerformanceCounter();
+    if (device->last_wakeup) {
+        const Uint64 interval = now - device->last_wakeup;
+        const Uint64 jitter_ns = SDL_PerformanceCounterToNS((interval > period) ? (interval - period) : (period - interval), SDL_GetPerformanceFrequency());
+
+        SDL_AtomicLock(&device->stats_lock);
+        device->stats.jitter_ns_total += jitter_ns;
+        if (jitter_ns > device->stats.jitter_ns_max) {
+            device->stats.jitter_ns_max = jitter_ns;
+        }
+        SDL_AtomicUnlock(&device->stats_lock);
+    }
+    device->last_wakeup = now;
+}
+
 /* The general mixing thread function */
 static int SDLCALL SDL_RunAudio(void *userdata)
 {
@@ -678,6 +1041,11 @@ static int SDLCALL SDL_RunAudio(void *userdata)
     SDL_AudioDevice *device = startup_data->device;
     void *udata = device->callbackspec.userdata;
     SDL_AudioCallback callback = device->callbackspec.callback;
+    const Uint64 perf_freq = SDL_GetPerformanceFrequency();
+    const Uint64 period = (device->spec.samples * perf_freq) / device->spec.freq;
+    const Uint64 callback_period = (device->callbackspec.samples * perf_freq) / device->callbackspec.freq;
+    AudioThreadTimings timings;
+    Uint64 resample_start;
     int data_len = 0;
     Uint8 *data;
     Uint8 *device_buf_keepsafe = NULL;
@@ -705,6 +1073,10 @@ static int SDLCALL SDL_RunAudio(void *userdata)
     while (!SDL_AtomicGet(&device->shutdown)) {
         data_len = device->callbackspec.size;
 
+        if (device->lockfree) {
+            drain_audio_commands(device);
+        }
+
         /* Fill the current buffer with sound */
         if (!device->stream && SDL_AtomicGet(&device->enabled)) {
             data = current_audio.impl.GetDeviceBuf(device);
@@ -731,20 +1103,54 @@ static int SDLCALL SDL_RunAudio(void *userdata)
             data = device->work_buffer;
         }
 
+        SDL_zero(timings);
+
         /* !!! FIXME: this should be LockDevice. */
-        SDL_LockMutex(device->mixer_lock);
-        if (SDL_AtomicGet(&device->paused)) {
+        if (!device->lockfree) {
+            SDL_LockMutex(device->mixer_lock);
+        }
+
+        /* Time spent waiting for the application to unlock the device
+           isn't the callback's fault, so start the clock here. */
+        timings.callback_start = SDL_GetPerformanceCounter();
+
+        /* Decide once whether this period is paused, so the callback, the
+           frame clock and the backend all agree even if it changes meanwhile */
+        device->period_paused = SDL_AtomicGet(&device->paused) ? SDL_TRUE : SDL_FALSE;
+        if (device->period_paused) {
             SDL_memset(data, device->callbackspec.silence, data_len);
         } else {
             callback(udata, data, data_len);
+            if (SDL_AtomicGet(&device->has_bound_streams)) {
+                if (device->lockfree) {
+                    SDL_LockMutex(device->mixer_lock);
+                }
+                mix_bound_streams(device, data, data_len);
+                if (device->lockfree) {
+                    SDL_UnlockMutex(device->mixer_lock);
+                }
+            }
+            apply_audio_volume(device, data, data_len);
+            timings.callback_ran = SDL_TRUE;
+        }
+        if (!device->lockfree) {
+            SDL_UnlockMutex(device->mixer_lock);
         }
-        SDL_UnlockMutex(device->mixer_lock);
+
+        resample_start = SDL_GetPerformanceCounter();
+        timings.callback_ticks = resample_start - timings.callback_start;
 
         if (device->stream) {
             /* Stream available audio to device, converting/resampling. */
             /* if this fails...oh well. We'll play silence here. */
             SDL_AudioStreamPut(device->stream, data, data_len);
+            timings.resample_ticks = SDL_GetPerformanceCounter() - resample_start;
+        }
 
+        /* Producing a buffer should take less time than playing it. */
+        timings.late = (timings.callback_ticks + timings.resample_ticks > callback_period);
+
+        if (device->stream) {
             while (SDL_AudioStreamAvailable(device->stream) >= ((int)device->spec.size)) {
                 int got;
                 if (SDL_AtomicGet(&device->enabled)) {
@@ -760,37 +1166,47 @@ static int SDLCALL SDL_RunAudio(void *userdata)
                 } else {
                     data = NULL;
                 }
+                resample_start = SDL_GetPerformanceCounter();
                 got = SDL_AudioStreamGet(device->stream, data ? data : device->work_buffer, device->spec.size);
+                timings.resample_ticks += SDL_GetPerformanceCounter() - resample_start;
                 SDL_assert((got <= 0) || (got == device->spec.size));
 
                 if (data == NULL) { /* device is having issues... */
                     const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
                     SDL_Delay(delay); /* wait for as long as this buffer would have played. Maybe device recovers later? */
+                    device->schedule_periods = 0;
                 } else {
                     if (got != device->spec.size) {
                         SDL_memset(data, device->spec.silence, device->spec.size);
+                        ++timings.silence_fills;
                     }
-                    current_audio.impl.PlayDevice(device);
-                    current_audio.impl.WaitDevice(device);
+                    play_audio_buffer(device, period, device->period_paused);
+                    wait_audio_device(device, period);
                 }
             }
 
             /* it seems resampling was not fast enough, device_buf_keepsafe was not released yet, so play silence here */
             if (device_buf_keepsafe) {
                 SDL_memset(device_buf_keepsafe, device->spec.silence, device->spec.size);
-                current_audio.impl.PlayDevice(device);
-                current_audio.impl.WaitDevice(device);
+                ++timings.silence_fills;
+                play_audio_buffer(device, period, device->period_paused);
+                wait_audio_device(device, period);
                 device_buf_keepsafe = NULL;
             }
+
+            timings.stream_queued = SDL_AudioStreamAvailable(device->stream);
         } else if (data == device->work_buffer) {
             /* nothing to do; pause like we queued a buffer to play. */
             const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
             SDL_Delay(delay);
+            device->schedule_periods = 0;
         } else { /* writing directly to the device. */
             /* queue this buffer and wait for it to finish playing. */
-            current_audio.impl.PlayDevice(device);
-            current_audio.impl.WaitDevice(device);
+            play_audio_buffer(device, period, device->period_paused);
+            wait_audio_device(device, period);
         }
+
+        update_audio_stats(device, &timings);
     }
 
     /* Wait for the audio to drain. */
@@ -810,6 +1226,8 @@ static int SDLCALL SDL_CaptureAudio(void *userdata)
     const int silence = (int)device->spec.silence;
     const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
     const int data_len = device->spec.size;
+    const int callback_framelen = (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8) * device->callbackspec.channels;
+    const Uint64 freq = SDL_GetPerformanceFrequency();
     Uint8 *data;
     void *udata = device->callbackspec.userdata;
     SDL_AudioCallback callback = device->callbackspec.callback;
@@ -837,6 +1255,7 @@ static int SDLCALL SDL_CaptureAudio(void *userdata)
     while (!SDL_AtomicGet(&device->shutdown)) {
         int still_need;
         Uint8 *ptr;
+        Uint64 captured_ns;
 
         if (SDL_AtomicGet(&device->paused)) {
             SDL_Delay(delay); /* just so we don't cook the CPU. */
@@ -881,17 +1300,30 @@ static int SDLCALL SDL_CaptureAudio(void *userdata)
             SDL_memset(ptr, silence, still_need);
         }
 
+        /* The newest sample frame we have was captured about now. */
+        captured_ns = SDL_PerformanceCounterToNS(SDL_GetPerformanceCounter(), freq);
+
         if (device->stream) {
+            int available;
+
             /* if this fails...oh well. */
             SDL_AudioStreamPut(device->stream, data, data_len);
 
-            while (SDL_AudioStreamAvailable(device->stream) >= ((int)device->callbackspec.size)) {
+            while ((available = SDL_AudioStreamAvailable(device->stream)) >= ((int)device->callbackspec.size)) {
                 const int got = SDL_AudioStreamGet(device->stream, device->work_buffer, device->callbackspec.size);
                 SDL_assert((got < 0) || (got == device->callbackspec.size));
                 if (got != device->callbackspec.size) {
                     SDL_memset(device->work_buffer, device->spec.silence, device->callbackspec.size);
                 }
 
+                if (device->capture_ring) {
+                    if (!SDL_AtomicGet(&device->paused)) {
+                        const Uint64 frames = (Uint64)(available / callback_framelen);
+                        push_capture_packet(device, device->work_buffer, captured_ns - (frames * 1000000000) / device->callbackspec.freq);
+                    }
+                    continue;
+                }
+
                 /* !!! FIXME: this should be LockDevice. */
                 SDL_LockMutex(device->mixer_lock);
                 if (!SDL_AtomicGet(&device->paused)) {
@@ -899,6 +1331,10 @@ static int SDLCALL SDL_CaptureAudio(void *userdata)
                 }
                 SDL_UnlockMutex(device->mixer_lock);
             }
+        } else if (device->capture_ring) {
+            if (!SDL_AtomicGet(&device->paused)) {
+                push_capture_packet(device, data, captured_ns - ((Uint64)device->spec.samples * 1000000000) / device->spec.freq);
+            }
         } else { /* feeding user callback directly without streaming. */
             /* !!! FIXME: this should be LockDevice. */
             SDL_LockMutex(device->mixer_lock);
@@ -1213,6 +1649,12 @@ static void close_audio_device(SDL_AudioDevice *device)
     }
 
     SDL_free(device->work_buffer);
+    SDL_free(device->volume_buffer);
+    SDL_free(device->bound_streams);
+    SDL_free(device->mix_buffer);
+    SDL_free(device->mix_stream_buffer);
+    SDL_free(device->capture_ring);
+    SDL_free(device->capture_ring_data);
     SDL_FreeAudioStream(device->stream);
 
     if (device->id > 0) {
@@ -1415,6 +1857,7 @@ static SDL_AudioDeviceID open_audio_device(const char *devname, int iscapture,
 
     SDL_AtomicSet(&device->shutdown, 0); /* just in case. */
     SDL_AtomicSet(&device->paused, 1);
+    SDL_AtomicSet(&device->requested_paused, 1);
     SDL_AtomicSet(&device->enabled, 1);
 
     /* Create a mutex for locking the sound buffers */
@@ -1425,6 +1868,7 @@ static SDL_AudioDeviceID open_audio_device(const char *devname, int iscapture,
             SDL_SetError("Couldn't create mixer lock");
             return 0;
         }
+        SDL_SetLockName(device->mixer_lock, "device->mixer_lock");
     }
 
     /* For backends that require a power-of-two value for spec.samples, take the
@@ -1495,7 +1939,27 @@ static SDL_AudioDeviceID open_audio_device(const char *devname, int iscapture,
         }
     }
 
-    if (device->spec.callback == NULL) { /* use buffer queueing? */
+    if (iscapture && device->spec.callback == NULL && !current_audio.impl.ProvidesOwnCallbackThread &&
+        SDL_GetHintBoolean(SDL_HINT_AUDIO_CAPTURE_LOCKFREE, SDL_FALSE)) {
+        /* A ring of whole callback buffers, about half a second's worth. */
+        int size = 8;
+        while ((size * (int)obtained->samples) < (obtained->freq / 2)) {
+            size *= 2;
+        }
+        device->capture_ring = (SDL_CapturePacket *)SDL_calloc(size, sizeof(SDL_CapturePacket));
+        device->capture_ring_data = (Uint8 *)SDL_malloc((size_t)size * obtained->size);
+        if (!device->capture_ring || !device->capture_ring_data) {
+            close_audio_device(device);
+            SDL_OutOfMemory();
+            return 0;
+        }
+        for (i = 0; i < size; ++i) {
+            device->capture_ring[i].data = device->capture_ring_data + ((size_t)i * obtained->size);
+        }
+        device->capture_ring_size = size;
+        device->callbackspec.callback = SDL_BufferQueueFillCallback; /* so SDL_DequeueAudio() accepts it */
+        device->callbackspec.userdata = device;
+    } else if (device->spec.callback == NULL) { /* use buffer queueing? */
         /* pool a few packets to start. Enough for two callbacks. */
         device->buffer_queue = SDL_NewDataQueue(SDL_AUDIOBUFFERQUEUE_PACKETLEN, obtained->size * 2);
         if (!device->buffer_queue) {
@@ -1521,6 +1985,27 @@ static SDL_AudioDeviceID open_audio_device(const char *devname, int iscapture,
         return 0;
     }
 
+    SDL_AtomicSet(&device->volume, SDL_MIX_MAXVOLUME);
+    SDL_AtomicSet(&device->requested_volume, SDL_MIX_MAXVOLUME);
+    if (!iscapture) {
+        device->volume_buffer = (Uint8 *)SDL_malloc(device->callbackspec.size);
+        if (device->volume_buffer == NULL) {
+            close_audio_device(device);
+            SDL_OutOfMemory();
+            return 0;
+        }
+    }
+
+    /* The buffer queue callbacks rely on mixer_lock, so only application
+       callbacks on our own playback thread can run without it. */
+    device->lockfree = (!iscapture && !current_audio.impl.ProvidesOwnCallbackThread &&
+                        device->spec.callback != NULL &&
+                        SDL_GetHintBoolean(SDL_HINT_AUDIO_CALLBACK_LOCKFREE, SDL_FALSE));
+    device->prefill = SDL_GetHintBoolean(SDL_HINT_AUDIO_PREFILL, SDL_FALSE);
+    for (i = 0; i < SDL_AUDIO_COMMAND_RING_SIZE; ++i) {
+        SDL_AtomicSet(&device->commands[i].sequence, i);
+    }
+
     /* Find an available device ID... */
     SDL_LockMutex(current_audio.detectionLock);
     for (id = min_id - 1; id < SDL_arraysize(open_devices); id++) {
@@ -1627,6 +2112,45 @@ SDL_AudioStatus SDL_GetAudioDeviceStatus(SDL_AudioDeviceID devid)
     return status;
 }
 
+Uint64 SDL_GetAudioDeviceFramesPlayed(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    Uint64 frames = 0;
+    if (device) {
+        SDL_AtomicLock(&device->stats_lock);
+        frames = device->frames_played;
+        SDL_AtomicUnlock(&device->stats_lock);
+    }
+    return frames;
+}
+
+int SDL_GetAudioDeviceStats(SDL_AudioDeviceID devid, SDL_AudioDeviceStats *stats)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    if (!device) {
+        return -1;
+    }
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+    SDL_AtomicLock(&device->stats_lock);
+    *stats = device->stats;
+    SDL_AtomicUnlock(&device->stats_lock);
+    return 0;
+}
+
+int SDL_ResetAudioDeviceStats(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    if (!device) {
+        return -1;
+    }
+    SDL_AtomicLock(&device->stats_lock);
+    SDL_zero(device->stats);
+    SDL_AtomicUnlock(&device->stats_lock);
+    return 0;
+}
+
 SDL_AudioStatus SDL_GetAudioStatus(void)
 {
     return SDL_GetAudioDeviceStatus(1);
@@ -1636,10 +2160,181 @@ void SDL_PauseAudioDevice(SDL_AudioDeviceID devid, int pause_on)
 {
     SDL_AudioDevice *device = get_audio_device(devid);
     if (device) {
+        if (device->lockfree) {
+            SDL_AtomicSet(&device->requested_paused, pause_on ? 1 : 0);
+            send_audio_command(device, SDL_AUDIO_COMMAND_PAUSE);
+        } else {
+            current_audio.impl.LockDevice(device);
+            SDL_AtomicSet(&device->paused, pause_on ? 1 : 0);
+            current_audio.impl.UnlockDevice(device);
+        }
+    }
+}
+
+int SDL_SetAudioDeviceVolume(SDL_AudioDeviceID devid, int volume)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    if (!device) {
+        return -1;
+    }
+    if (device->iscapture || current_audio.impl.ProvidesOwnCallbackThread) {
+        return SDL_Unsupported();
+    }
+
+    volume = SDL_clamp(volume, 0, SDL_MIX_MAXVOLUME);
+    if (device->lockfree) {
+        SDL_AtomicSet(&device->requested_volume, volume);
+        send_audio_command(device, SDL_AUDIO_COMMAND_SET_VOLUME);
+    } else {
         current_audio.impl.LockDevice(device);
-        SDL_AtomicSet(&device->paused, pause_on ? 1 : 0);
+        SDL_AtomicSet(&device->volume, volume);
         current_audio.impl.UnlockDevice(device);
     }
+    return 0;
+}
+
+/* Allocate the accumulator and conversion for the first bound stream. */
+static int prepare_audio_mixing(SDL_AudioDevice *device)
+{
+    const SDL_AudioSpec *spec = &device->callbackspec;
+    const size_t float_len = (size_t)spec->samples * spec->channels * sizeof(float);
+
+    if (device->mix_stream_buffer) {
+        return 0;
+    }
+
+    if (spec->format != AUDIO_F32SYS) {
+        if (SDL_BuildAudioCVT(&device->mix_cvt, AUDIO_F32SYS, spec->channels, spec->freq,
+                              spec->format, spec->channels, spec->freq) < 0) {
+            return -1;
+        }
+        device->mix_buffer = (float *)SDL_malloc(float_len * device->mix_cvt.len_mult);
+        if (!device->mix_buffer) {
+            return SDL_OutOfMemory();
+        }
+    }
+
+    device->mix_stream_buffer = (float *)SDL_malloc(float_len);
+    if (!device->mix_stream_buffer) {
+        SDL_free(device->mix_buffer);
+        device->mix_buffer = NULL;
+        return SDL_OutOfMemory();
+    }
+    return 0;
+}
+
+static SDL_BoundAudioStream *find_bound_stream(SDL_AudioDevice *device, SDL_AudioStream *stream)
+{
+    int i;
+    for (i = 0; i < device->num_bound_streams; ++i) {
+        if (device->bound_streams[i].stream == stream) {
+            return &device->bound_streams[i];
+        }
+    }
+    return NULL;
+}
+
+int SDL_BindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioFormat format;
+    Uint8 channels;
+    int rate;
+    int retval = 0;
+
+    if (!device) {
+        return -1;
+    }
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (device->iscapture || current_audio.impl.ProvidesOwnCallbackThread) {
+        return SDL_Unsupported();
+    }
+
+    SDL_GetAudioStreamOutputFormat(stream, &format, &channels, &rate);
+    if (format != AUDIO_F32SYS || channels != device->callbackspec.channels || rate != device->callbackspec.freq) {
+        return SDL_SetError("Audio stream must produce AUDIO_F32SYS with the device's channels and frequency");
+    }
+
+    current_audio.impl.LockDevice(device);
+    if (find_bound_stream(device, stream)) {
+        retval = SDL_SetError("Audio stream is already bound to this device");
+    } else if (prepare_audio_mixing(device) < 0) {
+        retval = -1;
+    } else {
+        if (device->num_bound_streams == device->max_bound_streams) {
+            const int max_streams = device->max_bound_streams ? (device->max_bound_streams * 2) : 8;
+            SDL_BoundAudioStream *streams = (SDL_BoundAudioStream *)SDL_realloc(device->bound_streams, max_streams * sizeof(*streams));
+            if (!streams) {
+                retval = SDL_OutOfMemory();
+            } else {
+                device->bound_streams = streams;
+                device->max_bound_streams = max_streams;
+            }
+        }
+        if (retval == 0) {
+            SDL_BoundAudioStream *bound = &device->bound_streams[device->num_bound_streams++];
+            bound->stream = stream;
+            bound->gain = 1.0f;
+            bound->target_gain = 1.0f;
+            SDL_AtomicSet(&device->has_bound_streams, 1);
+        }
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    return retval;
+}
+
+int SDL_UnbindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_BoundAudioStream *bound;
+    int retval = 0;
+
+    if (!device) {
+        return -1;
+    }
+
+    current_audio.impl.LockDevice(device);
+    bound = find_bound_stream(device, stream);
+    if (!bound) {
+        retval = SDL_SetError("Audio stream is not bound to this device");
+    } else {
+        const int index = (int)(bound - device->bound_streams);
+        SDL_memmove(bound, bound + 1, (device->num_bound_streams - index - 1) * sizeof(*bound));
+        if (--device->num_bound_streams == 0) {
+            SDL_AtomicSet(&device->has_bound_streams, 0);
+        }
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    return retval;
+}
+
+int SDL_SetBoundAudioStreamGain(SDL_AudioDeviceID devid, SDL_AudioStream *stream, float gain)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_BoundAudioStream *bound;
+    int retval = 0;
+
+    if (!device) {
+        return -1;
+    }
+    if (gain < 0.0f) {
+        return SDL_InvalidParamError("gain");
+    }
+
+    current_audio.impl.LockDevice(device);
+    bound = find_bound_stream(device, stream);
+    if (!bound) {
+        retval = SDL_SetError("Audio stream is not bound to this device");
+    } else {
+        bound->target_gain = gain;
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    return retval;
 }
 
 void SDL_PauseAudio(int pause_on)
@@ -71,6 +71,15 @@ extern SDL_AudioFilter SDL_Convert_F32_to_S16;
 extern SDL_AudioFilter SDL_Convert_F32_to_U16;
 extern SDL_AudioFilter SDL_Convert_F32_to_S32;
 
+/* Get a single pass converter for both the format and channel conversion, if there is one for these formats. */
+extern SDL_AudioFilter SDL_GetFusedAudioConverter(SDL_AudioFormat src_format, Uint8 src_channels, SDL_AudioFormat dst_format, Uint8 dst_channels);
+
+/* Get a converter that also swaps the byte order, if there is one for these formats. Otherwise add SDL_Convert_Byteswap as a separate pass. */
+extern SDL_AudioFilter SDL_GetByteswapAudioConverter(SDL_AudioFormat src_format, SDL_AudioFormat dst_format);
+
+extern void SDL_GetAudioStreamOutputFormat(SDL_AudioStream *stream, SDL_AudioFormat *format, Uint8 *channels, int *rate);
+extern void SDL_MixAudioF32Gain(float *dst, const float *src, int num_frames, int channels, float gain_start, float gain_end);
+
 #endif /* SDL_audio_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
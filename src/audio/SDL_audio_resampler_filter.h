@@ -1058,4 +1058,1655 @@ static const float ResamplerFilterDifference[RESAMPLER_FILTER_SIZE] = {
     0.000000000f
 };
 
+#define RESAMPLER_HQ_ZERO_CROSSINGS            16
+#define RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING 256
+#define RESAMPLER_HQ_FILTER_SIZE               ((RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING * RESAMPLER_HQ_ZERO_CROSSINGS) + 1)
+
+static const float ResamplerFilterHQ[RESAMPLER_HQ_FILTER_SIZE] = {
+    1.000000000f, 0.999974906f, 0.999899268f, 0.999772727f, 0.999595284f,
+    0.999367058f, 0.999087930f, 0.998757958f, 0.998377204f, 0.997945786f,
+    0.997463584f, 0.996930778f, 0.996347308f, 0.995713353f, 0.995028853f,
+    0.994293809f, 0.993508518f, 0.992672980f, 0.991787136f, 0.990851164f,
+    0.989865184f, 0.988829136f, 0.987743318f, 0.986607790f, 0.985422552f,
+    0.984187722f, 0.982903540f, 0.981570065f, 0.980187297f, 0.978755653f,
+    0.977274954f, 0.975745499f, 0.974167407f, 0.972540796f, 0.970865846f,
+    0.969142675f, 0.967371523f, 0.965552568f, 0.963685751f, 0.961771548f,
+    0.959810019f, 0.957801223f, 0.955745578f, 0.953643024f, 0.951493919f,
+    0.949298501f, 0.947056770f, 0.944769084f, 0.942435801f, 0.940056741f,
+    0.937632561f, 0.935163081f, 0.932648718f, 0.930089831f, 0.927486539f,
+    0.924839020f, 0.922147572f, 0.919412434f, 0.916633904f, 0.913812220f,
+    0.910947561f, 0.908040285f, 0.905090690f, 0.902098954f, 0.899065375f,
+    0.895990252f, 0.892873824f, 0.889716506f, 0.886518478f, 0.883279979f,
+    0.880001426f, 0.876683056f, 0.873325229f, 0.869928181f, 0.866492271f,
+    0.863017797f, 0.859504998f, 0.855954409f, 0.852366209f, 0.848740697f,
+    0.845078290f, 0.841379225f, 0.837643981f, 0.833872616f, 0.830065846f,
+    0.826223791f, 0.822346866f, 0.818435371f, 0.814489722f, 0.810510278f,
+    0.806497276f, 0.802451253f, 0.798372567f, 0.794261396f, 0.790118277f,
+    0.785943568f, 0.781737685f, 0.777500749f, 0.773233533f, 0.768936217f,
+    0.764609098f, 0.760252774f, 0.755867362f, 0.751453638f, 0.747011721f,
+    0.742541969f, 0.738044977f, 0.733521044f, 0.728970528f, 0.724394023f,
+    0.719791710f, 0.715164125f, 0.710511744f, 0.705834806f, 0.701133847f,
+    0.696409166f, 0.691661417f, 0.686890841f, 0.682097852f, 0.677282929f,
+    0.672446489f, 0.667589009f, 0.662710786f, 0.657812476f, 0.652894258f,
+    0.647956669f, 0.643000185f, 0.638025224f, 0.633032203f, 0.628021538f,
+    0.622993708f, 0.617949128f, 0.612888277f, 0.607811511f, 0.602719367f,
+    0.597612321f, 0.592490673f, 0.587354958f, 0.582205594f, 0.577043056f,
+    0.571867824f, 0.566680253f, 0.561480880f, 0.556270003f, 0.551048279f,
+    0.545816004f, 0.540573657f, 0.535321772f, 0.530060709f, 0.524790943f,
+    0.519512951f, 0.514227152f, 0.508933961f, 0.503633916f, 0.498327374f,
+    0.493014812f, 0.487696737f, 0.482373536f, 0.477045774f, 0.471713692f,
+    0.466377884f, 0.461038828f, 0.455696821f, 0.450352460f, 0.445006132f,
+    0.439658195f, 0.434309244f, 0.428959638f, 0.423609853f, 0.418260276f,
+    0.412911534f, 0.407563835f, 0.402217656f, 0.396873504f, 0.391531855f,
+    0.386193097f, 0.380857587f, 0.375525951f, 0.370198458f, 0.364875555f,
+    0.359557688f, 0.354245335f, 0.348938912f, 0.343638778f, 0.338345528f,
+    0.333059341f, 0.327780783f, 0.322510242f, 0.317248195f, 0.311994970f,
+    0.306751013f, 0.301516861f, 0.296292722f, 0.291079134f, 0.285876423f,
+    0.280685037f, 0.275505364f, 0.270337850f, 0.265182972f, 0.260040939f,
+    0.254912198f, 0.249797180f, 0.244696304f, 0.239609912f, 0.234538391f,
+    0.229482234f, 0.224441662f, 0.219417095f, 0.214408964f, 0.209417582f,
+    0.204443365f, 0.199486703f, 0.194547996f, 0.189627439f, 0.184725523f,
+    0.179842576f, 0.174978942f, 0.170135006f, 0.165311202f, 0.160507679f,
+    0.155724883f, 0.150963143f, 0.146222845f, 0.141504258f, 0.136807770f,
+    0.132133767f, 0.127482399f, 0.122854091f, 0.118249163f, 0.113667928f,
+    0.109110691f, 0.104577780f, 0.100069590f, 0.095586240f, 0.091128118f,
+    0.086695530f, 0.082288772f, 0.077908121f, 0.073553883f, 0.069226407f,
+    0.064925820f, 0.060652483f, 0.056406669f, 0.052188642f, 0.047998674f,
+    0.043837029f, 0.039704043f, 0.035599817f, 0.031524681f, 0.027478877f,
+    0.023462662f, 0.019476272f, 0.015519944f, 0.011593992f, 0.007698490f,
+    0.003833743f, -0.000000027f, -0.003802601f, -0.007573763f, -0.011313302f,
+    -0.015020939f, -0.018696615f, -0.022340054f, -0.025951067f, -0.029529458f,
+    -0.033075035f, -0.036587622f, -0.040066961f, -0.043513019f, -0.046925560f,
+    -0.050304405f, -0.053649396f, -0.056960363f, -0.060237158f, -0.063479565f,
+    -0.066687562f, -0.069860943f, -0.072999574f, -0.076103300f, -0.079172000f,
+    -0.082205541f, -0.085203744f, -0.088166609f, -0.091093957f, -0.093985677f,
+    -0.096841656f, -0.099661812f, -0.102446012f, -0.105194122f, -0.107906163f,
+    -0.110581994f, -0.113221519f, -0.115824677f, -0.118391365f, -0.120921537f,
+    -0.123415060f, -0.125872001f, -0.128292218f, -0.130675673f, -0.133022279f,
+    -0.135332033f, -0.137604848f, -0.139840752f, -0.142039672f, -0.144201577f,
+    -0.146326438f, -0.148414254f, -0.150464967f, -0.152478561f, -0.154455081f,
+    -0.156394482f, -0.158296764f, -0.160161942f, -0.161990017f, -0.163780957f,
+    -0.165534824f, -0.167251632f, -0.168931395f, -0.170574129f, -0.172179878f,
+    -0.173748642f, -0.175280511f, -0.176775455f, -0.178233579f, -0.179654926f,
+    -0.181039512f, -0.182387412f, -0.183698699f, -0.184973404f, -0.186211631f,
+    -0.187413439f, -0.188578904f, -0.189708084f, -0.190801084f, -0.191857979f,
+    -0.192878842f, -0.193863794f, -0.194812924f, -0.195726320f, -0.196604103f,
+    -0.197446316f, -0.198253170f, -0.199024752f, -0.199761122f, -0.200462461f,
+    -0.201128855f, -0.201760471f, -0.202357396f, -0.202919796f, -0.203447804f,
+    -0.203941524f, -0.204401180f, -0.204826832f, -0.205218658f, -0.205576837f,
+    -0.205901518f, -0.206192866f, -0.206451014f, -0.206676170f, -0.206868455f,
+    -0.207028076f, -0.207155198f, -0.207250014f, -0.207312688f, -0.207343414f,
+    -0.207342371f, -0.207309753f, -0.207245737f, -0.207150549f, -0.207024366f,
+    -0.206867412f, -0.206679851f, -0.206461906f, -0.206213832f, -0.205935776f,
+    -0.205627978f, -0.205290660f, -0.204924017f, -0.204528332f, -0.204103738f,
+    -0.203650534f, -0.203168958f, -0.202659175f, -0.202121451f, -0.201556027f,
+    -0.200963125f, -0.200343013f, -0.199695915f, -0.199022084f, -0.198321760f,
+    -0.197595179f, -0.196842626f, -0.196064308f, -0.195260540f, -0.194431514f,
+    -0.193577558f, -0.192698866f, -0.191795722f, -0.190868393f, -0.189917147f,
+    -0.188942268f, -0.187943980f, -0.186922595f, -0.185878381f, -0.184811577f,
+    -0.183722496f, -0.182611421f, -0.181478590f, -0.180324301f, -0.179148898f,
+    -0.177952558f, -0.176735580f, -0.175498307f, -0.174240977f, -0.172963902f,
+    -0.171667367f, -0.170351654f, -0.169017047f, -0.167663872f, -0.166292384f,
+    -0.164902866f, -0.163495675f, -0.162071034f, -0.160629347f, -0.159170762f,
+    -0.157695651f, -0.156204313f, -0.154697061f, -0.153174147f, -0.151635915f,
+    -0.150082648f, -0.148514658f, -0.146932214f, -0.145335674f, -0.143725291f,
+    -0.142101377f, -0.140464321f, -0.138814270f, -0.137151614f, -0.135476634f,
+    -0.133789673f, -0.132091001f, -0.130380914f, -0.128659740f, -0.126927778f,
+    -0.125185326f, -0.123432711f, -0.121670187f, -0.119898103f, -0.118116759f,
+    -0.116326511f, -0.114527516f, -0.112720162f, -0.110904753f, -0.109081589f,
+    -0.107250974f, -0.105413191f, -0.103568561f, -0.101717390f, -0.099859945f,
+    -0.097996563f, -0.096127525f, -0.094253130f, -0.092373684f, -0.090489529f,
+    -0.088600852f, -0.086707994f, -0.084811255f, -0.082910940f, -0.081007339f,
+    -0.079100728f, -0.077191412f, -0.075279690f, -0.073365822f, -0.071450122f,
+    -0.069532871f, -0.067614347f, -0.065694831f, -0.063774690f, -0.061854064f,
+    -0.059933290f, -0.058012661f, -0.056092449f, -0.054172933f, -0.052254390f,
+    -0.050337087f, -0.048421316f, -0.046507321f, -0.044595387f, -0.042685788f,
+    -0.040778778f, -0.038874637f, -0.036973685f, -0.035076044f, -0.033182051f,
+    -0.031291965f, -0.029406037f, -0.027524527f, -0.025647691f, -0.023775771f,
+    -0.021909028f, -0.020047706f, -0.018192045f, -0.016342297f, -0.014498703f,
+    -0.012661503f, -0.010831005f, -0.009007305f, -0.007190708f, -0.005381447f,
+    -0.003579753f, -0.001785853f, 0.000000025f, 0.001777659f, 0.003546824f,
+    0.005307303f, 0.007058876f, 0.008801329f, 0.010534447f, 0.012257953f,
+    0.013971773f, 0.015675632f, 0.017369326f, 0.019052655f, 0.020725416f,
+    0.022387415f, 0.024038453f, 0.025678340f, 0.027306890f, 0.028923905f,
+    0.030529210f, 0.032122612f, 0.033703946f, 0.035272952f, 0.036829598f,
+    0.038373638f, 0.039904900f, 0.041423220f, 0.042928439f, 0.044420380f,
+    0.045898896f, 0.047363818f, 0.048815005f, 0.050252289f, 0.051675532f,
+    0.053084578f, 0.054479290f, 0.055859461f, 0.057225078f, 0.058575936f,
+    0.059911899f, 0.061232850f, 0.062538646f, 0.063829169f, 0.065104291f,
+    0.066363901f, 0.067607865f, 0.068836078f, 0.070048422f, 0.071244806f,
+    0.072425105f, 0.073589161f, 0.074736983f, 0.075868428f, 0.076983377f,
+    0.078081757f, 0.079163469f, 0.080228433f, 0.081276558f, 0.082307756f,
+    0.083321966f, 0.084319085f, 0.085299060f, 0.086261809f, 0.087207265f,
+    0.088135332f, 0.089046016f, 0.089939222f, 0.090814888f, 0.091672964f,
+    0.092513390f, 0.093336128f, 0.094141126f, 0.094928324f, 0.095697716f,
+    0.096449248f, 0.097182862f, 0.097898550f, 0.098596275f, 0.099275976f,
+    0.099937700f, 0.100581378f, 0.101207010f, 0.101814561f, 0.102404028f,
+    0.102975391f, 0.103528641f, 0.104063794f, 0.104580805f, 0.105079710f,
+    0.105560489f, 0.106023155f, 0.106467694f, 0.106894165f, 0.107302547f,
+    0.107692853f, 0.108065099f, 0.108419321f, 0.108755529f, 0.109073736f,
+    0.109373994f, 0.109656326f, 0.109920748f, 0.110167295f, 0.110396028f,
+    0.110606961f, 0.110800155f, 0.110975638f, 0.111133471f, 0.111273691f,
+    0.111396372f, 0.111501530f, 0.111589260f, 0.111659586f, 0.111712590f,
+    0.111748330f, 0.111766860f, 0.111768253f, 0.111752607f, 0.111719951f,
+    0.111670382f, 0.111603968f, 0.111520782f, 0.111420922f, 0.111304462f,
+    0.111171462f, 0.111022055f, 0.110856302f, 0.110674299f, 0.110476129f,
+    0.110261902f, 0.110031694f, 0.109785616f, 0.109523796f, 0.109246291f,
+    0.108953230f, 0.108644702f, 0.108320832f, 0.107981719f, 0.107627481f,
+    0.107258216f, 0.106874064f, 0.106475137f, 0.106061548f, 0.105633393f,
+    0.105190828f, 0.104733966f, 0.104262926f, 0.103777833f, 0.103278831f,
+    0.102766037f, 0.102239579f, 0.101699598f, 0.101146221f, 0.100579590f,
+    0.099999845f, 0.099407114f, 0.098801538f, 0.098183267f, 0.097552441f,
+    0.096909195f, 0.096253686f, 0.095586054f, 0.094906449f, 0.094215013f,
+    0.093511887f, 0.092797257f, 0.092071250f, 0.091334015f, 0.090585768f,
+    0.089826554f, 0.089056589f, 0.088276029f, 0.087485023f, 0.086683728f,
+    0.085872330f, 0.085050955f, 0.084219798f, 0.083378993f, 0.082528725f,
+    0.081669137f, 0.080800407f, 0.079922713f, 0.079036199f, 0.078141034f,
+    0.077237405f, 0.076325446f, 0.075405367f, 0.074477300f, 0.073541448f,
+    0.072597958f, 0.071647011f, 0.070688769f, 0.069723420f, 0.068751119f,
+    0.067772053f, 0.066786453f, 0.065794356f, 0.064796016f, 0.063791588f,
+    0.062781259f, 0.061765205f, 0.060743578f, 0.059716582f, 0.058684383f,
+    0.057647143f, 0.056605048f, 0.055558272f, 0.054506999f, 0.053451385f,
+    0.052391611f, 0.051327862f, 0.050260305f, 0.049189117f, 0.048114471f,
+    0.047036547f, 0.045955513f, 0.044871543f, 0.043784816f, 0.042695500f,
+    0.041603781f, 0.040509813f, 0.039413787f, 0.038315866f, 0.037216306f,
+    0.036115117f, 0.035012547f, 0.033908777f, 0.032803964f, 0.031698290f,
+    0.030591924f, 0.029485023f, 0.028377770f, 0.027270328f, 0.026162861f,
+    0.025055537f, 0.023948526f, 0.022841990f, 0.021736100f, 0.020631012f,
+    0.019526891f, 0.018423904f, 0.017322211f, 0.016221970f, 0.015123345f,
+    0.014026497f, 0.012931579f, 0.011838755f, 0.010748178f, 0.009660005f,
+    0.008574393f, 0.007491491f, 0.006411542f, 0.005334528f, 0.004260683f,
+    0.003190160f, 0.002123106f, 0.001059669f, -0.000000002f, -0.001055763f,
+    -0.002107468f, -0.003154974f, -0.004198137f, -0.005236818f, -0.006270875f,
+    -0.007300170f, -0.008324563f, -0.009343920f, -0.010358104f, -0.011366983f,
+    -0.012370421f, -0.013368288f, -0.014360454f, -0.015346792f, -0.016327169f,
+    -0.017301464f, -0.018269548f, -0.019231303f, -0.020186603f, -0.021135252f,
+    -0.022077283f, -0.023012498f, -0.023940787f, -0.024862031f, -0.025776118f,
+    -0.026682934f, -0.027582372f, -0.028474322f, -0.029358674f, -0.030235322f,
+    -0.031104164f, -0.031965096f, -0.032818012f, -0.033662822f, -0.034499422f,
+    -0.035327714f, -0.036147602f, -0.036958996f, -0.037761800f, -0.038555928f,
+    -0.039341290f, -0.040117797f, -0.040885366f, -0.041643918f, -0.042393360f,
+    -0.043133613f, -0.043864604f, -0.044586197f, -0.045298435f, -0.046001177f,
+    -0.046694353f, -0.047377899f, -0.048051745f, -0.048715819f, -0.049370058f,
+    -0.050014395f, -0.050648771f, -0.051273130f, -0.051887408f, -0.052491549f,
+    -0.053085499f, -0.053669203f, -0.054242611f, -0.054805674f, -0.055358343f,
+    -0.055900563f, -0.056432303f, -0.056953508f, -0.057464149f, -0.057964176f,
+    -0.058453556f, -0.058932252f, -0.059400227f, -0.059857450f, -0.060303900f,
+    -0.060739491f, -0.061164290f, -0.061578218f, -0.061981257f, -0.062373381f,
+    -0.062754579f, -0.063124821f, -0.063484102f, -0.063832395f, -0.064169690f,
+    -0.064495981f, -0.064811245f, -0.065115489f, -0.065408692f, -0.065690853f,
+    -0.065961972f, -0.066222042f, -0.066471063f, -0.066709049f, -0.066935986f,
+    -0.067151889f, -0.067356758f, -0.067550600f, -0.067733429f, -0.067905247f,
+    -0.068066090f, -0.068215951f, -0.068354838f, -0.068482801f, -0.068599835f,
+    -0.068705969f, -0.068801232f, -0.068885624f, -0.068959191f, -0.069021955f,
+    -0.069073945f, -0.069115192f, -0.069145724f, -0.069165580f, -0.069174781f,
+    -0.069173373f, -0.069161393f, -0.069138885f, -0.069105878f, -0.069062427f,
+    -0.069008566f, -0.068944335f, -0.068869792f, -0.068784982f, -0.068689942f,
+    -0.068584740f, -0.068469420f, -0.068344034f, -0.068208627f, -0.068063267f,
+    -0.067908026f, -0.067742929f, -0.067568056f, -0.067383453f, -0.067189202f,
+    -0.066985346f, -0.066771962f, -0.066549115f, -0.066316880f, -0.066075303f,
+    -0.065824457f, -0.065564431f, -0.065295294f, -0.065017104f, -0.064729936f,
+    -0.064433880f, -0.064128995f, -0.063815370f, -0.063493080f, -0.063162208f,
+    -0.062822819f, -0.062475007f, -0.062118854f, -0.061754443f, -0.061381850f,
+    -0.061001170f, -0.060612489f, -0.060215883f, -0.059811484f, -0.059399307f,
+    -0.058979485f, -0.058552101f, -0.058117244f, -0.057675011f, -0.057225488f,
+    -0.056768786f, -0.056304976f, -0.055834170f, -0.055356454f, -0.054871935f,
+    -0.054380700f, -0.053882848f, -0.053378489f, -0.052867707f, -0.052350614f,
+    -0.051827300f, -0.051297884f, -0.050762445f, -0.050221100f, -0.049673948f,
+    -0.049121093f, -0.048562635f, -0.047998682f, -0.047429338f, -0.046854712f,
+    -0.046274949f, -0.045690063f, -0.045100220f, -0.044505514f, -0.043906055f,
+    -0.043301951f, -0.042693306f, -0.042080238f, -0.041462850f, -0.040841255f,
+    -0.040215552f, -0.039585862f, -0.038952287f, -0.038314942f, -0.037673932f,
+    -0.037029371f, -0.036381371f, -0.035730038f, -0.035075482f, -0.034417819f,
+    -0.033757161f, -0.033093613f, -0.032427285f, -0.031758294f, -0.031086754f,
+    -0.030412765f, -0.029736446f, -0.029057909f, -0.028377309f, -0.027694661f,
+    -0.027010128f, -0.026323816f, -0.025635839f, -0.024946308f, -0.024255326f,
+    -0.023563014f, -0.022869479f, -0.022174826f, -0.021479171f, -0.020782620f,
+    -0.020085283f, -0.019387269f, -0.018688688f, -0.017989647f, -0.017290251f,
+    -0.016590618f, -0.015890848f, -0.015191048f, -0.014491325f, -0.013791787f,
+    -0.013092542f, -0.012393693f, -0.011695345f, -0.010997606f, -0.010300575f,
+    -0.009604361f, -0.008909118f, -0.008214843f, -0.007521693f, -0.006829769f,
+    -0.006139171f, -0.005450003f, -0.004762362f, -0.004076350f, -0.003392065f,
+    -0.002709607f, -0.002029072f, -0.001350558f, -0.000674162f, 0.000000019f,
+    0.000671891f, 0.001341360f, 0.002008329f, 0.002672708f, 0.003334403f,
+    0.003993322f, 0.004649374f, 0.005302468f, 0.005952515f, 0.006599426f,
+    0.007243113f, 0.007883489f, 0.008520467f, 0.009153911f, 0.009783836f,
+    0.010410110f, 0.011032647f, 0.011651366f, 0.012266185f, 0.012877025f,
+    0.013483805f, 0.014086444f, 0.014684866f, 0.015278997f, 0.015868755f,
+    0.016454069f, 0.017034864f, 0.017611062f, 0.018182600f, 0.018749397f,
+    0.019311389f, 0.019868501f, 0.020420671f, 0.020967828f, 0.021509901f,
+    0.022046832f, 0.022578552f, 0.023105001f, 0.023626113f, 0.024141828f,
+    0.024652084f, 0.025156781f, 0.025655944f, 0.026149478f, 0.026637319f,
+    0.027119415f, 0.027595714f, 0.028066160f, 0.028530706f, 0.028989293f,
+    0.029441874f, 0.029888406f, 0.030328831f, 0.030763116f, 0.031191200f,
+    0.031613048f, 0.032028619f, 0.032437868f, 0.032840747f, 0.033237223f,
+    0.033627260f, 0.034010809f, 0.034387846f, 0.034758322f, 0.035122219f,
+    0.035479490f, 0.035830110f, 0.036174044f, 0.036511265f, 0.036841720f,
+    0.037165426f, 0.037482340f, 0.037792426f, 0.038095672f, 0.038392045f,
+    0.038681529f, 0.038964096f, 0.039239731f, 0.039508417f, 0.039770138f,
+    0.040024865f, 0.040272597f, 0.040513311f, 0.040747002f, 0.040973652f,
+    0.041193251f, 0.041405790f, 0.041611262f, 0.041809656f, 0.042000968f,
+    0.042185195f, 0.042362332f, 0.042532373f, 0.042695317f, 0.042851161f,
+    0.042999912f, 0.043141551f, 0.043276109f, 0.043403585f, 0.043523964f,
+    0.043637272f, 0.043743506f, 0.043842670f, 0.043934785f, 0.044019844f,
+    0.044097871f, 0.044168878f, 0.044232871f, 0.044289872f, 0.044339888f,
+    0.044382937f, 0.044419035f, 0.044448208f, 0.044470467f, 0.044485837f,
+    0.044494331f, 0.044495981f, 0.044490803f, 0.044478822f, 0.044460073f,
+    0.044434570f, 0.044402342f, 0.044363413f, 0.044317819f, 0.044265591f,
+    0.044206757f, 0.044141348f, 0.044069394f, 0.043990932f, 0.043905992f,
+    0.043814611f, 0.043716829f, 0.043612674f, 0.043502189f, 0.043385409f,
+    0.043262389f, 0.043133140f, 0.042997729f, 0.042856187f, 0.042708557f,
+    0.042554878f, 0.042395204f, 0.042229578f, 0.042058039f, 0.041880637f,
+    0.041697416f, 0.041508436f, 0.041313726f, 0.041113351f, 0.040907357f,
+    0.040695790f, 0.040478706f, 0.040256176f, 0.040028207f, 0.039794888f,
+    0.039556261f, 0.039312385f, 0.039063312f, 0.038809095f, 0.038549796f,
+    0.038285475f, 0.038016181f, 0.037741978f, 0.037462916f, 0.037179071f,
+    0.036890488f, 0.036597233f, 0.036299370f, 0.035996955f, 0.035690054f,
+    0.035378728f, 0.035063036f, 0.034743045f, 0.034418821f, 0.034090422f,
+    0.033757918f, 0.033421371f, 0.033080846f, 0.032736413f, 0.032388162f,
+    0.032036103f, 0.031680334f, 0.031320930f, 0.030957945f, 0.030591447f,
+    0.030221513f, 0.029848207f, 0.029471597f, 0.029091755f, 0.028708749f,
+    0.028322648f, 0.027933523f, 0.027541440f, 0.027146477f, 0.026748700f,
+    0.026348175f, 0.025944982f, 0.025539186f, 0.025130859f, 0.024720075f,
+    0.024306905f, 0.023891417f, 0.023473684f, 0.023053778f, 0.022631776f,
+    0.022207744f, 0.021781757f, 0.021353915f, 0.020924233f, 0.020492809f,
+    0.020059718f, 0.019625034f, 0.019188823f, 0.018751165f, 0.018312128f,
+    0.017871786f, 0.017430205f, 0.016987467f, 0.016543636f, 0.016098788f,
+    0.015652994f, 0.015206325f, 0.014758852f, 0.014310651f, 0.013861788f,
+    0.013412337f, 0.012962367f, 0.012511953f, 0.012061161f, 0.011610066f,
+    0.011158734f, 0.010707238f, 0.010255646f, 0.009804031f, 0.009352461f,
+    0.008901038f, 0.008449764f, 0.007998743f, 0.007548041f, 0.007097727f,
+    0.006647871f, 0.006198538f, 0.005749797f, 0.005301713f, 0.004854355f,
+    0.004407788f, 0.003962079f, 0.003517292f, 0.003073494f, 0.002630749f,
+    0.002189121f, 0.001748675f, 0.001309474f, 0.000871583f, 0.000435062f,
+    -0.000000024f, -0.000433614f, -0.000865646f, -0.001296060f, -0.001724794f,
+    -0.002151788f, -0.002576983f, -0.003000286f, -0.003421706f, -0.003841148f,
+    -0.004258558f, -0.004673876f, -0.005087048f, -0.005498015f, -0.005906723f,
+    -0.006313117f, -0.006717141f, -0.007118742f, -0.007517866f, -0.007914460f,
+    -0.008308473f, -0.008699851f, -0.009088545f, -0.009474502f, -0.009857644f,
+    -0.010237982f, -0.010615435f, -0.010989957f, -0.011361498f, -0.011730013f,
+    -0.012095454f, -0.012457778f, -0.012816937f, -0.013172888f, -0.013525588f,
+    -0.013874991f, -0.014221057f, -0.014563744f, -0.014903012f, -0.015238819f,
+    -0.015571123f, -0.015899887f, -0.016225075f, -0.016546646f, -0.016864562f,
+    -0.017178789f, -0.017489292f, -0.017796034f, -0.018098982f, -0.018398102f,
+    -0.018693361f, -0.018984728f, -0.019272169f, -0.019555653f, -0.019835154f,
+    -0.020110639f, -0.020382080f, -0.020649452f, -0.020912724f, -0.021171870f,
+    -0.021426866f, -0.021677691f, -0.021924313f, -0.022166712f, -0.022404864f,
+    -0.022638749f, -0.022868345f, -0.023093631f, -0.023314591f, -0.023531197f,
+    -0.023743438f, -0.023951292f, -0.024154749f, -0.024353785f, -0.024548389f,
+    -0.024738546f, -0.024924241f, -0.025105428f, -0.025282159f, -0.025454396f,
+    -0.025622118f, -0.025785325f, -0.025944000f, -0.026098138f, -0.026247725f,
+    -0.026392762f, -0.026533239f, -0.026669146f, -0.026800487f, -0.026927244f,
+    -0.027049430f, -0.027167032f, -0.027280046f, -0.027388476f, -0.027492320f,
+    -0.027591577f, -0.027686248f, -0.027776331f, -0.027861834f, -0.027942756f,
+    -0.028019102f, -0.028090870f, -0.028158078f, -0.028220719f, -0.028278803f,
+    -0.028332340f, -0.028381336f, -0.028425798f, -0.028465735f, -0.028501157f,
+    -0.028532075f, -0.028558498f, -0.028580440f, -0.028597912f, -0.028610926f,
+    -0.028619494f, -0.028623639f, -0.028623367f, -0.028618693f, -0.028609639f,
+    -0.028596215f, -0.028578443f, -0.028556343f, -0.028529925f, -0.028499220f,
+    -0.028464235f, -0.028425002f, -0.028381534f, -0.028333852f, -0.028281985f,
+    -0.028225951f, -0.028165773f, -0.028101480f, -0.028033089f, -0.027960628f,
+    -0.027884120f, -0.027803596f, -0.027719077f, -0.027630594f, -0.027538173f,
+    -0.027441842f, -0.027341630f, -0.027237568f, -0.027129682f, -0.027018003f,
+    -0.026902562f, -0.026783388f, -0.026660517f, -0.026533980f, -0.026403809f,
+    -0.026270032f, -0.026132686f, -0.025991809f, -0.025847428f, -0.025699578f,
+    -0.025548300f, -0.025393624f, -0.025235590f, -0.025074232f, -0.024909584f,
+    -0.024741689f, -0.024570579f, -0.024396295f, -0.024218870f, -0.024038350f,
+    -0.023854772f, -0.023668168f, -0.023478586f, -0.023286059f, -0.023090634f,
+    -0.022892347f, -0.022691242f, -0.022487354f, -0.022280728f, -0.022071410f,
+    -0.021859432f, -0.021644844f, -0.021427685f, -0.021208001f, -0.020985832f,
+    -0.020761218f, -0.020534210f, -0.020304846f, -0.020073172f, -0.019839229f,
+    -0.019603064f, -0.019364722f, -0.019124281f, -0.018881714f, -0.018637104f,
+    -0.018390497f, -0.018141935f, -0.017891463f, -0.017639128f, -0.017384978f,
+    -0.017129054f, -0.016871406f, -0.016612077f, -0.016351115f, -0.016088564f,
+    -0.015824471f, -0.015558884f, -0.015291848f, -0.015023410f, -0.014753615f,
+    -0.014482512f, -0.014210144f, -0.013936562f, -0.013661810f, -0.013385935f,
+    -0.013108983f, -0.012831002f, -0.012552038f, -0.012272138f, -0.011991347f,
+    -0.011709714f, -0.011427285f, -0.011144105f, -0.010860223f, -0.010575684f,
+    -0.010290532f, -0.010004818f, -0.009718585f, -0.009431880f, -0.009144749f,
+    -0.008857237f, -0.008569391f, -0.008281258f, -0.007992882f, -0.007704308f,
+    -0.007415582f, -0.007126749f, -0.006837855f, -0.006548944f, -0.006260061f,
+    -0.005971250f, -0.005682557f, -0.005394025f, -0.005105698f, -0.004817621f,
+    -0.004529837f, -0.004242389f, -0.003955321f, -0.003668720f, -0.003382541f,
+    -0.003096870f, -0.002811750f, -0.002527223f, -0.002243332f, -0.001960116f,
+    -0.001677619f, -0.001395880f, -0.001114942f, -0.000834845f, -0.000555628f,
+    -0.000277333f, 0.000000001f, 0.000276335f, 0.000551629f, 0.000825845f,
+    0.001098943f, 0.001370886f, 0.001641636f, 0.001911155f, 0.002179405f,
+    0.002446350f, 0.002711953f, 0.002976178f, 0.003238989f, 0.003500349f,
+    0.003760225f, 0.004018580f, 0.004275381f, 0.004530593f, 0.004784183f,
+    0.005036117f, 0.005286361f, 0.005534884f, 0.005781651f, 0.006026634f,
+    0.006269800f, 0.006511116f, 0.006750553f, 0.006988081f, 0.007223670f,
+    0.007457289f, 0.007688910f, 0.007918504f, 0.008146044f, 0.008371500f,
+    0.008594846f, 0.008816056f, 0.009035101f, 0.009251957f, 0.009466597f,
+    0.009678996f, 0.009889129f, 0.010096974f, 0.010302469f, 0.010505662f,
+    0.010706494f, 0.010904944f, 0.011100988f, 0.011294606f, 0.011485776f,
+    0.011674478f, 0.011860691f, 0.012044393f, 0.012225569f, 0.012404198f,
+    0.012580262f, 0.012753741f, 0.012924620f, 0.013092882f, 0.013258509f,
+    0.013421485f, 0.013581796f, 0.013739425f, 0.013894356f, 0.014046579f,
+    0.014196080f, 0.014342840f, 0.014486852f, 0.014628102f, 0.014766577f,
+    0.014902269f, 0.015035161f, 0.015165250f, 0.015292520f, 0.015416965f,
+    0.015538574f, 0.015657341f, 0.015773255f, 0.015886312f, 0.015996501f,
+    0.016103819f, 0.016208258f, 0.016309813f, 0.016408477f, 0.016504247f,
+    0.016597118f, 0.016687088f, 0.016774150f, 0.016858306f, 0.016939549f,
+    0.017017880f, 0.017093297f, 0.017165799f, 0.017235385f, 0.017302055f,
+    0.017365810f, 0.017426651f, 0.017484576f, 0.017539581f, 0.017591687f,
+    0.017640885f, 0.017687181f, 0.017730575f, 0.017771075f, 0.017808679f,
+    0.017843401f, 0.017875239f, 0.017904202f, 0.017930293f, 0.017953524f,
+    0.017973896f, 0.017991418f, 0.018006098f, 0.018017948f, 0.018026972f,
+    0.018033182f, 0.018036585f, 0.018037193f, 0.018035013f, 0.018030059f,
+    0.018022344f, 0.018011874f, 0.017998664f, 0.017982721f, 0.017964065f,
+    0.017942708f, 0.017918659f, 0.017891936f, 0.017862549f, 0.017830517f,
+    0.017795850f, 0.017758567f, 0.017718680f, 0.017676208f, 0.017631169f,
+    0.017583575f, 0.017533444f, 0.017480794f, 0.017425643f, 0.017368007f,
+    0.017307907f, 0.017245360f, 0.017180385f, 0.017113000f, 0.017043227f,
+    0.016971083f, 0.016896592f, 0.016819771f, 0.016740641f, 0.016659221f,
+    0.016575536f, 0.016489606f, 0.016401453f, 0.016311098f, 0.016218577f,
+    0.016123887f, 0.016027065f, 0.015928131f, 0.015827110f, 0.015724026f,
+    0.015618900f, 0.015511760f, 0.015402627f, 0.015291529f, 0.015178486f,
+    0.015063525f, 0.014946674f, 0.014827953f, 0.014707390f, 0.014585013f,
+    0.014460843f, 0.014334910f, 0.014207238f, 0.014077856f, 0.013946787f,
+    0.013814061f, 0.013679703f, 0.013543740f, 0.013406200f, 0.013267109f,
+    0.013126497f, 0.012984390f, 0.012840815f, 0.012695801f, 0.012549377f,
+    0.012401571f, 0.012252407f, 0.012101918f, 0.011950131f, 0.011797072f,
+    0.011642775f, 0.011487265f, 0.011330571f, 0.011172722f, 0.011013748f,
+    0.010853678f, 0.010692539f, 0.010530363f, 0.010367176f, 0.010203009f,
+    0.010037893f, 0.009871855f, 0.009704924f, 0.009537132f, 0.009368504f,
+    0.009199074f, 0.009028869f, 0.008857920f, 0.008686254f, 0.008513927f,
+    0.008340918f, 0.008167283f, 0.007993049f, 0.007818247f, 0.007642907f,
+    0.007467056f, 0.007290725f, 0.007113943f, 0.006936739f, 0.006759143f,
+    0.006581183f, 0.006402888f, 0.006224289f, 0.006045414f, 0.005866290f,
+    0.005686948f, 0.005507417f, 0.005327724f, 0.005147900f, 0.004967971f,
+    0.004787966f, 0.004607914f, 0.004427844f, 0.004247782f, 0.004067758f,
+    0.003887799f, 0.003707933f, 0.003528187f, 0.003348590f, 0.003169168f,
+    0.002989949f, 0.002810960f, 0.002632228f, 0.002453780f, 0.002275642f,
+    0.002097841f, 0.001920404f, 0.001743357f, 0.001566726f, 0.001390536f,
+    0.001214814f, 0.001039586f, 0.000864876f, 0.000690710f, 0.000517112f,
+    0.000344109f, 0.000171724f, -0.000000019f, -0.000171093f, -0.000341477f,
+    -0.000511146f, -0.000680075f, -0.000848242f, -0.001015624f, -0.001182170f,
+    -0.001347912f, -0.001512799f, -0.001676809f, -0.001839921f, -0.002002112f,
+    -0.002163361f, -0.002323645f, -0.002482945f, -0.002641238f, -0.002798504f,
+    -0.002954723f, -0.003109874f, -0.003263937f, -0.003416892f, -0.003568720f,
+    -0.003719401f, -0.003868917f, -0.004017248f, -0.004164377f, -0.004310285f,
+    -0.004454953f, -0.004598364f, -0.004740501f, -0.004881346f, -0.005020883f,
+    -0.005159095f, -0.005295965f, -0.005431477f, -0.005565616f, -0.005698365f,
+    -0.005829710f, -0.005959635f, -0.006088126f, -0.006215169f, -0.006340750f,
+    -0.006464853f, -0.006587466f, -0.006708575f, -0.006828170f, -0.006946234f,
+    -0.007062756f, -0.007177724f, -0.007291127f, -0.007402952f, -0.007513190f,
+    -0.007621828f, -0.007728854f, -0.007834261f, -0.007938039f, -0.008040175f,
+    -0.008140660f, -0.008239487f, -0.008336646f, -0.008432129f, -0.008525928f,
+    -0.008618017f, -0.008708420f, -0.008797117f, -0.008884098f, -0.008969357f,
+    -0.009052888f, -0.009134685f, -0.009214740f, -0.009293050f, -0.009369609f,
+    -0.009444410f, -0.009517451f, -0.009588725f, -0.009658230f, -0.009725960f,
+    -0.009791914f, -0.009856086f, -0.009918478f, -0.009979081f, -0.010037895f,
+    -0.010094919f, -0.010150152f, -0.010203590f, -0.010255233f, -0.010305080f,
+    -0.010353129f, -0.010399382f, -0.010443839f, -0.010486498f, -0.010527359f,
+    -0.010566426f, -0.010603699f, -0.010639177f, -0.010672864f, -0.010704760f,
+    -0.010734869f, -0.010763194f, -0.010789735f, -0.010814497f, -0.010837482f,
+    -0.010858694f, -0.010878138f, -0.010895818f, -0.010911735f, -0.010925896f,
+    -0.010938308f, -0.010948971f, -0.010957894f, -0.010965082f, -0.010970540f,
+    -0.010974275f, -0.010976292f, -0.010976600f, -0.010975204f, -0.010972111f,
+    -0.010967327f, -0.010960863f, -0.010952724f, -0.010942921f, -0.010931458f,
+    -0.010918348f, -0.010903596f, -0.010887212f, -0.010869207f, -0.010849587f,
+    -0.010828365f, -0.010805548f, -0.010781148f, -0.010755174f, -0.010727636f,
+    -0.010698548f, -0.010667915f, -0.010635754f, -0.010602073f, -0.010566882f,
+    -0.010530196f, -0.010492026f, -0.010452382f, -0.010411278f, -0.010368726f,
+    -0.010324739f, -0.010279329f, -0.010232509f, -0.010184291f, -0.010134690f,
+    -0.010083719f, -0.010031392f, -0.009977720f, -0.009922719f, -0.009866404f,
+    -0.009808788f, -0.009749884f, -0.009689709f, -0.009628276f, -0.009565600f,
+    -0.009501696f, -0.009436579f, -0.009370266f, -0.009302769f, -0.009234104f,
+    -0.009164288f, -0.009093336f, -0.009021265f, -0.008948088f, -0.008873824f,
+    -0.008798487f, -0.008722093f, -0.008644662f, -0.008566204f, -0.008486741f,
+    -0.008406298f, -0.008324873f, -0.008242489f, -0.008159165f, -0.008074918f,
+    -0.007989765f, -0.007903723f, -0.007816809f, -0.007729040f, -0.007640434f,
+    -0.007551008f, -0.007460779f, -0.007369766f, -0.007277984f, -0.007185451f,
+    -0.007092186f, -0.006998207f, -0.006903530f, -0.006808174f, -0.006712155f,
+    -0.006615493f, -0.006518204f, -0.006420308f, -0.006321820f, -0.006222761f,
+    -0.006123146f, -0.006022995f, -0.005922325f, -0.005821154f, -0.005719500f,
+    -0.005617381f, -0.005514814f, -0.005411819f, -0.005308412f, -0.005204613f,
+    -0.005100438f, -0.004995906f, -0.004891034f, -0.004785841f, -0.004680343f,
+    -0.004574560f, -0.004468509f, -0.004362206f, -0.004255672f, -0.004148922f,
+    -0.004041974f, -0.003934848f, -0.003827558f, -0.003720125f, -0.003612563f,
+    -0.003504893f, -0.003397129f, -0.003289291f, -0.003181394f, -0.003073457f,
+    -0.002965496f, -0.002857545f, -0.002749588f, -0.002641659f, -0.002533773f,
+    -0.002425948f, -0.002318201f, -0.002210548f, -0.002103006f, -0.001995591f,
+    -0.001888319f, -0.001781207f, -0.001674271f, -0.001567527f, -0.001460991f,
+    -0.001354678f, -0.001248605f, -0.001142787f, -0.001037240f, -0.000931978f,
+    -0.000827019f, -0.000722375f, -0.000618064f, -0.000514099f, -0.000410496f,
+    -0.000307270f, -0.000204434f, -0.000102004f, 0.000000006f, 0.000101582f,
+    0.000202709f, 0.000303375f, 0.000403564f, 0.000503263f, 0.000602459f,
+    0.000701138f, 0.000799287f, 0.000896892f, 0.000993941f, 0.001090421f,
+    0.001186318f, 0.001281621f, 0.001376316f, 0.001470392f, 0.001563837f,
+    0.001656637f, 0.001748782f, 0.001840261f, 0.001931060f, 0.002021169f,
+    0.002110577f, 0.002199272f, 0.002287244f, 0.002374482f, 0.002460976f,
+    0.002546714f, 0.002631673f, 0.002715870f, 0.002799282f, 0.002881900f,
+    0.002963712f, 0.003044710f, 0.003124884f, 0.003204226f, 0.003282727f,
+    0.003360378f, 0.003437170f, 0.003513095f, 0.003588144f, 0.003662310f,
+    0.003735584f, 0.003807960f, 0.003879429f, 0.003949984f, 0.004019619f,
+    0.004088324f, 0.004156095f, 0.004222926f, 0.004288808f, 0.004353735f,
+    0.004417702f, 0.004480703f, 0.004542732f, 0.004603783f, 0.004663852f,
+    0.004722932f, 0.004781018f, 0.004838107f, 0.004894193f, 0.004949272f,
+    0.005003339f, 0.005056390f, 0.005108422f, 0.005159431f, 0.005209411f,
+    0.005258362f, 0.005306279f, 0.005353160f, 0.005399000f, 0.005443799f,
+    0.005487552f, 0.005530258f, 0.005571915f, 0.005612521f, 0.005652073f,
+    0.005690570f, 0.005728011f, 0.005764395f, 0.005799720f, 0.005833984f,
+    0.005867189f, 0.005899332f, 0.005930408f, 0.005960427f, 0.005989386f,
+    0.006017282f, 0.006044118f, 0.006069891f, 0.006094605f, 0.006118258f,
+    0.006140852f, 0.006162389f, 0.006182869f, 0.006202294f, 0.006220666f,
+    0.006237985f, 0.006254255f, 0.006269476f, 0.006283652f, 0.006296784f,
+    0.006308876f, 0.006319929f, 0.006329947f, 0.006338932f, 0.006346888f,
+    0.006353819f, 0.006359726f, 0.006364615f, 0.006368489f, 0.006371350f,
+    0.006373206f, 0.006374056f, 0.006373909f, 0.006372768f, 0.006370635f,
+    0.006367519f, 0.006363422f, 0.006358348f, 0.006352305f, 0.006345297f,
+    0.006337330f, 0.006328408f, 0.006318538f, 0.006307725f, 0.006295976f,
+    0.006283296f, 0.006269691f, 0.006255167f, 0.006239732f, 0.006223391f,
+    0.006206152f, 0.006188020f, 0.006169002f, 0.006149107f, 0.006128340f,
+    0.006106709f, 0.006084220f, 0.006060885f, 0.006036706f, 0.006011692f,
+    0.005985851f, 0.005959191f, 0.005931721f, 0.005903447f, 0.005874378f,
+    0.005844521f, 0.005813887f, 0.005782482f, 0.005750315f, 0.005717394f,
+    0.005683729f, 0.005649327f, 0.005614198f, 0.005578350f, 0.005541793f,
+    0.005504535f, 0.005466585f, 0.005427952f, 0.005388646f, 0.005348676f,
+    0.005308050f, 0.005266780f, 0.005224873f, 0.005182338f, 0.005139188f,
+    0.005095431f, 0.005051075f, 0.005006130f, 0.004960609f, 0.004914518f,
+    0.004867869f, 0.004820670f, 0.004772934f, 0.004724668f, 0.004675884f,
+    0.004626591f, 0.004576799f, 0.004526519f, 0.004475761f, 0.004424535f,
+    0.004372850f, 0.004320718f, 0.004268149f, 0.004215153f, 0.004161740f,
+    0.004107921f, 0.004053706f, 0.003999105f, 0.003944129f, 0.003888789f,
+    0.003833093f, 0.003777055f, 0.003720690f, 0.003663995f, 0.003606986f,
+    0.003549677f, 0.003492075f, 0.003434192f, 0.003376038f, 0.003317624f,
+    0.003258960f, 0.003200057f, 0.003140924f, 0.003081573f, 0.003022014f,
+    0.002962257f, 0.002902312f, 0.002842191f, 0.002781903f, 0.002721458f,
+    0.002660867f, 0.002600140f, 0.002539288f, 0.002478319f, 0.002417247f,
+    0.002356078f, 0.002294826f, 0.002233498f, 0.002172105f, 0.002110658f,
+    0.002049165f, 0.001987638f, 0.001926086f, 0.001864520f, 0.001802947f,
+    0.001741380f, 0.001679827f, 0.001618297f, 0.001556802f, 0.001495350f,
+    0.001433950f, 0.001372613f, 0.001311348f, 0.001250163f, 0.001189069f,
+    0.001128075f, 0.001067190f, 0.001006422f, 0.000945782f, 0.000885278f,
+    0.000824919f, 0.000764714f, 0.000704672f, 0.000644802f, 0.000585112f,
+    0.000525611f, 0.000466307f, 0.000407209f, 0.000348335f, 0.000289675f,
+    0.000231245f, 0.000173055f, 0.000115112f, 0.000057424f, -0.000000000f,
+    -0.000057154f, -0.000114028f, -0.000170615f, -0.000226908f, -0.000282900f,
+    -0.000338582f, -0.000393947f, -0.000448988f, -0.000503698f, -0.000558069f,
+    -0.000612095f, -0.000665769f, -0.000719083f, -0.000772031f, -0.000824607f,
+    -0.000876803f, -0.000928614f, -0.000980032f, -0.001031052f, -0.001081667f,
+    -0.001131871f, -0.001181658f, -0.001231023f, -0.001279958f, -0.001328460f,
+    -0.001376521f, -0.001424137f, -0.001471301f, -0.001518009f, -0.001564256f,
+    -0.001610035f, -0.001655343f, -0.001700174f, -0.001744523f, -0.001788385f,
+    -0.001831757f, -0.001874632f, -0.001917008f, -0.001958879f, -0.002000241f,
+    -0.002041091f, -0.002081423f, -0.002121234f, -0.002160521f, -0.002199279f,
+    -0.002237506f, -0.002275196f, -0.002312347f, -0.002348949f, -0.002385013f,
+    -0.002420527f, -0.002455490f, -0.002489898f, -0.002523748f, -0.002557038f,
+    -0.002589765f, -0.002621927f, -0.002653521f, -0.002684545f, -0.002714997f,
+    -0.002744875f, -0.002774175f, -0.002802898f, -0.002831041f, -0.002858602f,
+    -0.002885580f, -0.002911973f, -0.002937779f, -0.002962999f, -0.002987630f,
+    -0.003011670f, -0.003035120f, -0.003057980f, -0.003080246f, -0.003101919f,
+    -0.003122999f, -0.003143484f, -0.003163375f, -0.003182672f, -0.003201373f,
+    -0.003219480f, -0.003236991f, -0.003253907f, -0.003270229f, -0.003285956f,
+    -0.003301089f, -0.003315629f, -0.003329575f, -0.003342929f, -0.003355692f,
+    -0.003367863f, -0.003379445f, -0.003390438f, -0.003400844f, -0.003410663f,
+    -0.003419896f, -0.003428547f, -0.003436614f, -0.003444101f, -0.003451009f,
+    -0.003457339f, -0.003463094f, -0.003468275f, -0.003472883f, -0.003476923f,
+    -0.003480396f, -0.003483303f, -0.003485647f, -0.003487431f, -0.003488657f,
+    -0.003489327f, -0.003489445f, -0.003489012f, -0.003488032f, -0.003486507f,
+    -0.003484441f, -0.003481836f, -0.003478695f, -0.003475023f, -0.003470820f,
+    -0.003466092f, -0.003460841f, -0.003455071f, -0.003448786f, -0.003441988f,
+    -0.003434682f, -0.003426871f, -0.003418559f, -0.003409750f, -0.003400447f,
+    -0.003390655f, -0.003380377f, -0.003369618f, -0.003358382f, -0.003346672f,
+    -0.003334494f, -0.003321851f, -0.003308747f, -0.003295188f, -0.003281177f,
+    -0.003266719f, -0.003251819f, -0.003236481f, -0.003220710f, -0.003204509f,
+    -0.003187885f, -0.003170842f, -0.003153385f, -0.003135519f, -0.003117248f,
+    -0.003098577f, -0.003079512f, -0.003060057f, -0.003040218f, -0.003019999f,
+    -0.002999406f, -0.002978445f, -0.002957119f, -0.002935434f, -0.002913399f,
+    -0.002891013f, -0.002868284f, -0.002845219f, -0.002821821f, -0.002798096f,
+    -0.002774050f, -0.002749689f, -0.002725018f, -0.002700042f, -0.002674766f,
+    -0.002649197f, -0.002623340f, -0.002597201f, -0.002570785f, -0.002544097f,
+    -0.002517145f, -0.002489932f, -0.002462465f, -0.002434749f, -0.002406791f,
+    -0.002378595f, -0.002350169f, -0.002321516f, -0.002292643f, -0.002263557f,
+    -0.002234261f, -0.002204764f, -0.002175069f, -0.002145183f, -0.002115112f,
+    -0.002084860f, -0.002054435f, -0.002023842f, -0.001993086f, -0.001962174f,
+    -0.001931111f, -0.001899903f, -0.001868555f, -0.001837074f, -0.001805464f,
+    -0.001773733f, -0.001741885f, -0.001709926f, -0.001677862f, -0.001645699f,
+    -0.001613442f, -0.001581096f, -0.001548669f, -0.001516164f, -0.001483589f,
+    -0.001450947f, -0.001418246f, -0.001385490f, -0.001352685f, -0.001319841f,
+    -0.001286954f, -0.001254035f, -0.001221089f, -0.001188122f, -0.001155138f,
+    -0.001122143f, -0.001089142f, -0.001056142f, -0.001023146f, -0.000990161f,
+    -0.000957192f, -0.000924243f, -0.000891321f, -0.000858429f, -0.000825574f,
+    -0.000792760f, -0.000759993f, -0.000727277f, -0.000694617f, -0.000662019f,
+    -0.000629487f, -0.000597026f, -0.000564641f, -0.000532337f, -0.000500119f,
+    -0.000467991f, -0.000435957f, -0.000404024f, -0.000372195f, -0.000340474f,
+    -0.000308867f, -0.000277378f, -0.000246011f, -0.000214771f, -0.000183662f,
+    -0.000152688f, -0.000121854f, -0.000091163f, -0.000060621f, -0.000030231f,
+    0.000000003f, 0.000030077f, 0.000059986f, 0.000089728f, 0.000119297f,
+    0.000148690f, 0.000177903f, 0.000206933f, 0.000235775f, 0.000264427f,
+    0.000292884f, 0.000321143f, 0.000349201f, 0.000377054f, 0.000404694f,
+    0.000432126f, 0.000459344f, 0.000486343f, 0.000513121f, 0.000539674f,
+    0.000565999f, 0.000592094f, 0.000617955f, 0.000643580f, 0.000668965f,
+    0.000694108f, 0.000719006f, 0.000743656f, 0.000768055f, 0.000792202f,
+    0.000816093f, 0.000839726f, 0.000863098f, 0.000886208f, 0.000909052f,
+    0.000931629f, 0.000953937f, 0.000975972f, 0.000997734f, 0.001019220f,
+    0.001040428f, 0.001061356f, 0.001082002f, 0.001102365f, 0.001122442f,
+    0.001142233f, 0.001161734f, 0.001180946f, 0.001199862f, 0.001218489f,
+    0.001236820f, 0.001254856f, 0.001272594f, 0.001290034f, 0.001307174f,
+    0.001324012f, 0.001340549f, 0.001356783f, 0.001372712f, 0.001388336f,
+    0.001403655f, 0.001418666f, 0.001433370f, 0.001447766f, 0.001461853f,
+    0.001475631f, 0.001489098f, 0.001502255f, 0.001515101f, 0.001527636f,
+    0.001539859f, 0.001551770f, 0.001563368f, 0.001574655f, 0.001585628f,
+    0.001596290f, 0.001606639f, 0.001616675f, 0.001626399f, 0.001635810f,
+    0.001644909f, 0.001653696f, 0.001662172f, 0.001670336f, 0.001678190f,
+    0.001685732f, 0.001692965f, 0.001699888f, 0.001706503f, 0.001712809f,
+    0.001718807f, 0.001724499f, 0.001729884f, 0.001734964f, 0.001739740f,
+    0.001744212f, 0.001748381f, 0.001752248f, 0.001755815f, 0.001759083f,
+    0.001762052f, 0.001764724f, 0.001767099f, 0.001769180f, 0.001770967f,
+    0.001772463f, 0.001773667f, 0.001774582f, 0.001775209f, 0.001775549f,
+    0.001775605f, 0.001775377f, 0.001774867f, 0.001774078f, 0.001773010f,
+    0.001771665f, 0.001770045f, 0.001768152f, 0.001765987f, 0.001763554f,
+    0.001760852f, 0.001757885f, 0.001754654f, 0.001751162f, 0.001747409f,
+    0.001743399f, 0.001739134f, 0.001734615f, 0.001729845f, 0.001724825f,
+    0.001719559f, 0.001714048f, 0.001708294f, 0.001702301f, 0.001696070f,
+    0.001689603f, 0.001682903f, 0.001675972f, 0.001668813f, 0.001661428f,
+    0.001653820f, 0.001645991f, 0.001637944f, 0.001629680f, 0.001621204f,
+    0.001612516f, 0.001603621f, 0.001594520f, 0.001585216f, 0.001575712f,
+    0.001566010f, 0.001556114f, 0.001546025f, 0.001535749f, 0.001525285f,
+    0.001514636f, 0.001503806f, 0.001492798f, 0.001481614f, 0.001470258f,
+    0.001458731f, 0.001447038f, 0.001435180f, 0.001423161f, 0.001410983f,
+    0.001398650f, 0.001386164f, 0.001373528f, 0.001360745f, 0.001347817f,
+    0.001334749f, 0.001321543f, 0.001308202f, 0.001294728f, 0.001281125f,
+    0.001267395f, 0.001253542f, 0.001239568f, 0.001225477f, 0.001211271f,
+    0.001196954f, 0.001182528f, 0.001167996f, 0.001153362f, 0.001138628f,
+    0.001123797f, 0.001108873f, 0.001093857f, 0.001078754f, 0.001063566f,
+    0.001048296f, 0.001032947f, 0.001017522f, 0.001002024f, 0.000986456f,
+    0.000970820f, 0.000955121f, 0.000939360f, 0.000923540f, 0.000907666f,
+    0.000891738f, 0.000875761f, 0.000859738f, 0.000843670f, 0.000827561f,
+    0.000811414f, 0.000795232f, 0.000779017f, 0.000762773f, 0.000746502f,
+    0.000730207f, 0.000713891f, 0.000697556f, 0.000681206f, 0.000664842f,
+    0.000648469f, 0.000632088f, 0.000615703f, 0.000599315f, 0.000582928f,
+    0.000566545f, 0.000550167f, 0.000533798f, 0.000517441f, 0.000501097f,
+    0.000484770f, 0.000468462f, 0.000452175f, 0.000435913f, 0.000419677f,
+    0.000403470f, 0.000387295f, 0.000371154f, 0.000355049f, 0.000338983f,
+    0.000322959f, 0.000306978f, 0.000291043f, 0.000275157f, 0.000259321f,
+    0.000243539f, 0.000227811f, 0.000212141f, 0.000196531f, 0.000180982f,
+    0.000165498f, 0.000150080f, 0.000134730f, 0.000119451f, 0.000104244f,
+    0.000089112f, 0.000074056f, 0.000059079f, 0.000044183f, 0.000029369f,
+    0.000014640f, -0.000000003f, -0.000014558f, -0.000029022f, -0.000043395f,
+    -0.000057673f, -0.000071856f, -0.000085942f, -0.000099924f, -0.000113810f,
+    -0.000127594f, -0.000141273f, -0.000154847f, -0.000168314f, -0.000181672f,
+    -0.000194919f, -0.000208055f, -0.000221077f, -0.000233984f, -0.000246775f,
+    -0.000259449f, -0.000272003f, -0.000284438f, -0.000296750f, -0.000308940f,
+    -0.000321005f, -0.000332945f, -0.000344759f, -0.000356444f, -0.000368001f,
+    -0.000379428f, -0.000390723f, -0.000401886f, -0.000412916f, -0.000423812f,
+    -0.000434573f, -0.000445197f, -0.000455684f, -0.000466033f, -0.000476244f,
+    -0.000486315f, -0.000496245f, -0.000506034f, -0.000515682f, -0.000525186f,
+    -0.000534547f, -0.000543764f, -0.000552836f, -0.000561763f, -0.000570544f,
+    -0.000579179f, -0.000587667f, -0.000596007f, -0.000604199f, -0.000612243f,
+    -0.000620138f, -0.000627884f, -0.000635480f, -0.000642927f, -0.000650223f,
+    -0.000657369f, -0.000664365f, -0.000671209f, -0.000677902f, -0.000684444f,
+    -0.000690835f, -0.000697074f, -0.000703161f, -0.000709097f, -0.000714881f,
+    -0.000720513f, -0.000725993f, -0.000731322f, -0.000736499f, -0.000741524f,
+    -0.000746398f, -0.000751121f, -0.000755692f, -0.000760113f, -0.000764383f,
+    -0.000768502f, -0.000772471f, -0.000776290f, -0.000779959f, -0.000783479f,
+    -0.000786850f, -0.000790072f, -0.000793146f, -0.000796072f, -0.000798851f,
+    -0.000801482f, -0.000803968f, -0.000806307f, -0.000808501f, -0.000810550f,
+    -0.000812455f, -0.000814216f, -0.000815834f, -0.000817310f, -0.000818643f,
+    -0.000819836f, -0.000820888f, -0.000821800f, -0.000822574f, -0.000823209f,
+    -0.000823706f, -0.000824067f, -0.000824292f, -0.000824382f, -0.000824337f,
+    -0.000824159f, -0.000823849f, -0.000823407f, -0.000822834f, -0.000822131f,
+    -0.000821300f, -0.000820340f, -0.000819254f, -0.000818041f, -0.000816703f,
+    -0.000815242f, -0.000813658f, -0.000811952f, -0.000810125f, -0.000808178f,
+    -0.000806112f, -0.000803929f, -0.000801630f, -0.000799215f, -0.000796686f,
+    -0.000794044f, -0.000791290f, -0.000788425f, -0.000785451f, -0.000782368f,
+    -0.000779178f, -0.000775883f, -0.000772482f, -0.000768978f, -0.000765372f,
+    -0.000761665f, -0.000757858f, -0.000753953f, -0.000749950f, -0.000745852f,
+    -0.000741659f, -0.000737372f, -0.000732994f, -0.000728525f, -0.000723967f,
+    -0.000719321f, -0.000714588f, -0.000709770f, -0.000704868f, -0.000699884f,
+    -0.000694818f, -0.000689672f, -0.000684448f, -0.000679146f, -0.000673769f,
+    -0.000668318f, -0.000662794f, -0.000657198f, -0.000651531f, -0.000645797f,
+    -0.000639994f, -0.000634126f, -0.000628193f, -0.000622197f, -0.000616140f,
+    -0.000610021f, -0.000603845f, -0.000597610f, -0.000591319f, -0.000584974f,
+    -0.000578575f, -0.000572125f, -0.000565624f, -0.000559074f, -0.000552477f,
+    -0.000545833f, -0.000539144f, -0.000532412f, -0.000525639f, -0.000518824f,
+    -0.000511970f, -0.000505079f, -0.000498151f, -0.000491188f, -0.000484192f,
+    -0.000477163f, -0.000470103f, -0.000463014f, -0.000455897f, -0.000448754f,
+    -0.000441585f, -0.000434392f, -0.000427176f, -0.000419939f, -0.000412682f,
+    -0.000405407f, -0.000398114f, -0.000390806f, -0.000383483f, -0.000376146f,
+    -0.000368798f, -0.000361439f, -0.000354071f, -0.000346695f, -0.000339312f,
+    -0.000331923f, -0.000324531f, -0.000317135f, -0.000309738f, -0.000302340f,
+    -0.000294943f, -0.000287548f, -0.000280156f, -0.000272769f, -0.000265388f,
+    -0.000258013f, -0.000250647f, -0.000243289f, -0.000235942f, -0.000228607f,
+    -0.000221284f, -0.000213975f, -0.000206682f, -0.000199404f, -0.000192143f,
+    -0.000184903f, -0.000177680f, -0.000170478f, -0.000163297f, -0.000156139f,
+    -0.000149004f, -0.000141895f, -0.000134810f, -0.000127753f, -0.000120723f,
+    -0.000113722f, -0.000106751f, -0.000099810f, -0.000092901f, -0.000086025f,
+    -0.000079182f, -0.000072373f, -0.000065600f, -0.000058863f, -0.000052163f,
+    -0.000045501f, -0.000038877f, -0.000032294f, -0.000025751f, -0.000019249f,
+    -0.000012790f, -0.000006373f, 0.000000000f, 0.000006329f, 0.000012612f,
+    0.000018849f, 0.000025040f, 0.000031183f, 0.000037278f, 0.000043324f,
+    0.000049320f, 0.000055267f, 0.000061163f, 0.000067007f, 0.000072799f,
+    0.000078538f, 0.000084224f, 0.000089856f, 0.000095434f, 0.000100957f,
+    0.000106424f, 0.000111835f, 0.000117189f, 0.000122486f, 0.000127725f,
+    0.000132907f, 0.000138030f, 0.000143093f, 0.000148097f, 0.000153042f,
+    0.000157926f, 0.000162749f, 0.000167511f, 0.000172212f, 0.000176851f,
+    0.000181427f, 0.000185941f, 0.000190392f, 0.000194780f, 0.000199105f,
+    0.000203365f, 0.000207562f, 0.000211694f, 0.000215762f, 0.000219765f,
+    0.000223704f, 0.000227576f, 0.000231384f, 0.000235126f, 0.000238802f,
+    0.000242412f, 0.000245957f, 0.000249435f, 0.000252847f, 0.000256192f,
+    0.000259471f, 0.000262683f, 0.000265829f, 0.000268908f, 0.000271920f,
+    0.000274866f, 0.000277744f, 0.000280556f, 0.000283301f, 0.000285979f,
+    0.000288590f, 0.000291135f, 0.000293613f, 0.000296024f, 0.000298369f,
+    0.000300647f, 0.000302859f, 0.000305004f, 0.000307083f, 0.000309096f,
+    0.000311043f, 0.000312925f, 0.000314740f, 0.000316491f, 0.000318176f,
+    0.000319795f, 0.000321350f, 0.000322840f, 0.000324266f, 0.000325627f,
+    0.000326924f, 0.000328157f, 0.000329327f, 0.000330433f, 0.000331477f,
+    0.000332458f, 0.000333376f, 0.000334232f, 0.000335026f, 0.000335759f,
+    0.000336431f, 0.000337041f, 0.000337591f, 0.000338081f, 0.000338511f,
+    0.000338881f, 0.000339193f, 0.000339445f, 0.000339640f, 0.000339776f,
+    0.000339855f, 0.000339876f, 0.000339841f, 0.000339750f, 0.000339602f,
+    0.000339399f, 0.000339142f, 0.000338829f, 0.000338463f, 0.000338042f,
+    0.000337569f, 0.000337043f, 0.000336465f, 0.000335835f, 0.000335154f,
+    0.000334421f, 0.000333639f, 0.000332807f, 0.000331926f, 0.000330996f,
+    0.000330018f, 0.000328992f, 0.000327919f, 0.000326799f, 0.000325633f,
+    0.000324422f, 0.000323165f, 0.000321864f, 0.000320520f, 0.000319132f,
+    0.000317701f, 0.000316228f, 0.000314713f, 0.000313158f, 0.000311561f,
+    0.000309925f, 0.000308250f, 0.000306535f, 0.000304783f, 0.000302993f,
+    0.000301166f, 0.000299302f, 0.000297403f, 0.000295469f, 0.000293500f,
+    0.000291496f, 0.000289460f, 0.000287390f, 0.000285289f, 0.000283156f,
+    0.000280991f, 0.000278797f, 0.000276572f, 0.000274319f, 0.000272036f,
+    0.000269726f, 0.000267389f, 0.000265024f, 0.000262634f, 0.000260218f,
+    0.000257777f, 0.000255312f, 0.000252823f, 0.000250310f, 0.000247776f,
+    0.000245220f, 0.000242642f, 0.000240043f, 0.000237425f, 0.000234787f,
+    0.000232130f, 0.000229455f, 0.000226763f, 0.000224053f, 0.000221327f,
+    0.000218585f, 0.000215828f, 0.000213056f, 0.000210270f, 0.000207470f,
+    0.000204658f, 0.000201833f, 0.000198996f, 0.000196149f, 0.000193291f,
+    0.000190422f, 0.000187545f, 0.000184658f, 0.000181764f, 0.000178861f,
+    0.000175952f, 0.000173036f, 0.000170114f, 0.000167186f, 0.000164253f,
+    0.000161316f, 0.000158375f, 0.000155431f, 0.000152484f, 0.000149535f,
+    0.000146584f, 0.000143631f, 0.000140679f, 0.000137725f, 0.000134773f,
+    0.000131821f, 0.000128870f, 0.000125922f, 0.000122976f, 0.000120032f,
+    0.000117092f, 0.000114156f, 0.000111224f, 0.000108297f, 0.000105376f,
+    0.000102459f, 0.000099550f, 0.000096646f, 0.000093750f, 0.000090862f,
+    0.000087981f, 0.000085109f, 0.000082246f, 0.000079391f, 0.000076547f,
+    0.000073713f, 0.000070889f, 0.000068077f, 0.000065275f, 0.000062486f,
+    0.000059708f, 0.000056943f, 0.000054191f, 0.000051452f, 0.000048727f,
+    0.000046016f, 0.000043320f, 0.000040638f, 0.000037971f, 0.000035319f,
+    0.000032684f, 0.000030064f, 0.000027461f, 0.000024875f, 0.000022305f,
+    0.000019753f, 0.000017219f, 0.000014703f, 0.000012205f, 0.000009726f,
+    0.000007265f, 0.000004824f, 0.000002402f, -0.000000000f, -0.000002383f,
+    -0.000004745f, -0.000007086f, -0.000009407f, -0.000011708f, -0.000013986f,
+    -0.000016244f, -0.000018480f, -0.000020694f, -0.000022886f, -0.000025056f,
+    -0.000027203f, -0.000029328f, -0.000031430f, -0.000033509f, -0.000035565f,
+    -0.000037597f, -0.000039606f, -0.000041592f, -0.000043553f, -0.000045491f,
+    -0.000047404f, -0.000049293f, -0.000051158f, -0.000052998f, -0.000054814f,
+    -0.000056604f, -0.000058370f, -0.000060111f, -0.000061827f, -0.000063518f,
+    -0.000065183f, -0.000066824f, -0.000068438f, -0.000070027f, -0.000071591f,
+    -0.000073129f, -0.000074642f, -0.000076128f, -0.000077589f, -0.000079024f,
+    -0.000080433f, -0.000081817f, -0.000083174f, -0.000084506f, -0.000085811f,
+    -0.000087091f, -0.000088344f, -0.000089571f, -0.000090773f, -0.000091948f,
+    -0.000093098f, -0.000094222f, -0.000095319f, -0.000096391f, -0.000097437f,
+    -0.000098457f, -0.000099452f, -0.000100420f, -0.000101363f, -0.000102280f,
+    -0.000103171f, -0.000104037f, -0.000104878f, -0.000105693f, -0.000106483f,
+    -0.000107247f, -0.000107986f, -0.000108700f, -0.000109390f, -0.000110054f,
+    -0.000110693f, -0.000111308f, -0.000111897f, -0.000112463f, -0.000113004f,
+    -0.000113520f, -0.000114013f, -0.000114481f, -0.000114926f, -0.000115346f,
+    -0.000115743f, -0.000116117f, -0.000116467f, -0.000116793f, -0.000117097f,
+    -0.000117377f, -0.000117635f, -0.000117870f, -0.000118082f, -0.000118272f,
+    -0.000118440f, -0.000118586f, -0.000118710f, -0.000118812f, -0.000118893f,
+    -0.000118952f, -0.000118990f, -0.000119007f, -0.000119003f, -0.000118979f,
+    -0.000118934f, -0.000118868f, -0.000118783f, -0.000118678f, -0.000118553f,
+    -0.000118408f, -0.000118244f, -0.000118061f, -0.000117860f, -0.000117639f,
+    -0.000117400f, -0.000117142f, -0.000116867f, -0.000116574f, -0.000116262f,
+    -0.000115934f, -0.000115588f, -0.000115225f, -0.000114846f, -0.000114449f,
+    -0.000114037f, -0.000113608f, -0.000113163f, -0.000112703f, -0.000112227f,
+    -0.000111736f, -0.000111229f, -0.000110708f, -0.000110172f, -0.000109622f,
+    -0.000109058f, -0.000108480f, -0.000107888f, -0.000107283f, -0.000106665f,
+    -0.000106033f, -0.000105389f, -0.000104732f, -0.000104063f, -0.000103382f,
+    -0.000102689f, -0.000101985f, -0.000101269f, -0.000100542f, -0.000099804f,
+    -0.000099055f, -0.000098296f, -0.000097527f, -0.000096748f, -0.000095959f,
+    -0.000095161f, -0.000094353f, -0.000093536f, -0.000092711f, -0.000091877f,
+    -0.000091034f, -0.000090184f, -0.000089325f, -0.000088459f, -0.000087586f,
+    -0.000086705f, -0.000085817f, -0.000084923f, -0.000084022f, -0.000083115f,
+    -0.000082201f, -0.000081282f, -0.000080357f, -0.000079427f, -0.000078491f,
+    -0.000077551f, -0.000076606f, -0.000075656f, -0.000074702f, -0.000073744f,
+    -0.000072782f, -0.000071816f, -0.000070847f, -0.000069875f, -0.000068899f,
+    -0.000067921f, -0.000066940f, -0.000065957f, -0.000064971f, -0.000063984f,
+    -0.000062994f, -0.000062003f, -0.000061011f, -0.000060017f, -0.000059022f,
+    -0.000058027f, -0.000057031f, -0.000056034f, -0.000055037f, -0.000054040f,
+    -0.000053043f, -0.000052046f, -0.000051050f, -0.000050055f, -0.000049060f,
+    -0.000048066f, -0.000047074f, -0.000046082f, -0.000045093f, -0.000044105f,
+    -0.000043119f, -0.000042135f, -0.000041153f, -0.000040173f, -0.000039196f,
+    -0.000038221f, -0.000037250f, -0.000036281f, -0.000035315f, -0.000034353f,
+    -0.000033394f, -0.000032439f, -0.000031487f, -0.000030540f, -0.000029596f,
+    -0.000028656f, -0.000027721f, -0.000026790f, -0.000025863f, -0.000024941f,
+    -0.000024024f, -0.000023112f, -0.000022205f, -0.000021303f, -0.000020406f,
+    -0.000019515f, -0.000018629f, -0.000017749f, -0.000016874f, -0.000016005f,
+    -0.000015142f, -0.000014286f, -0.000013435f, -0.000012591f, -0.000011752f,
+    -0.000010921f, -0.000010096f, -0.000009277f, -0.000008465f, -0.000007660f,
+    -0.000006862f, -0.000006071f, -0.000005286f, -0.000004509f, -0.000003739f,
+    -0.000002977f, -0.000002221f, -0.000001473f, -0.000000733f, 0.000000000f,
+    0.000000726f, 0.000001443f, 0.000002153f, 0.000002856f, 0.000003550f,
+    0.000004236f, 0.000004915f, 0.000005586f, 0.000006248f, 0.000006903f,
+    0.000007549f, 0.000008188f, 0.000008818f, 0.000009439f, 0.000010053f,
+    0.000010658f, 0.000011255f, 0.000011844f, 0.000012424f, 0.000012996f,
+    0.000013559f, 0.000014114f, 0.000014661f, 0.000015199f, 0.000015728f,
+    0.000016249f, 0.000016762f, 0.000017266f, 0.000017761f, 0.000018248f,
+    0.000018726f, 0.000019196f, 0.000019657f, 0.000020109f, 0.000020553f,
+    0.000020988f, 0.000021415f, 0.000021834f, 0.000022243f, 0.000022645f,
+    0.000023037f, 0.000023421f, 0.000023797f, 0.000024164f, 0.000024523f,
+    0.000024873f, 0.000025215f, 0.000025549f, 0.000025874f, 0.000026190f,
+    0.000026499f, 0.000026799f, 0.000027091f, 0.000027374f, 0.000027650f,
+    0.000027917f, 0.000028176f, 0.000028427f, 0.000028670f, 0.000028905f,
+    0.000029132f, 0.000029351f, 0.000029562f, 0.000029765f, 0.000029960f,
+    0.000030148f, 0.000030328f, 0.000030500f, 0.000030665f, 0.000030822f,
+    0.000030971f, 0.000031113f, 0.000031248f, 0.000031375f, 0.000031495f,
+    0.000031607f, 0.000031713f, 0.000031811f, 0.000031902f, 0.000031986f,
+    0.000032063f, 0.000032133f, 0.000032197f, 0.000032253f, 0.000032303f,
+    0.000032346f, 0.000032383f, 0.000032413f, 0.000032436f, 0.000032453f,
+    0.000032464f, 0.000032469f, 0.000032467f, 0.000032459f, 0.000032445f,
+    0.000032425f, 0.000032399f, 0.000032368f, 0.000032330f, 0.000032287f,
+    0.000032238f, 0.000032184f, 0.000032124f, 0.000032059f, 0.000031988f,
+    0.000031912f, 0.000031831f, 0.000031744f, 0.000031653f, 0.000031557f,
+    0.000031455f, 0.000031349f, 0.000031238f, 0.000031123f, 0.000031002f,
+    0.000030878f, 0.000030749f, 0.000030615f, 0.000030477f, 0.000030335f,
+    0.000030189f, 0.000030038f, 0.000029884f, 0.000029726f, 0.000029564f,
+    0.000029398f, 0.000029228f, 0.000029055f, 0.000028878f, 0.000028698f,
+    0.000028514f, 0.000028327f, 0.000028137f, 0.000027944f, 0.000027747f,
+    0.000027548f, 0.000027346f, 0.000027140f, 0.000026932f, 0.000026721f,
+    0.000026508f, 0.000026292f, 0.000026074f, 0.000025853f, 0.000025629f,
+    0.000025404f, 0.000025176f, 0.000024946f, 0.000024714f, 0.000024480f,
+    0.000024245f, 0.000024007f, 0.000023767f, 0.000023526f, 0.000023283f,
+    0.000023039f, 0.000022793f, 0.000022546f, 0.000022297f, 0.000022047f,
+    0.000021796f, 0.000021544f, 0.000021290f, 0.000021036f, 0.000020780f,
+    0.000020524f, 0.000020267f, 0.000020009f, 0.000019750f, 0.000019490f,
+    0.000019231f, 0.000018970f, 0.000018709f, 0.000018448f, 0.000018186f,
+    0.000017924f, 0.000017662f, 0.000017399f, 0.000017137f, 0.000016874f,
+    0.000016611f, 0.000016349f, 0.000016086f, 0.000015824f, 0.000015562f,
+    0.000015300f, 0.000015039f, 0.000014777f, 0.000014517f, 0.000014256f,
+    0.000013997f, 0.000013737f, 0.000013479f, 0.000013221f, 0.000012964f,
+    0.000012707f, 0.000012451f, 0.000012196f, 0.000011942f, 0.000011689f,
+    0.000011437f, 0.000011186f, 0.000010936f, 0.000010687f, 0.000010439f,
+    0.000010193f, 0.000009947f, 0.000009703f, 0.000009460f, 0.000009218f,
+    0.000008978f, 0.000008739f, 0.000008502f, 0.000008266f, 0.000008031f,
+    0.000007798f, 0.000007567f, 0.000007337f, 0.000007109f, 0.000006882f,
+    0.000006657f, 0.000006434f, 0.000006212f, 0.000005992f, 0.000005774f,
+    0.000005558f, 0.000005344f, 0.000005131f, 0.000004920f, 0.000004712f,
+    0.000004505f, 0.000004300f, 0.000004097f, 0.000003895f, 0.000003696f,
+    0.000003499f, 0.000003304f, 0.000003111f, 0.000002920f, 0.000002731f,
+    0.000002544f, 0.000002360f, 0.000002177f, 0.000001997f, 0.000001818f,
+    0.000001642f, 0.000001468f, 0.000001296f, 0.000001126f, 0.000000959f,
+    0.000000793f, 0.000000630f, 0.000000469f, 0.000000311f, 0.000000154f,
+    -0.000000000f, -0.000000152f, -0.000000302f, -0.000000449f, -0.000000595f,
+    -0.000000738f, -0.000000878f, -0.000001017f, -0.000001153f, -0.000001287f,
+    -0.000001419f, -0.000001549f, -0.000001676f, -0.000001801f, -0.000001924f,
+    -0.000002044f, -0.000002163f, -0.000002279f, -0.000002393f, -0.000002504f,
+    -0.000002614f, -0.000002721f, -0.000002826f, -0.000002929f, -0.000003029f,
+    -0.000003128f, -0.000003224f, -0.000003318f, -0.000003410f, -0.000003499f,
+    -0.000003587f, -0.000003672f, -0.000003755f, -0.000003837f, -0.000003916f,
+    -0.000003993f, -0.000004067f, -0.000004140f, -0.000004211f, -0.000004280f,
+    -0.000004346f, -0.000004411f, -0.000004473f, -0.000004534f, -0.000004593f,
+    -0.000004649f, -0.000004704f, -0.000004757f, -0.000004808f, -0.000004857f,
+    -0.000004904f, -0.000004949f, -0.000004992f, -0.000005033f, -0.000005073f,
+    -0.000005111f, -0.000005147f, -0.000005181f, -0.000005214f, -0.000005244f,
+    -0.000005273f, -0.000005301f, -0.000005326f, -0.000005350f, -0.000005373f,
+    -0.000005393f, -0.000005413f, -0.000005430f, -0.000005446f, -0.000005460f,
+    -0.000005473f, -0.000005484f, -0.000005494f, -0.000005503f, -0.000005510f,
+    -0.000005515f, -0.000005519f, -0.000005522f, -0.000005523f, -0.000005523f,
+    -0.000005521f, -0.000005519f, -0.000005515f, -0.000005509f, -0.000005503f,
+    -0.000005495f, -0.000005486f, -0.000005476f, -0.000005465f, -0.000005452f,
+    -0.000005438f, -0.000005424f, -0.000005408f, -0.000005391f, -0.000005373f,
+    -0.000005354f, -0.000005334f, -0.000005313f, -0.000005291f, -0.000005268f,
+    -0.000005245f, -0.000005220f, -0.000005195f, -0.000005168f, -0.000005141f,
+    -0.000005113f, -0.000005084f, -0.000005054f, -0.000005024f, -0.000004993f,
+    -0.000004961f, -0.000004928f, -0.000004895f, -0.000004861f, -0.000004827f,
+    -0.000004791f, -0.000004756f, -0.000004719f, -0.000004682f, -0.000004645f,
+    -0.000004607f, -0.000004569f, -0.000004530f, -0.000004490f, -0.000004450f,
+    -0.000004410f, -0.000004369f, -0.000004328f, -0.000004286f, -0.000004245f,
+    -0.000004202f, -0.000004160f, -0.000004117f, -0.000004074f, -0.000004030f,
+    -0.000003987f, -0.000003943f, -0.000003898f, -0.000003854f, -0.000003809f,
+    -0.000003765f, -0.000003720f, -0.000003675f, -0.000003629f, -0.000003584f,
+    -0.000003539f, -0.000003493f, -0.000003447f, -0.000003402f, -0.000003356f,
+    -0.000003310f, -0.000003264f, -0.000003219f, -0.000003173f, -0.000003127f,
+    -0.000003081f, -0.000003036f, -0.000002990f, -0.000002945f, -0.000002899f,
+    -0.000002854f, -0.000002808f, -0.000002763f, -0.000002718f, -0.000002673f,
+    -0.000002629f, -0.000002584f, -0.000002540f, -0.000002495f, -0.000002451f,
+    -0.000002408f, -0.000002364f, -0.000002321f, -0.000002277f, -0.000002234f,
+    -0.000002192f, -0.000002149f, -0.000002107f, -0.000002065f, -0.000002024f,
+    -0.000001982f, -0.000001941f, -0.000001901f, -0.000001860f, -0.000001820f,
+    -0.000001780f, -0.000001741f, -0.000001702f, -0.000001663f, -0.000001625f,
+    -0.000001587f, -0.000001549f, -0.000001512f, -0.000001475f, -0.000001438f,
+    -0.000001402f, -0.000001366f, -0.000001331f, -0.000001296f, -0.000001261f,
+    -0.000001227f, -0.000001193f, -0.000001160f, -0.000001127f, -0.000001094f,
+    -0.000001062f, -0.000001031f, -0.000000999f, -0.000000968f, -0.000000938f,
+    -0.000000908f, -0.000000878f, -0.000000849f, -0.000000821f, -0.000000792f,
+    -0.000000765f, -0.000000737f, -0.000000710f, -0.000000684f, -0.000000658f,
+    -0.000000632f, -0.000000607f, -0.000000582f, -0.000000558f, -0.000000534f,
+    -0.000000511f, -0.000000488f, -0.000000465f, -0.000000443f, -0.000000422f,
+    -0.000000401f, -0.000000380f, -0.000000360f, -0.000000340f, -0.000000320f,
+    -0.000000302f, -0.000000283f, -0.000000265f, -0.000000247f, -0.000000230f,
+    -0.000000213f, -0.000000197f, -0.000000181f, -0.000000165f, -0.000000150f,
+    -0.000000135f, -0.000000121f, -0.000000107f, -0.000000094f, -0.000000081f,
+    -0.000000068f, -0.000000056f, -0.000000044f, -0.000000032f, -0.000000021f,
+    -0.000000010f, 0.000000000f
+};
+
+static const float ResamplerFilterHQDifference[RESAMPLER_HQ_FILTER_SIZE] = {
+    -0.000025094f, -0.000075638f, -0.000126541f, -0.000177443f, -0.000228226f,
+    -0.000279129f, -0.000329971f, -0.000380754f, -0.000431418f, -0.000482202f,
+    -0.000532806f, -0.000583470f, -0.000633955f, -0.000684500f, -0.000735044f,
+    -0.000785291f, -0.000835538f, -0.000885844f, -0.000935972f, -0.000985980f,
+    -0.001036048f, -0.001085818f, -0.001135528f, -0.001185238f, -0.001234829f,
+    -0.001284182f, -0.001333475f, -0.001382768f, -0.001431644f, -0.001480699f,
+    -0.001529455f, -0.001578093f, -0.001626611f, -0.001674950f, -0.001723170f,
+    -0.001771152f, -0.001818955f, -0.001866817f, -0.001914203f, -0.001961529f,
+    -0.002008796f, -0.002055645f, -0.002102554f, -0.002149105f, -0.002195418f,
+    -0.002241731f, -0.002287686f, -0.002333283f, -0.002379060f, -0.002424181f,
+    -0.002469480f, -0.002514362f, -0.002558887f, -0.002603292f, -0.002647519f,
+    -0.002691448f, -0.002735138f, -0.002778530f, -0.002821684f, -0.002864659f,
+    -0.002907276f, -0.002949595f, -0.002991736f, -0.003033578f, -0.003075123f,
+    -0.003116429f, -0.003157318f, -0.003198028f, -0.003238499f, -0.003278553f,
+    -0.003318369f, -0.003357828f, -0.003397048f, -0.003435910f, -0.003474474f,
+    -0.003512800f, -0.003550589f, -0.003588200f, -0.003625512f, -0.003662407f,
+    -0.003699064f, -0.003735244f, -0.003771365f, -0.003806770f, -0.003842056f,
+    -0.003876925f, -0.003911495f, -0.003945649f, -0.003979445f, -0.004013002f,
+    -0.004046023f, -0.004078686f, -0.004111171f, -0.004143119f, -0.004174709f,
+    -0.004205883f, -0.004236937f, -0.004267216f, -0.004297316f, -0.004327118f,
+    -0.004356325f, -0.004385412f, -0.004413724f, -0.004441917f, -0.004469752f,
+    -0.004496992f, -0.004523933f, -0.004550517f, -0.004576504f, -0.004602313f,
+    -0.004627585f, -0.004652381f, -0.004676938f, -0.004700959f, -0.004724681f,
+    -0.004747748f, -0.004770577f, -0.004792988f, -0.004814923f, -0.004836440f,
+    -0.004857481f, -0.004878223f, -0.004898310f, -0.004918218f, -0.004937589f,
+    -0.004956484f, -0.004974961f, -0.004993021f, -0.005010664f, -0.005027831f,
+    -0.005044580f, -0.005060852f, -0.005076766f, -0.005092144f, -0.005107045f,
+    -0.005121648f, -0.005135715f, -0.005149364f, -0.005162537f, -0.005175233f,
+    -0.005187571f, -0.005199373f, -0.005210876f, -0.005221725f, -0.005232275f,
+    -0.005242348f, -0.005251884f, -0.005261064f, -0.005269766f, -0.005277991f,
+    -0.005285800f, -0.005293190f, -0.005300045f, -0.005306542f, -0.005312562f,
+    -0.005318075f, -0.005323201f, -0.005327761f, -0.005332083f, -0.005335808f,
+    -0.005339056f, -0.005342007f, -0.005344361f, -0.005346328f, -0.005347937f,
+    -0.005348951f, -0.005349606f, -0.005349785f, -0.005349576f, -0.005348742f,
+    -0.005347699f, -0.005346179f, -0.005344152f, -0.005341649f, -0.005338758f,
+    -0.005335510f, -0.005331635f, -0.005327493f, -0.005322903f, -0.005317867f,
+    -0.005312353f, -0.005306423f, -0.005300134f, -0.005293250f, -0.005286187f,
+    -0.005278558f, -0.005270541f, -0.005262047f, -0.005253226f, -0.005243957f,
+    -0.005234152f, -0.005224138f, -0.005213588f, -0.005202711f, -0.005191386f,
+    -0.005179673f, -0.005167514f, -0.005154878f, -0.005142033f, -0.005128741f,
+    -0.005115017f, -0.005100876f, -0.005086392f, -0.005071521f, -0.005056158f,
+    -0.005040571f, -0.005024567f, -0.005008131f, -0.004991382f, -0.004974216f,
+    -0.004956663f, -0.004938707f, -0.004920557f, -0.004901916f, -0.004882947f,
+    -0.004863635f, -0.004843935f, -0.004823804f, -0.004803523f, -0.004782796f,
+    -0.004761741f, -0.004740298f, -0.004718587f, -0.004696488f, -0.004674003f,
+    -0.004651368f, -0.004628308f, -0.004604928f, -0.004581235f, -0.004557237f,
+    -0.004532911f, -0.004508190f, -0.004483350f, -0.004458122f, -0.004432589f,
+    -0.004406758f, -0.004380651f, -0.004354239f, -0.004327476f, -0.004300587f,
+    -0.004273336f, -0.004245814f, -0.004218027f, -0.004189968f, -0.004161645f,
+    -0.004132986f, -0.004104227f, -0.004075136f, -0.004045803f, -0.004016215f,
+    -0.003986390f, -0.003956328f, -0.003925952f, -0.003895502f, -0.003864747f,
+    -0.003833770f, -0.003802574f, -0.003771162f, -0.003739539f, -0.003707637f,
+    -0.003675677f, -0.003643438f, -0.003611013f, -0.003578391f, -0.003545577f,
+    -0.003512587f, -0.003479339f, -0.003446057f, -0.003412541f, -0.003378846f,
+    -0.003344990f, -0.003310967f, -0.003276795f, -0.003242407f, -0.003207996f,
+    -0.003173381f, -0.003138632f, -0.003103726f, -0.003068700f, -0.003033541f,
+    -0.002998203f, -0.002962865f, -0.002927348f, -0.002891719f, -0.002855979f,
+    -0.002820157f, -0.002784200f, -0.002748109f, -0.002712041f, -0.002675831f,
+    -0.002639525f, -0.002603158f, -0.002566688f, -0.002530172f, -0.002493523f,
+    -0.002456941f, -0.002420217f, -0.002383456f, -0.002346605f, -0.002309754f,
+    -0.002272815f, -0.002235904f, -0.002198920f, -0.002161905f, -0.002124861f,
+    -0.002087817f, -0.002050713f, -0.002013594f, -0.001976520f, -0.001939401f,
+    -0.001902282f, -0.001865178f, -0.001828074f, -0.001790941f, -0.001753867f,
+    -0.001716807f, -0.001679763f, -0.001642734f, -0.001605749f, -0.001568764f,
+    -0.001531869f, -0.001494944f, -0.001458123f, -0.001421347f, -0.001384586f,
+    -0.001347899f, -0.001311287f, -0.001274705f, -0.001238227f, -0.001201808f,
+    -0.001165465f, -0.001129180f, -0.001093000f, -0.001056895f, -0.001020864f,
+    -0.000984952f, -0.000949129f, -0.000913396f, -0.000877783f, -0.000842214f,
+    -0.000806853f, -0.000771582f, -0.000736371f, -0.000701338f, -0.000666395f,
+    -0.000631616f, -0.000596926f, -0.000562400f, -0.000528008f, -0.000493720f,
+    -0.000459656f, -0.000425652f, -0.000391826f, -0.000358179f, -0.000324681f,
+    -0.000291348f, -0.000258148f, -0.000225157f, -0.000192285f, -0.000159621f,
+    -0.000127122f, -0.000094816f, -0.000062674f, -0.000030726f, 0.000001043f,
+    0.000032619f, 0.000064015f, 0.000095189f, 0.000126183f, 0.000156954f,
+    0.000187561f, 0.000217944f, 0.000248075f, 0.000278056f, 0.000307798f,
+    0.000337318f, 0.000366643f, 0.000395685f, 0.000424594f, 0.000453204f,
+    0.000481576f, 0.000509784f, 0.000537723f, 0.000565425f, 0.000592902f,
+    0.000620112f, 0.000647098f, 0.000673831f, 0.000700325f, 0.000726581f,
+    0.000752553f, 0.000778317f, 0.000803769f, 0.000829026f, 0.000853956f,
+    0.000878692f, 0.000903144f, 0.000927329f, 0.000951245f, 0.000974879f,
+    0.000998288f, 0.001021385f, 0.001044214f, 0.001066804f, 0.001089081f,
+    0.001111075f, 0.001132831f, 0.001154289f, 0.001175404f, 0.001196340f,
+    0.001216978f, 0.001237273f, 0.001257330f, 0.001277074f, 0.001296535f,
+    0.001315713f, 0.001334608f, 0.001353174f, 0.001371488f, 0.001389518f,
+    0.001407191f, 0.001424640f, 0.001441687f, 0.001458585f, 0.001475111f,
+    0.001491338f, 0.001507252f, 0.001522914f, 0.001538232f, 0.001553267f,
+    0.001567990f, 0.001582444f, 0.001596540f, 0.001610383f, 0.001623914f,
+    0.001637056f, 0.001650050f, 0.001662657f, 0.001674980f, 0.001686960f,
+    0.001698673f, 0.001710087f, 0.001721174f, 0.001731962f, 0.001742452f,
+    0.001752615f, 0.001762524f, 0.001772083f, 0.001781344f, 0.001790248f,
+    0.001798995f, 0.001807354f, 0.001815408f, 0.001823165f, 0.001830615f,
+    0.001837783f, 0.001844630f, 0.001851171f, 0.001857445f, 0.001863383f,
+    0.001869038f, 0.001874395f, 0.001879446f, 0.001884155f, 0.001888677f,
+    0.001892857f, 0.001896739f, 0.001900315f, 0.001903601f, 0.001906611f,
+    0.001909316f, 0.001911722f, 0.001913868f, 0.001915701f, 0.001917250f,
+    0.001918525f, 0.001919515f, 0.001920141f, 0.001920626f, 0.001920775f,
+    0.001920629f, 0.001920212f, 0.001919515f, 0.001918543f, 0.001917303f,
+    0.001915772f, 0.001913995f, 0.001911934f, 0.001909599f, 0.001907010f,
+    0.001904141f, 0.001900952f, 0.001897641f, 0.001893993f, 0.001890086f,
+    0.001885928f, 0.001881510f, 0.001876837f, 0.001871919f, 0.001866743f,
+    0.001861323f, 0.001855660f, 0.001849748f, 0.001843594f, 0.001837200f,
+    0.001830498f, 0.001823700f, 0.001816597f, 0.001809261f, 0.001801694f,
+    0.001793900f, 0.001785878f, 0.001777633f, 0.001769166f, 0.001760479f,
+    0.001751573f, 0.001742453f, 0.001733118f, 0.001723506f, 0.001713820f,
+    0.001703859f, 0.001693694f, 0.001683328f, 0.001672762f, 0.001661999f,
+    0.001651037f, 0.001639888f, 0.001628550f, 0.001617014f, 0.001605306f,
+    0.001593402f, 0.001581334f, 0.001569007f, 0.001556646f, 0.001544040f,
+    0.001531262f, 0.001518320f, 0.001505218f, 0.001491942f, 0.001478516f,
+    0.001464922f, 0.001451187f, 0.001437284f, 0.001423243f, 0.001409046f,
+    0.001394711f, 0.001380172f, 0.001365617f, 0.001350857f, 0.001335964f,
+    0.001320951f, 0.001305796f, 0.001290523f, 0.001275122f, 0.001259610f,
+    0.001243964f, 0.001228213f, 0.001212344f, 0.001196384f, 0.001180299f,
+    0.001164056f, 0.001147822f, 0.001131445f, 0.001114950f, 0.001098379f,
+    0.001081713f, 0.001064964f, 0.001048125f, 0.001031198f, 0.001014210f,
+    0.000997119f, 0.000979975f, 0.000962749f, 0.000945456f, 0.000928067f,
+    0.000910684f, 0.000893205f, 0.000875667f, 0.000858076f, 0.000840425f,
+    0.000822738f, 0.000804998f, 0.000787199f, 0.000769392f, 0.000751533f,
+    0.000733614f, 0.000715688f, 0.000697725f, 0.000679702f, 0.000661723f,
+    0.000643678f, 0.000625633f, 0.000607550f, 0.000589468f, 0.000571363f,
+    0.000553250f, 0.000535153f, 0.000517011f, 0.000498906f, 0.000480779f,
+    0.000462666f, 0.000444539f, 0.000426471f, 0.000408381f, 0.000390306f,
+    0.000372246f, 0.000354223f, 0.000336207f, 0.000318207f, 0.000300258f,
+    0.000282332f, 0.000264421f, 0.000246547f, 0.000228733f, 0.000210933f,
+    0.000193194f, 0.000175484f, 0.000157833f, 0.000140220f, 0.000122681f,
+    0.000105157f, 0.000087731f, 0.000070326f, 0.000053003f, 0.000035740f,
+    0.000018530f, 0.000001393f, -0.000015646f, -0.000032656f, -0.000049569f,
+    -0.000066414f, -0.000083186f, -0.000099860f, -0.000116460f, -0.000133000f,
+    -0.000149406f, -0.000165753f, -0.000182003f, -0.000198171f, -0.000214227f,
+    -0.000230208f, -0.000246078f, -0.000261821f, -0.000277504f, -0.000293061f,
+    -0.000308529f, -0.000323869f, -0.000339113f, -0.000354238f, -0.000369266f,
+    -0.000384152f, -0.000398926f, -0.000413589f, -0.000428155f, -0.000442564f,
+    -0.000456862f, -0.000471041f, -0.000485092f, -0.000499003f, -0.000512794f,
+    -0.000526458f, -0.000539981f, -0.000553377f, -0.000566632f, -0.000579745f,
+    -0.000592731f, -0.000605576f, -0.000618272f, -0.000630826f, -0.000643246f,
+    -0.000655510f, -0.000667632f, -0.000679605f, -0.000691436f, -0.000703126f,
+    -0.000714630f, -0.000726007f, -0.000737235f, -0.000748247f, -0.000759214f,
+    -0.000769965f, -0.000780560f, -0.000791006f, -0.000801295f, -0.000811398f,
+    -0.000821374f, -0.000831157f, -0.000840805f, -0.000850268f, -0.000859588f,
+    -0.000868730f, -0.000877693f, -0.000886515f, -0.000895165f, -0.000903629f,
+    -0.000911959f, -0.000920080f, -0.000928067f, -0.000935853f, -0.000943489f,
+    -0.000950947f, -0.000958242f, -0.000965349f, -0.000972301f, -0.000979066f,
+    -0.000985600f, -0.000992097f, -0.000998341f, -0.001004428f, -0.001010329f,
+    -0.001016054f, -0.001021627f, -0.001026995f, -0.001032200f, -0.001037240f,
+    -0.001042094f, -0.001046777f, -0.001051273f, -0.001055613f, -0.001059774f,
+    -0.001063749f, -0.001067556f, -0.001071189f, -0.001074646f, -0.001077924f,
+    -0.001081035f, -0.001083970f, -0.001086727f, -0.001089316f, -0.001091719f,
+    -0.001093969f, -0.001096025f, -0.001097921f, -0.001099560f, -0.001101188f,
+    -0.001102570f, -0.001103770f, -0.001104813f, -0.001105674f, -0.001106367f,
+    -0.001106901f, -0.001107253f, -0.001107441f, -0.001107467f, -0.001107324f,
+    -0.001107011f, -0.001106536f, -0.001105890f, -0.001105089f, -0.001104120f,
+    -0.001102988f, -0.001101693f, -0.001100240f, -0.001098625f, -0.001096848f,
+    -0.001094918f, -0.001092824f, -0.001090577f, -0.001088173f, -0.001085612f,
+    -0.001082901f, -0.001079949f, -0.001077014f, -0.001073845f, -0.001070523f,
+    -0.001067054f, -0.001063436f, -0.001059672f, -0.001055761f, -0.001051705f,
+    -0.001047506f, -0.001043163f, -0.001038681f, -0.001034057f, -0.001029294f,
+    -0.001024393f, -0.001019358f, -0.001014184f, -0.001008878f, -0.001003438f,
+    -0.000997867f, -0.000992166f, -0.000986338f, -0.000980377f, -0.000974296f,
+    -0.000968084f, -0.000961754f, -0.000955300f, -0.000948649f, -0.000942031f,
+    -0.000935216f, -0.000928288f, -0.000921244f, -0.000914088f, -0.000906816f,
+    -0.000899438f, -0.000891950f, -0.000884352f, -0.000876648f, -0.000868842f,
+    -0.000860931f, -0.000852916f, -0.000844810f, -0.000836600f, -0.000828292f,
+    -0.000819888f, -0.000811394f, -0.000802804f, -0.000794128f, -0.000785362f,
+    -0.000776507f, -0.000767570f, -0.000758551f, -0.000749443f, -0.000740252f,
+    -0.000730991f, -0.000721592f, -0.000712238f, -0.000702742f, -0.000693176f,
+    -0.000683546f, -0.000673845f, -0.000664074f, -0.000654239f, -0.000644337f,
+    -0.000634376f, -0.000624359f, -0.000614278f, -0.000604142f, -0.000593949f,
+    -0.000583705f, -0.000573408f, -0.000563063f, -0.000552669f, -0.000542220f,
+    -0.000531740f, -0.000521205f, -0.000510640f, -0.000500027f, -0.000489380f,
+    -0.000478696f, -0.000467975f, -0.000457224f, -0.000446450f, -0.000435591f,
+    -0.000424799f, -0.000413928f, -0.000403039f, -0.000392124f, -0.000381198f,
+    -0.000370242f, -0.000359282f, -0.000348292f, -0.000337295f, -0.000326291f,
+    -0.000315264f, -0.000304244f, -0.000293203f, -0.000282161f, -0.000271119f,
+    -0.000260070f, -0.000249021f, -0.000237986f, -0.000226937f, -0.000215903f,
+    -0.000204869f, -0.000193842f, -0.000182830f, -0.000171818f, -0.000160843f,
+    -0.000149861f, -0.000138886f, -0.000127964f, -0.000117034f, -0.000106134f,
+    -0.000095263f, -0.000084393f, -0.000073567f, -0.000062764f, -0.000051990f,
+    -0.000041246f, -0.000030532f, -0.000019856f, -0.000009201f, 0.000001408f,
+    0.000011981f, 0.000022508f, 0.000033006f, 0.000043452f, 0.000053860f,
+    0.000064231f, 0.000074543f, 0.000084810f, 0.000095040f, 0.000105202f,
+    0.000115320f, 0.000125386f, 0.000135407f, 0.000145361f, 0.000155240f,
+    0.000165097f, 0.000174873f, 0.000184603f, 0.000194252f, 0.000203855f,
+    0.000213385f, 0.000222847f, 0.000232235f, 0.000241578f, 0.000250846f,
+    0.000260025f, 0.000269137f, 0.000278190f, 0.000287168f, 0.000296056f,
+    0.000304885f, 0.000313625f, 0.000322290f, 0.000330873f, 0.000339389f,
+    0.000347812f, 0.000356153f, 0.000364412f, 0.000372592f, 0.000380680f,
+    0.000388682f, 0.000396606f, 0.000404399f, 0.000412177f, 0.000419822f,
+    0.000427384f, 0.000434857f, 0.000442233f, 0.000449523f, 0.000456702f,
+    0.000463810f, 0.000470806f, 0.000477716f, 0.000484519f, 0.000491235f,
+    0.000497852f, 0.000504360f, 0.000510782f, 0.000517093f, 0.000523314f,
+    0.000529416f, 0.000535440f, 0.000541344f, 0.000547152f, 0.000552855f,
+    0.000558458f, 0.000563953f, 0.000569344f, 0.000574626f, 0.000579763f,
+    0.000584885f, 0.000589844f, 0.000594705f, 0.000599459f, 0.000604104f,
+    0.000608645f, 0.000613067f, 0.000617389f, 0.000621594f, 0.000625703f,
+    0.000629690f, 0.000633575f, 0.000637345f, 0.000641011f, 0.000644561f,
+    0.000647999f, 0.000651333f, 0.000654556f, 0.000657663f, 0.000660658f,
+    0.000663549f, 0.000666328f, 0.000668991f, 0.000671539f, 0.000673989f,
+    0.000676319f, 0.000678537f, 0.000680599f, 0.000682648f, 0.000684533f,
+    0.000686312f, 0.000687977f, 0.000689531f, 0.000690982f, 0.000692312f,
+    0.000693535f, 0.000694653f, 0.000695655f, 0.000696551f, 0.000697337f,
+    0.000698013f, 0.000698581f, 0.000699041f, 0.000699395f, 0.000699634f,
+    0.000699770f, 0.000699800f, 0.000699723f, 0.000699538f, 0.000699245f,
+    0.000698850f, 0.000698348f, 0.000697739f, 0.000697031f, 0.000696214f,
+    0.000695243f, 0.000694275f, 0.000693150f, 0.000691924f, 0.000690598f,
+    0.000689168f, 0.000687641f, 0.000686012f, 0.000684285f, 0.000682459f,
+    0.000680535f, 0.000678514f, 0.000676395f, 0.000674182f, 0.000671872f,
+    0.000669468f, 0.000666970f, 0.000664379f, 0.000661695f, 0.000658919f,
+    0.000656052f, 0.000653094f, 0.000650047f, 0.000646912f, 0.000643687f,
+    0.000640376f, 0.000636978f, 0.000633444f, 0.000629925f, 0.000626273f,
+    0.000622537f, 0.000618719f, 0.000614819f, 0.000610840f, 0.000606780f,
+    0.000602639f, 0.000598422f, 0.000594131f, 0.000589758f, 0.000585314f,
+    0.000580795f, 0.000576198f, 0.000571538f, 0.000566797f, 0.000561992f,
+    0.000557112f, 0.000552170f, 0.000547158f, 0.000542073f, 0.000536932f,
+    0.000531720f, 0.000526449f, 0.000521112f, 0.000515714f, 0.000510257f,
+    0.000504697f, 0.000499163f, 0.000493534f, 0.000487842f, 0.000482095f,
+    0.000476299f, 0.000470446f, 0.000464546f, 0.000458587f, 0.000452582f,
+    0.000446532f, 0.000440424f, 0.000434285f, 0.000428084f, 0.000421848f,
+    0.000415571f, 0.000409249f, 0.000402879f, 0.000396475f, 0.000390038f,
+    0.000383548f, 0.000377037f, 0.000370476f, 0.000363898f, 0.000357270f,
+    0.000350621f, 0.000343934f, 0.000337221f, 0.000330456f, 0.000323705f,
+    0.000316914f, 0.000310086f, 0.000303246f, 0.000296373f, 0.000289485f,
+    0.000282567f, 0.000275634f, 0.000268687f, 0.000261720f, 0.000254728f,
+    0.000247732f, 0.000240713f, 0.000233691f, 0.000226650f, 0.000219598f,
+    0.000212539f, 0.000205472f, 0.000198394f, 0.000191312f, 0.000184227f,
+    0.000177138f, 0.000170041f, 0.000162944f, 0.000155844f, 0.000148751f,
+    0.000141639f, 0.000134557f, 0.000127476f, 0.000120379f, 0.000113308f,
+    0.000106234f, 0.000099164f, 0.000092115f, 0.000085060f, 0.000078026f,
+    0.000071008f, 0.000063993f, 0.000057001f, 0.000050016f, 0.000043049f,
+    0.000036098f, 0.000029173f, 0.000022259f, 0.000015371f, 0.000008494f,
+    0.000001650f, -0.000005178f, -0.000011981f, -0.000018749f, -0.000025503f,
+    -0.000032227f, -0.000038929f, -0.000045594f, -0.000052229f, -0.000058834f,
+    -0.000065409f, -0.000071954f, -0.000078462f, -0.000084940f, -0.000091381f,
+    -0.000097781f, -0.000104155f, -0.000110485f, -0.000116780f, -0.000123020f,
+    -0.000129249f, -0.000135411f, -0.000141542f, -0.000147630f, -0.000153679f,
+    -0.000159673f, -0.000165626f, -0.000171538f, -0.000177402f, -0.000183221f,
+    -0.000188980f, -0.000194710f, -0.000200376f, -0.000205994f, -0.000211567f,
+    -0.000217084f, -0.000222530f, -0.000227969f, -0.000233319f, -0.000238627f,
+    -0.000243876f, -0.000249073f, -0.000254218f, -0.000259299f, -0.000264321f,
+    -0.000269294f, -0.000274204f, -0.000279061f, -0.000283845f, -0.000288583f,
+    -0.000293255f, -0.000297863f, -0.000302415f, -0.000306901f, -0.000311326f,
+    -0.000315692f, -0.000319991f, -0.000324223f, -0.000328399f, -0.000332505f,
+    -0.000336546f, -0.000340525f, -0.000344433f, -0.000348251f, -0.000352059f,
+    -0.000355769f, -0.000359405f, -0.000362985f, -0.000366498f, -0.000369934f,
+    -0.000373306f, -0.000376610f, -0.000379842f, -0.000383006f, -0.000386100f,
+    -0.000389125f, -0.000392083f, -0.000394963f, -0.000397777f, -0.000400525f,
+    -0.000403194f, -0.000405796f, -0.000408327f, -0.000410784f, -0.000413170f,
+    -0.000415487f, -0.000417734f, -0.000419905f, -0.000422003f, -0.000424031f,
+    -0.000425987f, -0.000427842f, -0.000429682f, -0.000431424f, -0.000433091f,
+    -0.000434684f, -0.000436211f, -0.000437658f, -0.000439037f, -0.000440342f,
+    -0.000441581f, -0.000442738f, -0.000443831f, -0.000444848f, -0.000445794f,
+    -0.000446669f, -0.000447473f, -0.000448201f, -0.000448864f, -0.000449451f,
+    -0.000449969f, -0.000450415f, -0.000450792f, -0.000451095f, -0.000451332f,
+    -0.000451496f, -0.000451592f, -0.000451615f, -0.000451570f, -0.000451422f,
+    -0.000451274f, -0.000451021f, -0.000450702f, -0.000450314f, -0.000449856f,
+    -0.000449333f, -0.000448741f, -0.000448083f, -0.000447358f, -0.000446567f,
+    -0.000445709f, -0.000444787f, -0.000443798f, -0.000442745f, -0.000441628f,
+    -0.000440446f, -0.000439201f, -0.000437892f, -0.000436520f, -0.000435086f,
+    -0.000433590f, -0.000432032f, -0.000430414f, -0.000428734f, -0.000426994f,
+    -0.000425195f, -0.000423303f, -0.000421419f, -0.000419443f, -0.000417409f,
+    -0.000415319f, -0.000413172f, -0.000410967f, -0.000408708f, -0.000406394f,
+    -0.000404024f, -0.000401602f, -0.000399123f, -0.000396594f, -0.000394013f,
+    -0.000391378f, -0.000388694f, -0.000385957f, -0.000383142f, -0.000380337f,
+    -0.000377454f, -0.000374521f, -0.000371542f, -0.000368515f, -0.000365441f,
+    -0.000362324f, -0.000359159f, -0.000355951f, -0.000352700f, -0.000349402f,
+    -0.000346066f, -0.000342687f, -0.000339268f, -0.000335807f, -0.000332304f,
+    -0.000328764f, -0.000325188f, -0.000321571f, -0.000317916f, -0.000314226f,
+    -0.000310503f, -0.000306742f, -0.000302948f, -0.000299120f, -0.000295259f,
+    -0.000291366f, -0.000287442f, -0.000283483f, -0.000279501f, -0.000275485f,
+    -0.000271441f, -0.000267372f, -0.000263272f, -0.000259146f, -0.000254996f,
+    -0.000250826f, -0.000246622f, -0.000242399f, -0.000238152f, -0.000233885f,
+    -0.000229595f, -0.000225287f, -0.000220960f, -0.000216605f, -0.000212241f,
+    -0.000207854f, -0.000203457f, -0.000199037f, -0.000194604f, -0.000190157f,
+    -0.000185695f, -0.000181187f, -0.000176731f, -0.000172237f, -0.000167722f,
+    -0.000163207f, -0.000158675f, -0.000154138f, -0.000149587f, -0.000145037f,
+    -0.000140477f, -0.000135908f, -0.000131341f, -0.000126757f, -0.000122186f,
+    -0.000117602f, -0.000113014f, -0.000108430f, -0.000103844f, -0.000099257f,
+    -0.000094671f, -0.000090083f, -0.000085503f, -0.000080923f, -0.000076346f,
+    -0.000071768f, -0.000067208f, -0.000062641f, -0.000058085f, -0.000053536f,
+    -0.000048997f, -0.000044461f, -0.000039937f, -0.000035422f, -0.000030918f,
+    -0.000026423f, -0.000021942f, -0.000017472f, -0.000013014f, -0.000008568f,
+    -0.000004144f, 0.000000272f, 0.000004673f, 0.000009054f, 0.000013424f,
+    0.000017771f, 0.000022100f, 0.000026418f, 0.000030706f, 0.000034984f,
+    0.000039233f, 0.000043469f, 0.000047682f, 0.000051867f, 0.000056034f,
+    0.000060178f, 0.000064293f, 0.000068391f, 0.000072461f, 0.000076508f,
+    0.000080524f, 0.000084519f, 0.000088483f, 0.000092421f, 0.000096330f,
+    0.000100212f, 0.000104062f, 0.000107886f, 0.000111679f, 0.000115441f,
+    0.000119174f, 0.000122871f, 0.000126537f, 0.000130171f, 0.000133777f,
+    0.000137346f, 0.000140877f, 0.000144381f, 0.000147849f, 0.000151278f,
+    0.000154676f, 0.000158034f, 0.000161357f, 0.000164649f, 0.000167895f,
+    0.000171110f, 0.000174284f, 0.000177424f, 0.000180520f, 0.000183579f,
+    0.000186604f, 0.000189582f, 0.000192527f, 0.000195425f, 0.000198288f,
+    0.000201104f, 0.000203889f, 0.000206625f, 0.000209318f, 0.000211978f,
+    0.000214588f, 0.000217158f, 0.000219684f, 0.000222169f, 0.000224615f,
+    0.000227008f, 0.000229364f, 0.000231674f, 0.000233943f, 0.000236165f,
+    0.000238342f, 0.000240441f, 0.000242567f, 0.000244610f, 0.000246607f,
+    0.000248563f, 0.000250472f, 0.000252334f, 0.000254150f, 0.000255924f,
+    0.000257649f, 0.000259329f, 0.000260962f, 0.000262551f, 0.000264093f,
+    0.000265587f, 0.000267035f, 0.000268438f, 0.000269796f, 0.000271102f,
+    0.000272368f, 0.000273583f, 0.000274751f, 0.000275875f, 0.000276952f,
+    0.000277980f, 0.000278965f, 0.000279900f, 0.000280791f, 0.000281633f,
+    0.000282429f, 0.000283180f, 0.000283882f, 0.000284540f, 0.000285151f,
+    0.000285714f, 0.000286234f, 0.000286705f, 0.000287131f, 0.000287511f,
+    0.000287846f, 0.000288134f, 0.000288376f, 0.000288574f, 0.000288726f,
+    0.000288833f, 0.000288893f, 0.000288911f, 0.000288883f, 0.000288811f,
+    0.000288693f, 0.000288532f, 0.000288327f, 0.000288077f, 0.000287784f,
+    0.000287449f, 0.000287068f, 0.000286601f, 0.000286179f, 0.000285671f,
+    0.000285120f, 0.000284527f, 0.000283892f, 0.000283215f, 0.000282498f,
+    0.000281738f, 0.000280938f, 0.000280097f, 0.000279217f, 0.000278295f,
+    0.000277334f, 0.000276334f, 0.000275294f, 0.000274216f, 0.000273099f,
+    0.000271943f, 0.000270750f, 0.000269519f, 0.000268250f, 0.000266945f,
+    0.000265603f, 0.000264225f, 0.000262811f, 0.000261361f, 0.000259876f,
+    0.000258355f, 0.000256801f, 0.000255212f, 0.000253590f, 0.000251933f,
+    0.000250244f, 0.000248523f, 0.000246768f, 0.000244983f, 0.000243166f,
+    0.000241316f, 0.000239437f, 0.000237527f, 0.000235589f, 0.000233619f,
+    0.000231621f, 0.000229594f, 0.000227540f, 0.000225456f, 0.000223346f,
+    0.000221210f, 0.000219045f, 0.000216856f, 0.000214640f, 0.000212399f,
+    0.000210132f, 0.000207845f, 0.000205495f, 0.000203193f, 0.000200831f,
+    0.000198450f, 0.000196044f, 0.000193618f, 0.000191170f, 0.000188702f,
+    0.000186213f, 0.000183702f, 0.000181176f, 0.000178629f, 0.000176064f,
+    0.000173479f, 0.000170879f, 0.000168262f, 0.000165627f, 0.000162976f,
+    0.000160310f, 0.000157629f, 0.000154931f, 0.000152223f, 0.000149501f,
+    0.000146760f, 0.000144012f, 0.000141250f, 0.000138475f, 0.000135692f,
+    0.000132892f, 0.000130089f, 0.000127270f, 0.000124445f, 0.000121609f,
+    0.000118767f, 0.000115914f, 0.000113057f, 0.000110188f, 0.000107318f,
+    0.000104439f, 0.000101555f, 0.000098664f, 0.000095770f, 0.000092871f,
+    0.000089969f, 0.000087062f, 0.000084156f, 0.000081243f, 0.000078332f,
+    0.000075417f, 0.000072502f, 0.000069587f, 0.000066670f, 0.000063755f,
+    0.000060841f, 0.000057925f, 0.000055006f, 0.000052106f, 0.000049198f,
+    0.000046296f, 0.000043394f, 0.000040499f, 0.000037605f, 0.000034722f,
+    0.000031838f, 0.000028962f, 0.000026092f, 0.000023231f, 0.000020372f,
+    0.000017522f, 0.000014680f, 0.000011850f, 0.000009025f, 0.000006210f,
+    0.000003403f, 0.000000607f, -0.000002179f, -0.000004955f, -0.000007715f,
+    -0.000010470f, -0.000013210f, -0.000015942f, -0.000018656f, -0.000021357f,
+    -0.000024049f, -0.000026723f, -0.000029387f, -0.000032032f, -0.000034668f,
+    -0.000037283f, -0.000039887f, -0.000042472f, -0.000045039f, -0.000047594f,
+    -0.000050131f, -0.000052650f, -0.000055151f, -0.000057636f, -0.000060100f,
+    -0.000062548f, -0.000064975f, -0.000067385f, -0.000069773f, -0.000072144f,
+    -0.000074491f, -0.000076821f, -0.000079131f, -0.000081420f, -0.000083685f,
+    -0.000085929f, -0.000088153f, -0.000090355f, -0.000092521f, -0.000094689f,
+    -0.000096822f, -0.000098934f, -0.000101021f, -0.000103084f, -0.000105126f,
+    -0.000107139f, -0.000109133f, -0.000111098f, -0.000113043f, -0.000114961f,
+    -0.000116851f, -0.000118721f, -0.000120563f, -0.000122378f, -0.000124170f,
+    -0.000125933f, -0.000127671f, -0.000129382f, -0.000131070f, -0.000132726f,
+    -0.000134358f, -0.000135963f, -0.000137540f, -0.000139091f, -0.000140612f,
+    -0.000142107f, -0.000143575f, -0.000145013f, -0.000146424f, -0.000147806f,
+    -0.000149163f, -0.000150490f, -0.000151787f, -0.000153058f, -0.000154297f,
+    -0.000155510f, -0.000156694f, -0.000157849f, -0.000158974f, -0.000160070f,
+    -0.000161139f, -0.000162176f, -0.000163186f, -0.000164167f, -0.000165116f,
+    -0.000166038f, -0.000166931f, -0.000167793f, -0.000168627f, -0.000169431f,
+    -0.000170205f, -0.000170949f, -0.000171666f, -0.000172327f, -0.000173008f,
+    -0.000173636f, -0.000174234f, -0.000174802f, -0.000175341f, -0.000175851f,
+    -0.000176331f, -0.000176782f, -0.000177204f, -0.000177596f, -0.000177960f,
+    -0.000178294f, -0.000178600f, -0.000178875f, -0.000179124f, -0.000179342f,
+    -0.000179531f, -0.000179693f, -0.000179825f, -0.000179929f, -0.000180005f,
+    -0.000180052f, -0.000180070f, -0.000180061f, -0.000180024f, -0.000179959f,
+    -0.000179867f, -0.000179745f, -0.000179597f, -0.000179422f, -0.000179219f,
+    -0.000178989f, -0.000178732f, -0.000178448f, -0.000178138f, -0.000177800f,
+    -0.000177437f, -0.000177047f, -0.000176631f, -0.000176189f, -0.000175722f,
+    -0.000175229f, -0.000174710f, -0.000174166f, -0.000173597f, -0.000173004f,
+    -0.000172385f, -0.000171742f, -0.000171075f, -0.000170384f, -0.000169668f,
+    -0.000168929f, -0.000168167f, -0.000167381f, -0.000166547f, -0.000165741f,
+    -0.000164887f, -0.000164011f, -0.000163112f, -0.000162191f, -0.000161248f,
+    -0.000160285f, -0.000159299f, -0.000158293f, -0.000157266f, -0.000156218f,
+    -0.000155151f, -0.000154063f, -0.000152955f, -0.000151829f, -0.000150681f,
+    -0.000149516f, -0.000148331f, -0.000147129f, -0.000145908f, -0.000144668f,
+    -0.000143411f, -0.000142138f, -0.000140845f, -0.000139537f, -0.000138212f,
+    -0.000136870f, -0.000135512f, -0.000134139f, -0.000132749f, -0.000131345f,
+    -0.000129926f, -0.000128491f, -0.000127043f, -0.000125581f, -0.000124103f,
+    -0.000122613f, -0.000121110f, -0.000119594f, -0.000118064f, -0.000116522f,
+    -0.000114968f, -0.000113402f, -0.000111825f, -0.000110238f, -0.000108638f,
+    -0.000107027f, -0.000105407f, -0.000103777f, -0.000102136f, -0.000100485f,
+    -0.000098827f, -0.000097159f, -0.000095483f, -0.000093798f, -0.000092089f,
+    -0.000090403f, -0.000088696f, -0.000086982f, -0.000085259f, -0.000083531f,
+    -0.000081796f, -0.000080056f, -0.000078309f, -0.000076559f, -0.000074801f,
+    -0.000073041f, -0.000071274f, -0.000069505f, -0.000067730f, -0.000065954f,
+    -0.000064172f, -0.000062392f, -0.000060603f, -0.000058814f, -0.000057024f,
+    -0.000055233f, -0.000053437f, -0.000051644f, -0.000049846f, -0.000048050f,
+    -0.000046252f, -0.000044458f, -0.000042658f, -0.000040862f, -0.000039067f,
+    -0.000037272f, -0.000035478f, -0.000033687f, -0.000031896f, -0.000030110f,
+    -0.000028325f, -0.000026541f, -0.000024762f, -0.000022985f, -0.000021212f,
+    -0.000019444f, -0.000017679f, -0.000015917f, -0.000014162f, -0.000012412f,
+    -0.000010663f, -0.000008923f, -0.000007188f, -0.000005458f, -0.000003735f,
+    -0.000002017f, -0.000000307f, 0.000001395f, 0.000003094f, 0.000004783f,
+    0.000006464f, 0.000008139f, 0.000009803f, 0.000011463f, 0.000013110f,
+    0.000014752f, 0.000016384f, 0.000018005f, 0.000019620f, 0.000021222f,
+    0.000022816f, 0.000024400f, 0.000025975f, 0.000027538f, 0.000029088f,
+    0.000030632f, 0.000032161f, 0.000033681f, 0.000035191f, 0.000036686f,
+    0.000038170f, 0.000039644f, 0.000041104f, 0.000042552f, 0.000043987f,
+    0.000045410f, 0.000046819f, 0.000048218f, 0.000049600f, 0.000050971f,
+    0.000052327f, 0.000053672f, 0.000055001f, 0.000056314f, 0.000057616f,
+    0.000058904f, 0.000060175f, 0.000061433f, 0.000062676f, 0.000063905f,
+    0.000065116f, 0.000066314f, 0.000067497f, 0.000068665f, 0.000069817f,
+    0.000070952f, 0.000072071f, 0.000073177f, 0.000074264f, 0.000075337f,
+    0.000076394f, 0.000077431f, 0.000078457f, 0.000079463f, 0.000080443f,
+    0.000081426f, 0.000082384f, 0.000083324f, 0.000084247f, 0.000085153f,
+    0.000086042f, 0.000086914f, 0.000087769f, 0.000088606f, 0.000089426f,
+    0.000090229f, 0.000091013f, 0.000091782f, 0.000092533f, 0.000093265f,
+    0.000093979f, 0.000094677f, 0.000095356f, 0.000096018f, 0.000096663f,
+    0.000097288f, 0.000097896f, 0.000098487f, 0.000099060f, 0.000099615f,
+    0.000100151f, 0.000100670f, 0.000101171f, 0.000101654f, 0.000102119f,
+    0.000102567f, 0.000102995f, 0.000103407f, 0.000103800f, 0.000104174f,
+    0.000104533f, 0.000104872f, 0.000105193f, 0.000105498f, 0.000105783f,
+    0.000106052f, 0.000106302f, 0.000106535f, 0.000106750f, 0.000106947f,
+    0.000107127f, 0.000107289f, 0.000107434f, 0.000107561f, 0.000107671f,
+    0.000107763f, 0.000107839f, 0.000107897f, 0.000107937f, 0.000107961f,
+    0.000107951f, 0.000107957f, 0.000107929f, 0.000107886f, 0.000107825f,
+    0.000107747f, 0.000107653f, 0.000107542f, 0.000107415f, 0.000107272f,
+    0.000107112f, 0.000106936f, 0.000106744f, 0.000106536f, 0.000106313f,
+    0.000106073f, 0.000105818f, 0.000105547f, 0.000105261f, 0.000104960f,
+    0.000104643f, 0.000104311f, 0.000103965f, 0.000103603f, 0.000103227f,
+    0.000102836f, 0.000102430f, 0.000102010f, 0.000101576f, 0.000101128f,
+    0.000100665f, 0.000100189f, 0.000099699f, 0.000099196f, 0.000098679f,
+    0.000098149f, 0.000097605f, 0.000097049f, 0.000096479f, 0.000095897f,
+    0.000095303f, 0.000094695f, 0.000094076f, 0.000093444f, 0.000092801f,
+    0.000092145f, 0.000091478f, 0.000090799f, 0.000090109f, 0.000089408f,
+    0.000088695f, 0.000087972f, 0.000087238f, 0.000086494f, 0.000085738f,
+    0.000084959f, 0.000084197f, 0.000083412f, 0.000082617f, 0.000081812f,
+    0.000080998f, 0.000080175f, 0.000079342f, 0.000078501f, 0.000077650f,
+    0.000076792f, 0.000075925f, 0.000075049f, 0.000074166f, 0.000073274f,
+    0.000072376f, 0.000071469f, 0.000070555f, 0.000069635f, 0.000068706f,
+    0.000067771f, 0.000066830f, 0.000065882f, 0.000064927f, 0.000063967f,
+    0.000063001f, 0.000062029f, 0.000061051f, 0.000060068f, 0.000059080f,
+    0.000058087f, 0.000057088f, 0.000056087f, 0.000055078f, 0.000054067f,
+    0.000053051f, 0.000052032f, 0.000051009f, 0.000049980f, 0.000048951f,
+    0.000047917f, 0.000046880f, 0.000045841f, 0.000044798f, 0.000043753f,
+    0.000042706f, 0.000041657f, 0.000040606f, 0.000039552f, 0.000038497f,
+    0.000037441f, 0.000036384f, 0.000035325f, 0.000034265f, 0.000033205f,
+    0.000032143f, 0.000031075f, 0.000030019f, 0.000028959f, 0.000027896f,
+    0.000026836f, 0.000025773f, 0.000024714f, 0.000023653f, 0.000022594f,
+    0.000021537f, 0.000020480f, 0.000019425f, 0.000018372f, 0.000017319f,
+    0.000016270f, 0.000015222f, 0.000014176f, 0.000013132f, 0.000012091f,
+    0.000011053f, 0.000010018f, 0.000008985f, 0.000007956f, 0.000006931f,
+    0.000005907f, 0.000004889f, 0.000003874f, 0.000002861f, 0.000001855f,
+    0.000000851f, -0.000000147f, -0.000001142f, -0.000002132f, -0.000003117f,
+    -0.000004097f, -0.000005073f, -0.000006043f, -0.000007008f, -0.000007967f,
+    -0.000008922f, -0.000009870f, -0.000010813f, -0.000011749f, -0.000012680f,
+    -0.000013605f, -0.000014524f, -0.000015435f, -0.000016341f, -0.000017240f,
+    -0.000018132f, -0.000019018f, -0.000019895f, -0.000020767f, -0.000021630f,
+    -0.000022489f, -0.000023335f, -0.000024179f, -0.000025013f, -0.000025841f,
+    -0.000026660f, -0.000027470f, -0.000028274f, -0.000029069f, -0.000029856f,
+    -0.000030634f, -0.000031405f, -0.000032167f, -0.000032921f, -0.000033665f,
+    -0.000034402f, -0.000035129f, -0.000035848f, -0.000036557f, -0.000037258f,
+    -0.000037950f, -0.000038632f, -0.000039306f, -0.000039970f, -0.000040626f,
+    -0.000041270f, -0.000041907f, -0.000042534f, -0.000043150f, -0.000043758f,
+    -0.000044356f, -0.000044945f, -0.000045522f, -0.000046091f, -0.000046649f,
+    -0.000047198f, -0.000047737f, -0.000048265f, -0.000048785f, -0.000049293f,
+    -0.000049791f, -0.000050280f, -0.000050758f, -0.000051226f, -0.000051685f,
+    -0.000052132f, -0.000052569f, -0.000052996f, -0.000053413f, -0.000053818f,
+    -0.000054216f, -0.000054601f, -0.000054976f, -0.000055341f, -0.000055695f,
+    -0.000056039f, -0.000056365f, -0.000056695f, -0.000057008f, -0.000057310f,
+    -0.000057602f, -0.000057883f, -0.000058154f, -0.000058414f, -0.000058664f,
+    -0.000058903f, -0.000059132f, -0.000059351f, -0.000059559f, -0.000059757f,
+    -0.000059945f, -0.000060121f, -0.000060288f, -0.000060445f, -0.000060591f,
+    -0.000060727f, -0.000060852f, -0.000060968f, -0.000061073f, -0.000061168f,
+    -0.000061253f, -0.000061328f, -0.000061393f, -0.000061447f, -0.000061492f,
+    -0.000061527f, -0.000061552f, -0.000061567f, -0.000061572f, -0.000061568f,
+    -0.000061553f, -0.000061529f, -0.000061496f, -0.000061452f, -0.000061399f,
+    -0.000061337f, -0.000061265f, -0.000061185f, -0.000061094f, -0.000060994f,
+    -0.000060885f, -0.000060767f, -0.000060640f, -0.000060504f, -0.000060359f,
+    -0.000060205f, -0.000060042f, -0.000059870f, -0.000059690f, -0.000059501f,
+    -0.000059304f, -0.000059098f, -0.000058874f, -0.000058661f, -0.000058430f,
+    -0.000058190f, -0.000057943f, -0.000057688f, -0.000057424f, -0.000057153f,
+    -0.000056874f, -0.000056588f, -0.000056293f, -0.000055991f, -0.000055682f,
+    -0.000055365f, -0.000055041f, -0.000054710f, -0.000054371f, -0.000054026f,
+    -0.000053674f, -0.000053314f, -0.000052948f, -0.000052576f, -0.000052196f,
+    -0.000051810f, -0.000051418f, -0.000051020f, -0.000050615f, -0.000050204f,
+    -0.000049787f, -0.000049365f, -0.000048936f, -0.000048501f, -0.000048061f,
+    -0.000047615f, -0.000047165f, -0.000046708f, -0.000046246f, -0.000045780f,
+    -0.000045308f, -0.000044831f, -0.000044349f, -0.000043862f, -0.000043371f,
+    -0.000042876f, -0.000042375f, -0.000041871f, -0.000041362f, -0.000040849f,
+    -0.000040333f, -0.000039811f, -0.000039287f, -0.000038758f, -0.000038226f,
+    -0.000037690f, -0.000037151f, -0.000036603f, -0.000036063f, -0.000035514f,
+    -0.000034963f, -0.000034408f, -0.000033851f, -0.000033290f, -0.000032727f,
+    -0.000032162f, -0.000031594f, -0.000031024f, -0.000030452f, -0.000029878f,
+    -0.000029301f, -0.000028723f, -0.000028143f, -0.000027561f, -0.000026978f,
+    -0.000026393f, -0.000025806f, -0.000025220f, -0.000024631f, -0.000024041f,
+    -0.000023450f, -0.000022859f, -0.000022266f, -0.000021674f, -0.000021080f,
+    -0.000020486f, -0.000019891f, -0.000019297f, -0.000018701f, -0.000018107f,
+    -0.000017511f, -0.000016916f, -0.000016322f, -0.000015727f, -0.000015133f,
+    -0.000014540f, -0.000013946f, -0.000013354f, -0.000012763f, -0.000012171f,
+    -0.000011582f, -0.000010993f, -0.000010405f, -0.000009819f, -0.000009234f,
+    -0.000008650f, -0.000008068f, -0.000007487f, -0.000006907f, -0.000006331f,
+    -0.000005754f, -0.000005181f, -0.000004608f, -0.000004040f, -0.000003472f,
+    -0.000002908f, -0.000002344f, -0.000001784f, -0.000001226f, -0.000000670f,
+    -0.000000118f, 0.000000433f, 0.000000980f, 0.000001525f, 0.000002066f,
+    0.000002605f, 0.000003141f, 0.000003673f, 0.000004202f, 0.000004729f,
+    0.000005251f, 0.000005770f, 0.000006285f, 0.000006798f, 0.000007306f,
+    0.000007811f, 0.000008312f, 0.000008810f, 0.000009303f, 0.000009792f,
+    0.000010278f, 0.000010759f, 0.000011236f, 0.000011709f, 0.000012179f,
+    0.000012643f, 0.000013104f, 0.000013559f, 0.000014011f, 0.000014458f,
+    0.000014900f, 0.000015338f, 0.000015771f, 0.000016200f, 0.000016624f,
+    0.000017043f, 0.000017457f, 0.000017866f, 0.000018271f, 0.000018671f,
+    0.000019065f, 0.000019454f, 0.000019839f, 0.000020219f, 0.000020593f,
+    0.000020962f, 0.000021326f, 0.000021684f, 0.000022035f, 0.000022386f,
+    0.000022729f, 0.000023066f, 0.000023398f, 0.000023725f, 0.000024046f,
+    0.000024361f, 0.000024671f, 0.000024976f, 0.000025275f, 0.000025569f,
+    0.000025857f, 0.000026139f, 0.000026416f, 0.000026687f, 0.000026953f,
+    0.000027213f, 0.000027467f, 0.000027715f, 0.000027959f, 0.000028196f,
+    0.000028427f, 0.000028653f, 0.000028873f, 0.000029087f, 0.000029295f,
+    0.000029498f, 0.000029695f, 0.000029886f, 0.000030071f, 0.000030251f,
+    0.000030425f, 0.000030593f, 0.000030756f, 0.000030912f, 0.000031063f,
+    0.000031208f, 0.000031348f, 0.000031481f, 0.000031609f, 0.000031731f,
+    0.000031848f, 0.000031959f, 0.000032064f, 0.000032163f, 0.000032257f,
+    0.000032346f, 0.000032427f, 0.000032505f, 0.000032576f, 0.000032642f,
+    0.000032701f, 0.000032756f, 0.000032805f, 0.000032844f, 0.000032886f,
+    0.000032919f, 0.000032946f, 0.000032968f, 0.000032984f, 0.000032995f,
+    0.000033000f, 0.000033000f, 0.000032995f, 0.000032985f, 0.000032970f,
+    0.000032949f, 0.000032923f, 0.000032892f, 0.000032855f, 0.000032814f,
+    0.000032768f, 0.000032716f, 0.000032660f, 0.000032598f, 0.000032532f,
+    0.000032461f, 0.000032385f, 0.000032304f, 0.000032218f, 0.000032128f,
+    0.000032033f, 0.000031933f, 0.000031829f, 0.000031720f, 0.000031607f,
+    0.000031489f, 0.000031367f, 0.000031240f, 0.000031109f, 0.000030974f,
+    0.000030834f, 0.000030690f, 0.000030542f, 0.000030390f, 0.000030234f,
+    0.000030074f, 0.000029909f, 0.000029741f, 0.000029569f, 0.000029393f,
+    0.000029213f, 0.000029030f, 0.000028843f, 0.000028652f, 0.000028457f,
+    0.000028259f, 0.000028058f, 0.000027853f, 0.000027640f, 0.000027433f,
+    0.000027218f, 0.000026999f, 0.000026778f, 0.000026553f, 0.000026326f,
+    0.000026095f, 0.000025861f, 0.000025625f, 0.000025385f, 0.000025143f,
+    0.000024898f, 0.000024650f, 0.000024400f, 0.000024147f, 0.000023891f,
+    0.000023633f, 0.000023372f, 0.000023110f, 0.000022844f, 0.000022577f,
+    0.000022307f, 0.000022036f, 0.000021762f, 0.000021486f, 0.000021208f,
+    0.000020928f, 0.000020646f, 0.000020363f, 0.000020077f, 0.000019790f,
+    0.000019502f, 0.000019211f, 0.000018916f, 0.000018626f, 0.000018332f,
+    0.000018036f, 0.000017738f, 0.000017440f, 0.000017140f, 0.000016839f,
+    0.000016537f, 0.000016233f, 0.000015929f, 0.000015624f, 0.000015318f,
+    0.000015012f, 0.000014704f, 0.000014396f, 0.000014087f, 0.000013777f,
+    0.000013468f, 0.000013157f, 0.000012846f, 0.000012535f, 0.000012223f,
+    0.000011911f, 0.000011599f, 0.000011286f, 0.000010974f, 0.000010662f,
+    0.000010349f, 0.000010036f, 0.000009724f, 0.000009412f, 0.000009099f,
+    0.000008787f, 0.000008476f, 0.000008164f, 0.000007853f, 0.000007543f,
+    0.000007233f, 0.000006923f, 0.000006614f, 0.000006306f, 0.000005998f,
+    0.000005692f, 0.000005385f, 0.000005080f, 0.000004775f, 0.000004472f,
+    0.000004169f, 0.000003868f, 0.000003567f, 0.000003267f, 0.000002969f,
+    0.000002672f, 0.000002376f, 0.000002081f, 0.000001787f, 0.000001495f,
+    0.000001204f, 0.000000915f, 0.000000627f, 0.000000340f, 0.000000056f,
+    -0.000000228f, -0.000000510f, -0.000000790f, -0.000001068f, -0.000001345f,
+    -0.000001620f, -0.000001893f, -0.000002164f, -0.000002434f, -0.000002701f,
+    -0.000002967f, -0.000003231f, -0.000003493f, -0.000003752f, -0.000004010f,
+    -0.000004266f, -0.000004519f, -0.000004770f, -0.000005019f, -0.000005266f,
+    -0.000005511f, -0.000005753f, -0.000005994f, -0.000006231f, -0.000006467f,
+    -0.000006700f, -0.000006931f, -0.000007159f, -0.000007385f, -0.000007608f,
+    -0.000007829f, -0.000008048f, -0.000008263f, -0.000008477f, -0.000008687f,
+    -0.000008896f, -0.000009101f, -0.000009304f, -0.000009504f, -0.000009702f,
+    -0.000009896f, -0.000010089f, -0.000010276f, -0.000010465f, -0.000010649f,
+    -0.000010830f, -0.000011008f, -0.000011184f, -0.000011356f, -0.000011527f,
+    -0.000011693f, -0.000011858f, -0.000012019f, -0.000012178f, -0.000012333f,
+    -0.000012486f, -0.000012636f, -0.000012783f, -0.000012927f, -0.000013068f,
+    -0.000013206f, -0.000013341f, -0.000013474f, -0.000013603f, -0.000013730f,
+    -0.000013853f, -0.000013974f, -0.000014091f, -0.000014206f, -0.000014317f,
+    -0.000014426f, -0.000014532f, -0.000014634f, -0.000014734f, -0.000014831f,
+    -0.000014925f, -0.000015015f, -0.000015103f, -0.000015188f, -0.000015270f,
+    -0.000015349f, -0.000015425f, -0.000015498f, -0.000015568f, -0.000015635f,
+    -0.000015700f, -0.000015761f, -0.000015819f, -0.000015875f, -0.000015927f,
+    -0.000015977f, -0.000016024f, -0.000016068f, -0.000016109f, -0.000016147f,
+    -0.000016182f, -0.000016215f, -0.000016244f, -0.000016271f, -0.000016295f,
+    -0.000016316f, -0.000016335f, -0.000016350f, -0.000016363f, -0.000016373f,
+    -0.000016381f, -0.000016385f, -0.000016388f, -0.000016387f, -0.000016383f,
+    -0.000016377f, -0.000016369f, -0.000016358f, -0.000016344f, -0.000016327f,
+    -0.000016308f, -0.000016287f, -0.000016263f, -0.000016236f, -0.000016207f,
+    -0.000016175f, -0.000016141f, -0.000016105f, -0.000016066f, -0.000016024f,
+    -0.000015981f, -0.000015935f, -0.000015886f, -0.000015836f, -0.000015783f,
+    -0.000015728f, -0.000015670f, -0.000015610f, -0.000015548f, -0.000015484f,
+    -0.000015418f, -0.000015350f, -0.000015279f, -0.000015207f, -0.000015132f,
+    -0.000015056f, -0.000014977f, -0.000014896f, -0.000014814f, -0.000014729f,
+    -0.000014643f, -0.000014555f, -0.000014464f, -0.000014372f, -0.000014279f,
+    -0.000014183f, -0.000014086f, -0.000013982f, -0.000013886f, -0.000013784f,
+    -0.000013680f, -0.000013574f, -0.000013467f, -0.000013358f, -0.000013247f,
+    -0.000013136f, -0.000013022f, -0.000012907f, -0.000012791f, -0.000012674f,
+    -0.000012555f, -0.000012434f, -0.000012313f, -0.000012190f, -0.000012065f,
+    -0.000011940f, -0.000011813f, -0.000011686f, -0.000011557f, -0.000011427f,
+    -0.000011295f, -0.000011163f, -0.000011030f, -0.000010896f, -0.000010761f,
+    -0.000010624f, -0.000010487f, -0.000010349f, -0.000010211f, -0.000010071f,
+    -0.000009930f, -0.000009789f, -0.000009647f, -0.000009504f, -0.000009361f,
+    -0.000009217f, -0.000009072f, -0.000008927f, -0.000008781f, -0.000008635f,
+    -0.000008488f, -0.000008340f, -0.000008192f, -0.000008044f, -0.000007895f,
+    -0.000007746f, -0.000007596f, -0.000007447f, -0.000007296f, -0.000007146f,
+    -0.000006995f, -0.000006844f, -0.000006693f, -0.000006542f, -0.000006391f,
+    -0.000006239f, -0.000006087f, -0.000005936f, -0.000005784f, -0.000005632f,
+    -0.000005480f, -0.000005329f, -0.000005177f, -0.000005025f, -0.000004874f,
+    -0.000004723f, -0.000004572f, -0.000004421f, -0.000004270f, -0.000004119f,
+    -0.000003969f, -0.000003819f, -0.000003669f, -0.000003520f, -0.000003371f,
+    -0.000003222f, -0.000003074f, -0.000002926f, -0.000002779f, -0.000002632f,
+    -0.000002485f, -0.000002339f, -0.000002194f, -0.000002049f, -0.000001905f,
+    -0.000001761f, -0.000001618f, -0.000001476f, -0.000001334f, -0.000001193f,
+    -0.000001052f, -0.000000912f, -0.000000773f, -0.000000635f, -0.000000498f,
+    -0.000000361f, -0.000000225f, -0.000000090f, 0.000000044f, 0.000000178f,
+    0.000000311f, 0.000000442f, 0.000000573f, 0.000000703f, 0.000000832f,
+    0.000000959f, 0.000001087f, 0.000001212f, 0.000001338f, 0.000001461f,
+    0.000001584f, 0.000001706f, 0.000001827f, 0.000001947f, 0.000002065f,
+    0.000002183f, 0.000002299f, 0.000002415f, 0.000002529f, 0.000002642f,
+    0.000002754f, 0.000002865f, 0.000002974f, 0.000003083f, 0.000003190f,
+    0.000003296f, 0.000003400f, 0.000003504f, 0.000003606f, 0.000003707f,
+    0.000003807f, 0.000003905f, 0.000004003f, 0.000004098f, 0.000004193f,
+    0.000004286f, 0.000004378f, 0.000004469f, 0.000004558f, 0.000004646f,
+    0.000004733f, 0.000004818f, 0.000004902f, 0.000004985f, 0.000005066f,
+    0.000005146f, 0.000005224f, 0.000005301f, 0.000005377f, 0.000005451f,
+    0.000005524f, 0.000005596f, 0.000005666f, 0.000005735f, 0.000005802f,
+    0.000005868f, 0.000005933f, 0.000005996f, 0.000006058f, 0.000006118f,
+    0.000006177f, 0.000006235f, 0.000006291f, 0.000006345f, 0.000006399f,
+    0.000006450f, 0.000006501f, 0.000006550f, 0.000006598f, 0.000006644f,
+    0.000006689f, 0.000006732f, 0.000006774f, 0.000006814f, 0.000006854f,
+    0.000006891f, 0.000006928f, 0.000006963f, 0.000006996f, 0.000007029f,
+    0.000007059f, 0.000007089f, 0.000007117f, 0.000007144f, 0.000007169f,
+    0.000007193f, 0.000007216f, 0.000007237f, 0.000007257f, 0.000007275f,
+    0.000007293f, 0.000007308f, 0.000007323f, 0.000007336f, 0.000007348f,
+    0.000007359f, 0.000007368f, 0.000007376f, 0.000007383f, 0.000007389f,
+    0.000007393f, 0.000007396f, 0.000007397f, 0.000007398f, 0.000007397f,
+    0.000007395f, 0.000007392f, 0.000007387f, 0.000007381f, 0.000007375f,
+    0.000007367f, 0.000007357f, 0.000007347f, 0.000007335f, 0.000007323f,
+    0.000007309f, 0.000007294f, 0.000007278f, 0.000007261f, 0.000007240f,
+    0.000007223f, 0.000007202f, 0.000007181f, 0.000007158f, 0.000007135f,
+    0.000007110f, 0.000007084f, 0.000007057f, 0.000007030f, 0.000007001f,
+    0.000006971f, 0.000006941f, 0.000006909f, 0.000006876f, 0.000006843f,
+    0.000006809f, 0.000006773f, 0.000006737f, 0.000006700f, 0.000006662f,
+    0.000006623f, 0.000006584f, 0.000006543f, 0.000006502f, 0.000006460f,
+    0.000006417f, 0.000006373f, 0.000006328f, 0.000006283f, 0.000006237f,
+    0.000006191f, 0.000006143f, 0.000006095f, 0.000006046f, 0.000005997f,
+    0.000005946f, 0.000005896f, 0.000005844f, 0.000005792f, 0.000005739f,
+    0.000005686f, 0.000005632f, 0.000005578f, 0.000005523f, 0.000005467f,
+    0.000005411f, 0.000005354f, 0.000005297f, 0.000005239f, 0.000005181f,
+    0.000005123f, 0.000005064f, 0.000005004f, 0.000004944f, 0.000004884f,
+    0.000004823f, 0.000004762f, 0.000004701f, 0.000004639f, 0.000004577f,
+    0.000004514f, 0.000004451f, 0.000004388f, 0.000004324f, 0.000004261f,
+    0.000004197f, 0.000004132f, 0.000004068f, 0.000004003f, 0.000003938f,
+    0.000003873f, 0.000003808f, 0.000003742f, 0.000003676f, 0.000003610f,
+    0.000003544f, 0.000003478f, 0.000003412f, 0.000003345f, 0.000003279f,
+    0.000003212f, 0.000003146f, 0.000003079f, 0.000003012f, 0.000002945f,
+    0.000002879f, 0.000002812f, 0.000002745f, 0.000002678f, 0.000002611f,
+    0.000002545f, 0.000002478f, 0.000002411f, 0.000002345f, 0.000002278f,
+    0.000002212f, 0.000002145f, 0.000002079f, 0.000002013f, 0.000001947f,
+    0.000001881f, 0.000001816f, 0.000001750f, 0.000001685f, 0.000001620f,
+    0.000001555f, 0.000001490f, 0.000001426f, 0.000001361f, 0.000001297f,
+    0.000001233f, 0.000001170f, 0.000001107f, 0.000001044f, 0.000000981f,
+    0.000000918f, 0.000000856f, 0.000000794f, 0.000000733f, 0.000000672f,
+    0.000000611f, 0.000000550f, 0.000000490f, 0.000000430f, 0.000000370f,
+    0.000000311f, 0.000000253f, 0.000000194f, 0.000000136f, 0.000000079f,
+    0.000000022f, -0.000000035f, -0.000000092f, -0.000000147f, -0.000000203f,
+    -0.000000258f, -0.000000312f, -0.000000367f, -0.000000420f, -0.000000473f,
+    -0.000000526f, -0.000000578f, -0.000000630f, -0.000000681f, -0.000000732f,
+    -0.000000782f, -0.000000832f, -0.000000881f, -0.000000930f, -0.000000978f,
+    -0.000001026f, -0.000001073f, -0.000001120f, -0.000001166f, -0.000001211f,
+    -0.000001256f, -0.000001301f, -0.000001345f, -0.000001388f, -0.000001431f,
+    -0.000001473f, -0.000001515f, -0.000001556f, -0.000001596f, -0.000001636f,
+    -0.000001676f, -0.000001714f, -0.000001752f, -0.000001790f, -0.000001827f,
+    -0.000001863f, -0.000001899f, -0.000001935f, -0.000001969f, -0.000002003f,
+    -0.000002037f, -0.000002069f, -0.000002102f, -0.000002133f, -0.000002164f,
+    -0.000002195f, -0.000002224f, -0.000002254f, -0.000002282f, -0.000002310f,
+    -0.000002338f, -0.000002364f, -0.000002390f, -0.000002416f, -0.000002441f,
+    -0.000002465f, -0.000002489f, -0.000002512f, -0.000002535f, -0.000002556f,
+    -0.000002578f, -0.000002598f, -0.000002618f, -0.000002638f, -0.000002657f,
+    -0.000002675f, -0.000002693f, -0.000002710f, -0.000002726f, -0.000002742f,
+    -0.000002757f, -0.000002772f, -0.000002786f, -0.000002800f, -0.000002812f,
+    -0.000002825f, -0.000002836f, -0.000002848f, -0.000002858f, -0.000002868f,
+    -0.000002878f, -0.000002886f, -0.000002895f, -0.000002902f, -0.000002910f,
+    -0.000002916f, -0.000002922f, -0.000002928f, -0.000002933f, -0.000002937f,
+    -0.000002941f, -0.000002944f, -0.000002947f, -0.000002949f, -0.000002951f,
+    -0.000002952f, -0.000002953f, -0.000002953f, -0.000002953f, -0.000002952f,
+    -0.000002950f, -0.000002949f, -0.000002946f, -0.000002943f, -0.000002940f,
+    -0.000002936f, -0.000002932f, -0.000002927f, -0.000002922f, -0.000002916f,
+    -0.000002910f, -0.000002903f, -0.000002896f, -0.000002889f, -0.000002881f,
+    -0.000002872f, -0.000002863f, -0.000002854f, -0.000002844f, -0.000002834f,
+    -0.000002824f, -0.000002813f, -0.000002801f, -0.000002790f, -0.000002777f,
+    -0.000002765f, -0.000002752f, -0.000002739f, -0.000002725f, -0.000002711f,
+    -0.000002697f, -0.000002682f, -0.000002667f, -0.000002651f, -0.000002636f,
+    -0.000002620f, -0.000002603f, -0.000002586f, -0.000002569f, -0.000002552f,
+    -0.000002534f, -0.000002516f, -0.000002498f, -0.000002479f, -0.000002460f,
+    -0.000002441f, -0.000002422f, -0.000002402f, -0.000002382f, -0.000002362f,
+    -0.000002342f, -0.000002321f, -0.000002300f, -0.000002279f, -0.000002258f,
+    -0.000002236f, -0.000002214f, -0.000002192f, -0.000002170f, -0.000002147f,
+    -0.000002125f, -0.000002102f, -0.000002079f, -0.000002056f, -0.000002032f,
+    -0.000002009f, -0.000001985f, -0.000001961f, -0.000001937f, -0.000001913f,
+    -0.000001889f, -0.000001865f, -0.000001840f, -0.000001816f, -0.000001791f,
+    -0.000001766f, -0.000001741f, -0.000001716f, -0.000001691f, -0.000001665f,
+    -0.000001640f, -0.000001615f, -0.000001589f, -0.000001564f, -0.000001538f,
+    -0.000001512f, -0.000001487f, -0.000001461f, -0.000001435f, -0.000001409f,
+    -0.000001383f, -0.000001357f, -0.000001331f, -0.000001305f, -0.000001280f,
+    -0.000001254f, -0.000001227f, -0.000001202f, -0.000001176f, -0.000001150f,
+    -0.000001124f, -0.000001098f, -0.000001072f, -0.000001046f, -0.000001020f,
+    -0.000000994f, -0.000000969f, -0.000000943f, -0.000000917f, -0.000000892f,
+    -0.000000866f, -0.000000840f, -0.000000815f, -0.000000790f, -0.000000764f,
+    -0.000000739f, -0.000000714f, -0.000000689f, -0.000000664f, -0.000000639f,
+    -0.000000615f, -0.000000590f, -0.000000565f, -0.000000541f, -0.000000517f,
+    -0.000000492f, -0.000000468f, -0.000000444f, -0.000000421f, -0.000000397f,
+    -0.000000373f, -0.000000350f, -0.000000327f, -0.000000304f, -0.000000281f,
+    -0.000000258f, -0.000000235f, -0.000000212f, -0.000000190f, -0.000000168f,
+    -0.000000146f, -0.000000124f, -0.000000102f, -0.000000081f, -0.000000059f,
+    -0.000000038f, -0.000000017f, 0.000000004f, 0.000000025f, 0.000000045f,
+    0.000000065f, 0.000000085f, 0.000000105f, 0.000000125f, 0.000000145f,
+    0.000000164f, 0.000000183f, 0.000000202f, 0.000000221f, 0.000000239f,
+    0.000000257f, 0.000000276f, 0.000000293f, 0.000000311f, 0.000000329f,
+    0.000000346f, 0.000000363f, 0.000000380f, 0.000000396f, 0.000000413f,
+    0.000000429f, 0.000000445f, 0.000000460f, 0.000000476f, 0.000000491f,
+    0.000000506f, 0.000000521f, 0.000000536f, 0.000000550f, 0.000000564f,
+    0.000000578f, 0.000000592f, 0.000000605f, 0.000000618f, 0.000000631f,
+    0.000000644f, 0.000000657f, 0.000000669f, 0.000000681f, 0.000000693f,
+    0.000000705f, 0.000000716f, 0.000000727f, 0.000000738f, 0.000000749f,
+    0.000000759f, 0.000000769f, 0.000000779f, 0.000000789f, 0.000000798f,
+    0.000000808f, 0.000000817f, 0.000000826f, 0.000000834f, 0.000000842f,
+    0.000000851f, 0.000000858f, 0.000000866f, 0.000000874f, 0.000000881f,
+    0.000000888f, 0.000000894f, 0.000000901f, 0.000000907f, 0.000000913f,
+    0.000000919f, 0.000000925f, 0.000000930f, 0.000000935f, 0.000000940f,
+    0.000000945f, 0.000000950f, 0.000000954f, 0.000000958f, 0.000000962f,
+    0.000000966f, 0.000000969f, 0.000000972f, 0.000000975f, 0.000000978f,
+    0.000000981f, 0.000000983f, 0.000000986f, 0.000000988f, 0.000000989f,
+    0.000000991f, 0.000000992f, 0.000000994f, 0.000000995f, 0.000000996f,
+    0.000000996f, 0.000000997f, 0.000000997f, 0.000000997f, 0.000000997f,
+    0.000000997f, 0.000000996f, 0.000000996f, 0.000000995f, 0.000000994f,
+    0.000000993f, 0.000000991f, 0.000000990f, 0.000000988f, 0.000000986f,
+    0.000000984f, 0.000000982f, 0.000000980f, 0.000000977f, 0.000000974f,
+    0.000000972f, 0.000000969f, 0.000000966f, 0.000000962f, 0.000000959f,
+    0.000000955f, 0.000000952f, 0.000000948f, 0.000000944f, 0.000000940f,
+    0.000000935f, 0.000000931f, 0.000000927f, 0.000000922f, 0.000000917f,
+    0.000000912f, 0.000000907f, 0.000000902f, 0.000000897f, 0.000000891f,
+    0.000000886f, 0.000000880f, 0.000000875f, 0.000000869f, 0.000000863f,
+    0.000000857f, 0.000000851f, 0.000000844f, 0.000000838f, 0.000000832f,
+    0.000000825f, 0.000000819f, 0.000000812f, 0.000000805f, 0.000000798f,
+    0.000000791f, 0.000000784f, 0.000000777f, 0.000000770f, 0.000000763f,
+    0.000000755f, 0.000000748f, 0.000000741f, 0.000000733f, 0.000000725f,
+    0.000000718f, 0.000000710f, 0.000000702f, 0.000000694f, 0.000000687f,
+    0.000000679f, 0.000000671f, 0.000000663f, 0.000000655f, 0.000000646f,
+    0.000000638f, 0.000000630f, 0.000000622f, 0.000000614f, 0.000000605f,
+    0.000000597f, 0.000000589f, 0.000000580f, 0.000000572f, 0.000000563f,
+    0.000000555f, 0.000000546f, 0.000000538f, 0.000000529f, 0.000000521f,
+    0.000000512f, 0.000000504f, 0.000000495f, 0.000000487f, 0.000000478f,
+    0.000000470f, 0.000000461f, 0.000000453f, 0.000000444f, 0.000000435f,
+    0.000000427f, 0.000000418f, 0.000000410f, 0.000000401f, 0.000000393f,
+    0.000000384f, 0.000000376f, 0.000000367f, 0.000000359f, 0.000000350f,
+    0.000000342f, 0.000000333f, 0.000000325f, 0.000000317f, 0.000000308f,
+    0.000000300f, 0.000000292f, 0.000000284f, 0.000000275f, 0.000000267f,
+    0.000000259f, 0.000000251f, 0.000000243f, 0.000000235f, 0.000000227f,
+    0.000000219f, 0.000000211f, 0.000000203f, 0.000000195f, 0.000000188f,
+    0.000000180f, 0.000000172f, 0.000000165f, 0.000000157f, 0.000000149f,
+    0.000000142f, 0.000000135f, 0.000000127f, 0.000000120f, 0.000000113f,
+    0.000000105f, 0.000000098f, 0.000000091f, 0.000000084f, 0.000000077f,
+    0.000000070f, 0.000000063f, 0.000000057f, 0.000000050f, 0.000000043f,
+    0.000000037f, 0.000000030f, 0.000000024f, 0.000000017f, 0.000000011f,
+    0.000000005f, -0.000000002f, -0.000000008f, -0.000000014f, -0.000000020f,
+    -0.000000026f, -0.000000032f, -0.000000037f, -0.000000043f, -0.000000049f,
+    -0.000000054f, -0.000000060f, -0.000000065f, -0.000000071f, -0.000000076f,
+    -0.000000081f, -0.000000086f, -0.000000091f, -0.000000096f, -0.000000101f,
+    -0.000000106f, -0.000000111f, -0.000000116f, -0.000000120f, -0.000000125f,
+    -0.000000129f, -0.000000134f, -0.000000138f, -0.000000142f, -0.000000146f,
+    -0.000000150f, -0.000000154f, -0.000000158f, -0.000000162f, -0.000000166f,
+    -0.000000170f, -0.000000173f, -0.000000177f, -0.000000180f, -0.000000184f,
+    -0.000000187f, -0.000000190f, -0.000000193f, -0.000000196f, -0.000000199f,
+    -0.000000202f, -0.000000205f, -0.000000208f, -0.000000211f, -0.000000213f,
+    -0.000000216f, -0.000000218f, -0.000000221f, -0.000000223f, -0.000000226f,
+    -0.000000228f, -0.000000230f, -0.000000232f, -0.000000234f, -0.000000236f,
+    -0.000000238f, -0.000000239f, -0.000000241f, -0.000000243f, -0.000000244f,
+    -0.000000246f, -0.000000247f, -0.000000249f, -0.000000250f, -0.000000251f,
+    -0.000000252f, -0.000000253f, -0.000000255f, -0.000000255f, -0.000000256f,
+    -0.000000257f, -0.000000258f, -0.000000259f, -0.000000259f, -0.000000260f,
+    -0.000000260f, -0.000000261f, -0.000000261f, -0.000000262f, -0.000000262f,
+    -0.000000262f, -0.000000262f, -0.000000263f, -0.000000263f, -0.000000263f,
+    -0.000000263f, -0.000000262f, -0.000000262f, -0.000000262f, -0.000000262f,
+    -0.000000262f, -0.000000261f, -0.000000261f, -0.000000260f, -0.000000260f,
+    -0.000000259f, -0.000000259f, -0.000000258f, -0.000000257f, -0.000000257f,
+    -0.000000256f, -0.000000255f, -0.000000254f, -0.000000253f, -0.000000252f,
+    -0.000000251f, -0.000000250f, -0.000000249f, -0.000000248f, -0.000000247f,
+    -0.000000245f, -0.000000244f, -0.000000243f, -0.000000242f, -0.000000240f,
+    -0.000000239f, -0.000000237f, -0.000000236f, -0.000000235f, -0.000000233f,
+    -0.000000231f, -0.000000230f, -0.000000228f, -0.000000227f, -0.000000225f,
+    -0.000000223f, -0.000000222f, -0.000000220f, -0.000000218f, -0.000000216f,
+    -0.000000214f, -0.000000213f, -0.000000211f, -0.000000209f, -0.000000207f,
+    -0.000000205f, -0.000000203f, -0.000000201f, -0.000000199f, -0.000000197f,
+    -0.000000195f, -0.000000193f, -0.000000191f, -0.000000189f, -0.000000187f,
+    -0.000000185f, -0.000000183f, -0.000000181f, -0.000000178f, -0.000000176f,
+    -0.000000174f, -0.000000172f, -0.000000170f, -0.000000168f, -0.000000165f,
+    -0.000000163f, -0.000000161f, -0.000000159f, -0.000000156f, -0.000000154f,
+    -0.000000152f, -0.000000150f, -0.000000148f, -0.000000145f, -0.000000143f,
+    -0.000000141f, -0.000000139f, -0.000000136f, -0.000000134f, -0.000000132f,
+    -0.000000130f, -0.000000127f, -0.000000125f, -0.000000123f, -0.000000121f,
+    -0.000000118f, -0.000000116f, -0.000000114f, -0.000000112f, -0.000000109f,
+    -0.000000107f, -0.000000105f, -0.000000103f, -0.000000101f, -0.000000098f,
+    -0.000000096f, -0.000000094f, -0.000000092f, -0.000000090f, -0.000000088f,
+    -0.000000085f, -0.000000083f, -0.000000081f, -0.000000079f, -0.000000077f,
+    -0.000000075f, -0.000000073f, -0.000000071f, -0.000000069f, -0.000000067f,
+    -0.000000065f, -0.000000063f, -0.000000061f, -0.000000059f, -0.000000057f,
+    -0.000000055f, -0.000000053f, -0.000000051f, -0.000000049f, -0.000000047f,
+    -0.000000045f, -0.000000043f, -0.000000041f, -0.000000040f, -0.000000038f,
+    -0.000000036f, -0.000000034f, -0.000000032f, -0.000000031f, -0.000000029f,
+    -0.000000027f, -0.000000026f, -0.000000024f, -0.000000022f, -0.000000021f,
+    -0.000000019f, -0.000000017f, -0.000000016f, -0.000000014f, -0.000000013f,
+    -0.000000011f, -0.000000010f, -0.000000008f, -0.000000007f, -0.000000005f,
+    -0.000000004f, -0.000000003f, -0.000000001f, 0.000000000f, 0.000000001f,
+    0.000000003f, 0.000000004f, 0.000000005f, 0.000000007f, 0.000000008f,
+    0.000000009f, 0.000000010f, 0.000000011f, 0.000000012f, 0.000000014f,
+    0.000000015f, 0.000000016f, 0.000000017f, 0.000000018f, 0.000000019f,
+    0.000000020f, 0.000000021f, 0.000000022f, 0.000000023f, 0.000000024f,
+    0.000000025f, 0.000000026f, 0.000000026f, 0.000000027f, 0.000000028f,
+    0.000000029f, 0.000000030f, 0.000000030f, 0.000000031f, 0.000000032f,
+    0.000000033f, 0.000000033f, 0.000000034f, 0.000000035f, 0.000000035f,
+    0.000000036f, 0.000000036f, 0.000000037f, 0.000000037f, 0.000000038f,
+    0.000000038f, 0.000000039f, 0.000000039f, 0.000000040f, 0.000000040f,
+    0.000000041f, 0.000000041f, 0.000000042f, 0.000000042f, 0.000000042f,
+    0.000000043f, 0.000000043f, 0.000000043f, 0.000000043f, 0.000000044f,
+    0.000000044f, 0.000000044f, 0.000000044f, 0.000000045f, 0.000000045f,
+    0.000000045f, 0.000000045f, 0.000000045f, 0.000000045f, 0.000000045f,
+    0.000000046f, 0.000000046f, 0.000000046f, 0.000000046f, 0.000000046f,
+    0.000000046f, 0.000000046f, 0.000000046f, 0.000000046f, 0.000000046f,
+    0.000000046f, 0.000000046f, 0.000000046f, 0.000000045f, 0.000000045f,
+    0.000000045f, 0.000000045f, 0.000000045f, 0.000000045f, 0.000000045f,
+    0.000000045f, 0.000000044f, 0.000000044f, 0.000000044f, 0.000000044f,
+    0.000000044f, 0.000000043f, 0.000000043f, 0.000000043f, 0.000000043f,
+    0.000000042f, 0.000000042f, 0.000000042f, 0.000000042f, 0.000000041f,
+    0.000000041f, 0.000000041f, 0.000000040f, 0.000000040f, 0.000000040f,
+    0.000000039f, 0.000000039f, 0.000000039f, 0.000000038f, 0.000000038f,
+    0.000000038f, 0.000000037f, 0.000000037f, 0.000000037f, 0.000000036f,
+    0.000000036f, 0.000000035f, 0.000000035f, 0.000000035f, 0.000000034f,
+    0.000000034f, 0.000000033f, 0.000000033f, 0.000000033f, 0.000000032f,
+    0.000000032f, 0.000000031f, 0.000000031f, 0.000000030f, 0.000000030f,
+    0.000000030f, 0.000000029f, 0.000000029f, 0.000000028f, 0.000000028f,
+    0.000000027f, 0.000000027f, 0.000000026f, 0.000000026f, 0.000000026f,
+    0.000000025f, 0.000000025f, 0.000000024f, 0.000000024f, 0.000000023f,
+    0.000000023f, 0.000000022f, 0.000000022f, 0.000000022f, 0.000000021f,
+    0.000000021f, 0.000000020f, 0.000000020f, 0.000000019f, 0.000000019f,
+    0.000000019f, 0.000000018f, 0.000000018f, 0.000000017f, 0.000000017f,
+    0.000000016f, 0.000000016f, 0.000000016f, 0.000000015f, 0.000000015f,
+    0.000000014f, 0.000000014f, 0.000000013f, 0.000000013f, 0.000000013f,
+    0.000000012f, 0.000000012f, 0.000000012f, 0.000000011f, 0.000000011f,
+    0.000000010f, 0.000000000f
+};
+
 /* vi: set ts=4 sw=4 expandtab: */
+
@@ -176,6 +176,270 @@ static void SDLCALL SDL_ConvertMonoToStereo_SSE(SDL_AudioCVT *cvt, SDL_AudioForm
 /* Include the autogenerated channel converters... */
 #include "SDL_audio_channel_converters.h"
 
+#ifdef HAVE_SSE_INTRINSICS
+/* SSE versions of the 5.1 and 7.1 up/downmixes above.
+   These do the same multiplies and adds in the same order as the generated
+   converters, so the output is identical. */
+
+static void SDLCALL SDL_Convert51ToStereo_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *)cvt->buf;
+    const float *src = dst;
+    int i = cvt->len_cvt / (sizeof(float) * 6);
+    const __m128 front = _mm_set1_ps(0.294545442f);
+    const __m128 center = _mm_set1_ps(0.208181813f);
+    const __m128 lfe = _mm_set1_ps(0.090909094f);
+    const __m128 back_left = _mm_setr_ps(0.251818180f, 0.154545456f, 0.251818180f, 0.154545456f);
+    const __m128 back_right = _mm_setr_ps(0.154545456f, 0.251818180f, 0.154545456f, 0.251818180f);
+
+    LOG_DEBUG_CONVERT("5.1", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    while (i >= 2) {
+        const __m128 in1 = _mm_loadu_ps(&src[0]); /* FL0 FR0 FC0 LFE0 */
+        const __m128 in2 = _mm_loadu_ps(&src[4]); /* BL0 BR0 FL1 FR1 */
+        const __m128 in3 = _mm_loadu_ps(&src[8]); /* FC1 LFE1 BL1 BR1 */
+        __m128 out = _mm_mul_ps(_mm_shuffle_ps(in1, in2, _MM_SHUFFLE(3, 2, 1, 0)), front);
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(in1, in3, _MM_SHUFFLE(0, 0, 2, 2)), center));
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(in1, in3, _MM_SHUFFLE(1, 1, 3, 3)), lfe));
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(in2, in3, _MM_SHUFFLE(2, 2, 0, 0)), back_left));
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(in2, in3, _MM_SHUFFLE(3, 3, 1, 1)), back_right));
+        _mm_storeu_ps(dst, out);
+        i -= 2;
+        src += 12;
+        dst += 4;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    if (i) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        dst[0] /* FL */ = (src[0] * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.251818180f) + (srcBR * 0.154545456f);
+        dst[1] /* FR */ = (src[1] * 0.294545442f) + (srcFC * 0.208181813f) + (srcLFE * 0.090909094f) + (srcBL * 0.154545456f) + (srcBR * 0.251818180f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 6) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, format);
+    }
+}
+
+static void SDLCALL SDL_Convert71ToStereo_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *)cvt->buf;
+    const float *src = dst;
+    int i = cvt->len_cvt / (sizeof(float) * 8);
+    const __m128 front = _mm_set1_ps(0.211866662f);
+    const __m128 center = _mm_set1_ps(0.150266662f);
+    const __m128 lfe = _mm_set1_ps(0.066666670f);
+    const __m128 back_left = _mm_setr_ps(0.181066677f, 0.111066669f, 0.181066677f, 0.111066669f);
+    const __m128 back_right = _mm_setr_ps(0.111066669f, 0.181066677f, 0.111066669f, 0.181066677f);
+    const __m128 side_left = _mm_setr_ps(0.194133341f, 0.085866667f, 0.194133341f, 0.085866667f);
+    const __m128 side_right = _mm_setr_ps(0.085866667f, 0.194133341f, 0.085866667f, 0.194133341f);
+
+    LOG_DEBUG_CONVERT("7.1", "stereo (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    while (i >= 2) {
+        const __m128 front1 = _mm_loadu_ps(&src[0]);  /* FL0 FR0 FC0 LFE0 */
+        const __m128 back1 = _mm_loadu_ps(&src[4]);   /* BL0 BR0 SL0 SR0 */
+        const __m128 front2 = _mm_loadu_ps(&src[8]);  /* FL1 FR1 FC1 LFE1 */
+        const __m128 back2 = _mm_loadu_ps(&src[12]);  /* BL1 BR1 SL1 SR1 */
+        __m128 out = _mm_mul_ps(_mm_movelh_ps(front1, front2), front);
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(front1, front2, _MM_SHUFFLE(2, 2, 2, 2)), center));
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(front1, front2, _MM_SHUFFLE(3, 3, 3, 3)), lfe));
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(back1, back2, _MM_SHUFFLE(0, 0, 0, 0)), back_left));
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(back1, back2, _MM_SHUFFLE(1, 1, 1, 1)), back_right));
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(back1, back2, _MM_SHUFFLE(2, 2, 2, 2)), side_left));
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(back1, back2, _MM_SHUFFLE(3, 3, 3, 3)), side_right));
+        _mm_storeu_ps(dst, out);
+        i -= 2;
+        src += 16;
+        dst += 4;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    if (i) {
+        const float srcFC = src[2];
+        const float srcLFE = src[3];
+        const float srcBL = src[4];
+        const float srcBR = src[5];
+        const float srcSL = src[6];
+        const float srcSR = src[7];
+        dst[0] /* FL */ = (src[0] * 0.211866662f) + (srcFC * 0.150266662f) + (srcLFE * 0.066666670f) + (srcBL * 0.181066677f) + (srcBR * 0.111066669f) + (srcSL * 0.194133341f) + (srcSR * 0.085866667f);
+        dst[1] /* FR */ = (src[1] * 0.211866662f) + (srcFC * 0.150266662f) + (srcLFE * 0.066666670f) + (srcBL * 0.111066669f) + (srcBR * 0.181066677f) + (srcSL * 0.085866667f) + (srcSR * 0.194133341f);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, format);
+    }
+}
+
+static void SDLCALL SDL_Convert71To51_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    float *dst = (float *)cvt->buf;
+    const float *src = dst;
+    int i = cvt->len_cvt / (sizeof(float) * 8);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 front_scale = _mm_setr_ps(0.518000007f, 0.518000007f, 0.518000007f, 1.0f);
+    const __m128 side_to_front = _mm_set1_ps(0.188999996f);
+    const __m128 back_scale = _mm_setr_ps(0.518000007f, 0.518000007f, 0.481999993f, 0.481999993f);
+
+    LOG_DEBUG_CONVERT("7.1", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* One frame at a time, the output frames don't line up with the registers. */
+    for (; i; i--, src += 8, dst += 6) {
+        const __m128 front = _mm_loadu_ps(&src[0]); /* FL FR FC LFE */
+        const __m128 back = _mm_loadu_ps(&src[4]);  /* BL BR SL SR */
+        /* FL*a+SL*b, FR*a+SR*b, FC*a, LFE */
+        const __m128 out1 = _mm_add_ps(_mm_mul_ps(front, front_scale), _mm_movelh_ps(_mm_mul_ps(_mm_movehl_ps(back, back), side_to_front), zero));
+        /* BL*a+SL*c, BR*a+SR*c in the low half */
+        const __m128 scaled = _mm_mul_ps(back, back_scale);
+        const __m128 out2 = _mm_add_ps(scaled, _mm_movehl_ps(scaled, scaled));
+        _mm_storeu_ps(&dst[0], out1);
+        _mm_storel_pi((__m64 *)&dst[4], out2);
+    }
+
+    cvt->len_cvt = (cvt->len_cvt / 8) * 6;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, format);
+    }
+}
+
+static void SDLCALL SDL_ConvertStereoTo51_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(float) * 2);
+    int i = num_frames & ~1;
+    const __m128 zero = _mm_setzero_ps();
+
+    LOG_DEBUG_CONVERT("stereo", "5.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    if (i != num_frames) {
+        dst[i * 6 + 5] /* BR */ = 0.0f;
+        dst[i * 6 + 4] /* BL */ = 0.0f;
+        dst[i * 6 + 3] /* LFE */ = 0.0f;
+        dst[i * 6 + 2] /* FC */ = 0.0f;
+        dst[i * 6 + 1] /* FR */ = src[i * 2 + 1];
+        dst[i * 6 + 0] /* FL */ = src[i * 2];
+    }
+
+    while (i) {
+        i -= 2;
+
+        {
+        const __m128 in = _mm_loadu_ps(&src[i * 2]); /* FL0 FR0 FL1 FR1 */
+        float *out = &dst[i * 6];
+        _mm_storeu_ps(&out[8], zero);
+        _mm_storeu_ps(&out[4], _mm_shuffle_ps(zero, in, _MM_SHUFFLE(3, 2, 0, 0)));
+        _mm_storeu_ps(&out[0], _mm_movelh_ps(in, zero));
+        }
+    }
+
+    cvt->len_cvt = num_frames * 6 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, format);
+    }
+}
+
+static void SDLCALL SDL_ConvertStereoTo71_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(float) * 2);
+    int i = num_frames & ~1;
+    const __m128 zero = _mm_setzero_ps();
+
+    LOG_DEBUG_CONVERT("stereo", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    if (i != num_frames) {
+        const __m128 in = _mm_loadl_pi(zero, (const __m64 *)&src[i * 2]);
+        _mm_storeu_ps(&dst[i * 8 + 4], zero);
+        _mm_storeu_ps(&dst[i * 8], in);
+    }
+
+    while (i) {
+        i -= 2;
+
+        {
+        const __m128 in = _mm_loadu_ps(&src[i * 2]); /* FL0 FR0 FL1 FR1 */
+        float *out = &dst[i * 8];
+        _mm_storeu_ps(&out[12], zero);
+        _mm_storeu_ps(&out[8], _mm_movehl_ps(zero, in));
+        _mm_storeu_ps(&out[4], zero);
+        _mm_storeu_ps(&out[0], _mm_movelh_ps(in, zero));
+        }
+    }
+
+    cvt->len_cvt = num_frames * 8 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, format);
+    }
+}
+
+static void SDLCALL SDL_Convert51To71_SSE(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(float) * 6);
+    int i = num_frames & ~1;
+    const __m128 zero = _mm_setzero_ps();
+
+    LOG_DEBUG_CONVERT("5.1", "7.1 (using SSE)");
+    SDL_assert(format == AUDIO_F32SYS);
+
+    /* convert backwards, since output is growing in-place. */
+    if (i != num_frames) {
+        const __m128 back = _mm_loadl_pi(zero, (const __m64 *)&src[i * 6 + 4]);
+        const __m128 front = _mm_loadu_ps(&src[i * 6]);
+        _mm_storeu_ps(&dst[i * 8 + 4], back);
+        _mm_storeu_ps(&dst[i * 8], front);
+    }
+
+    while (i) {
+        i -= 2;
+
+        {
+        const __m128 in1 = _mm_loadu_ps(&src[i * 6]);     /* FL0 FR0 FC0 LFE0 */
+        const __m128 in2 = _mm_loadu_ps(&src[i * 6 + 4]); /* BL0 BR0 FL1 FR1 */
+        const __m128 in3 = _mm_loadu_ps(&src[i * 6 + 8]); /* FC1 LFE1 BL1 BR1 */
+        float *out = &dst[i * 8];
+        _mm_storeu_ps(&out[12], _mm_movehl_ps(zero, in3));
+        _mm_storeu_ps(&out[8], _mm_shuffle_ps(in2, in3, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm_storeu_ps(&out[4], _mm_movelh_ps(in2, zero));
+        _mm_storeu_ps(&out[0], in1);
+        }
+    }
+
+    cvt->len_cvt = num_frames * 8 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, format);
+    }
+}
+
+static const struct
+{
+    SDL_AudioFilter scalar;
+    SDL_AudioFilter simd;
+} sse_channel_converters[] = {
+    { SDL_Convert51ToStereo, SDL_Convert51ToStereo_SSE },
+    { SDL_Convert71ToStereo, SDL_Convert71ToStereo_SSE },
+    { SDL_Convert71To51, SDL_Convert71To51_SSE },
+    { SDL_ConvertStereoTo51, SDL_ConvertStereoTo51_SSE },
+    { SDL_ConvertStereoTo71, SDL_ConvertStereoTo71_SSE },
+    { SDL_Convert51To71, SDL_Convert51To71_SSE },
+};
+#endif
+
 /* SDL's resampler uses a "bandlimited interpolation" algorithm:
      https://ccrma.stanford.edu/~jos/resample/ */
 
@@ -196,8 +460,282 @@ static Sint32 ResamplerPadding(const Sint32 inrate, const Sint32 outrate)
     return RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
 }
 
+/* Calculates one output frame as the dot product of num_taps consecutive input frames and the coefficients */
+typedef void (*SDL_ResampleFrameFunc)(const float *frames, const float *coefs, const int num_taps, const int chans, float *out);
+
+typedef struct
+{
+    SDL_AudioResamplingQuality quality;
+    int inrate;
+    int outrate;
+    int num_taps;   /* a multiple of four, the extra taps have zero coefficients */
+    int first_tap;  /* offset of the first tap from the source frame */
+    int phase_step; /* every source fraction is a multiple of the gcd of the rates */
+    int num_phases; /* 0 if the coefficients are calculated for every frame instead */
+    float *bank;    /* num_phases rows of num_taps coefficients */
+    float *scratch; /* num_taps coefficients, then num_taps frames for the edges */
+    SDL_ResampleFrameFunc resample_frame;
+} SDL_AudioResampler;
+
+/* The coefficient bank isn't worth it for rates without a small common period */
+#define RESAMPLER_MAX_BANK_SIZE (64 * 1024)
+
+/* Pass this as max_outframes when the resampler is used for more than one buffer */
+#define RESAMPLER_UNBOUNDED_OUTPUT 0
+
+static SDL_AudioResamplingQuality GetResamplingQualityHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_RESAMPLING_QUALITY);
+
+    if (hint) {
+        if (*hint == '0' || SDL_strcasecmp(hint, "linear") == 0) {
+            return SDL_AUDIO_RESAMPLING_LINEAR;
+        } else if (*hint == '2' || SDL_strcasecmp(hint, "high") == 0) {
+            return SDL_AUDIO_RESAMPLING_HIGH;
+        }
+    }
+    return SDL_AUDIO_RESAMPLING_MEDIUM;
+}
+
+/* The high quality filter is stretched to the output rate when downsampling, so it stays band limited */
+static int GetHighQualityHalfTaps(const int inrate, const int outrate)
+{
+    if (inrate > outrate) {
+        return (int)(((Sint64)RESAMPLER_HQ_ZERO_CROSSINGS * inrate + outrate - 1) / outrate);
+    }
+    return RESAMPLER_HQ_ZERO_CROSSINGS;
+}
+
+static void SDL_CalculateResamplerCoefficients(const SDL_AudioResampler *resampler, const int srcfraction, float *coefs)
+{
+    const int outrate = resampler->outrate;
+    int j;
+
+    SDL_memset(coefs, 0, resampler->num_taps * sizeof(float));
+
+    switch (resampler->quality) {
+    case SDL_AUDIO_RESAMPLING_LINEAR:
+    {
+        const float interpolation = ((float)srcfraction) / ((float)outrate);
+        coefs[0] = 1.0f - interpolation;
+        coefs[1] = interpolation;
+        break;
+    }
+    case SDL_AUDIO_RESAMPLING_HIGH:
+    {
+        const double scale = (resampler->inrate > outrate) ? ((double)outrate / resampler->inrate) : 1.0;
+        const double fraction = ((double)srcfraction) / ((double)outrate);
+        const double filterscale = scale * RESAMPLER_HQ_SAMPLES_PER_ZERO_CROSSING;
+
+        for (j = 0; j < resampler->num_taps; j++) {
+            const double position = SDL_fabs((resampler->first_tap + j) - fraction) * filterscale;
+            const int filt_ind = (int)position;
+            if (filt_ind < RESAMPLER_HQ_FILTER_SIZE - 1) {
+                const float interpolation = (float)(position - filt_ind);
+                coefs[j] = (float)scale * (ResamplerFilterHQ[filt_ind] + (interpolation * ResamplerFilterHQDifference[filt_ind]));
+            }
+        }
+        break;
+    }
+    default:
+    {
+        /* The coefficients of the original single quality resampler. They get summed
+           in a different order now, so the output can differ in the last bits. */
+        const float interpolation1 = ((float)srcfraction) / ((float)outrate);
+        const int filterindex1 = ((Sint32)srcfraction) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate;
+        const float interpolation2 = 1.0f - interpolation1;
+        const int filterindex2 = ((Sint32)(outrate - srcfraction)) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate;
+
+        /* do this twice to calculate the coefficients, once for the "left wing" and then same for the right. */
+        for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+            const int filt_ind = filterindex1 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+            coefs[RESAMPLER_ZERO_CROSSINGS - j] = ResamplerFilter[filt_ind] + (interpolation1 * ResamplerFilterDifference[filt_ind]);
+        }
+        for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
+            const int filt_ind = filterindex2 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
+            coefs[RESAMPLER_ZERO_CROSSINGS + 1 + j] = ResamplerFilter[filt_ind] + (interpolation2 * ResamplerFilterDifference[filt_ind]);
+        }
+        break;
+    }
+    }
+}
+
+static void SDL_ResampleFrame_Scalar(const float *frames, const float *coefs, const int num_taps, const int chans, float *out)
+{
+    int i, chan;
+
+    for (chan = 0; chan < chans; chan++) {
+        float outsample = 0.0f;
+        for (i = 0; i < num_taps; i++) {
+            outsample += frames[(i * chans) + chan] * coefs[i];
+        }
+        out[chan] = outsample;
+    }
+}
+
+#ifdef HAVE_SSE_INTRINSICS
+static void SDL_ResampleFrame_SSE(const float *frames, const float *coefs, const int num_taps, const int chans, float *out)
+{
+    int i, chan;
+
+    if (chans == 1) {
+        __m128 sum = _mm_setzero_ps();
+        for (i = 0; i < num_taps; i += 4) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&frames[i]), _mm_loadu_ps(&coefs[i])));
+        }
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(out, sum);
+    } else if (chans == 2) {
+        /* Two frames at a time, with each coefficient repeated for both channels */
+        __m128 sum = _mm_setzero_ps();
+        for (i = 0; i < num_taps; i += 2) {
+            const __m128 coef = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)&coefs[i]);
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&frames[i * 2]), _mm_unpacklo_ps(coef, coef)));
+        }
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        _mm_storel_pi((__m64 *)out, sum);
+    } else {
+        for (chan = 0; chan + 4 <= chans; chan += 4) {
+            __m128 sum = _mm_setzero_ps();
+            for (i = 0; i < num_taps; i++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&frames[(i * chans) + chan]), _mm_set1_ps(coefs[i])));
+            }
+            _mm_storeu_ps(&out[chan], sum);
+        }
+        for (; chan < chans; chan++) {
+            float outsample = 0.0f;
+            for (i = 0; i < num_taps; i++) {
+                outsample += frames[(i * chans) + chan] * coefs[i];
+            }
+            out[chan] = outsample;
+        }
+    }
+}
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+static void SDL_ResampleFrame_NEON(const float *frames, const float *coefs, const int num_taps, const int chans, float *out)
+{
+    int i, chan;
+
+    if (chans == 1) {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        float32x2_t sum2;
+        for (i = 0; i < num_taps; i += 4) {
+            sum = vmlaq_f32(sum, vld1q_f32(&frames[i]), vld1q_f32(&coefs[i]));
+        }
+        sum2 = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+        vst1_lane_f32(out, vpadd_f32(sum2, sum2), 0);
+    } else if (chans == 2) {
+        /* Two frames at a time, with each coefficient repeated for both channels */
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for (i = 0; i < num_taps; i += 2) {
+            const float32x2_t coef = vld1_f32(&coefs[i]);
+            sum = vmlaq_f32(sum, vld1q_f32(&frames[i * 2]), vcombine_f32(vdup_lane_f32(coef, 0), vdup_lane_f32(coef, 1)));
+        }
+        vst1_f32(out, vadd_f32(vget_low_f32(sum), vget_high_f32(sum)));
+    } else {
+        for (chan = 0; chan + 4 <= chans; chan += 4) {
+            float32x4_t sum = vdupq_n_f32(0.0f);
+            for (i = 0; i < num_taps; i++) {
+                sum = vmlaq_n_f32(sum, vld1q_f32(&frames[(i * chans) + chan]), coefs[i]);
+            }
+            vst1q_f32(&out[chan], sum);
+        }
+        for (; chan < chans; chan++) {
+            float outsample = 0.0f;
+            for (i = 0; i < num_taps; i++) {
+                outsample += frames[(i * chans) + chan] * coefs[i];
+            }
+            out[chan] = outsample;
+        }
+    }
+}
+#endif
+
+/* max_outframes is the most frames this resampler will ever produce, or RESAMPLER_UNBOUNDED_OUTPUT */
+static int SDL_InitAudioResampler(SDL_AudioResampler *resampler, const SDL_AudioResamplingQuality quality,
+                                  const int inrate, const int outrate, const int chans, const int max_outframes)
+{
+    int taps, a, b;
+
+    SDL_zerop(resampler);
+    resampler->quality = quality;
+    resampler->inrate = inrate;
+    resampler->outrate = outrate;
+
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLING_LINEAR:
+        resampler->first_tap = 0;
+        taps = 2;
+        break;
+    case SDL_AUDIO_RESAMPLING_HIGH:
+    {
+        const int halftaps = GetHighQualityHalfTaps(inrate, outrate);
+        resampler->first_tap = -halftaps;
+        taps = (halftaps * 2) + 2;
+        break;
+    }
+    default:
+        resampler->quality = SDL_AUDIO_RESAMPLING_MEDIUM;
+        resampler->first_tap = -RESAMPLER_ZERO_CROSSINGS;
+        taps = (RESAMPLER_ZERO_CROSSINGS * 2) + 1;
+        break;
+    }
+    resampler->num_taps = (taps + 3) & ~3;
+
+    resampler->scratch = (float *)SDL_malloc(resampler->num_taps * (chans + 1) * sizeof(float));
+    if (!resampler->scratch) {
+        return SDL_OutOfMemory();
+    }
+
+    /* Source fractions repeat with the period of the rates, so precalculate a row of coefficients per phase.
+       A one-shot conversion that needs fewer rows than that calculates them as it goes instead. */
+    a = inrate;
+    b = outrate;
+    while (b) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    resampler->phase_step = a;
+    if ((outrate / a) <= RESAMPLER_MAX_BANK_SIZE / resampler->num_taps &&
+        (max_outframes == RESAMPLER_UNBOUNDED_OUTPUT || (outrate / a) < max_outframes)) {
+        const int num_phases = outrate / a;
+        resampler->bank = (float *)SDL_malloc(num_phases * resampler->num_taps * sizeof(float));
+        if (resampler->bank) {
+            int phase;
+            for (phase = 0; phase < num_phases; phase++) {
+                SDL_CalculateResamplerCoefficients(resampler, phase * a, &resampler->bank[phase * resampler->num_taps]);
+            }
+            resampler->num_phases = num_phases;
+        }
+    }
+
+    resampler->resample_frame = SDL_ResampleFrame_Scalar;
+#ifdef HAVE_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        resampler->resample_frame = SDL_ResampleFrame_SSE;
+    }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        resampler->resample_frame = SDL_ResampleFrame_NEON;
+    }
+#endif
+    return 0;
+}
+
+static void SDL_QuitAudioResampler(SDL_AudioResampler *resampler)
+{
+    SDL_free(resampler->bank);
+    SDL_free(resampler->scratch);
+    SDL_zerop(resampler);
+}
+
 /* lpadding and rpadding are expected to be buffers of (ResamplePadding(inrate, outrate) * chans * sizeof(float)) bytes. */
-static int SDL_ResampleAudio(const int chans, const int inrate, const int outrate,
+static int SDL_ResampleAudio(const SDL_AudioResampler *resampler, const int chans,
                              const float *lpadding, const float *rpadding,
                              const float *inbuf, const int inbuflen,
                              float *outbuf, const int outbuflen)
@@ -208,6 +746,9 @@ static int SDL_ResampleAudio(const int chans, const int inrate, const int outrat
      * assumed to be non-negative so that division rounds by truncation and
      * modulo is always non-negative. Note that the operator order is important
      * for these integer divisions. */
+    const int inrate = resampler->inrate;
+    const int outrate = resampler->outrate;
+    const int num_taps = resampler->num_taps;
     const int paddinglen = ResamplerPadding(inrate, outrate);
     const int framelen = chans * (int)sizeof(float);
     const int inframes = inbuflen / framelen;
@@ -215,45 +756,58 @@ static int SDL_ResampleAudio(const int chans, const int inrate, const int outrat
     const int wantedoutframes = (int)((Sint64)inframes * outrate / inrate);
     const int maxoutframes = outbuflen / framelen;
     const int outframes = SDL_min(wantedoutframes, maxoutframes);
+    /* Step through the source one output frame at a time, instead of dividing for every frame:
+     * srcindex = i * inrate / outrate and srcfraction = i * inrate % outrate */
+    const int stepindex = inrate / outrate;
+    const int stepfraction = inrate % outrate;
+    float *coefs = resampler->scratch;
+    float *frames = resampler->scratch + num_taps;
     float *dst = outbuf;
-    int i, j, chan;
+    int srcindex = 0;
+    int srcfraction = 0;
+    int i, j;
+
+    SDL_assert(paddinglen >= -resampler->first_tap && paddinglen >= resampler->first_tap + num_taps);
 
     for (i = 0; i < outframes; i++) {
-        const int srcindex = (int)((Sint64)i * inrate / outrate);
-        /* Calculating the following way avoids subtraction or modulo of large
-         * floats which have low result precision.
-         *   interpolation1
-         * = (i / outrate * inrate) - floor(i / outrate * inrate)
-         * = mod(i / outrate * inrate, 1)
-         * = mod(i * inrate, outrate) / outrate */
-        const int srcfraction = ((Sint64)i) * inrate % outrate;
-        const float interpolation1 = ((float)srcfraction) / ((float)outrate);
-        const int filterindex1 = ((Sint32)srcfraction) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate;
-        const float interpolation2 = 1.0f - interpolation1;
-        const int filterindex2 = ((Sint32)(outrate - srcfraction)) * RESAMPLER_SAMPLES_PER_ZERO_CROSSING / outrate;
+        const int firstframe = srcindex + resampler->first_tap;
+        const float *rowcoefs;
+        const float *rowframes;
 
-        for (chan = 0; chan < chans; chan++) {
-            float outsample = 0.0f;
+        if (resampler->num_phases) {
+            rowcoefs = &resampler->bank[(srcfraction / resampler->phase_step) * num_taps];
+        } else {
+            SDL_CalculateResamplerCoefficients(resampler, srcfraction, coefs);
+            rowcoefs = coefs;
+        }
 
-            /* do this twice to calculate the sample, once for the "left wing" and then same for the right. */
-            for (j = 0; (filterindex1 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int filt_ind = filterindex1 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
-                const int srcframe = srcindex - j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a pre loop. */
-                const float insample = (srcframe < 0) ? lpadding[((paddinglen + srcframe) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float) (insample * (ResamplerFilter[filt_ind] + (interpolation1 * ResamplerFilterDifference[filt_ind])));
+        if (firstframe >= 0 && firstframe + num_taps <= inframes) {
+            rowframes = &inbuf[firstframe * chans];
+        } else {
+            /* Near the edges, gather the frames from the padding on either side */
+            for (j = 0; j < num_taps; j++) {
+                const int srcframe = firstframe + j;
+                const float *src;
+                if (srcframe < 0) {
+                    src = &lpadding[(paddinglen + srcframe) * chans];
+                } else if (srcframe >= inframes) {
+                    src = &rpadding[(srcframe - inframes) * chans];
+                } else {
+                    src = &inbuf[srcframe * chans];
+                }
+                SDL_memcpy(&frames[j * chans], src, framelen);
             }
+            rowframes = frames;
+        }
 
-            /* Do the right wing! */
-            for (j = 0; (filterindex2 + (j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING)) < RESAMPLER_FILTER_SIZE; j++) {
-                const int filt_ind = filterindex2 + j * RESAMPLER_SAMPLES_PER_ZERO_CROSSING;
-                const int srcframe = srcindex + 1 + j;
-                /* !!! FIXME: we can bubble this conditional out of here by doing a post loop. */
-                const float insample = (srcframe >= inframes) ? rpadding[((srcframe - inframes) * chans) + chan] : inbuf[(srcframe * chans) + chan];
-                outsample += (float) (insample * (ResamplerFilter[filt_ind] + (interpolation2 * ResamplerFilterDifference[filt_ind])));
-            }
+        resampler->resample_frame(rowframes, rowcoefs, num_taps, chans, dst);
+        dst += chans;
 
-            *(dst++) = outsample;
+        srcindex += stepindex;
+        srcfraction += stepfraction;
+        if (srcfraction >= outrate) {
+            srcfraction -= outrate;
+            srcindex++;
         }
     }
 
@@ -336,12 +890,17 @@ static int SDL_AddAudioCVTFilter(SDL_AudioCVT *cvt, SDL_AudioFilter filter)
 static int SDL_BuildAudioTypeCVTToFloat(SDL_AudioCVT *cvt, const SDL_AudioFormat src_fmt)
 {
     int retval = 0; /* 0 == no conversion necessary. */
+    SDL_AudioFilter byteswap_converter = NULL;
 
     if ((SDL_AUDIO_ISBIGENDIAN(src_fmt) != 0) == (SDL_BYTEORDER == SDL_LIL_ENDIAN) && SDL_AUDIO_BITSIZE(src_fmt) > 8) {
-        if (SDL_AddAudioCVTFilter(cvt, SDL_Convert_Byteswap) < 0) {
-            return -1;
+        /* See if we can swap the bytes while converting to float, instead of in a separate pass. */
+        byteswap_converter = SDL_GetByteswapAudioConverter(src_fmt, AUDIO_F32SYS);
+        if (!byteswap_converter || SDL_AUDIO_ISFLOAT(src_fmt)) {
+            if (SDL_AddAudioCVTFilter(cvt, byteswap_converter ? byteswap_converter : SDL_Convert_Byteswap) < 0) {
+                return -1;
+            }
+            retval = 1; /* added a converter. */
         }
-        retval = 1; /* added a converter. */
     }
 
     if (!SDL_AUDIO_ISFLOAT(src_fmt)) {
@@ -370,6 +929,10 @@ static int SDL_BuildAudioTypeCVTToFloat(SDL_AudioCVT *cvt, const SDL_AudioFormat
             break;
         }
 
+        if (byteswap_converter) {
+            filter = byteswap_converter;
+        }
+
         if (!filter) {
             return SDL_SetError("No conversion from source format to float available");
         }
@@ -395,6 +958,9 @@ static int SDL_BuildAudioTypeCVTToFloat(SDL_AudioCVT *cvt, const SDL_AudioFormat
 static int SDL_BuildAudioTypeCVTFromFloat(SDL_AudioCVT *cvt, const SDL_AudioFormat dst_fmt)
 {
     int retval = 0; /* 0 == no conversion necessary. */
+    const SDL_bool byteswap = ((SDL_AUDIO_ISBIGENDIAN(dst_fmt) != 0) == (SDL_BYTEORDER == SDL_LIL_ENDIAN) && SDL_AUDIO_BITSIZE(dst_fmt) > 8) ? SDL_TRUE : SDL_FALSE;
+    /* See if we can swap the bytes while converting from float, instead of in a separate pass. */
+    const SDL_AudioFilter byteswap_converter = byteswap ? SDL_GetByteswapAudioConverter(AUDIO_F32SYS, dst_fmt) : NULL;
 
     if (!SDL_AUDIO_ISFLOAT(dst_fmt)) {
         const Uint16 dst_bitsize = SDL_AUDIO_BITSIZE(dst_fmt);
@@ -421,6 +987,10 @@ static int SDL_BuildAudioTypeCVTFromFloat(SDL_AudioCVT *cvt, const SDL_AudioForm
             break;
         }
 
+        if (byteswap_converter) {
+            filter = byteswap_converter;
+        }
+
         if (!filter) {
             return SDL_SetError("No conversion from float to format 0x%.4x available", dst_fmt);
         }
@@ -439,8 +1009,8 @@ static int SDL_BuildAudioTypeCVTFromFloat(SDL_AudioCVT *cvt, const SDL_AudioForm
         retval = 1; /* added a converter. */
     }
 
-    if ((SDL_AUDIO_ISBIGENDIAN(dst_fmt) != 0) == (SDL_BYTEORDER == SDL_LIL_ENDIAN) && SDL_AUDIO_BITSIZE(dst_fmt) > 8) {
-        if (SDL_AddAudioCVTFilter(cvt, SDL_Convert_Byteswap) < 0) {
+    if (byteswap && (!byteswap_converter || SDL_AUDIO_ISFLOAT(dst_fmt))) {
+        if (SDL_AddAudioCVTFilter(cvt, byteswap_converter ? byteswap_converter : SDL_Convert_Byteswap) < 0) {
             return -1;
         }
         retval = 1; /* added a converter. */
@@ -492,7 +1062,7 @@ static void SDL_ResampleCVT_SRC(SDL_AudioCVT *cvt, const int chans, const SDL_Au
 
 #endif /* HAVE_LIBSAMPLERATE_H */
 
-static void SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioFormat format)
+static void SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioResamplingQuality quality, const SDL_AudioFormat format)
 {
     /* !!! FIXME in 2.1: there are ten slots in the filter list, and the theoretical maximum we use is six (seven with NULL terminator).
        !!! FIXME in 2.1:   We need to store data for this resampler, because the cvt structure doesn't store the original sample rates,
@@ -507,8 +1077,10 @@ static void SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioF
     float *dst = (float *)(cvt->buf + srclen);
     const int dstlen = (cvt->len * cvt->len_mult) - srclen;
     const int requestedpadding = ResamplerPadding(inrate, outrate);
+    const int outframes = (int)SDL_min((Sint64)(srclen / (chans * (int)sizeof(float))) * outrate / inrate, SDL_MAX_SINT32);
     int paddingsamples;
     float *padding;
+    SDL_AudioResampler resampler;
 
     if (requestedpadding < SDL_MAX_SINT32 / chans) {
         paddingsamples = requestedpadding * chans;
@@ -524,8 +1096,14 @@ static void SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioF
         return;
     }
 
-    cvt->len_cvt = SDL_ResampleAudio(chans, inrate, outrate, padding, padding, src, srclen, dst, dstlen);
+    if (SDL_InitAudioResampler(&resampler, quality, inrate, outrate, chans, SDL_max(outframes, 1)) < 0) {
+        SDL_free(padding);
+        return;
+    }
 
+    cvt->len_cvt = SDL_ResampleAudio(&resampler, chans, padding, padding, src, srclen, dst, dstlen);
+
+    SDL_QuitAudioResampler(&resampler);
     SDL_free(padding);
 
     SDL_memmove(cvt->buf, dst, cvt->len_cvt); /* !!! FIXME: remove this if we can get the resampler to work in-place again. */
@@ -539,19 +1117,38 @@ static void SDL_ResampleCVT(SDL_AudioCVT *cvt, const int chans, const SDL_AudioF
    !!! FIXME:  store channel info, so we have to have function entry
    !!! FIXME:  points for each supported channel count and multiple
    !!! FIXME:  vs arbitrary. When we rev the ABI, clean this up. */
-#define RESAMPLER_FUNCS(chans)                                              \
-    static void SDLCALL                                                     \
-        SDL_ResampleCVT_c##chans(SDL_AudioCVT *cvt, SDL_AudioFormat format) \
-    {                                                                       \
-        SDL_ResampleCVT(cvt, chans, format);                                \
-    }
-RESAMPLER_FUNCS(1)
-RESAMPLER_FUNCS(2)
-RESAMPLER_FUNCS(4)
-RESAMPLER_FUNCS(6)
-RESAMPLER_FUNCS(8)
+#define RESAMPLER_FUNCS(quality, chans)                                                  \
+    static void SDLCALL                                                                  \
+        SDL_ResampleCVT_##quality##_c##chans(SDL_AudioCVT *cvt, SDL_AudioFormat format)  \
+    {                                                                                    \
+        SDL_ResampleCVT(cvt, chans, SDL_AUDIO_RESAMPLING_##quality, format);             \
+    }
+#define RESAMPLER_QUALITY_FUNCS(quality) \
+    RESAMPLER_FUNCS(quality, 1)          \
+    RESAMPLER_FUNCS(quality, 2)          \
+    RESAMPLER_FUNCS(quality, 4)          \
+    RESAMPLER_FUNCS(quality, 6)          \
+    RESAMPLER_FUNCS(quality, 8)
+RESAMPLER_QUALITY_FUNCS(LINEAR)
+RESAMPLER_QUALITY_FUNCS(MEDIUM)
+RESAMPLER_QUALITY_FUNCS(HIGH)
+#undef RESAMPLER_QUALITY_FUNCS
 #undef RESAMPLER_FUNCS
 
+/* Indexed by SDL_AudioResamplingQuality, then by channel count as in ChooseCVTResampler() */
+#define RESAMPLER_QUALITY_FUNCS(quality)                                                   \
+    {                                                                                      \
+        SDL_ResampleCVT_##quality##_c1, SDL_ResampleCVT_##quality##_c2,                    \
+            SDL_ResampleCVT_##quality##_c4, SDL_ResampleCVT_##quality##_c6,                \
+            SDL_ResampleCVT_##quality##_c8                                                 \
+    }
+static const SDL_AudioFilter cvt_resamplers[][5] = {
+    RESAMPLER_QUALITY_FUNCS(LINEAR),
+    RESAMPLER_QUALITY_FUNCS(MEDIUM),
+    RESAMPLER_QUALITY_FUNCS(HIGH)
+};
+#undef RESAMPLER_QUALITY_FUNCS
+
 #ifdef HAVE_LIBSAMPLERATE_H
 #define RESAMPLER_FUNCS(chans)                                                  \
     static void SDLCALL                                                         \
@@ -567,7 +1164,7 @@ RESAMPLER_FUNCS(8)
 #undef RESAMPLER_FUNCS
 #endif /* HAVE_LIBSAMPLERATE_H */
 
-static SDL_AudioFilter ChooseCVTResampler(const int dst_channels)
+static SDL_AudioFilter ChooseCVTResampler(const int dst_channels, const SDL_AudioResamplingQuality quality)
 {
 #ifdef HAVE_LIBSAMPLERATE_H
     if (SRC_available) {
@@ -590,15 +1187,15 @@ static SDL_AudioFilter ChooseCVTResampler(const int dst_channels)
 
     switch (dst_channels) {
     case 1:
-        return SDL_ResampleCVT_c1;
+        return cvt_resamplers[quality][0];
     case 2:
-        return SDL_ResampleCVT_c2;
+        return cvt_resamplers[quality][1];
     case 4:
-        return SDL_ResampleCVT_c4;
+        return cvt_resamplers[quality][2];
     case 6:
-        return SDL_ResampleCVT_c6;
+        return cvt_resamplers[quality][3];
     case 8:
-        return SDL_ResampleCVT_c8;
+        return cvt_resamplers[quality][4];
     default:
         break;
     }
@@ -615,7 +1212,7 @@ static int SDL_BuildAudioResampleCVT(SDL_AudioCVT *cvt, const int dst_channels,
         return 0; /* no conversion necessary. */
     }
 
-    filter = ChooseCVTResampler(dst_channels);
+    filter = ChooseCVTResampler(dst_channels, GetResamplingQualityHint());
     if (!filter) {
         return SDL_SetError("No conversion available for these rates");
     }
@@ -761,10 +1358,11 @@ int SDL_BuildAudioCVT(SDL_AudioCVT *cvt,
 
         /* just a byteswap needed? */
         if ((src_format & ~SDL_AUDIO_MASK_ENDIAN) == (dst_format & ~SDL_AUDIO_MASK_ENDIAN)) {
+            const SDL_AudioFilter byteswap_converter = SDL_GetByteswapAudioConverter(src_format, dst_format);
             if (SDL_AUDIO_BITSIZE(dst_format) == 8) {
                 return 0;
             }
-            if (SDL_AddAudioCVTFilter(cvt, SDL_Convert_Byteswap) < 0) {
+            if (SDL_AddAudioCVTFilter(cvt, byteswap_converter ? byteswap_converter : SDL_Convert_Byteswap) < 0) {
                 return -1;
             }
             cvt->needed = 1;
@@ -772,6 +1370,23 @@ int SDL_BuildAudioCVT(SDL_AudioCVT *cvt,
         }
     }
 
+    /* Some common conversions have a converter that does it all in one pass. */
+    if (src_rate == dst_rate) {
+        const SDL_AudioFilter fused_converter = SDL_GetFusedAudioConverter(src_format, src_channels, dst_format, dst_channels);
+        if (fused_converter) {
+            const int src_sample_frame_size = (SDL_AUDIO_BITSIZE(src_format) / 8) * src_channels;
+            const int dst_sample_frame_size = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+
+            if (SDL_AddAudioCVTFilter(cvt, fused_converter) < 0) {
+                return -1;
+            }
+            cvt->len_mult = (dst_sample_frame_size + (src_sample_frame_size - 1)) / src_sample_frame_size;
+            cvt->len_ratio = ((double)dst_sample_frame_size) / ((double)src_sample_frame_size);
+            cvt->needed = 1;
+            return 1;
+        }
+    }
+
     /* Convert data types, if necessary. Updates (cvt). */
     if (SDL_BuildAudioTypeCVTToFloat(cvt, src_format) < 0) {
         return -1; /* shouldn't happen, but just in case... */
@@ -809,6 +1424,18 @@ int SDL_BuildAudioCVT(SDL_AudioCVT *cvt,
             if (filter) {
                 channel_converter = filter;
             }
+        } else {
+#ifdef HAVE_SSE_INTRINSICS
+            if (SDL_HasSSE()) {
+                size_t i;
+                for (i = 0; i < SDL_arraysize(sse_channel_converters); ++i) {
+                    if (channel_converter == sse_channel_converters[i].scalar) {
+                        channel_converter = sse_channel_converters[i].simd;
+                        break;
+                    }
+                }
+            }
+#endif
         }
 
         if (SDL_AddAudioCVTFilter(cvt, channel_converter) < 0) {
@@ -869,6 +1496,8 @@ struct _SDL_AudioStream
     SDL_ResampleAudioStreamFunc resampler_func;
     SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
     SDL_CleanupAudioStreamResamplerFunc cleanup_resampler_func;
+    SDL_AudioResamplingQuality resampling_quality;
+    SDL_AudioResampler resampler; /* only used by the built-in resampler */
 };
 
 static Uint8 *EnsureStreamBufferSize(SDL_AudioStream *stream, int newlen)
@@ -977,8 +1606,6 @@ static int SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf,
     const float *inbuf = (const float *)_inbuf;
     float *outbuf = (float *)_outbuf;
     const int chans = (int)stream->pre_resample_channels;
-    const int inrate = stream->src_rate;
-    const int outrate = stream->dst_rate;
     const int paddingsamples = stream->resampler_padding_samples;
     const int paddingbytes = paddingsamples * sizeof(float);
     float *lpadding = (float *)stream->resampler_state;
@@ -988,7 +1615,7 @@ static int SDL_ResampleAudioStream(SDL_AudioStream *stream, const void *_inbuf,
 
     SDL_assert(inbuf != ((const float *)outbuf)); /* SDL_AudioStreamPut() shouldn't allow in-place resamples. */
 
-    retval = SDL_ResampleAudio(chans, inrate, outrate, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
+    retval = SDL_ResampleAudio(&stream->resampler, chans, lpadding, rpadding, inbuf, inbuflen, outbuf, outbuflen);
 
     /* update our left padding with end of current input, for next run. */
     SDL_memcpy((lpadding + paddingsamples) - (cpy / sizeof(float)), inbufend - cpy, cpy);
@@ -1005,6 +1632,44 @@ static void SDL_ResetAudioStreamResampler(SDL_AudioStream *stream)
 static void SDL_CleanupAudioStreamResampler(SDL_AudioStream *stream)
 {
     SDL_free(stream->resampler_state);
+    SDL_QuitAudioResampler(&stream->resampler);
+
+    stream->resampler_state = NULL;
+    stream->resampler_func = NULL;
+    stream->reset_resampler_func = NULL;
+    stream->cleanup_resampler_func = NULL;
+}
+
+static int SetupBuiltinResampling(SDL_AudioStream *stream, const SDL_AudioResamplingQuality quality)
+{
+    SDL_AudioResampler resampler;
+
+    if (SDL_InitAudioResampler(&resampler, quality, stream->src_rate, stream->dst_rate, stream->pre_resample_channels, RESAMPLER_UNBOUNDED_OUTPUT) < 0) {
+        return -1;
+    }
+
+    if (stream->resampler_func == SDL_ResampleAudioStream) {
+        /* keep the padding, so changing the quality doesn't click. */
+        SDL_QuitAudioResampler(&stream->resampler);
+    } else {
+        float *lpadding = (float *)SDL_calloc(stream->resampler_padding_samples, sizeof(float));
+        if (!lpadding) {
+            SDL_QuitAudioResampler(&resampler);
+            return SDL_OutOfMemory();
+        }
+
+        if (stream->cleanup_resampler_func) {
+            stream->cleanup_resampler_func(stream);
+        }
+        stream->resampler_state = lpadding;
+        stream->resampler_func = SDL_ResampleAudioStream;
+        stream->reset_resampler_func = SDL_ResetAudioStreamResampler;
+        stream->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
+    }
+
+    stream->resampler = resampler;
+    stream->resampling_quality = quality;
+    return 0;
 }
 
 SDL_AudioStream *SDL_NewAudioStream(const SDL_AudioFormat src_format,
@@ -1015,6 +1680,7 @@ SDL_AudioStream *SDL_NewAudioStream(const SDL_AudioFormat src_format,
                    const int dst_rate)
 {
     int packetlen = 4096; /* !!! FIXME: good enough for now. */
+    int dst_sample_frame_size;
     Uint8 pre_resample_channels;
     SDL_AudioStream *retval;
 
@@ -1028,6 +1694,12 @@ SDL_AudioStream *SDL_NewAudioStream(const SDL_AudioFormat src_format,
         return NULL;
     }
 
+    /* Keep whole sample frames in each queue packet, for SDL_AudioStreamPeek() */
+    dst_sample_frame_size = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+    if (dst_sample_frame_size > 0) {
+        packetlen -= packetlen % dst_sample_frame_size;
+    }
+
     retval = (SDL_AudioStream *)SDL_calloc(1, sizeof(SDL_AudioStream));
     if (!retval) {
         SDL_OutOfMemory();
@@ -1045,13 +1717,14 @@ SDL_AudioStream *SDL_NewAudioStream(const SDL_AudioFormat src_format,
     retval->src_format = src_format;
     retval->src_channels = src_channels;
     retval->src_rate = src_rate;
-    retval->dst_sample_frame_size = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+    retval->dst_sample_frame_size = dst_sample_frame_size;
     retval->dst_format = dst_format;
     retval->dst_channels = dst_channels;
     retval->dst_rate = dst_rate;
     retval->pre_resample_channels = pre_resample_channels;
     retval->packetlen = packetlen;
     retval->rate_incr = ((double)dst_rate) / ((double)src_rate);
+    retval->resampling_quality = GetResamplingQualityHint();
     retval->resampler_padding_samples = ResamplerPadding(retval->src_rate, retval->dst_rate) * pre_resample_channels;
     retval->resampler_padding = (float *)SDL_calloc(retval->resampler_padding_samples ? retval->resampler_padding_samples : 1, sizeof(float));
 
@@ -1091,16 +1764,10 @@ SDL_AudioStream *SDL_NewAudioStream(const SDL_AudioFormat src_format,
 #endif
 
         if (!retval->resampler_func) {
-            retval->resampler_state = SDL_calloc(retval->resampler_padding_samples, sizeof(float));
-            if (!retval->resampler_state) {
+            if (SetupBuiltinResampling(retval, retval->resampling_quality) < 0) {
                 SDL_FreeAudioStream(retval);
-                SDL_OutOfMemory();
                 return NULL;
             }
-
-            retval->resampler_func = SDL_ResampleAudioStream;
-            retval->reset_resampler_func = SDL_ResetAudioStreamResampler;
-            retval->cleanup_resampler_func = SDL_CleanupAudioStreamResampler;
         }
 
         /* Convert us to the final format after resampling. */
@@ -1124,75 +1791,96 @@ static int SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf,
     int buflen = len;
     int workbuflen;
     Uint8 *workbuf;
-    Uint8 *resamplebuf = NULL;
-    int resamplebuflen = 0;
+    Uint8 *outbuf;
+    int outbuflen;
     int neededpaddingbytes;
     int paddingbytes;
 
-    /* !!! FIXME: several converters can take advantage of SIMD, but only
-       !!! FIXME:  if the data is aligned to 16 bytes. EnsureStreamBufferSize()
-       !!! FIXME:  guarantees the buffer will align, but the
-       !!! FIXME:  converters will iterate over the data backwards if
-       !!! FIXME:  the output grows, and this means we won't align if buflen
-       !!! FIXME:  isn't a multiple of 16. In these cases, we should chop off
-       !!! FIXME:  a few samples at the end and convert them separately. */
+    /* The converted data is written to space reserved at the end of the
+       queue, which is 16 byte aligned, so SDL_AudioStreamGet() is the only
+       other copy.
 
-    /* no padding prepended on first run. */
-    neededpaddingbytes = stream->resampler_padding_samples * sizeof(float);
-    paddingbytes = stream->first_run ? 0 : neededpaddingbytes;
-    stream->first_run = SDL_FALSE;
+       !!! FIXME: converters that grow the data iterate over it backwards,
+       !!! FIXME:  so they won't be aligned if buflen isn't a multiple of 16.
+       !!! FIXME:  In these cases, we should chop off a few samples at the
+       !!! FIXME:  end and convert them separately. */
 
-    /* Make sure the work buffer can hold all the data we need at once... */
-    workbuflen = buflen;
-    if (stream->cvt_before_resampling.needed) {
-        workbuflen *= stream->cvt_before_resampling.len_mult;
-    }
+    if (stream->dst_rate == stream->src_rate) {
+        /* Not resampling, so we can convert in place in the queue. */
+        outbuflen = buflen;
+        if (stream->cvt_after_resampling.needed) {
+            outbuflen *= stream->cvt_after_resampling.len_mult;
+        }
 
-    if (stream->dst_rate != stream->src_rate) {
-        /* resamples can't happen in place, so make space for second buf. */
-        const int framesize = stream->pre_resample_channels * sizeof(float);
-        const int frames = workbuflen / framesize;
-        resamplebuflen = ((int)SDL_ceil(frames * stream->rate_incr)) * framesize;
-#if DEBUG_AUDIOSTREAM
-        SDL_Log("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", workbuflen, resamplebuflen, stream->rate_incr);
-#endif
-        workbuflen += resamplebuflen;
-    }
+        outbuf = (Uint8 *)SDL_ReserveSpaceInDataQueue(stream->queue, outbuflen);
+        if (!outbuf) {
+            return -1; /* probably out of memory. */
+        }
 
-    if (stream->cvt_after_resampling.needed) {
-        /* !!! FIXME: buffer might be big enough already? */
-        workbuflen *= stream->cvt_after_resampling.len_mult;
-    }
+        SDL_memcpy(outbuf, buf, buflen);
 
-    workbuflen += neededpaddingbytes;
+        if (stream->cvt_after_resampling.needed) {
+            stream->cvt_after_resampling.buf = outbuf;
+            stream->cvt_after_resampling.len = buflen;
+            if (SDL_ConvertAudio(&stream->cvt_after_resampling) == -1) {
+                SDL_CommitDataQueueSpace(stream->queue, 0);
+                return -1; /* uhoh! */
+            }
+            buflen = stream->cvt_after_resampling.len_cvt;
+        }
 
 #if DEBUG_AUDIOSTREAM
-    SDL_Log("AUDIOSTREAM: Putting %d bytes of preconverted audio, need %d byte work buffer\n", buflen, workbuflen);
+        SDL_Log("AUDIOSTREAM: Converted %d bytes in place to %d bytes\n", len, buflen);
 #endif
+    } else {
+        const int framesize = stream->pre_resample_channels * sizeof(float);
+        int resamplebuflen;
 
-    workbuf = EnsureStreamBufferSize(stream, workbuflen);
-    if (!workbuf) {
-        return -1; /* probably out of memory. */
-    }
+        /* no padding prepended on first run. */
+        neededpaddingbytes = stream->resampler_padding_samples * sizeof(float);
+        paddingbytes = stream->first_run ? 0 : neededpaddingbytes;
+        stream->first_run = SDL_FALSE;
 
-    resamplebuf = workbuf; /* default if not resampling. */
+        /* The work buffer holds the padding and the data before resampling */
+        workbuflen = buflen;
+        if (stream->cvt_before_resampling.needed) {
+            workbuflen *= stream->cvt_before_resampling.len_mult;
+        }
+
+        /* The resampler writes straight into the queue, with room for the final conversion */
+        resamplebuflen = ((int)SDL_ceil((workbuflen / framesize) * stream->rate_incr)) * framesize;
+        outbuflen = resamplebuflen;
+        if (stream->cvt_after_resampling.needed) {
+            outbuflen *= stream->cvt_after_resampling.len_mult;
+        }
 
-    SDL_memcpy(workbuf + paddingbytes, buf, buflen);
+        workbuflen += neededpaddingbytes;
 
-    if (stream->cvt_before_resampling.needed) {
-        stream->cvt_before_resampling.buf = workbuf + paddingbytes;
-        stream->cvt_before_resampling.len = buflen;
-        if (SDL_ConvertAudio(&stream->cvt_before_resampling) == -1) {
-            return -1; /* uhoh! */
+#if DEBUG_AUDIOSTREAM
+        SDL_Log("AUDIOSTREAM: Putting %d bytes of preconverted audio, need %d byte work buffer\n", buflen, workbuflen);
+        SDL_Log("AUDIOSTREAM: will resample %d bytes to %d (ratio=%.6f)\n", workbuflen, resamplebuflen, stream->rate_incr);
+#endif
+
+        workbuf = EnsureStreamBufferSize(stream, workbuflen);
+        if (!workbuf) {
+            return -1; /* probably out of memory. */
         }
-        buflen = stream->cvt_before_resampling.len_cvt;
+
+        SDL_memcpy(workbuf + paddingbytes, buf, buflen);
+
+        if (stream->cvt_before_resampling.needed) {
+            stream->cvt_before_resampling.buf = workbuf + paddingbytes;
+            stream->cvt_before_resampling.len = buflen;
+            if (SDL_ConvertAudio(&stream->cvt_before_resampling) == -1) {
+                return -1; /* uhoh! */
+            }
+            buflen = stream->cvt_before_resampling.len_cvt;
 
 #if DEBUG_AUDIOSTREAM
-        SDL_Log("AUDIOSTREAM: After initial conversion we have %d bytes\n", buflen);
+            SDL_Log("AUDIOSTREAM: After initial conversion we have %d bytes\n", buflen);
 #endif
-    }
+        }
 
-    if (stream->dst_rate != stream->src_rate) {
         /* save off some samples at the end; they are used for padding now so
            the resampler is coherent and then used at the start of the next
            put operation. Prepend last put operation's padding, too. */
@@ -1206,10 +1894,14 @@ static int SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf,
         /* save off the data at the end for the next run. */
         SDL_memcpy(stream->resampler_padding, workbuf + (buflen - neededpaddingbytes), neededpaddingbytes);
 
-        resamplebuf = workbuf + buflen; /* skip to second piece of workbuf. */
+        outbuf = (Uint8 *)SDL_ReserveSpaceInDataQueue(stream->queue, outbuflen);
+        if (!outbuf) {
+            return -1; /* probably out of memory. */
+        }
+
         SDL_assert(buflen >= neededpaddingbytes);
         if (buflen > neededpaddingbytes) {
-            buflen = stream->resampler_func(stream, workbuf, buflen - neededpaddingbytes, resamplebuf, resamplebuflen);
+            buflen = stream->resampler_func(stream, workbuf, buflen - neededpaddingbytes, outbuf, resamplebuflen);
         } else {
             buflen = 0;
         }
@@ -1217,19 +1909,20 @@ static int SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf,
 #if DEBUG_AUDIOSTREAM
         SDL_Log("AUDIOSTREAM: After resampling we have %d bytes\n", buflen);
 #endif
-    }
 
-    if (stream->cvt_after_resampling.needed && (buflen > 0)) {
-        stream->cvt_after_resampling.buf = resamplebuf;
-        stream->cvt_after_resampling.len = buflen;
-        if (SDL_ConvertAudio(&stream->cvt_after_resampling) == -1) {
-            return -1; /* uhoh! */
-        }
-        buflen = stream->cvt_after_resampling.len_cvt;
+        if (stream->cvt_after_resampling.needed && (buflen > 0)) {
+            stream->cvt_after_resampling.buf = outbuf;
+            stream->cvt_after_resampling.len = buflen;
+            if (SDL_ConvertAudio(&stream->cvt_after_resampling) == -1) {
+                SDL_CommitDataQueueSpace(stream->queue, 0);
+                return -1; /* uhoh! */
+            }
+            buflen = stream->cvt_after_resampling.len_cvt;
 
 #if DEBUG_AUDIOSTREAM
-        SDL_Log("AUDIOSTREAM: After final conversion we have %d bytes\n", buflen);
+            SDL_Log("AUDIOSTREAM: After final conversion we have %d bytes\n", buflen);
 #endif
+        }
     }
 
 #if DEBUG_AUDIOSTREAM
@@ -1244,20 +1937,13 @@ static int SDL_AudioStreamPutInternal(SDL_AudioStream *stream, const void *buf,
         *maxputbytes -= buflen;
     }
 
-    /* resamplebuf holds the final output, even if we didn't resample. */
-    return buflen ? SDL_WriteToDataQueue(stream->queue, resamplebuf, buflen) : 0;
+    /* outbuf holds the final output, even if we didn't resample. */
+    SDL_CommitDataQueueSpace(stream->queue, buflen);
+    return 0;
 }
 
 int SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
 {
-    /* !!! FIXME: several converters can take advantage of SIMD, but only
-       !!! FIXME:  if the data is aligned to 16 bytes. EnsureStreamBufferSize()
-       !!! FIXME:  guarantees the buffer will align, but the
-       !!! FIXME:  converters will iterate over the data backwards if
-       !!! FIXME:  the output grows, and this means we won't align if buflen
-       !!! FIXME:  isn't a multiple of 16. In these cases, we should chop off
-       !!! FIXME:  a few samples at the end and convert them separately. */
-
 #if DEBUG_AUDIOSTREAM
     SDL_Log("AUDIOSTREAM: wants to put %d preconverted bytes\n", buflen);
 #endif
@@ -1391,6 +2077,36 @@ int SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
     return (int)SDL_ReadFromDataQueue(stream->queue, buf, len);
 }
 
+/* look at converted/resampled data in the stream without copying it */
+int SDL_AudioStreamPeek(SDL_AudioStream *stream, const void **data)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (!data) {
+        return SDL_InvalidParamError("data");
+    }
+
+    /* The queue never splits a sample frame between packets */
+    return (int)SDL_PeekDataQueueBuffer(stream->queue, data);
+}
+
+/* remove data returned by SDL_AudioStreamPeek() from the stream */
+int SDL_AudioStreamCommitRead(SDL_AudioStream *stream, int len)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (len <= 0) {
+        return 0; /* nothing to do. */
+    }
+    if ((len % stream->dst_sample_frame_size) != 0) {
+        return SDL_SetError("Can't request partial sample frames");
+    }
+
+    return (int)SDL_ReadFromDataQueue(stream->queue, NULL, len);
+}
+
 /* number of converted/resampled bytes available */
 int SDL_AudioStreamAvailable(SDL_AudioStream *stream)
 {
@@ -1411,6 +2127,30 @@ void SDL_AudioStreamClear(SDL_AudioStream *stream)
     }
 }
 
+int SDL_SetAudioStreamResamplingQuality(SDL_AudioStream *stream, SDL_AudioResamplingQuality quality)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (quality < SDL_AUDIO_RESAMPLING_LINEAR || quality > SDL_AUDIO_RESAMPLING_HIGH) {
+        return SDL_InvalidParamError("quality");
+    }
+
+    if (stream->src_rate == stream->dst_rate) {
+        stream->resampling_quality = quality; /* nothing to resample. */
+        return 0;
+    }
+    return SetupBuiltinResampling(stream, quality);
+}
+
+/* the format SDL_AudioStreamGet() produces, for SDL_BindAudioStream() */
+void SDL_GetAudioStreamOutputFormat(SDL_AudioStream *stream, SDL_AudioFormat *format, Uint8 *channels, int *rate)
+{
+    *format = stream->dst_format;
+    *channels = stream->dst_channels;
+    *rate = stream->dst_rate;
+}
+
 /* dispose of a stream */
 void SDL_FreeAudioStream(SDL_AudioStream *stream)
 {
@@ -32,6 +32,36 @@
 #define HAVE_SSE2_INTRINSICS
 #endif
 
+#if defined(HAVE_SSE2_INTRINSICS) && defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#define HAVE_SSSE3_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+#if defined __clang__
+#if (!__has_attribute(target))
+#undef HAVE_SSSE3_INTRINSICS
+#undef HAVE_AVX2_INTRINSICS
+#endif
+#if (defined(_MSC_VER) || defined(__SCE__)) && !defined(__SSSE3__)
+#undef HAVE_SSSE3_INTRINSICS
+#endif
+#if (defined(_MSC_VER) || defined(__SCE__)) && !defined(__AVX2__)
+#undef HAVE_AVX2_INTRINSICS
+#endif
+#elif defined __GNUC__
+#if (__GNUC__ < 4) || (__GNUC__ == 4 && __GNUC_MINOR__ < 9)
+#undef HAVE_SSSE3_INTRINSICS
+#undef HAVE_AVX2_INTRINSICS
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SDL_TARGETING_SSSE3 __attribute__((target("ssse3")))
+#define SDL_TARGETING_AVX2 __attribute__((target("avx2")))
+#else
+#define SDL_TARGETING_SSSE3
+#define SDL_TARGETING_AVX2
+#endif
+
 #if defined(__x86_64__) && defined(HAVE_SSE2_INTRINSICS)
 #define NEED_SCALAR_CONVERTER_FALLBACKS 0  /* x86_64 guarantees SSE2. */
 #elif defined(__MACOSX__) && defined(HAVE_SSE2_INTRINSICS)
@@ -851,55 +881,38 @@ static void SDLCALL SDL_Convert_F32_to_S32_SSE2(SDL_AudioCVT *cvt, SDL_AudioForm
 }
 #endif
 
-#ifdef HAVE_NEON_INTRINSICS
-static void SDLCALL SDL_Convert_S8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+#ifdef HAVE_AVX2_INTRINSICS
+/* These use the same arithmetic as the SSE2 converters, so the output is identical, just twice as wide. */
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_S8_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
-    const Sint8 *src = ((const Sint8 *)(cvt->buf + cvt->len_cvt)) - 1;
-    float *dst = ((float *)(cvt->buf + cvt->len_cvt * 4)) - 1;
-    int i;
+    const Sint8 *src = (const Sint8 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    int i = cvt->len_cvt;
 
-    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_F32 (using NEON)");
+    /* dst[i] = i2f((src[i] ^ 0x80) | 0x47800000) - 65537.0 */
+    const __m128i flipper = _mm_set1_epi8(-0x80);
+    const __m256i caster = _mm256_set1_epi32(0x47800000 /* f2i(65536.0) */);
+    const __m256 offset = _mm256_set1_ps(-65537.0);
 
-    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
-    for (i = cvt->len_cvt; i && (((size_t)(dst - 15)) & 15); --i, --src, --dst) {
-        *dst = ((float)*src) * DIVBY128;
-    }
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_F32 (using AVX2)");
 
-    src -= 15;
-    dst -= 15; /* adjust to read NEON blocks from the start. */
-    SDL_assert(!i || !(((size_t)dst) & 15));
+    while (i >= 16) {
+        i -= 16;
 
-    /* Make sure src is aligned too. */
-    if (!(((size_t)src) & 15)) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const int8_t *mmsrc = (const int8_t *)src;
-        const float32x4_t divby128 = vdupq_n_f32(DIVBY128);
-        while (i >= 16) {                                            /* 16 * 8-bit */
-            const int8x16_t bytes = vld1q_s8(mmsrc);                 /* get 16 sint8 into a NEON register. */
-            const int16x8_t int16hi = vmovl_s8(vget_high_s8(bytes)); /* convert top 8 bytes to 8 int16 */
-            const int16x8_t int16lo = vmovl_s8(vget_low_s8(bytes));  /* convert bottom 8 bytes to 8 int16 */
-            /* split int16 to two int32, then convert to float, then multiply to normalize, store. */
-            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(int16lo))), divby128));
-            vst1q_f32(dst + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(int16lo))), divby128));
-            vst1q_f32(dst + 8, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(int16hi))), divby128));
-            vst1q_f32(dst + 12, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(int16hi))), divby128));
-            i -= 16;
-            mmsrc -= 16;
-            dst -= 16;
-        }
+        {
+        const __m128i bytes = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i]), flipper);
 
-        src = (const Sint8 *)mmsrc;
-    }
+        const __m256i ints1 = _mm256_or_si256(_mm256_cvtepu8_epi32(bytes), caster);
+        const __m256i ints2 = _mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8)), caster);
 
-    src += 15;
-    dst += 15; /* adjust for any scalar finishing. */
+        _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_castsi256_ps(ints1), offset));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_add_ps(_mm256_castsi256_ps(ints2), offset));
+        }
+    }
 
-    /* Finish off any leftovers with scalar operations. */
     while (i) {
-        *dst = ((float)*src) * DIVBY128;
-        i--;
-        src--;
-        dst--;
+        --i;
+        _mm_store_ss(&dst[i], _mm_add_ss(_mm_castsi128_ps(_mm_cvtsi32_si128((Uint8)src[i] ^ 0x47800080u)), _mm256_castps256_ps128(offset)));
     }
 
     cvt->len_cvt *= 4;
@@ -908,55 +921,35 @@ static void SDLCALL SDL_Convert_S8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioForma
     }
 }
 
-static void SDLCALL SDL_Convert_U8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_U8_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
-    const Uint8 *src = ((const Uint8 *)(cvt->buf + cvt->len_cvt)) - 1;
-    float *dst = ((float *)(cvt->buf + cvt->len_cvt * 4)) - 1;
-    int i;
+    const Uint8 *src = (const Uint8 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    int i = cvt->len_cvt;
 
-    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_F32 (using NEON)");
+    /* dst[i] = i2f(src[i] | 0x47800000) - 65537.0 */
+    const __m256i caster = _mm256_set1_epi32(0x47800000 /* f2i(65536.0) */);
+    const __m256 offset = _mm256_set1_ps(-65537.0);
 
-    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
-    for (i = cvt->len_cvt; i && (((size_t)(dst - 15)) & 15); --i, --src, --dst) {
-        *dst = (((float)*src) * DIVBY128) - 1.0f;
-    }
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_F32 (using AVX2)");
 
-    src -= 15;
-    dst -= 15; /* adjust to read NEON blocks from the start. */
-    SDL_assert(!i || !(((size_t)dst) & 15));
+    while (i >= 16) {
+        i -= 16;
 
-    /* Make sure src is aligned too. */
-    if (!(((size_t)src) & 15)) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const uint8_t *mmsrc = (const uint8_t *)src;
-        const float32x4_t divby128 = vdupq_n_f32(DIVBY128);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        while (i >= 16) {                                              /* 16 * 8-bit */
-            const uint8x16_t bytes = vld1q_u8(mmsrc);                  /* get 16 uint8 into a NEON register. */
-            const uint16x8_t uint16hi = vmovl_u8(vget_high_u8(bytes)); /* convert top 8 bytes to 8 uint16 */
-            const uint16x8_t uint16lo = vmovl_u8(vget_low_u8(bytes));  /* convert bottom 8 bytes to 8 uint16 */
-            /* split uint16 to two uint32, then convert to float, then multiply to normalize, subtract to adjust for sign, store. */
-            vst1q_f32(dst, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uint16lo))), divby128));
-            vst1q_f32(dst + 4, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uint16lo))), divby128));
-            vst1q_f32(dst + 8, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uint16hi))), divby128));
-            vst1q_f32(dst + 12, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uint16hi))), divby128));
-            i -= 16;
-            mmsrc -= 16;
-            dst -= 16;
-        }
+        {
+        const __m128i bytes = _mm_loadu_si128((const __m128i *)&src[i]);
 
-        src = (const Uint8 *)mmsrc;
-    }
+        const __m256i ints1 = _mm256_or_si256(_mm256_cvtepu8_epi32(bytes), caster);
+        const __m256i ints2 = _mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8)), caster);
 
-    src += 15;
-    dst += 15; /* adjust for any scalar finishing. */
+        _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_castsi256_ps(ints1), offset));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_add_ps(_mm256_castsi256_ps(ints2), offset));
+        }
+    }
 
-    /* Finish off any leftovers with scalar operations. */
     while (i) {
-        *dst = (((float)*src) * DIVBY128) - 1.0f;
-        i--;
-        src--;
-        dst--;
+        --i;
+        _mm_store_ss(&dst[i], _mm_add_ss(_mm_castsi128_ps(_mm_cvtsi32_si128(src[i] ^ 0x47800000u)), _mm256_castps256_ps128(offset)));
     }
 
     cvt->len_cvt *= 4;
@@ -965,47 +958,37 @@ static void SDLCALL SDL_Convert_U8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioForma
     }
 }
 
-static void SDLCALL SDL_Convert_S16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_S16_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
-    const Sint16 *src = ((const Sint16 *)(cvt->buf + cvt->len_cvt)) - 1;
-    float *dst = ((float *)(cvt->buf + cvt->len_cvt * 2)) - 1;
-    int i;
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    int i = cvt->len_cvt / 2;
 
-    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_F32 (using NEON)");
+    /* dst[i] = i2f((src[i] ^ 0x8000) | 0x43800000) - 257.0 */
+    const __m128i flipper = _mm_set1_epi16(-0x8000);
+    const __m256i caster = _mm256_set1_epi32(0x43800000 /* f2i(256.0) */);
+    const __m256 offset = _mm256_set1_ps(-257.0f);
 
-    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
-    for (i = cvt->len_cvt / sizeof(Sint16); i && (((size_t)(dst - 7)) & 15); --i, --src, --dst) {
-        *dst = ((float)*src) * DIVBY32768;
-    }
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_F32 (using AVX2)");
 
-    src -= 7;
-    dst -= 7; /* adjust to read NEON blocks from the start. */
-    SDL_assert(!i || !(((size_t)dst) & 15));
+    while (i >= 16) {
+        i -= 16;
 
-    /* Make sure src is aligned too. */
-    if (!(((size_t)src) & 15)) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
-        while (i >= 8) {                                            /* 8 * 16-bit */
-            const int16x8_t ints = vld1q_s16((int16_t const *)src); /* get 8 sint16 into a NEON register. */
-            /* split int16 to two int32, then convert to float, then multiply to normalize, store. */
-            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(ints))), divby32768));
-            vst1q_f32(dst + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(ints))), divby32768));
-            i -= 8;
-            src -= 8;
-            dst -= 8;
+        {
+        const __m128i shorts1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i]), flipper);
+        const __m128i shorts2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i + 8]), flipper);
+
+        const __m256i ints1 = _mm256_or_si256(_mm256_cvtepu16_epi32(shorts1), caster);
+        const __m256i ints2 = _mm256_or_si256(_mm256_cvtepu16_epi32(shorts2), caster);
+
+        _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_castsi256_ps(ints1), offset));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_add_ps(_mm256_castsi256_ps(ints2), offset));
         }
     }
 
-    src += 7;
-    dst += 7; /* adjust for any scalar finishing. */
-
-    /* Finish off any leftovers with scalar operations. */
     while (i) {
-        *dst = ((float)*src) * DIVBY32768;
-        i--;
-        src--;
-        dst--;
+        --i;
+        _mm_store_ss(&dst[i], _mm_add_ss(_mm_castsi128_ps(_mm_cvtsi32_si128((Uint16)src[i] ^ 0x43808000u)), _mm256_castps256_ps128(offset)));
     }
 
     cvt->len_cvt *= 2;
@@ -1014,48 +997,35 @@ static void SDLCALL SDL_Convert_S16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioForm
     }
 }
 
-static void SDLCALL SDL_Convert_U16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_U16_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
-    const Uint16 *src = ((const Uint16 *)(cvt->buf + cvt->len_cvt)) - 1;
-    float *dst = ((float *)(cvt->buf + cvt->len_cvt * 2)) - 1;
-    int i;
-
-    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_F32 (using NEON)");
+    const Uint16 *src = (const Uint16 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_samples = cvt->len_cvt / sizeof(Uint16);
+    int i = num_samples & ~15;
+    int j;
 
-    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
-    for (i = cvt->len_cvt / sizeof(Sint16); i && (((size_t)(dst - 7)) & 15); --i, --src, --dst) {
-        *dst = (((float)*src) * DIVBY32768) - 1.0f;
-    }
+    /* dst[i] = (f32(src[i]) * (1.0 / 32768.0)) - 1.0 */
+    const __m256 divby32768 = _mm256_set1_ps(DIVBY32768);
+    const __m256 minus1 = _mm256_set1_ps(-1.0f);
 
-    src -= 7;
-    dst -= 7; /* adjust to read NEON blocks from the start. */
-    SDL_assert(!i || !(((size_t)dst) & 15));
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_F32 (using AVX2)");
 
-    /* Make sure src is aligned too. */
-    if (!(((size_t)src) & 15)) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        while (i >= 8) {                                               /* 8 * 16-bit */
-            const uint16x8_t uints = vld1q_u16((uint16_t const *)src); /* get 8 uint16 into a NEON register. */
-            /* split uint16 to two int32, then convert to float, then multiply to normalize, subtract for sign, store. */
-            vst1q_f32(dst, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uints))), divby32768));
-            vst1q_f32(dst + 4, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uints))), divby32768));
-            i -= 8;
-            src -= 8;
-            dst -= 8;
-        }
+    /* Convert backwards, since output is growing in-place. */
+    for (j = num_samples - 1; j >= i; --j) {
+        dst[j] = (((float)src[j]) * DIVBY32768) - 1.0f;
     }
 
-    src += 7;
-    dst += 7; /* adjust for any scalar finishing. */
-
-    /* Finish off any leftovers with scalar operations. */
     while (i) {
-        *dst = (((float)*src) * DIVBY32768) - 1.0f;
-        i--;
-        src--;
-        dst--;
+        i -= 16;
+
+        {
+        const __m256i ints1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&src[i]));
+        const __m256i ints2 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&src[i + 8]));
+
+        _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(ints1), divby32768), minus1));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(ints2), divby32768), minus1));
+        }
     }
 
     cvt->len_cvt *= 2;
@@ -1064,42 +1034,32 @@ static void SDLCALL SDL_Convert_U16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioForm
     }
 }
 
-static void SDLCALL SDL_Convert_S32_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_S32_to_F32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const Sint32 *src = (const Sint32 *)cvt->buf;
     float *dst = (float *)cvt->buf;
-    int i;
+    int i = cvt->len_cvt / 4;
 
-    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_F32 (using NEON)");
+    /* dst[i] = f32(src[i]) / f32(0x80000000) */
+    const __m256 scaler = _mm256_set1_ps(DIVBY2147483648);
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof(Sint32); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
-        *dst = ((float)(*src >> 8)) * DIVBY8388607;
-    }
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_F32 (using AVX2)");
 
-    SDL_assert(!i || !(((size_t)dst) & 15));
+    while (i >= 16) {
+        i -= 16;
 
-    /* Make sure src is aligned too. */
-    if (!(((size_t)src) & 15)) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t divby8388607 = vdupq_n_f32(DIVBY8388607);
-        const int32_t *mmsrc = (const int32_t *)src;
-        while (i >= 4) { /* 4 * sint32 */
-            /* shift out lowest bits so int fits in a float32. Small precision loss, but much faster. */
-            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vshrq_n_s32(vld1q_s32(mmsrc), 8)), divby8388607));
-            i -= 4;
-            mmsrc += 4;
-            dst += 4;
+        {
+        const __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i ints2 = _mm256_loadu_si256((const __m256i *)&src[i + 8]);
+
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(_mm256_cvtepi32_ps(ints1), scaler));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_mul_ps(_mm256_cvtepi32_ps(ints2), scaler));
         }
-        src = (const Sint32 *)mmsrc;
     }
 
-    /* Finish off any leftovers with scalar operations. */
     while (i) {
-        *dst = ((float)(*src >> 8)) * DIVBY8388607;
-        i--;
-        src++;
-        dst++;
+        --i;
+        _mm_store_ss(&dst[i], _mm_mul_ss(_mm_cvt_si2ss(_mm_setzero_ps(), src[i]), _mm256_castps256_ps128(scaler)));
     }
 
     if (cvt->filters[++cvt->filter_index]) {
@@ -1107,63 +1067,45 @@ static void SDLCALL SDL_Convert_S32_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioForm
     }
 }
 
-static void SDLCALL SDL_Convert_F32_to_S8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_F32_to_S8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *)cvt->buf;
     Sint8 *dst = (Sint8 *)cvt->buf;
-    int i;
+    int i = cvt->len_cvt / 4;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S8 (using NEON)");
+    /* dst[i] = clamp(i16(f2i(src[i] + 98304.0) & 0xFFFF), -128, 127) */
+    const __m256 offset = _mm256_set1_ps(98304.0f);
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+    /* The packs work within each 128-bit lane, this puts the groups of 4 samples back in order */
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
-        const float sample = *src;
-        if (sample >= 1.0f) {
-            *dst = 127;
-        } else if (sample <= -1.0f) {
-            *dst = -128;
-        } else {
-            *dst = (Sint8)(sample * 127.0f);
-        }
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S8 (using AVX2)");
+
+    while (i >= 32) {
+        const __m256i ints1 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[0]), offset));
+        const __m256i ints2 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[8]), offset));
+        const __m256i ints3 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[16]), offset));
+        const __m256i ints4 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[24]), offset));
+
+        const __m256i shorts1 = _mm256_and_si256(_mm256_packs_epi16(ints1, ints2), mask);
+        const __m256i shorts2 = _mm256_and_si256(_mm256_packs_epi16(ints3, ints4), mask);
+
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(shorts1, shorts2), order);
+
+        _mm256_storeu_si256((__m256i *)dst, bytes);
+
+        i -= 32;
+        src += 32;
+        dst += 32;
     }
 
-    SDL_assert(!i || !(((size_t)dst) & 15));
+    while (i) {
+        const __m128i ints = _mm_castps_si128(_mm_add_ss(_mm_load_ss(src), _mm256_castps256_ps128(offset)));
+        *dst = (Sint8)(_mm_cvtsi128_si32(_mm_packs_epi16(ints, ints)) & 0xFF);
 
-    /* Make sure src is aligned too. */
-    if (!(((size_t)src) & 15)) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby127 = vdupq_n_f32(127.0f);
-        int8_t *mmdst = (int8_t *)dst;
-        while (i >= 16) {                                                                                                       /* 16 * float32 */
-            const int32x4_t ints1 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby127));      /* load 4 floats, clamp, convert to sint32 */
-            const int32x4_t ints2 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 4)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
-            const int32x4_t ints3 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 8)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
-            const int32x4_t ints4 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 12)), one), mulby127)); /* load 4 floats, clamp, convert to sint32 */
-            const int8x8_t i8lo = vmovn_s16(vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2)));                                  /* narrow to sint16, combine, narrow to sint8 */
-            const int8x8_t i8hi = vmovn_s16(vcombine_s16(vmovn_s32(ints3), vmovn_s32(ints4)));                                  /* narrow to sint16, combine, narrow to sint8 */
-            vst1q_s8(mmdst, vcombine_s8(i8lo, i8hi));                                                                           /* combine to int8x16_t, store out */
-            i -= 16;
-            src += 16;
-            mmdst += 16;
-        }
-        dst = (Sint8 *)mmdst;
-    }
-
-    /* Finish off any leftovers with scalar operations. */
-    while (i) {
-        const float sample = *src;
-        if (sample >= 1.0f) {
-            *dst = 127;
-        } else if (sample <= -1.0f) {
-            *dst = -128;
-        } else {
-            *dst = (Sint8)(sample * 127.0f);
-        }
-        i--;
-        src++;
-        dst++;
+        --i;
+        ++src;
+        ++dst;
     }
 
     cvt->len_cvt /= 4;
@@ -1172,64 +1114,45 @@ static void SDLCALL SDL_Convert_F32_to_S8_NEON(SDL_AudioCVT *cvt, SDL_AudioForma
     }
 }
 
-static void SDLCALL SDL_Convert_F32_to_U8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_F32_to_U8_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *)cvt->buf;
     Uint8 *dst = cvt->buf;
-    int i;
+    int i = cvt->len_cvt / 4;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U8 (using NEON)");
+    /* dst[i] = clamp(i16(f2i(src[i] + 98305.0) & 0xFFFF), 0, 255) */
+    const __m256 offset = _mm256_set1_ps(98305.0f);
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+    /* The packs work within each 128-bit lane, this puts the groups of 4 samples back in order */
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
-        const float sample = *src;
-        if (sample >= 1.0f) {
-            *dst = 255;
-        } else if (sample <= -1.0f) {
-            *dst = 0;
-        } else {
-            *dst = (Uint8)((sample + 1.0f) * 127.0f);
-        }
-    }
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U8 (using AVX2)");
 
-    SDL_assert(!i || !(((size_t)dst) & 15));
+    while (i >= 32) {
+        const __m256i ints1 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[0]), offset));
+        const __m256i ints2 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[8]), offset));
+        const __m256i ints3 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[16]), offset));
+        const __m256i ints4 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[24]), offset));
 
-    /* Make sure src is aligned too. */
-    if (!(((size_t)src) & 15)) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby127 = vdupq_n_f32(127.0f);
-        uint8_t *mmdst = (uint8_t *)dst;
-        while (i >= 16) {                                                                                                                         /* 16 * float32 */
-            const uint32x4_t uints1 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), one), mulby127));      /* load 4 floats, clamp, convert to uint32 */
-            const uint32x4_t uints2 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 4)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
-            const uint32x4_t uints3 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 8)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
-            const uint32x4_t uints4 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 12)), one), one), mulby127)); /* load 4 floats, clamp, convert to uint32 */
-            const uint8x8_t ui8lo = vmovn_u16(vcombine_u16(vmovn_u32(uints1), vmovn_u32(uints2)));                                                /* narrow to uint16, combine, narrow to uint8 */
-            const uint8x8_t ui8hi = vmovn_u16(vcombine_u16(vmovn_u32(uints3), vmovn_u32(uints4)));                                                /* narrow to uint16, combine, narrow to uint8 */
-            vst1q_u8(mmdst, vcombine_u8(ui8lo, ui8hi));                                                                                           /* combine to uint8x16_t, store out */
-            i -= 16;
-            src += 16;
-            mmdst += 16;
-        }
+        const __m256i shorts1 = _mm256_and_si256(_mm256_packus_epi16(ints1, ints2), mask);
+        const __m256i shorts2 = _mm256_and_si256(_mm256_packus_epi16(ints3, ints4), mask);
 
-        dst = (Uint8 *)mmdst;
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(shorts1, shorts2), order);
+
+        _mm256_storeu_si256((__m256i *)dst, bytes);
+
+        i -= 32;
+        src += 32;
+        dst += 32;
     }
 
-    /* Finish off any leftovers with scalar operations. */
     while (i) {
-        const float sample = *src;
-        if (sample >= 1.0f) {
-            *dst = 255;
-        } else if (sample <= -1.0f) {
-            *dst = 0;
-        } else {
-            *dst = (Uint8)((sample + 1.0f) * 127.0f);
-        }
-        i--;
-        src++;
-        dst++;
+        const __m128i ints = _mm_castps_si128(_mm_add_ss(_mm_load_ss(src), _mm256_castps256_ps128(offset)));
+        *dst = (Uint8)(_mm_cvtsi128_si32(_mm_packus_epi16(ints, ints)) & 0xFF);
+
+        --i;
+        ++src;
+        ++dst;
     }
 
     cvt->len_cvt /= 4;
@@ -1238,59 +1161,39 @@ static void SDLCALL SDL_Convert_F32_to_U8_NEON(SDL_AudioCVT *cvt, SDL_AudioForma
     }
 }
 
-static void SDLCALL SDL_Convert_F32_to_S16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_F32_to_S16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *)cvt->buf;
     Sint16 *dst = (Sint16 *)cvt->buf;
-    int i;
+    int i = cvt->len_cvt / 4;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (using NEON)");
+    /* dst[i] = clamp(f2i(src[i] + 257.0) - 0x43808000, -32768, 32767) */
+    const __m256 offset = _mm256_set1_ps(257.0f);
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
-        const float sample = *src;
-        if (sample >= 1.0f) {
-            *dst = 32767;
-        } else if (sample <= -1.0f) {
-            *dst = -32768;
-        } else {
-            *dst = (Sint16)(sample * 32767.0f);
-        }
-    }
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (using AVX2)");
 
-    SDL_assert(!i || !(((size_t)dst) & 15));
+    while (i >= 16) {
+        const __m256i ints1 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[0]), offset)), _mm256_castps_si256(offset));
+        const __m256i ints2 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[8]), offset)), _mm256_castps_si256(offset));
 
-    /* Make sure src is aligned too. */
-    if (!(((size_t)src) & 15)) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
-        int16_t *mmdst = (int16_t *)dst;
-        while (i >= 8) {                                                                                                         /* 8 * float32 */
-            const int32x4_t ints1 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby32767));     /* load 4 floats, clamp, convert to sint32 */
-            const int32x4_t ints2 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 4)), one), mulby32767)); /* load 4 floats, clamp, convert to sint32 */
-            vst1q_s16(mmdst, vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2)));                                                  /* narrow to sint16, combine, store out. */
-            i -= 8;
-            src += 8;
-            mmdst += 8;
-        }
-        dst = (Sint16 *)mmdst;
+        /* The pack works within each 128-bit lane, so swap the middle quarters afterwards */
+        const __m256i shorts = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints1, ints2), 0xD8);
+
+        _mm256_storeu_si256((__m256i *)dst, shorts);
+
+        i -= 16;
+        src += 16;
+        dst += 16;
     }
 
-    /* Finish off any leftovers with scalar operations. */
     while (i) {
-        const float sample = *src;
-        if (sample >= 1.0f) {
-            *dst = 32767;
-        } else if (sample <= -1.0f) {
-            *dst = -32768;
-        } else {
-            *dst = (Sint16)(sample * 32767.0f);
-        }
-        i--;
-        src++;
-        dst++;
+        const __m128 offset1 = _mm256_castps256_ps128(offset);
+        const __m128i ints = _mm_sub_epi32(_mm_castps_si128(_mm_add_ss(_mm_load_ss(src), offset1)), _mm_castps_si128(offset1));
+        *dst = (Sint16)(_mm_cvtsi128_si32(_mm_packs_epi32(ints, ints)) & 0xFFFF);
+
+        --i;
+        ++src;
+        ++dst;
     }
 
     cvt->len_cvt /= 2;
@@ -1299,44 +1202,33 @@ static void SDLCALL SDL_Convert_F32_to_S16_NEON(SDL_AudioCVT *cvt, SDL_AudioForm
     }
 }
 
-static void SDLCALL SDL_Convert_F32_to_U16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_F32_to_U16_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *)cvt->buf;
     Uint16 *dst = (Uint16 *)cvt->buf;
-    int i;
+    int i = cvt->len_cvt / 4;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U16 (using NEON)");
+    /* Same as the aligned SSE2 blocks: clamp, round to sint16 and flip the top bit.
+       Unaligned loads are fine here, so there's no scalar lead-in. */
+    const __m256 mulby32767 = _mm256_set1_ps(32767.0f);
+    const __m256i topbit = _mm256_set1_epi16(-32768);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 negone = _mm256_set1_ps(-1.0f);
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
-        const float sample = *src;
-        if (sample >= 1.0f) {
-            *dst = 65535;
-        } else if (sample <= -1.0f) {
-            *dst = 0;
-        } else {
-            *dst = (Uint16)((sample + 1.0f) * 32767.0f);
-        }
-    }
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U16 (using AVX2)");
 
-    SDL_assert(!i || !(((size_t)dst) & 15));
+    while (i >= 16) {
+        const __m256i ints1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(&src[0])), one), mulby32767));
+        const __m256i ints2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(negone, _mm256_loadu_ps(&src[8])), one), mulby32767));
 
-    /* Make sure src is aligned too. */
-    if (!(((size_t)src) & 15)) {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
-        uint16_t *mmdst = (uint16_t *)dst;
-        while (i >= 8) {                                                                                                                           /* 8 * float32 */
-            const uint32x4_t uints1 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), one), mulby32767));     /* load 4 floats, clamp, convert to uint32 */
-            const uint32x4_t uints2 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 4)), one), one), mulby32767)); /* load 4 floats, clamp, convert to uint32 */
-            vst1q_u16(mmdst, vcombine_u16(vmovn_u32(uints1), vmovn_u32(uints2)));                                                                  /* narrow to uint16, combine, store out. */
-            i -= 8;
-            src += 8;
-            mmdst += 8;
-        }
-        dst = (Uint16 *)mmdst;
+        /* The pack works within each 128-bit lane, so swap the middle quarters afterwards */
+        const __m256i shorts = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints1, ints2), 0xD8);
+
+        _mm256_storeu_si256((__m256i *)dst, _mm256_xor_si256(shorts, topbit));
+
+        i -= 16;
+        src += 16;
+        dst += 16;
     }
 
     /* Finish off any leftovers with scalar operations. */
@@ -1360,57 +1252,41 @@ static void SDLCALL SDL_Convert_F32_to_U16_NEON(SDL_AudioCVT *cvt, SDL_AudioForm
     }
 }
 
-static void SDLCALL SDL_Convert_F32_to_S32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_F32_to_S32_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
     const float *src = (const float *)cvt->buf;
     Sint32 *dst = (Sint32 *)cvt->buf;
-    int i;
+    int i = cvt->len_cvt / 4;
 
-    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (using NEON)");
+    /* dst[i] = i32(src[i] * 2147483648.0) ^ ((src[i] >= 2147483648.0) ? 0xFFFFFFFF : 0x00000000) */
+    const __m256 limit = _mm256_set1_ps(2147483648.0f);
 
-    /* Get dst aligned to 16 bytes */
-    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
-        const float sample = *src;
-        if (sample >= 1.0f) {
-            *dst = 2147483647;
-        } else if (sample <= -1.0f) {
-            *dst = (-2147483647) - 1;
-        } else {
-            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
-        }
-    }
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (using AVX2)");
 
-    SDL_assert(!i || !(((size_t)dst) & 15));
-    SDL_assert(!i || !(((size_t)src) & 15));
+    while (i >= 16) {
+        const __m256 values1 = _mm256_mul_ps(_mm256_loadu_ps(&src[0]), limit);
+        const __m256 values2 = _mm256_mul_ps(_mm256_loadu_ps(&src[8]), limit);
 
-    {
-        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
-        const float32x4_t one = vdupq_n_f32(1.0f);
-        const float32x4_t negone = vdupq_n_f32(-1.0f);
-        const float32x4_t mulby8388607 = vdupq_n_f32(8388607.0f);
-        int32_t *mmdst = (int32_t *)dst;
-        while (i >= 4) { /* 4 * float32 */
-            vst1q_s32(mmdst, vshlq_n_s32(vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby8388607)), 8));
-            i -= 4;
-            src += 4;
-            mmdst += 4;
-        }
-        dst = (Sint32 *)mmdst;
+        const __m256i ints1 = _mm256_xor_si256(_mm256_cvttps_epi32(values1), _mm256_castps_si256(_mm256_cmp_ps(values1, limit, _CMP_GE_OS)));
+        const __m256i ints2 = _mm256_xor_si256(_mm256_cvttps_epi32(values2), _mm256_castps_si256(_mm256_cmp_ps(values2, limit, _CMP_GE_OS)));
+
+        _mm256_storeu_si256((__m256i *)&dst[0], ints1);
+        _mm256_storeu_si256((__m256i *)&dst[8], ints2);
+
+        i -= 16;
+        src += 16;
+        dst += 16;
     }
 
-    /* Finish off any leftovers with scalar operations. */
     while (i) {
-        const float sample = *src;
-        if (sample >= 1.0f) {
-            *dst = 2147483647;
-        } else if (sample <= -1.0f) {
-            *dst = (-2147483647) - 1;
-        } else {
-            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
-        }
-        i--;
-        src++;
-        dst++;
+        const __m128 limit1 = _mm256_castps256_ps128(limit);
+        const __m128 values = _mm_mul_ss(_mm_load_ss(src), limit1);
+        const __m128i ints = _mm_xor_si128(_mm_cvttps_epi32(values), _mm_castps_si128(_mm_cmpge_ss(values, limit1)));
+        *dst = (Sint32)_mm_cvtsi128_si32(ints);
+
+        --i;
+        ++src;
+        ++dst;
     }
 
     if (cvt->filters[++cvt->filter_index]) {
@@ -1419,46 +1295,1658 @@ static void SDLCALL SDL_Convert_F32_to_S32_NEON(SDL_AudioCVT *cvt, SDL_AudioForm
 }
 #endif
 
-void SDL_ChooseAudioConverters(void)
+#ifdef HAVE_SSSE3_INTRINSICS
+/* Byteswapping converters.
+
+   Foreign endian data used to take a separate byteswap pass before or after
+   the type conversion. These do the swap with a byte shuffle on the way
+   through, with the same arithmetic as the SSE2 converters. */
+
+static void SDLCALL SDL_TARGETING_SSSE3 SDL_Convert_Byteswap16_SSSE3(SDL_AudioCVT *cvt, SDL_AudioFormat format)
 {
-    static SDL_bool converters_chosen = SDL_FALSE;
+    Uint16 *ptr = (Uint16 *)cvt->buf;
+    int i = cvt->len_cvt / 2;
+    const __m128i swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
 
-    if (converters_chosen) {
-        return;
+    LOG_DEBUG_CONVERT("16-bit byte order", "swapped (using SSSE3)");
+
+    while (i >= 8) {
+        _mm_storeu_si128((__m128i *)ptr, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ptr), swap));
+        i -= 8;
+        ptr += 8;
     }
 
-#define SET_CONVERTER_FUNCS(fntype)                           \
-    SDL_Convert_S8_to_F32 = SDL_Convert_S8_to_F32_##fntype;   \
-    SDL_Convert_U8_to_F32 = SDL_Convert_U8_to_F32_##fntype;   \
-    SDL_Convert_S16_to_F32 = SDL_Convert_S16_to_F32_##fntype; \
-    SDL_Convert_U16_to_F32 = SDL_Convert_U16_to_F32_##fntype; \
-    SDL_Convert_S32_to_F32 = SDL_Convert_S32_to_F32_##fntype; \
-    SDL_Convert_F32_to_S8 = SDL_Convert_F32_to_S8_##fntype;   \
-    SDL_Convert_F32_to_U8 = SDL_Convert_F32_to_U8_##fntype;   \
-    SDL_Convert_F32_to_S16 = SDL_Convert_F32_to_S16_##fntype; \
-    SDL_Convert_F32_to_U16 = SDL_Convert_F32_to_U16_##fntype; \
-    SDL_Convert_F32_to_S32 = SDL_Convert_F32_to_S32_##fntype; \
-    converters_chosen = SDL_TRUE
+    while (i) {
+        *ptr = SDL_Swap16(*ptr);
+        --i;
+        ++ptr;
+    }
 
-#ifdef HAVE_SSE2_INTRINSICS
-    if (SDL_HasSSE2()) {
-        SET_CONVERTER_FUNCS(SSE2);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, format ^ SDL_AUDIO_MASK_ENDIAN);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_SSSE3 SDL_Convert_Byteswap32_SSSE3(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    Uint32 *ptr = (Uint32 *)cvt->buf;
+    int i = cvt->len_cvt / 4;
+    const __m128i swap = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    LOG_DEBUG_CONVERT("32-bit byte order", "swapped (using SSSE3)");
+
+    while (i >= 4) {
+        _mm_storeu_si128((__m128i *)ptr, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ptr), swap));
+        i -= 4;
+        ptr += 4;
+    }
+
+    while (i) {
+        *ptr = SDL_Swap32(*ptr);
+        --i;
+        ++ptr;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, format ^ SDL_AUDIO_MASK_ENDIAN);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_SSSE3 SDL_Convert_S16_Swapped_to_F32_SSSE3(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint16 *src = (const Uint16 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    int i = cvt->len_cvt / 2;
+
+    /* Same as SDL_Convert_S16_to_F32_SSE2(), after swapping each sample */
+    const __m128i swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m128i flipper = _mm_set1_epi16(-0x8000);
+    const __m128i caster = _mm_set1_epi16(0x4380 /* 0x43800000 = f2i(256.0) */);
+    const __m128 offset = _mm_set1_ps(-257.0f);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 (swapped)", "AUDIO_F32 (using SSSE3)");
+
+    while (i >= 16) {
+        i -= 16;
+
+        {
+        const __m128i shorts1 = _mm_xor_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&src[i]), swap), flipper);
+        const __m128i shorts2 = _mm_xor_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&src[i + 8]), swap), flipper);
+
+        const __m128 floats1 = _mm_add_ps(_mm_castsi128_ps(_mm_unpacklo_epi16(shorts1, caster)), offset);
+        const __m128 floats2 = _mm_add_ps(_mm_castsi128_ps(_mm_unpackhi_epi16(shorts1, caster)), offset);
+        const __m128 floats3 = _mm_add_ps(_mm_castsi128_ps(_mm_unpacklo_epi16(shorts2, caster)), offset);
+        const __m128 floats4 = _mm_add_ps(_mm_castsi128_ps(_mm_unpackhi_epi16(shorts2, caster)), offset);
+
+        _mm_storeu_ps(&dst[i], floats1);
+        _mm_storeu_ps(&dst[i + 4], floats2);
+        _mm_storeu_ps(&dst[i + 8], floats3);
+        _mm_storeu_ps(&dst[i + 12], floats4);
+        }
+    }
+
+    while (i) {
+        --i;
+        _mm_store_ss(&dst[i], _mm_add_ss(_mm_castsi128_ps(_mm_cvtsi32_si128(SDL_Swap16(src[i]) ^ 0x43808000u)), offset));
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_SSSE3 SDL_Convert_S32_Swapped_to_F32_SSSE3(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint32 *src = (const Uint32 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    int i = cvt->len_cvt / 4;
+
+    /* Same as SDL_Convert_S32_to_F32_SSE2(), after swapping each sample */
+    const __m128i swap = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m128 scaler = _mm_set1_ps(DIVBY2147483648);
+
+    LOG_DEBUG_CONVERT("AUDIO_S32 (swapped)", "AUDIO_F32 (using SSSE3)");
+
+    while (i >= 8) {
+        i -= 8;
+
+        {
+        const __m128i ints1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&src[i]), swap);
+        const __m128i ints2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)&src[i + 4]), swap);
+
+        _mm_storeu_ps(&dst[i], _mm_mul_ps(_mm_cvtepi32_ps(ints1), scaler));
+        _mm_storeu_ps(&dst[i + 4], _mm_mul_ps(_mm_cvtepi32_ps(ints2), scaler));
+        }
+    }
+
+    while (i) {
+        --i;
+        _mm_store_ss(&dst[i], _mm_mul_ss(_mm_cvt_si2ss(_mm_setzero_ps(), (Sint32)SDL_Swap32(src[i])), scaler));
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_SSSE3 SDL_Convert_F32_to_S16_Swapped_SSSE3(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Uint16 *dst = (Uint16 *)cvt->buf;
+    int i = cvt->len_cvt / 4;
+
+    /* Same as SDL_Convert_F32_to_S16_SSE2(), then swap each sample */
+    const __m128i swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m128 offset = _mm_set1_ps(257.0f);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (swapped, using SSSE3)");
+
+    while (i >= 16) {
+        const __m128i ints1 = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_loadu_ps(&src[0]), offset)), _mm_castps_si128(offset));
+        const __m128i ints2 = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_loadu_ps(&src[4]), offset)), _mm_castps_si128(offset));
+        const __m128i ints3 = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_loadu_ps(&src[8]), offset)), _mm_castps_si128(offset));
+        const __m128i ints4 = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_loadu_ps(&src[12]), offset)), _mm_castps_si128(offset));
+
+        _mm_storeu_si128((__m128i *)&dst[0], _mm_shuffle_epi8(_mm_packs_epi32(ints1, ints2), swap));
+        _mm_storeu_si128((__m128i *)&dst[8], _mm_shuffle_epi8(_mm_packs_epi32(ints3, ints4), swap));
+
+        i -= 16;
+        src += 16;
+        dst += 16;
+    }
+
+    while (i) {
+        const __m128i ints = _mm_sub_epi32(_mm_castps_si128(_mm_add_ss(_mm_load_ss(src), offset)), _mm_castps_si128(offset));
+        *dst = SDL_Swap16((Uint16)(_mm_cvtsi128_si32(_mm_packs_epi32(ints, ints)) & 0xFFFF));
+
+        --i;
+        ++src;
+        ++dst;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS ^ SDL_AUDIO_MASK_ENDIAN);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_SSSE3 SDL_Convert_F32_to_S32_Swapped_SSSE3(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Uint32 *dst = (Uint32 *)cvt->buf;
+    int i = cvt->len_cvt / 4;
+
+    /* Same as SDL_Convert_F32_to_S32_SSE2(), then swap each sample */
+    const __m128i swap = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m128 limit = _mm_set1_ps(2147483648.0f);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (swapped, using SSSE3)");
+
+    while (i >= 8) {
+        const __m128 values1 = _mm_mul_ps(_mm_loadu_ps(&src[0]), limit);
+        const __m128 values2 = _mm_mul_ps(_mm_loadu_ps(&src[4]), limit);
+
+        const __m128i ints1 = _mm_xor_si128(_mm_cvttps_epi32(values1), _mm_castps_si128(_mm_cmpge_ps(values1, limit)));
+        const __m128i ints2 = _mm_xor_si128(_mm_cvttps_epi32(values2), _mm_castps_si128(_mm_cmpge_ps(values2, limit)));
+
+        _mm_storeu_si128((__m128i *)&dst[0], _mm_shuffle_epi8(ints1, swap));
+        _mm_storeu_si128((__m128i *)&dst[4], _mm_shuffle_epi8(ints2, swap));
+
+        i -= 8;
+        src += 8;
+        dst += 8;
+    }
+
+    while (i) {
+        const __m128 values = _mm_mul_ss(_mm_load_ss(src), limit);
+        const __m128i ints = _mm_xor_si128(_mm_cvttps_epi32(values), _mm_castps_si128(_mm_cmpge_ss(values, limit)));
+        *dst = SDL_Swap32((Uint32)_mm_cvtsi128_si32(ints));
+
+        --i;
+        ++src;
+        ++dst;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS ^ SDL_AUDIO_MASK_ENDIAN);
+    }
+}
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+static void SDLCALL SDL_Convert_S8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint8 *src = ((const Sint8 *)(cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *)(cvt->buf + cvt->len_cvt * 4)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S8", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt; i && (((size_t)(dst - 15)) & 15); --i, --src, --dst) {
+        *dst = ((float)*src) * DIVBY128;
+    }
+
+    src -= 15;
+    dst -= 15; /* adjust to read NEON blocks from the start. */
+    SDL_assert(!i || !(((size_t)dst) & 15));
+
+    /* Make sure src is aligned too. */
+    if (!(((size_t)src) & 15)) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const int8_t *mmsrc = (const int8_t *)src;
+        const float32x4_t divby128 = vdupq_n_f32(DIVBY128);
+        while (i >= 16) {                                            /* 16 * 8-bit */
+            const int8x16_t bytes = vld1q_s8(mmsrc);                 /* get 16 sint8 into a NEON register. */
+            const int16x8_t int16hi = vmovl_s8(vget_high_s8(bytes)); /* convert top 8 bytes to 8 int16 */
+            const int16x8_t int16lo = vmovl_s8(vget_low_s8(bytes));  /* convert bottom 8 bytes to 8 int16 */
+            /* split int16 to two int32, then convert to float, then multiply to normalize, store. */
+            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(int16lo))), divby128));
+            vst1q_f32(dst + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(int16lo))), divby128));
+            vst1q_f32(dst + 8, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(int16hi))), divby128));
+            vst1q_f32(dst + 12, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(int16hi))), divby128));
+            i -= 16;
+            mmsrc -= 16;
+            dst -= 16;
+        }
+
+        src = (const Sint8 *)mmsrc;
+    }
+
+    src += 15;
+    dst += 15; /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float)*src) * DIVBY128;
+        i--;
+        src--;
+        dst--;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_U8_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint8 *src = ((const Uint8 *)(cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *)(cvt->buf + cvt->len_cvt * 4)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_U8", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt; i && (((size_t)(dst - 15)) & 15); --i, --src, --dst) {
+        *dst = (((float)*src) * DIVBY128) - 1.0f;
+    }
+
+    src -= 15;
+    dst -= 15; /* adjust to read NEON blocks from the start. */
+    SDL_assert(!i || !(((size_t)dst) & 15));
+
+    /* Make sure src is aligned too. */
+    if (!(((size_t)src) & 15)) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const uint8_t *mmsrc = (const uint8_t *)src;
+        const float32x4_t divby128 = vdupq_n_f32(DIVBY128);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        while (i >= 16) {                                              /* 16 * 8-bit */
+            const uint8x16_t bytes = vld1q_u8(mmsrc);                  /* get 16 uint8 into a NEON register. */
+            const uint16x8_t uint16hi = vmovl_u8(vget_high_u8(bytes)); /* convert top 8 bytes to 8 uint16 */
+            const uint16x8_t uint16lo = vmovl_u8(vget_low_u8(bytes));  /* convert bottom 8 bytes to 8 uint16 */
+            /* split uint16 to two uint32, then convert to float, then multiply to normalize, subtract to adjust for sign, store. */
+            vst1q_f32(dst, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uint16lo))), divby128));
+            vst1q_f32(dst + 4, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uint16lo))), divby128));
+            vst1q_f32(dst + 8, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uint16hi))), divby128));
+            vst1q_f32(dst + 12, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uint16hi))), divby128));
+            i -= 16;
+            mmsrc -= 16;
+            dst -= 16;
+        }
+
+        src = (const Uint8 *)mmsrc;
+    }
+
+    src += 15;
+    dst += 15; /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = (((float)*src) * DIVBY128) - 1.0f;
+        i--;
+        src--;
+        dst--;
+    }
+
+    cvt->len_cvt *= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_S16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = ((const Sint16 *)(cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *)(cvt->buf + cvt->len_cvt * 2)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt / sizeof(Sint16); i && (((size_t)(dst - 7)) & 15); --i, --src, --dst) {
+        *dst = ((float)*src) * DIVBY32768;
+    }
+
+    src -= 7;
+    dst -= 7; /* adjust to read NEON blocks from the start. */
+    SDL_assert(!i || !(((size_t)dst) & 15));
+
+    /* Make sure src is aligned too. */
+    if (!(((size_t)src) & 15)) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
+        while (i >= 8) {                                            /* 8 * 16-bit */
+            const int16x8_t ints = vld1q_s16((int16_t const *)src); /* get 8 sint16 into a NEON register. */
+            /* split int16 to two int32, then convert to float, then multiply to normalize, store. */
+            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(ints))), divby32768));
+            vst1q_f32(dst + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(ints))), divby32768));
+            i -= 8;
+            src -= 8;
+            dst -= 8;
+        }
+    }
+
+    src += 7;
+    dst += 7; /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float)*src) * DIVBY32768;
+        i--;
+        src--;
+        dst--;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_U16_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Uint16 *src = ((const Uint16 *)(cvt->buf + cvt->len_cvt)) - 1;
+    float *dst = ((float *)(cvt->buf + cvt->len_cvt * 2)) - 1;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_U16", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes (since buffer is growing, we don't have to worry about overreading from src) */
+    for (i = cvt->len_cvt / sizeof(Sint16); i && (((size_t)(dst - 7)) & 15); --i, --src, --dst) {
+        *dst = (((float)*src) * DIVBY32768) - 1.0f;
+    }
+
+    src -= 7;
+    dst -= 7; /* adjust to read NEON blocks from the start. */
+    SDL_assert(!i || !(((size_t)dst) & 15));
+
+    /* Make sure src is aligned too. */
+    if (!(((size_t)src) & 15)) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        while (i >= 8) {                                               /* 8 * 16-bit */
+            const uint16x8_t uints = vld1q_u16((uint16_t const *)src); /* get 8 uint16 into a NEON register. */
+            /* split uint16 to two int32, then convert to float, then multiply to normalize, subtract for sign, store. */
+            vst1q_f32(dst, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_low_u16(uints))), divby32768));
+            vst1q_f32(dst + 4, vmlaq_f32(negone, vcvtq_f32_u32(vmovl_u16(vget_high_u16(uints))), divby32768));
+            i -= 8;
+            src -= 8;
+            dst -= 8;
+        }
+    }
+
+    src += 7;
+    dst += 7; /* adjust for any scalar finishing. */
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = (((float)*src) * DIVBY32768) - 1.0f;
+        i--;
+        src--;
+        dst--;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_S32_to_F32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint32 *src = (const Sint32 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S32", "AUDIO_F32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof(Sint32); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
+        *dst = ((float)(*src >> 8)) * DIVBY8388607;
+    }
+
+    SDL_assert(!i || !(((size_t)dst) & 15));
+
+    /* Make sure src is aligned too. */
+    if (!(((size_t)src) & 15)) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t divby8388607 = vdupq_n_f32(DIVBY8388607);
+        const int32_t *mmsrc = (const int32_t *)src;
+        while (i >= 4) { /* 4 * sint32 */
+            /* shift out lowest bits so int fits in a float32. Small precision loss, but much faster. */
+            vst1q_f32(dst, vmulq_f32(vcvtq_f32_s32(vshrq_n_s32(vld1q_s32(mmsrc), 8)), divby8388607));
+            i -= 4;
+            mmsrc += 4;
+            dst += 4;
+        }
+        src = (const Sint32 *)mmsrc;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = ((float)(*src >> 8)) * DIVBY8388607;
+        i--;
+        src++;
+        dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_F32_to_S8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Sint8 *dst = (Sint8 *)cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S8 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 127;
+        } else if (sample <= -1.0f) {
+            *dst = -128;
+        } else {
+            *dst = (Sint8)(sample * 127.0f);
+        }
+    }
+
+    SDL_assert(!i || !(((size_t)dst) & 15));
+
+    /* Make sure src is aligned too. */
+    if (!(((size_t)src) & 15)) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby127 = vdupq_n_f32(127.0f);
+        int8_t *mmdst = (int8_t *)dst;
+        while (i >= 16) {                                                                                                       /* 16 * float32 */
+            const int32x4_t ints1 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby127));      /* load 4 floats, clamp, convert to sint32 */
+            const int32x4_t ints2 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 4)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
+            const int32x4_t ints3 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 8)), one), mulby127));  /* load 4 floats, clamp, convert to sint32 */
+            const int32x4_t ints4 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 12)), one), mulby127)); /* load 4 floats, clamp, convert to sint32 */
+            const int8x8_t i8lo = vmovn_s16(vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2)));                                  /* narrow to sint16, combine, narrow to sint8 */
+            const int8x8_t i8hi = vmovn_s16(vcombine_s16(vmovn_s32(ints3), vmovn_s32(ints4)));                                  /* narrow to sint16, combine, narrow to sint8 */
+            vst1q_s8(mmdst, vcombine_s8(i8lo, i8hi));                                                                           /* combine to int8x16_t, store out */
+            i -= 16;
+            src += 16;
+            mmdst += 16;
+        }
+        dst = (Sint8 *)mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 127;
+        } else if (sample <= -1.0f) {
+            *dst = -128;
+        } else {
+            *dst = (Sint8)(sample * 127.0f);
+        }
+        i--;
+        src++;
+        dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S8);
+    }
+}
+
+static void SDLCALL SDL_Convert_F32_to_U8_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Uint8 *dst = cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U8 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 255;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint8)((sample + 1.0f) * 127.0f);
+        }
+    }
+
+    SDL_assert(!i || !(((size_t)dst) & 15));
+
+    /* Make sure src is aligned too. */
+    if (!(((size_t)src) & 15)) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby127 = vdupq_n_f32(127.0f);
+        uint8_t *mmdst = (uint8_t *)dst;
+        while (i >= 16) {                                                                                                                         /* 16 * float32 */
+            const uint32x4_t uints1 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), one), mulby127));      /* load 4 floats, clamp, convert to uint32 */
+            const uint32x4_t uints2 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 4)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
+            const uint32x4_t uints3 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 8)), one), one), mulby127));  /* load 4 floats, clamp, convert to uint32 */
+            const uint32x4_t uints4 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 12)), one), one), mulby127)); /* load 4 floats, clamp, convert to uint32 */
+            const uint8x8_t ui8lo = vmovn_u16(vcombine_u16(vmovn_u32(uints1), vmovn_u32(uints2)));                                                /* narrow to uint16, combine, narrow to uint8 */
+            const uint8x8_t ui8hi = vmovn_u16(vcombine_u16(vmovn_u32(uints3), vmovn_u32(uints4)));                                                /* narrow to uint16, combine, narrow to uint8 */
+            vst1q_u8(mmdst, vcombine_u8(ui8lo, ui8hi));                                                                                           /* combine to uint8x16_t, store out */
+            i -= 16;
+            src += 16;
+            mmdst += 16;
+        }
+
+        dst = (Uint8 *)mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 255;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint8)((sample + 1.0f) * 127.0f);
+        }
+        i--;
+        src++;
+        dst++;
+    }
+
+    cvt->len_cvt /= 4;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U8);
+    }
+}
+
+/* Scalar version of the NEON conversion below, so results don't depend on buffer alignment */
+static SDL_INLINE Sint16 SDL_F32_to_S16_NEON(const float sample)
+{
+    if (sample >= 1.0f) {
+        return 32767;
+    } else if (sample <= -1.0f) {
+        return -32767;
+    }
+    return (Sint16)(sample * 32767.0f);
+}
+
+static void SDLCALL SDL_Convert_F32_to_S16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Sint16 *dst = (Sint16 *)cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S16 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
+        *dst = SDL_F32_to_S16_NEON(*src);
+    }
+
+    SDL_assert(!i || !(((size_t)dst) & 15));
+
+    /* Make sure src is aligned too. */
+    if (!(((size_t)src) & 15)) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
+        int16_t *mmdst = (int16_t *)dst;
+        while (i >= 8) {                                                                                                         /* 8 * float32 */
+            const int32x4_t ints1 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby32767));     /* load 4 floats, clamp, convert to sint32 */
+            const int32x4_t ints2 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 4)), one), mulby32767)); /* load 4 floats, clamp, convert to sint32 */
+            vst1q_s16(mmdst, vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2)));                                                  /* narrow to sint16, combine, store out. */
+            i -= 8;
+            src += 8;
+            mmdst += 8;
+        }
+        dst = (Sint16 *)mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        *dst = SDL_F32_to_S16_NEON(*src);
+        i--;
+        src++;
+        dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_F32_to_U16_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Uint16 *dst = (Uint16 *)cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_U16 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 65535;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint16)((sample + 1.0f) * 32767.0f);
+        }
+    }
+
+    SDL_assert(!i || !(((size_t)dst) & 15));
+
+    /* Make sure src is aligned too. */
+    if (!(((size_t)src) & 15)) {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
+        uint16_t *mmdst = (uint16_t *)dst;
+        while (i >= 8) {                                                                                                                           /* 8 * float32 */
+            const uint32x4_t uints1 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), one), mulby32767));     /* load 4 floats, clamp, convert to uint32 */
+            const uint32x4_t uints2 = vcvtq_u32_f32(vmulq_f32(vaddq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src + 4)), one), one), mulby32767)); /* load 4 floats, clamp, convert to uint32 */
+            vst1q_u16(mmdst, vcombine_u16(vmovn_u32(uints1), vmovn_u32(uints2)));                                                                  /* narrow to uint16, combine, store out. */
+            i -= 8;
+            src += 8;
+            mmdst += 8;
+        }
+        dst = (Uint16 *)mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 65535;
+        } else if (sample <= -1.0f) {
+            *dst = 0;
+        } else {
+            *dst = (Uint16)((sample + 1.0f) * 32767.0f);
+        }
+        i--;
+        src++;
+        dst++;
+    }
+
+    cvt->len_cvt /= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_U16SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_F32_to_S32_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Sint32 *dst = (Sint32 *)cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32", "AUDIO_S32 (using NEON)");
+
+    /* Get dst aligned to 16 bytes */
+    for (i = cvt->len_cvt / sizeof(float); i && (((size_t)dst) & 15); --i, ++src, ++dst) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 2147483647;
+        } else if (sample <= -1.0f) {
+            *dst = (-2147483647) - 1;
+        } else {
+            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
+        }
+    }
+
+    SDL_assert(!i || !(((size_t)dst) & 15));
+    SDL_assert(!i || !(((size_t)src) & 15));
+
+    {
+        /* Aligned! Do NEON blocks as long as we have 16 bytes available. */
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t negone = vdupq_n_f32(-1.0f);
+        const float32x4_t mulby8388607 = vdupq_n_f32(8388607.0f);
+        int32_t *mmdst = (int32_t *)dst;
+        while (i >= 4) { /* 4 * float32 */
+            vst1q_s32(mmdst, vshlq_n_s32(vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(src)), one), mulby8388607)), 8));
+            i -= 4;
+            src += 4;
+            mmdst += 4;
+        }
+        dst = (Sint32 *)mmdst;
+    }
+
+    /* Finish off any leftovers with scalar operations. */
+    while (i) {
+        const float sample = *src;
+        if (sample >= 1.0f) {
+            *dst = 2147483647;
+        } else if (sample <= -1.0f) {
+            *dst = (-2147483647) - 1;
+        } else {
+            *dst = ((Sint32)(sample * 8388607.0f)) << 8;
+        }
+        i--;
+        src++;
+        dst++;
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S32SYS);
+    }
+}
+#endif
+
+/* Fused converters.
+
+   These handle a few common conversions in a single pass over the buffer,
+   instead of running the type and channel conversion filters one after
+   another. Each produces exactly the same output as the filter chain it
+   replaces on the same CPU, so the type conversion uses the same arithmetic
+   as the matching converters above and the channel mix is the one from
+   SDL_audio_channel_converters.h. */
+
+static SDL_AudioFilter SDL_Convert_S16_Mono_to_S16_Stereo = NULL;
+static SDL_AudioFilter SDL_Convert_S16_Stereo_to_F32_51 = NULL;
+static SDL_AudioFilter SDL_Convert_S16_Stereo_to_F32_71 = NULL;
+static SDL_AudioFilter SDL_Convert_F32_71_to_S16_Stereo = NULL;
+
+/* Coefficients from SDL_Convert71ToStereo() */
+#define MIX71_FRONT     0.211866662f
+#define MIX71_CENTER    0.150266662f
+#define MIX71_LFE       0.066666670f
+#define MIX71_BACK_NEAR 0.181066677f
+#define MIX71_BACK_FAR  0.111066669f
+#define MIX71_SIDE_NEAR 0.194133341f
+#define MIX71_SIDE_FAR  0.085866667f
+
+#define MIX71_TO_FL(src) (((src)[0] * MIX71_FRONT) + ((src)[2] * MIX71_CENTER) + ((src)[3] * MIX71_LFE) + ((src)[4] * MIX71_BACK_NEAR) + ((src)[5] * MIX71_BACK_FAR) + ((src)[6] * MIX71_SIDE_NEAR) + ((src)[7] * MIX71_SIDE_FAR))
+#define MIX71_TO_FR(src) (((src)[1] * MIX71_FRONT) + ((src)[2] * MIX71_CENTER) + ((src)[3] * MIX71_LFE) + ((src)[4] * MIX71_BACK_FAR) + ((src)[5] * MIX71_BACK_NEAR) + ((src)[6] * MIX71_SIDE_FAR) + ((src)[7] * MIX71_SIDE_NEAR))
+
+/* Convert S16 stereo frames [first, last) to F32 with silent extra channels.
+   This goes backwards, since output is growing in-place. */
+static void SDL_ConvertS16StereoToF32Surround(Uint8 *buf, int first, int last, int dst_channels)
+{
+    const Sint16 *src = (const Sint16 *)buf;
+    float *dst = (float *)buf;
+    int i, c;
+
+    for (i = last - 1; i >= first; --i) {
+        const float srcFL = ((float)src[i * 2]) * DIVBY32768;
+        const float srcFR = ((float)src[i * 2 + 1]) * DIVBY32768;
+        float *out = &dst[i * dst_channels];
+        for (c = dst_channels - 1; c >= 2; --c) {
+            out[c] = 0.0f;
+        }
+        out[1] = srcFR;
+        out[0] = srcFL;
+    }
+}
+
+#if NEED_SCALAR_CONVERTER_FALLBACKS
+static SDL_INLINE Sint16 SDL_F32_to_S16_Scalar(const float sample)
+{
+    /* Same as SDL_Convert_F32_to_S16_Scalar() */
+    union float_bits x;
+    Uint32 y, z;
+    x.f32 = sample + 384.0f;
+
+    y = x.u32 - 0x43C00000u;
+    z = 0x7FFFu - (y ^ SIGNMASK(y));
+    y = y ^ (z & SIGNMASK(z));
+
+    return (Sint16)(y & 0xFFFF);
+}
+
+static void SDLCALL SDL_Convert_S16_Mono_to_S16_Stereo_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    Sint16 *dst = (Sint16 *)cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 mono", "AUDIO_S16 stereo");
+
+    /* S16 survives the round trip through float unchanged, so this is just a copy.
+       Convert backwards, since output is growing in-place. */
+    for (i = cvt->len_cvt / sizeof(Sint16) - 1; i >= 0; --i) {
+        const Sint16 sample = src[i];
+        dst[i * 2 + 1] = sample;
+        dst[i * 2] = sample;
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_S16_Stereo_to_F32_51_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const int num_frames = cvt->len_cvt / (sizeof(Sint16) * 2);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 5.1");
+
+    SDL_ConvertS16StereoToF32Surround(cvt->buf, 0, num_frames, 6);
+
+    cvt->len_cvt = num_frames * 6 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_S16_Stereo_to_F32_71_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const int num_frames = cvt->len_cvt / (sizeof(Sint16) * 2);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 7.1");
+
+    SDL_ConvertS16StereoToF32Surround(cvt->buf, 0, num_frames, 8);
+
+    cvt->len_cvt = num_frames * 8 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_F32_71_to_S16_Stereo_Scalar(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const int num_frames = cvt->len_cvt / (sizeof(float) * 8);
+    const float *src = (const float *)cvt->buf;
+    Sint16 *dst = (Sint16 *)cvt->buf;
+    int i;
+
+    LOG_DEBUG_CONVERT("AUDIO_F32 7.1", "AUDIO_S16 stereo");
+
+    for (i = num_frames; i; --i, src += 8, dst += 2) {
+        const float left = MIX71_TO_FL(src);
+        const float right = MIX71_TO_FR(src);
+        dst[0] = SDL_F32_to_S16_Scalar(left);
+        dst[1] = SDL_F32_to_S16_Scalar(right);
+    }
+
+    cvt->len_cvt = num_frames * 2 * sizeof(Sint16);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+#endif
+
+#ifdef HAVE_SSE2_INTRINSICS
+static SDL_INLINE Sint16 SDL_F32_to_S16_SSE2(const float sample)
+{
+    /* Same as SDL_Convert_F32_to_S16_SSE2() */
+    const __m128 offset = _mm_set1_ps(257.0f);
+    const __m128i ints = _mm_sub_epi32(_mm_castps_si128(_mm_add_ss(_mm_set_ss(sample), offset)), _mm_castps_si128(offset));
+    return (Sint16)(_mm_cvtsi128_si32(_mm_packs_epi32(ints, ints)) & 0xFFFF);
+}
+
+static void SDLCALL SDL_Convert_S16_Mono_to_S16_Stereo_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    Sint16 *dst = (Sint16 *)cvt->buf;
+    const int num_samples = cvt->len_cvt / sizeof(Sint16);
+    int i = num_samples & ~7;
+    int j;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 mono", "AUDIO_S16 stereo (using SSE2)");
+
+    /* S16 survives the round trip through float unchanged, so this is just a copy.
+       Convert backwards, since output is growing in-place. */
+    for (j = num_samples - 1; j >= i; --j) {
+        const Sint16 sample = src[j];
+        dst[j * 2 + 1] = sample;
+        dst[j * 2] = sample;
+    }
+
+    while (i) {
+        i -= 8;
+
+        {
+        const __m128i shorts = _mm_loadu_si128((const __m128i *)&src[i]);
+        _mm_storeu_si128((__m128i *)&dst[i * 2], _mm_unpacklo_epi16(shorts, shorts));
+        _mm_storeu_si128((__m128i *)&dst[i * 2 + 8], _mm_unpackhi_epi16(shorts, shorts));
+        }
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_S16_Stereo_to_F32_51_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(Sint16) * 2);
+    int i = num_frames & ~3;
+    const __m128 divby32768 = _mm_set1_ps(DIVBY32768);
+    const __m128 zero = _mm_setzero_ps();
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 5.1 (using SSE2)");
+
+    /* Convert backwards, since output is growing in-place. */
+    SDL_ConvertS16StereoToF32Surround(cvt->buf, i, num_frames, 6);
+
+    while (i) {
+        i -= 4;
+
+        {
+        const __m128i shorts = _mm_loadu_si128((const __m128i *)&src[i * 2]);
+        const __m128 frames01 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 16)), divby32768);
+        const __m128 frames23 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(shorts, shorts), 16)), divby32768);
+        float *out = &dst[i * 6];
+
+        _mm_storeu_ps(&out[0], _mm_movelh_ps(frames01, zero));
+        _mm_storeu_ps(&out[4], _mm_shuffle_ps(zero, frames01, _MM_SHUFFLE(3, 2, 1, 0)));
+        _mm_storeu_ps(&out[8], zero);
+        _mm_storeu_ps(&out[12], _mm_movelh_ps(frames23, zero));
+        _mm_storeu_ps(&out[16], _mm_shuffle_ps(zero, frames23, _MM_SHUFFLE(3, 2, 1, 0)));
+        _mm_storeu_ps(&out[20], zero);
+        }
+    }
+
+    cvt->len_cvt = num_frames * 6 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_S16_Stereo_to_F32_71_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(Sint16) * 2);
+    int i = num_frames & ~3;
+    const __m128 divby32768 = _mm_set1_ps(DIVBY32768);
+    const __m128 zero = _mm_setzero_ps();
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 7.1 (using SSE2)");
+
+    /* Convert backwards, since output is growing in-place. */
+    SDL_ConvertS16StereoToF32Surround(cvt->buf, i, num_frames, 8);
+
+    while (i) {
+        i -= 4;
+
+        {
+        const __m128i shorts = _mm_loadu_si128((const __m128i *)&src[i * 2]);
+        const __m128 frames01 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 16)), divby32768);
+        const __m128 frames23 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(shorts, shorts), 16)), divby32768);
+        float *out = &dst[i * 8];
+
+        _mm_storeu_ps(&out[0], _mm_movelh_ps(frames01, zero));
+        _mm_storeu_ps(&out[4], zero);
+        _mm_storeu_ps(&out[8], _mm_movehl_ps(zero, frames01));
+        _mm_storeu_ps(&out[12], zero);
+        _mm_storeu_ps(&out[16], _mm_movelh_ps(frames23, zero));
+        _mm_storeu_ps(&out[20], zero);
+        _mm_storeu_ps(&out[24], _mm_movehl_ps(zero, frames23));
+        _mm_storeu_ps(&out[28], zero);
+        }
+    }
+
+    cvt->len_cvt = num_frames * 8 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_F32_71_to_S16_Stereo_SSE2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Sint16 *dst = (Sint16 *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(float) * 8);
+    int i = num_frames;
+    const __m128 offset = _mm_set1_ps(257.0f);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32 7.1", "AUDIO_S16 stereo (using SSE2)");
+
+    while (i >= 4) {
+        /* Load 4 frames, then transpose them so each register holds one channel */
+        __m128 FL = _mm_loadu_ps(&src[0]);
+        __m128 FR = _mm_loadu_ps(&src[8]);
+        __m128 FC = _mm_loadu_ps(&src[16]);
+        __m128 LFE = _mm_loadu_ps(&src[24]);
+        __m128 BL = _mm_loadu_ps(&src[4]);
+        __m128 BR = _mm_loadu_ps(&src[12]);
+        __m128 SL = _mm_loadu_ps(&src[20]);
+        __m128 SR = _mm_loadu_ps(&src[28]);
+        __m128 left, right;
+        __m128i ileft, iright;
+
+        _MM_TRANSPOSE4_PS(FL, FR, FC, LFE);
+        _MM_TRANSPOSE4_PS(BL, BR, SL, SR);
+
+        /* Accumulate in the same order as the scalar mix, so rounding is identical */
+        left = _mm_mul_ps(FL, _mm_set1_ps(MIX71_FRONT));
+        left = _mm_add_ps(left, _mm_mul_ps(FC, _mm_set1_ps(MIX71_CENTER)));
+        left = _mm_add_ps(left, _mm_mul_ps(LFE, _mm_set1_ps(MIX71_LFE)));
+        left = _mm_add_ps(left, _mm_mul_ps(BL, _mm_set1_ps(MIX71_BACK_NEAR)));
+        left = _mm_add_ps(left, _mm_mul_ps(BR, _mm_set1_ps(MIX71_BACK_FAR)));
+        left = _mm_add_ps(left, _mm_mul_ps(SL, _mm_set1_ps(MIX71_SIDE_NEAR)));
+        left = _mm_add_ps(left, _mm_mul_ps(SR, _mm_set1_ps(MIX71_SIDE_FAR)));
+
+        right = _mm_mul_ps(FR, _mm_set1_ps(MIX71_FRONT));
+        right = _mm_add_ps(right, _mm_mul_ps(FC, _mm_set1_ps(MIX71_CENTER)));
+        right = _mm_add_ps(right, _mm_mul_ps(LFE, _mm_set1_ps(MIX71_LFE)));
+        right = _mm_add_ps(right, _mm_mul_ps(BL, _mm_set1_ps(MIX71_BACK_FAR)));
+        right = _mm_add_ps(right, _mm_mul_ps(BR, _mm_set1_ps(MIX71_BACK_NEAR)));
+        right = _mm_add_ps(right, _mm_mul_ps(SL, _mm_set1_ps(MIX71_SIDE_FAR)));
+        right = _mm_add_ps(right, _mm_mul_ps(SR, _mm_set1_ps(MIX71_SIDE_NEAR)));
+
+        ileft = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(left, offset)), _mm_castps_si128(offset));
+        iright = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(right, offset)), _mm_castps_si128(offset));
+        _mm_storeu_si128((__m128i *)dst, _mm_packs_epi32(_mm_unpacklo_epi32(ileft, iright), _mm_unpackhi_epi32(ileft, iright)));
+
+        i -= 4;
+        src += 32;
+        dst += 8;
+    }
+
+    while (i) {
+        const float left = MIX71_TO_FL(src);
+        const float right = MIX71_TO_FR(src);
+        dst[0] = SDL_F32_to_S16_SSE2(left);
+        dst[1] = SDL_F32_to_S16_SSE2(right);
+
+        --i;
+        src += 8;
+        dst += 2;
+    }
+
+    cvt->len_cvt = num_frames * 2 * sizeof(Sint16);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+#endif
+
+#ifdef HAVE_AVX2_INTRINSICS
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_S16_Mono_to_S16_Stereo_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    Sint16 *dst = (Sint16 *)cvt->buf;
+    const int num_samples = cvt->len_cvt / sizeof(Sint16);
+    int i = num_samples & ~15;
+    int j;
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 mono", "AUDIO_S16 stereo (using AVX2)");
+
+    /* S16 survives the round trip through float unchanged, so this is just a copy.
+       Convert backwards, since output is growing in-place. */
+    for (j = num_samples - 1; j >= i; --j) {
+        const Sint16 sample = src[j];
+        dst[j * 2 + 1] = sample;
+        dst[j * 2] = sample;
+    }
+
+    while (i) {
+        i -= 16;
+
+        {
+        /* The unpacks work within each 128-bit lane, so swap the middle quarters afterwards */
+        const __m256i shorts = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i lo = _mm256_unpacklo_epi16(shorts, shorts);
+        const __m256i hi = _mm256_unpackhi_epi16(shorts, shorts);
+        _mm256_storeu_si256((__m256i *)&dst[i * 2], _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i *)&dst[i * 2 + 16], _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_S16_Stereo_to_F32_51_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(Sint16) * 2);
+    int i = num_frames & ~3;
+    const __m256 divby32768 = _mm256_set1_ps(DIVBY32768);
+    const __m256 zero = _mm256_setzero_ps();
+    /* Spread 4 stereo frames over 3 registers of 5.1 frames, the blends zero the rest */
+    const __m256i spread0 = _mm256_setr_epi32(0, 1, 0, 0, 0, 0, 2, 3);
+    const __m256i spread1 = _mm256_setr_epi32(0, 0, 0, 0, 4, 5, 0, 0);
+    const __m256i spread2 = _mm256_setr_epi32(0, 0, 6, 7, 0, 0, 0, 0);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 5.1 (using AVX2)");
+
+    /* Convert backwards, since output is growing in-place. */
+    SDL_ConvertS16StereoToF32Surround(cvt->buf, i, num_frames, 6);
+
+    while (i) {
+        i -= 4;
+
+        {
+        const __m128i shorts = _mm_loadu_si128((const __m128i *)&src[i * 2]);
+        const __m256 frames = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(shorts)), divby32768);
+        float *out = &dst[i * 6];
+
+        _mm256_storeu_ps(&out[0], _mm256_blend_ps(zero, _mm256_permutevar8x32_ps(frames, spread0), 0xC3));
+        _mm256_storeu_ps(&out[8], _mm256_blend_ps(zero, _mm256_permutevar8x32_ps(frames, spread1), 0x30));
+        _mm256_storeu_ps(&out[16], _mm256_blend_ps(zero, _mm256_permutevar8x32_ps(frames, spread2), 0x0C));
+        }
+    }
+
+    cvt->len_cvt = num_frames * 6 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_S16_Stereo_to_F32_71_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(Sint16) * 2);
+    int i = num_frames & ~3;
+    const __m256 divby32768 = _mm256_set1_ps(DIVBY32768);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256i frame1 = _mm256_setr_epi32(2, 3, 0, 0, 0, 0, 0, 0);
+    const __m256i frame2 = _mm256_setr_epi32(4, 5, 0, 0, 0, 0, 0, 0);
+    const __m256i frame3 = _mm256_setr_epi32(6, 7, 0, 0, 0, 0, 0, 0);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 7.1 (using AVX2)");
+
+    /* Convert backwards, since output is growing in-place. */
+    SDL_ConvertS16StereoToF32Surround(cvt->buf, i, num_frames, 8);
+
+    while (i) {
+        i -= 4;
+
+        {
+        const __m128i shorts = _mm_loadu_si128((const __m128i *)&src[i * 2]);
+        const __m256 frames = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(shorts)), divby32768);
+        float *out = &dst[i * 8];
+
+        _mm256_storeu_ps(&out[0], _mm256_blend_ps(zero, frames, 0x03));
+        _mm256_storeu_ps(&out[8], _mm256_blend_ps(zero, _mm256_permutevar8x32_ps(frames, frame1), 0x03));
+        _mm256_storeu_ps(&out[16], _mm256_blend_ps(zero, _mm256_permutevar8x32_ps(frames, frame2), 0x03));
+        _mm256_storeu_ps(&out[24], _mm256_blend_ps(zero, _mm256_permutevar8x32_ps(frames, frame3), 0x03));
+        }
+    }
+
+    cvt->len_cvt = num_frames * 8 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_TARGETING_AVX2 SDL_Convert_F32_71_to_S16_Stereo_AVX2(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Sint16 *dst = (Sint16 *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(float) * 8);
+    int i = num_frames;
+    const __m256 offset = _mm256_set1_ps(257.0f);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32 7.1", "AUDIO_S16 stereo (using AVX2)");
+
+    while (i >= 8) {
+        /* Load 8 frames, then transpose them so each register holds one channel */
+        const __m256 r0 = _mm256_loadu_ps(&src[0]);
+        const __m256 r1 = _mm256_loadu_ps(&src[8]);
+        const __m256 r2 = _mm256_loadu_ps(&src[16]);
+        const __m256 r3 = _mm256_loadu_ps(&src[24]);
+        const __m256 r4 = _mm256_loadu_ps(&src[32]);
+        const __m256 r5 = _mm256_loadu_ps(&src[40]);
+        const __m256 r6 = _mm256_loadu_ps(&src[48]);
+        const __m256 r7 = _mm256_loadu_ps(&src[56]);
+        const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        const __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+        const __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+        const __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+        const __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+        const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 FL = _mm256_permute2f128_ps(s0, s4, 0x20);
+        const __m256 FR = _mm256_permute2f128_ps(s1, s5, 0x20);
+        const __m256 FC = _mm256_permute2f128_ps(s2, s6, 0x20);
+        const __m256 LFE = _mm256_permute2f128_ps(s3, s7, 0x20);
+        const __m256 BL = _mm256_permute2f128_ps(s0, s4, 0x31);
+        const __m256 BR = _mm256_permute2f128_ps(s1, s5, 0x31);
+        const __m256 SL = _mm256_permute2f128_ps(s2, s6, 0x31);
+        const __m256 SR = _mm256_permute2f128_ps(s3, s7, 0x31);
+        __m256 left, right;
+        __m256i ileft, iright;
+
+        /* Accumulate in the same order as the scalar mix, so rounding is identical */
+        left = _mm256_mul_ps(FL, _mm256_set1_ps(MIX71_FRONT));
+        left = _mm256_add_ps(left, _mm256_mul_ps(FC, _mm256_set1_ps(MIX71_CENTER)));
+        left = _mm256_add_ps(left, _mm256_mul_ps(LFE, _mm256_set1_ps(MIX71_LFE)));
+        left = _mm256_add_ps(left, _mm256_mul_ps(BL, _mm256_set1_ps(MIX71_BACK_NEAR)));
+        left = _mm256_add_ps(left, _mm256_mul_ps(BR, _mm256_set1_ps(MIX71_BACK_FAR)));
+        left = _mm256_add_ps(left, _mm256_mul_ps(SL, _mm256_set1_ps(MIX71_SIDE_NEAR)));
+        left = _mm256_add_ps(left, _mm256_mul_ps(SR, _mm256_set1_ps(MIX71_SIDE_FAR)));
+
+        right = _mm256_mul_ps(FR, _mm256_set1_ps(MIX71_FRONT));
+        right = _mm256_add_ps(right, _mm256_mul_ps(FC, _mm256_set1_ps(MIX71_CENTER)));
+        right = _mm256_add_ps(right, _mm256_mul_ps(LFE, _mm256_set1_ps(MIX71_LFE)));
+        right = _mm256_add_ps(right, _mm256_mul_ps(BL, _mm256_set1_ps(MIX71_BACK_FAR)));
+        right = _mm256_add_ps(right, _mm256_mul_ps(BR, _mm256_set1_ps(MIX71_BACK_NEAR)));
+        right = _mm256_add_ps(right, _mm256_mul_ps(SL, _mm256_set1_ps(MIX71_SIDE_FAR)));
+        right = _mm256_add_ps(right, _mm256_mul_ps(SR, _mm256_set1_ps(MIX71_SIDE_NEAR)));
+
+        /* Same conversion as SDL_Convert_F32_to_S16_SSE2(). The unpacks and the pack
+           all work within each 128-bit lane, which leaves the frames in order. */
+        ileft = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(left, offset)), _mm256_castps_si256(offset));
+        iright = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(right, offset)), _mm256_castps_si256(offset));
+        _mm256_storeu_si256((__m256i *)dst, _mm256_packs_epi32(_mm256_unpacklo_epi32(ileft, iright), _mm256_unpackhi_epi32(ileft, iright)));
+
+        i -= 8;
+        src += 64;
+        dst += 16;
+    }
+
+    while (i) {
+        const float left = MIX71_TO_FL(src);
+        const float right = MIX71_TO_FR(src);
+        dst[0] = SDL_F32_to_S16_SSE2(left);
+        dst[1] = SDL_F32_to_S16_SSE2(right);
+
+        --i;
+        src += 8;
+        dst += 2;
+    }
+
+    cvt->len_cvt = num_frames * 2 * sizeof(Sint16);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+static void SDLCALL SDL_Convert_S16_Mono_to_S16_Stereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    Sint16 *dst = (Sint16 *)cvt->buf;
+    const int num_samples = cvt->len_cvt / sizeof(Sint16);
+    int i = num_samples & ~7;
+    int j;
+    const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t negone = vdupq_n_f32(-1.0f);
+    const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 mono", "AUDIO_S16 stereo (using NEON)");
+
+    /* The NEON converters scale by 32767 on the way back, so this can't just copy.
+       Convert backwards, since output is growing in-place. */
+    for (j = num_samples - 1; j >= i; --j) {
+        const Sint16 sample = SDL_F32_to_S16_NEON(((float)src[j]) * DIVBY32768);
+        dst[j * 2 + 1] = sample;
+        dst[j * 2] = sample;
+    }
+
+    while (i) {
+        i -= 8;
+
+        {
+        const int16x8_t ints = vld1q_s16((int16_t const *)&src[i]);
+        const float32x4_t floats1 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(ints))), divby32768);
+        const float32x4_t floats2 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(ints))), divby32768);
+        const int32x4_t ints1 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, floats1), one), mulby32767));
+        const int32x4_t ints2 = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, floats2), one), mulby32767));
+        int16x8x2_t stereo;
+        stereo.val[0] = vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2));
+        stereo.val[1] = stereo.val[0];
+        vst2q_s16((int16_t *)&dst[i * 2], stereo);
+        }
+    }
+
+    cvt->len_cvt *= 2;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_S16_Stereo_to_F32_51_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(Sint16) * 2);
+    int i = num_frames & ~3;
+    const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x2_t zero2 = vdup_n_f32(0.0f);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 5.1 (using NEON)");
+
+    /* Convert backwards, since output is growing in-place. */
+    SDL_ConvertS16StereoToF32Surround(cvt->buf, i, num_frames, 6);
+
+    while (i) {
+        i -= 4;
+
+        {
+        const int16x8_t ints = vld1q_s16((int16_t const *)&src[i * 2]);
+        const float32x4_t frames01 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(ints))), divby32768);
+        const float32x4_t frames23 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(ints))), divby32768);
+        float *out = &dst[i * 6];
+
+        vst1q_f32(&out[0], vcombine_f32(vget_low_f32(frames01), zero2));
+        vst1q_f32(&out[4], vcombine_f32(zero2, vget_high_f32(frames01)));
+        vst1q_f32(&out[8], zero);
+        vst1q_f32(&out[12], vcombine_f32(vget_low_f32(frames23), zero2));
+        vst1q_f32(&out[16], vcombine_f32(zero2, vget_high_f32(frames23)));
+        vst1q_f32(&out[20], zero);
+        }
+    }
+
+    cvt->len_cvt = num_frames * 6 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_S16_Stereo_to_F32_71_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const Sint16 *src = (const Sint16 *)cvt->buf;
+    float *dst = (float *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(Sint16) * 2);
+    int i = num_frames & ~3;
+    const float32x4_t divby32768 = vdupq_n_f32(DIVBY32768);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x2_t zero2 = vdup_n_f32(0.0f);
+
+    LOG_DEBUG_CONVERT("AUDIO_S16 stereo", "AUDIO_F32 7.1 (using NEON)");
+
+    /* Convert backwards, since output is growing in-place. */
+    SDL_ConvertS16StereoToF32Surround(cvt->buf, i, num_frames, 8);
+
+    while (i) {
+        i -= 4;
+
+        {
+        const int16x8_t ints = vld1q_s16((int16_t const *)&src[i * 2]);
+        const float32x4_t frames01 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(ints))), divby32768);
+        const float32x4_t frames23 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(ints))), divby32768);
+        float *out = &dst[i * 8];
+
+        vst1q_f32(&out[0], vcombine_f32(vget_low_f32(frames01), zero2));
+        vst1q_f32(&out[4], zero);
+        vst1q_f32(&out[8], vcombine_f32(vget_high_f32(frames01), zero2));
+        vst1q_f32(&out[12], zero);
+        vst1q_f32(&out[16], vcombine_f32(vget_low_f32(frames23), zero2));
+        vst1q_f32(&out[20], zero);
+        vst1q_f32(&out[24], vcombine_f32(vget_high_f32(frames23), zero2));
+        vst1q_f32(&out[28], zero);
+        }
+    }
+
+    cvt->len_cvt = num_frames * 8 * sizeof(float);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_F32SYS);
+    }
+}
+
+static void SDLCALL SDL_Convert_F32_71_to_S16_Stereo_NEON(SDL_AudioCVT *cvt, SDL_AudioFormat format)
+{
+    const float *src = (const float *)cvt->buf;
+    Sint16 *dst = (Sint16 *)cvt->buf;
+    const int num_frames = cvt->len_cvt / (sizeof(float) * 8);
+    int i = num_frames;
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t negone = vdupq_n_f32(-1.0f);
+    const float32x4_t mulby32767 = vdupq_n_f32(32767.0f);
+
+    LOG_DEBUG_CONVERT("AUDIO_F32 7.1", "AUDIO_S16 stereo (using NEON)");
+
+    while (i >= 4) {
+        /* The mix uses the scalar expression, since compilers are free to fuse its
+           multiply-adds on ARM and a vector mix could round differently. */
+        float left[4], right[4];
+        int32x4_t ileft, iright;
+        int16x4x2_t stereo;
+        int j;
+
+        for (j = 0; j < 4; ++j) {
+            left[j] = MIX71_TO_FL(&src[j * 8]);
+            right[j] = MIX71_TO_FR(&src[j * 8]);
+        }
+
+        ileft = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(left)), one), mulby32767));
+        iright = vcvtq_s32_f32(vmulq_f32(vminq_f32(vmaxq_f32(negone, vld1q_f32(right)), one), mulby32767));
+        stereo.val[0] = vmovn_s32(ileft);
+        stereo.val[1] = vmovn_s32(iright);
+        vst2_s16((int16_t *)dst, stereo);
+
+        i -= 4;
+        src += 32;
+        dst += 8;
+    }
+
+    while (i) {
+        const float left = MIX71_TO_FL(src);
+        const float right = MIX71_TO_FR(src);
+        dst[0] = SDL_F32_to_S16_NEON(left);
+        dst[1] = SDL_F32_to_S16_NEON(right);
+
+        --i;
+        src += 8;
+        dst += 2;
+    }
+
+    cvt->len_cvt = num_frames * 2 * sizeof(Sint16);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index](cvt, AUDIO_S16SYS);
+    }
+}
+#endif
+
+SDL_AudioFilter SDL_GetFusedAudioConverter(SDL_AudioFormat src_format, Uint8 src_channels, SDL_AudioFormat dst_format, Uint8 dst_channels)
+{
+    static const struct
+    {
+        SDL_AudioFormat src_format;
+        Uint8 src_channels;
+        SDL_AudioFormat dst_format;
+        Uint8 dst_channels;
+        SDL_AudioFilter *filter;
+    } fused_converters[] = {
+        { AUDIO_S16SYS, 1, AUDIO_S16SYS, 2, &SDL_Convert_S16_Mono_to_S16_Stereo },
+        { AUDIO_S16SYS, 2, AUDIO_F32SYS, 6, &SDL_Convert_S16_Stereo_to_F32_51 },
+        { AUDIO_S16SYS, 2, AUDIO_F32SYS, 8, &SDL_Convert_S16_Stereo_to_F32_71 },
+        { AUDIO_F32SYS, 8, AUDIO_S16SYS, 2, &SDL_Convert_F32_71_to_S16_Stereo },
+    };
+    size_t i;
+
+    SDL_ChooseAudioConverters();
+
+    for (i = 0; i < SDL_arraysize(fused_converters); ++i) {
+        if (fused_converters[i].src_format == src_format &&
+            fused_converters[i].src_channels == src_channels &&
+            fused_converters[i].dst_format == dst_format &&
+            fused_converters[i].dst_channels == dst_channels) {
+            return *fused_converters[i].filter;
+        }
+    }
+    return NULL;
+}
+
+/* These stay NULL without a SIMD implementation, SDL_audiocvt.c falls back to a separate byteswap pass then. */
+static SDL_AudioFilter SDL_Convert_Byteswap16 = NULL;
+static SDL_AudioFilter SDL_Convert_Byteswap32 = NULL;
+static SDL_AudioFilter SDL_Convert_S16_Swapped_to_F32 = NULL;
+static SDL_AudioFilter SDL_Convert_S32_Swapped_to_F32 = NULL;
+static SDL_AudioFilter SDL_Convert_F32_to_S16_Swapped = NULL;
+static SDL_AudioFilter SDL_Convert_F32_to_S32_Swapped = NULL;
+
+SDL_AudioFilter SDL_GetByteswapAudioConverter(SDL_AudioFormat src_format, SDL_AudioFormat dst_format)
+{
+    SDL_ChooseAudioConverters();
+
+    /* Only the byte order differs */
+    if ((src_format ^ dst_format) == SDL_AUDIO_MASK_ENDIAN) {
+        switch (SDL_AUDIO_BITSIZE(src_format)) {
+        case 16:
+            return SDL_Convert_Byteswap16;
+        case 32:
+            return SDL_Convert_Byteswap32;
+        default:
+            return NULL;
+        }
+    }
+
+    if (dst_format == AUDIO_F32SYS) {
+        if (src_format == (AUDIO_S16SYS ^ SDL_AUDIO_MASK_ENDIAN)) {
+            return SDL_Convert_S16_Swapped_to_F32;
+        } else if (src_format == (AUDIO_S32SYS ^ SDL_AUDIO_MASK_ENDIAN)) {
+            return SDL_Convert_S32_Swapped_to_F32;
+        }
+    } else if (src_format == AUDIO_F32SYS) {
+        if (dst_format == (AUDIO_S16SYS ^ SDL_AUDIO_MASK_ENDIAN)) {
+            return SDL_Convert_F32_to_S16_Swapped;
+        } else if (dst_format == (AUDIO_S32SYS ^ SDL_AUDIO_MASK_ENDIAN)) {
+            return SDL_Convert_F32_to_S32_Swapped;
+        }
+    }
+    return NULL;
+}
+
+void SDL_ChooseAudioConverters(void)
+{
+    /* Choose again whenever SDL_HINT_CPU_FEATURE_MASK changes what's available */
+    static int chosen_features = -1;
+    SDL_bool converters_chosen = SDL_FALSE;
+    const int features = (SDL_HasSSE2() << 0) | (SDL_HasSSE41() << 1) | (SDL_HasAVX2() << 2) | (SDL_HasNEON() << 3);
+
+    if (features == chosen_features) {
+        return;
+    }
+    chosen_features = features;
+
+    SDL_Convert_S16_Mono_to_S16_Stereo = NULL;
+    SDL_Convert_S16_Stereo_to_F32_51 = NULL;
+    SDL_Convert_S16_Stereo_to_F32_71 = NULL;
+    SDL_Convert_F32_71_to_S16_Stereo = NULL;
+    SDL_Convert_Byteswap16 = NULL;
+    SDL_Convert_Byteswap32 = NULL;
+    SDL_Convert_S16_Swapped_to_F32 = NULL;
+    SDL_Convert_S32_Swapped_to_F32 = NULL;
+    SDL_Convert_F32_to_S16_Swapped = NULL;
+    SDL_Convert_F32_to_S32_Swapped = NULL;
+
+#define SET_CONVERTER_FUNCS(fntype)                           \
+    SDL_Convert_S8_to_F32 = SDL_Convert_S8_to_F32_##fntype;   \
+    SDL_Convert_U8_to_F32 = SDL_Convert_U8_to_F32_##fntype;   \
+    SDL_Convert_S16_to_F32 = SDL_Convert_S16_to_F32_##fntype; \
+    SDL_Convert_U16_to_F32 = SDL_Convert_U16_to_F32_##fntype; \
+    SDL_Convert_S32_to_F32 = SDL_Convert_S32_to_F32_##fntype; \
+    SDL_Convert_F32_to_S8 = SDL_Convert_F32_to_S8_##fntype;   \
+    SDL_Convert_F32_to_U8 = SDL_Convert_F32_to_U8_##fntype;   \
+    SDL_Convert_F32_to_S16 = SDL_Convert_F32_to_S16_##fntype; \
+    SDL_Convert_F32_to_U16 = SDL_Convert_F32_to_U16_##fntype; \
+    SDL_Convert_F32_to_S32 = SDL_Convert_F32_to_S32_##fntype; \
+    converters_chosen = SDL_TRUE
+
+#define SET_FUSED_CONVERTER_FUNCS(fntype)                                                   \
+    SDL_Convert_S16_Mono_to_S16_Stereo = SDL_Convert_S16_Mono_to_S16_Stereo_##fntype; \
+    SDL_Convert_S16_Stereo_to_F32_51 = SDL_Convert_S16_Stereo_to_F32_51_##fntype;     \
+    SDL_Convert_S16_Stereo_to_F32_71 = SDL_Convert_S16_Stereo_to_F32_71_##fntype;     \
+    SDL_Convert_F32_71_to_S16_Stereo = SDL_Convert_F32_71_to_S16_Stereo_##fntype
+
+#define SET_BYTESWAP_CONVERTER_FUNCS(fntype)                                          \
+    SDL_Convert_Byteswap16 = SDL_Convert_Byteswap16_##fntype;                       \
+    SDL_Convert_Byteswap32 = SDL_Convert_Byteswap32_##fntype;                       \
+    SDL_Convert_S16_Swapped_to_F32 = SDL_Convert_S16_Swapped_to_F32_##fntype;       \
+    SDL_Convert_S32_Swapped_to_F32 = SDL_Convert_S32_Swapped_to_F32_##fntype;       \
+    SDL_Convert_F32_to_S16_Swapped = SDL_Convert_F32_to_S16_Swapped_##fntype;       \
+    SDL_Convert_F32_to_S32_Swapped = SDL_Convert_F32_to_S32_Swapped_##fntype
+
+#ifdef HAVE_SSE2_INTRINSICS
+    /* Without scalar fallbacks SSE2 is the baseline, even if it was masked off */
+    if (SDL_HasSSE2() || !NEED_SCALAR_CONVERTER_FALLBACKS) {
+        SET_CONVERTER_FUNCS(SSE2);
+        SET_FUSED_CONVERTER_FUNCS(SSE2);
+#ifdef HAVE_SSSE3_INTRINSICS
+        /* There's no SSSE3 check, but every CPU with SSE4.1 has SSSE3. */
+        if (SDL_HasSSE41()) {
+            SET_BYTESWAP_CONVERTER_FUNCS(SSSE3);
+        }
+#endif
+#ifdef HAVE_AVX2_INTRINSICS
+        if (SDL_HasAVX2()) {
+            SET_CONVERTER_FUNCS(AVX2);
+            SET_FUSED_CONVERTER_FUNCS(AVX2);
+        }
+#endif
         return;
     }
 #endif
 
 #ifdef HAVE_NEON_INTRINSICS
-    if (SDL_HasNEON()) {
+    if (SDL_HasNEON() || !NEED_SCALAR_CONVERTER_FALLBACKS) {
         SET_CONVERTER_FUNCS(NEON);
+        SET_FUSED_CONVERTER_FUNCS(NEON);
         return;
     }
 #endif
 
 #if NEED_SCALAR_CONVERTER_FALLBACKS
     SET_CONVERTER_FUNCS(Scalar);
+    SET_FUSED_CONVERTER_FUNCS(Scalar);
 #endif
 
 #undef SET_CONVERTER_FUNCS
+#undef SET_FUSED_CONVERTER_FUNCS
+#undef SET_BYTESWAP_CONVERTER_FUNCS
 
     SDL_assert(converters_chosen == SDL_TRUE);
 }
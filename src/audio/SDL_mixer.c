@@ -25,8 +25,17 @@
 #include "SDL_cpuinfo.h"
 #include "SDL_timer.h"
 #include "SDL_audio.h"
+#include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
 
+#ifdef __ARM_NEON
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#ifdef __SSE__
+#define HAVE_SSE_INTRINSICS 1
+#endif
+
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
  */
@@ -342,4 +351,54 @@ void SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
     }
 }
 
+/* Add native float samples, scaled by a gain that moves linearly from
+ * gain_start to gain_end over the frames, to a float accumulator. Nothing
+ * is clamped here; that happens when the accumulator is converted.
+ */
+void SDL_MixAudioF32Gain(float *dst, const float *src, int num_frames, int channels, float gain_start, float gain_end)
+{
+    int i = 0;
+
+    if (gain_start != gain_end) {
+        /* Ramps only last one buffer, so keep them simple. */
+        const float step = (gain_end - gain_start) / (float)num_frames;
+        float gain = gain_start;
+        int c;
+
+        for (i = 0; i < num_frames; ++i) {
+            for (c = 0; c < channels; ++c) {
+                *(dst++) += *(src++) * gain;
+            }
+            gain += step;
+        }
+        return;
+    }
+
+    num_frames *= channels;
+
+#ifdef HAVE_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        const __m128 gain = _mm_set1_ps(gain_start);
+        for (; i + 8 <= num_frames; i += 8) {
+            const __m128 a = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), gain));
+            const __m128 b = _mm_add_ps(_mm_loadu_ps(dst + i + 4), _mm_mul_ps(_mm_loadu_ps(src + i + 4), gain));
+            _mm_storeu_ps(dst + i, a);
+            _mm_storeu_ps(dst + i + 4, b);
+        }
+    }
+#elif defined(HAVE_NEON_INTRINSICS)
+    if (SDL_HasNEON()) {
+        const float32x4_t gain = vdupq_n_f32(gain_start);
+        for (; i + 8 <= num_frames; i += 8) {
+            vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), gain));
+            vst1q_f32(dst + i + 4, vmlaq_f32(vld1q_f32(dst + i + 4), vld1q_f32(src + i + 4), gain));
+        }
+    }
+#endif
+
+    for (; i < num_frames; ++i) {
+        dst[i] += src[i] * gain_start;
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
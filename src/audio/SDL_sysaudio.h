@@ -123,6 +123,44 @@ typedef struct SDL_AudioDriver
     SDL_AudioDeviceItem *inputDevices;
 } SDL_AudioDriver;
 
+/* Control operations posted to a playback thread running without mixer_lock
+   (SDL_HINT_AUDIO_CALLBACK_LOCKFREE). A command only tells the audio thread
+   which requested_* value to apply, so a stale command can't undo a newer
+   request that was applied directly under the device lock. */
+typedef enum
+{
+    SDL_AUDIO_COMMAND_PAUSE,
+    SDL_AUDIO_COMMAND_SET_VOLUME
+} SDL_AudioCommandType;
+
+typedef struct SDL_AudioCommand
+{
+    SDL_atomic_t sequence; /* slot ownership, see post_audio_command() */
+    SDL_AudioCommandType type;
+} SDL_AudioCommand;
+
+/* Must be a power of two */
+#define SDL_AUDIO_COMMAND_RING_SIZE 64
+
+/* How long a command waits for room in a full ring, in milliseconds */
+#define SDL_AUDIO_COMMAND_TIMEOUT 1000
+
+/* An SDL_AudioStream mixed into a playback device's output (SDL_BindAudioStream). */
+typedef struct SDL_BoundAudioStream
+{
+    SDL_AudioStream *stream;
+    float gain;        /* gain at the start of the next buffer */
+    float target_gain; /* gain the ramp ends at, one buffer later */
+} SDL_BoundAudioStream;
+
+/* A buffer of captured audio in the lock-free capture ring (SDL_HINT_AUDIO_CAPTURE_LOCKFREE). */
+typedef struct SDL_CapturePacket
+{
+    Uint64 timestamp; /* capture time of the first sample frame, in nanoseconds */
+    Uint32 sequence;
+    Uint8 *data;      /* callbackspec.size bytes */
+} SDL_CapturePacket;
+
 /* Define the SDL audio driver structure */
 struct SDL_AudioDevice
 {
@@ -145,6 +183,58 @@ struct SDL_AudioDevice
     SDL_atomic_t paused;
     SDL_bool iscapture;
 
+    /* Whether the audio thread rendered the current period as paused. It's
+       decided once per period, before the callback, and backends should read
+       it in PlayDevice() and WaitDevice() instead of paused. */
+    SDL_bool period_paused;
+
+    /* Sample frames handed to PlayDevice() while not paused, and the
+       device statistics, both guarded by stats_lock. */
+    Uint64 frames_played;
+    SDL_AudioDeviceStats stats;
+    SDL_SpinLock stats_lock;
+
+    /* Deadline tracking, only touched by the audio thread. */
+    Uint64 schedule_start;
+    Uint64 schedule_periods;
+    Uint64 last_wakeup;
+    SDL_bool prefill;
+
+    /* Volume applied after the callback, 0 to SDL_MIX_MAXVOLUME. */
+    SDL_atomic_t volume;
+    Uint8 *volume_buffer;
+
+    /* If true, the audio thread never takes mixer_lock and control
+       operations are posted to the command ring instead. */
+    SDL_bool lockfree;
+    SDL_AudioCommand commands[SDL_AUDIO_COMMAND_RING_SIZE];
+    SDL_atomic_t command_head; /* next slot claimed by a producer */
+    Uint32 command_tail;       /* next slot read by the audio thread */
+    SDL_atomic_t requested_paused; /* latest SDL_PauseAudioDevice() value */
+    SDL_atomic_t requested_volume; /* latest SDL_SetAudioDeviceVolume() value */
+
+    /* Streams mixed into the callback's output, guarded by the device lock,
+       and the float accumulator they are mixed in. has_bound_streams lets a
+       lock-free audio thread skip the lock when there is nothing to mix. */
+    SDL_BoundAudioStream *bound_streams;
+    int num_bound_streams;
+    int max_bound_streams;
+    SDL_atomic_t has_bound_streams;
+    float *mix_buffer;
+    float *mix_stream_buffer;
+    SDL_AudioCVT mix_cvt; /* accumulator to callbackspec.format */
+
+    /* Lock-free capture ring, single producer and single consumer. The
+       capture thread fills packets at capture_head and never waits; readers
+       take them from capture_tail while holding the device lock. */
+    SDL_CapturePacket *capture_ring;
+    Uint8 *capture_ring_data;
+    int capture_ring_size;      /* a power of two */
+    SDL_atomic_t capture_head;
+    SDL_atomic_t capture_tail;
+    Uint32 capture_sequence;    /* next sequence number, capture thread only */
+    Uint32 capture_read_offset; /* bytes already read from the tail packet */
+
     /* Scratch buffer used in the bridge between SDL and the user callback. */
     Uint8 *work_buffer;
 
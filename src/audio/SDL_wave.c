@@ -35,6 +35,7 @@
 
 #include "SDL_hints.h"
 #include "SDL_audio.h"
+#include "SDL_thread.h"
 #include "SDL_wave.h"
 #include "SDL_audio_c.h"
 
@@ -335,6 +336,100 @@ static Sint64 WaveAdjustToFactValue(WaveFile *file, Sint64 sampleframes)
     return sampleframes;
 }
 
+typedef int (*ADPCM_DecodeFunc)(ADPCM_DecoderState *state);
+
+/* ADPCM blocks start over with the state from their header, so complete
+ * blocks can be decoded in any order. Bulk loads with enough of them get
+ * handed out to the job system in ranges; below that, the work isn't worth
+ * spreading over threads.
+ */
+#define ADPCM_PARALLEL_BLOCKS_PER_RANGE 512
+#define ADPCM_PARALLEL_MIN_BLOCKS       (ADPCM_PARALLEL_BLOCKS_PER_RANGE * 2)
+
+typedef struct ADPCM_ParallelDecode
+{
+    const ADPCM_DecoderState *state;
+    size_t cstatesize;
+    ADPCM_DecodeFunc decodeheader;
+    ADPCM_DecodeFunc decodedata;
+    SDL_atomic_t failed;
+} ADPCM_ParallelDecode;
+
+static void SDLCALL ADPCM_DecodeBlockRange(void *data, int start, int end)
+{
+    ADPCM_ParallelDecode *decode = (ADPCM_ParallelDecode *)data;
+    ADPCM_DecoderState state = *decode->state; /* Own copy with its own cstate. */
+    int b;
+
+    state.cstate = SDL_calloc(1, decode->cstatesize);
+    if (!state.cstate) {
+        SDL_AtomicSet(&decode->failed, 1);
+        return;
+    }
+
+    for (b = start; b < end; b++) {
+        state.block.data = state.input.data + (size_t)b * state.blocksize;
+        state.block.size = state.blocksize;
+        state.block.pos = 0;
+        state.output.pos = (size_t)b * state.samplesperblock * state.channels;
+        state.framesleft = (Sint64)state.samplesperblock;
+
+        if (decode->decodeheader(&state) < 0 || decode->decodedata(&state) < 0) {
+            SDL_AtomicSet(&decode->failed, 1);
+            break;
+        }
+    }
+
+    SDL_free(state.cstate);
+}
+
+/* Decodes the first blockcount blocks of the input, which must all be complete
+ * and decode to samplesperblock sample frames each, and advances the state past
+ * them. Returns -1 without advancing if anything went wrong or there are no
+ * worker threads to share the work with; the serial decoder then runs over the
+ * same blocks and reports the actual error.
+ */
+static int ADPCM_DecodeBlocksParallel(ADPCM_DecoderState *state, size_t blockcount, size_t cstatesize,
+                                      ADPCM_DecodeFunc decodeheader, ADPCM_DecodeFunc decodedata)
+{
+    ADPCM_ParallelDecode decode;
+
+    if (blockcount < ADPCM_PARALLEL_MIN_BLOCKS || blockcount > SDL_MAX_SINT32) {
+        return -1;
+    }
+    if (SDL_GetNumJobWorkers() < 1) {
+        return -1;
+    }
+
+    decode.state = state;
+    decode.cstatesize = cstatesize;
+    decode.decodeheader = decodeheader;
+    decode.decodedata = decodedata;
+    SDL_AtomicSet(&decode.failed, 0);
+
+    if (SDL_ParallelFor((int)blockcount, ADPCM_PARALLEL_BLOCKS_PER_RANGE, ADPCM_DecodeBlockRange, &decode) < 0 ||
+        SDL_AtomicGet(&decode.failed)) {
+        return -1;
+    }
+
+    state->input.pos += blockcount * state->blocksize;
+    state->output.pos += blockcount * state->samplesperblock * state->channels;
+    state->framesleft -= (Sint64)(blockcount * state->samplesperblock);
+    return 0;
+}
+
+/* Number of blocks at the start of the input that can be decoded independently. */
+static size_t ADPCM_CompleteBlockCount(const ADPCM_DecoderState *state)
+{
+    size_t blockcount = state->input.size / state->blocksize;
+    const Uint64 framesblocks = (Uint64)state->framesleft / state->samplesperblock;
+
+    if (blockcount > framesblocks) {
+        blockcount = (size_t)framesblocks;
+    }
+    return blockcount;
+}
+
 static int MS_ADPCM_CalculateSampleFrames(WaveFile *file, size_t datalength)
 {
     WaveFormat *format = &file->format;
@@ -690,6 +785,10 @@ static int MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 
     state.cstate = cstate;
 
+    /* Most of a big file can be decoded in parallel; the rest goes block by block. */
+    ADPCM_DecodeBlocksParallel(&state, ADPCM_CompleteBlockCount(&state), sizeof(cstate),
+                               MS_ADPCM_DecodeBlockHeader, MS_ADPCM_DecodeBlockData);
+
     /* Decode block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -1086,6 +1185,10 @@ static int IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len
     }
     state.cstate = cstate;
 
+    /* Most of a big file can be decoded in parallel; the rest goes block by block. */
+    ADPCM_DecodeBlocksParallel(&state, ADPCM_CompleteBlockCount(&state), state.channels,
+                               IMA_ADPCM_DecodeBlockHeader, IMA_ADPCM_DecodeBlockData);
+
     /* Decode block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -1160,52 +1263,79 @@ static int LAW_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* Companded samples expand through a table, which is faster than decoding the
+ * sign, exponent, and mantissa of every sample.
+ */
+static const Sint16 alaw_lut[256] = {
+    -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736, -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784, -2752,
+    -2624, -3008, -2880, -2240, -2112, -2496, -2368, -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392, -22016,
+    -20992, -24064, -23040, -17920, -16896, -19968, -18944, -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136, -11008,
+    -10496, -12032, -11520, -8960, -8448, -9984, -9472, -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568, -344,
+    -328, -376, -360, -280, -264, -312, -296, -472, -456, -504, -488, -408, -392, -440, -424, -88,
+    -72, -120, -104, -24, -8, -56, -40, -216, -200, -248, -232, -152, -136, -184, -168, -1376,
+    -1312, -1504, -1440, -1120, -1056, -1248, -1184, -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696, -688,
+    -656, -752, -720, -560, -528, -624, -592, -944, -912, -1008, -976, -816, -784, -880, -848, 5504,
+    5248, 6016, 5760, 4480, 4224, 4992, 4736, 7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784, 2752,
+    2624, 3008, 2880, 2240, 2112, 2496, 2368, 3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392, 22016,
+    20992, 24064, 23040, 17920, 16896, 19968, 18944, 30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136, 11008,
+    10496, 12032, 11520, 8960, 8448, 9984, 9472, 15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568, 344,
+    328, 376, 360, 280, 264, 312, 296, 472, 456, 504, 488, 408, 392, 440, 424, 88,
+    72, 120, 104, 24, 8, 56, 40, 216, 200, 248, 232, 152, 136, 184, 168, 1376,
+    1312, 1504, 1440, 1120, 1056, 1248, 1184, 1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696, 688,
+    656, 752, 720, 560, 528, 624, 592, 944, 912, 1008, 976, 816, 784, 880, 848
+};
+static const Sint16 mulaw_lut[256] = {
+    -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956, -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764, -15996,
+    -15484, -14972, -14460, -13948, -13436, -12924, -12412, -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316, -7932,
+    -7676, -7420, -7164, -6908, -6652, -6396, -6140, -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092, -3900,
+    -3772, -3644, -3516, -3388, -3260, -3132, -3004, -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980, -1884,
+    -1820, -1756, -1692, -1628, -1564, -1500, -1436, -1372, -1308, -1244, -1180, -1116, -1052, -988, -924, -876,
+    -844, -812, -780, -748, -716, -684, -652, -620, -588, -556, -524, -492, -460, -428, -396, -372,
+    -356, -340, -324, -308, -292, -276, -260, -244, -228, -212, -196, -180, -164, -148, -132, -120,
+    -112, -104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0, 32124,
+    31100, 30076, 29052, 28028, 27004, 25980, 24956, 23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764, 15996,
+    15484, 14972, 14460, 13948, 13436, 12924, 12412, 11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316, 7932,
+    7676, 7420, 7164, 6908, 6652, 6396, 6140, 5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092, 3900,
+    3772, 3644, 3516, 3388, 3260, 3132, 3004, 2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980, 1884,
+    1820, 1756, 1692, 1628, 1564, 1500, 1436, 1372, 1308, 1244, 1180, 1116, 1052, 988, 924, 876,
+    844, 812, 780, 748, 716, 684, 652, 620, 588, 556, 524, 492, 460, 428, 396, 372,
+    356, 340, 324, 308, 292, 276, 260, 244, 228, 212, 196, 180, 164, 148, 132, 120,
+    112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
+};
+
+/* Expands 8-bit A-law or mu-law samples at the start of buf to 16-bit samples
+ * in the system byte order. Works backwards, since it expands in-place.
+ */
+static void LAW_ExpandInPlace(Uint16 encoding, Uint8 *buf, size_t sample_count)
 {
-#ifdef SDL_WAVE_LAW_LUT
-    const Sint16 alaw_lut[256] = {
-        -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736, -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784, -2752,
-        -2624, -3008, -2880, -2240, -2112, -2496, -2368, -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392, -22016,
-        -20992, -24064, -23040, -17920, -16896, -19968, -18944, -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136, -11008,
-        -10496, -12032, -11520, -8960, -8448, -9984, -9472, -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568, -344,
-        -328, -376, -360, -280, -264, -312, -296, -472, -456, -504, -488, -408, -392, -440, -424, -88,
-        -72, -120, -104, -24, -8, -56, -40, -216, -200, -248, -232, -152, -136, -184, -168, -1376,
-        -1312, -1504, -1440, -1120, -1056, -1248, -1184, -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696, -688,
-        -656, -752, -720, -560, -528, -624, -592, -944, -912, -1008, -976, -816, -784, -880, -848, 5504,
-        5248, 6016, 5760, 4480, 4224, 4992, 4736, 7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784, 2752,
-        2624, 3008, 2880, 2240, 2112, 2496, 2368, 3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392, 22016,
-        20992, 24064, 23040, 17920, 16896, 19968, 18944, 30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136, 11008,
-        10496, 12032, 11520, 8960, 8448, 9984, 9472, 15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568, 344,
-        328, 376, 360, 280, 264, 312, 296, 472, 456, 504, 488, 408, 392, 440, 424, 88,
-        72, 120, 104, 24, 8, 56, 40, 216, 200, 248, 232, 152, 136, 184, 168, 1376,
-        1312, 1504, 1440, 1120, 1056, 1248, 1184, 1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696, 688,
-        656, 752, 720, 560, 528, 624, 592, 944, 912, 1008, 976, 816, 784, 880, 848
-    };
-    const Sint16 mulaw_lut[256] = {
-        -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956, -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764, -15996,
-        -15484, -14972, -14460, -13948, -13436, -12924, -12412, -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316, -7932,
-        -7676, -7420, -7164, -6908, -6652, -6396, -6140, -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092, -3900,
-        -3772, -3644, -3516, -3388, -3260, -3132, -3004, -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980, -1884,
-        -1820, -1756, -1692, -1628, -1564, -1500, -1436, -1372, -1308, -1244, -1180, -1116, -1052, -988, -924, -876,
-        -844, -812, -780, -748, -716, -684, -652, -620, -588, -556, -524, -492, -460, -428, -396, -372,
-        -356, -340, -324, -308, -292, -276, -260, -244, -228, -212, -196, -180, -164, -148, -132, -120,
-        -112, -104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0, 32124,
-        31100, 30076, 29052, 28028, 27004, 25980, 24956, 23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764, 15996,
-        15484, 14972, 14460, 13948, 13436, 12924, 12412, 11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316, 7932,
-        7676, 7420, 7164, 6908, 6652, 6396, 6140, 5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092, 3900,
-        3772, 3644, 3516, 3388, 3260, 3132, 3004, 2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980, 1884,
-        1820, 1756, 1692, 1628, 1564, 1500, 1436, 1372, 1308, 1244, 1180, 1116, 1052, 988, 924, 876,
-        844, 812, 780, 748, 716, 684, 652, 620, 588, 556, 524, 492, 460, 428, 396, 372,
-        356, 340, 324, 308, 292, 276, 260, 244, 228, 212, 196, 180, 164, 148, 132, 120,
-        112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
-    };
-#endif
+    const Sint16 *lut = (encoding == ALAW_CODE) ? alaw_lut : mulaw_lut;
+    const Uint8 *src = buf;
+    Sint16 *dst = (Sint16 *)buf;
+    size_t i = sample_count;
+
+    /* Unrolled, the loads can get ahead of the stores that overwrite them. */
+    while (i >= 4) {
+        const Sint16 s3 = lut[src[i - 1]];
+        const Sint16 s2 = lut[src[i - 2]];
+        const Sint16 s1 = lut[src[i - 3]];
+        const Sint16 s0 = lut[src[i - 4]];
+        dst[i - 1] = s3;
+        dst[i - 2] = s2;
+        dst[i - 3] = s1;
+        dst[i - 4] = s0;
+        i -= 4;
+    }
+    while (i--) {
+        dst[i] = lut[src[i]];
+    }
+}
 
+static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
+    size_t sample_count, expanded_len;
     Uint8 *src;
-    Sint16 *dst;
 
     if (chunk->length != chunk->size) {
         file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
@@ -1221,6 +1351,10 @@ static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         return 0;
     }
 
+    if (format->encoding != ALAW_CODE && format->encoding != MULAW_CODE) {
+        return SDL_SetError("Unknown companded encoding");
+    }
+
     sample_count = (size_t)file->sampleframes;
     if (SafeMult(&sample_count, format->channels)) {
         return SDL_OutOfMemory();
@@ -1241,60 +1375,8 @@ static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     chunk->data = NULL;
     chunk->size = 0;
 
-    dst = (Sint16 *)src;
-
-    /* Work backwards, since we're expanding in-place. SDL_AudioSpec.format will
-     * inform the caller about the byte order.
-     */
-    i = sample_count;
-    switch (file->format.encoding) {
-#ifdef SDL_WAVE_LAW_LUT
-    case ALAW_CODE:
-        while (i--) {
-            dst[i] = alaw_lut[src[i]];
-        }
-        break;
-    case MULAW_CODE:
-        while (i--) {
-            dst[i] = mulaw_lut[src[i]];
-        }
-        break;
-#else
-    case ALAW_CODE:
-        while (i--) {
-            Uint8 nibble = src[i];
-            Uint8 exponent = (nibble & 0x7f) ^ 0x55;
-            Sint16 mantissa = exponent & 0xf;
-
-            exponent >>= 4;
-            if (exponent > 0) {
-                mantissa |= 0x10;
-            }
-            mantissa = (mantissa << 4) | 0x8;
-            if (exponent > 1) {
-                mantissa <<= exponent - 1;
-            }
-
-            dst[i] = nibble & 0x80 ? mantissa : -mantissa;
-        }
-        break;
-    case MULAW_CODE:
-        while (i--) {
-            Uint8 nibble = ~src[i];
-            Sint16 mantissa = nibble & 0xf;
-            Uint8 exponent = (nibble >> 4) & 0x7;
-            Sint16 step = 4 << (exponent + 1);
-
-            mantissa = (0x80 << exponent) + step * mantissa + step / 2 - 132;
-
-            dst[i] = nibble & 0x80 ? -mantissa : mantissa;
-        }
-        break;
-#endif
-    default:
-        SDL_free(src);
-        return SDL_SetError("Unknown companded encoding");
-    }
+    /* SDL_AudioSpec.format will inform the caller about the byte order. */
+    LAW_ExpandInPlace(format->encoding, src, sample_count);
 
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
@@ -1345,11 +1427,33 @@ static int PCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Shifts 24-bit samples at the start of ptr to 32 bits. */
+static void PCM_ExpandSint24InPlace(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    /* work from end to start, since we're expanding in-place. */
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static int PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1377,21 +1481,7 @@ static int PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    /* work from end to start, since we're expanding in-place. */
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24InPlace(ptr, sample_count);
 
     return 0;
 }
@@ -1768,7 +1858,11 @@ static int WaveCheckFormat(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static int WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Reads everything up to the data of the data chunk and fills in the spec.
+ * On success, file->chunk is the data chunk with no data read yet, and
+ * endposition is where the WAVE data ends in the stream.
+ */
+static int WaveLoadHeaders(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1981,9 +2075,71 @@ static int WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 *
 
     WaveFreeChunkData(chunk);
 
-    /* Process data chunk. */
+    /* Setting up the SDL_AudioSpec. All unsupported formats were filtered out
+     * by checks earlier in this function.
+     */
+    SDL_zerop(spec);
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->samples = 4096; /* Good default buffer size */
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        /* These can be easily stored in the byte order of the system. */
+        spec->format = AUDIO_S16SYS;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = AUDIO_F32LSB;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = AUDIO_U8;
+            break;
+        case 16:
+            spec->format = AUDIO_S16LSB;
+            break;
+        case 24: /* Has been shifted to 32 bits. */
+        case 32:
+            spec->format = AUDIO_S32LSB;
+            break;
+        default:
+            /* Just in case something unexpected happened in the checks. */
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    }
+
+    spec->silence = SDL_SilenceValueForFormat(spec->format);
+
+    /* The data chunk comes next. */
     *chunk = datachunk;
 
+    /* Report the end position back to the cleanup code. */
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
+    }
+
+    return 0;
+}
+
+static int WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endposition;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+
+    if (WaveLoadHeaders(src, file, spec, &endposition) < 0) {
+        return -1;
+    }
+
+    /* Process data chunk. */
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result == -1) {
@@ -2027,52 +2183,8 @@ static int WaveLoad(SDL_RWops *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 *
         break;
     }
 
-    /* Setting up the SDL_AudioSpec. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    SDL_zerop(spec);
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->samples = 4096; /* Good default buffer size */
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        /* These can be easily stored in the byte order of the system. */
-        spec->format = AUDIO_S16SYS;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = AUDIO_F32LSB;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = AUDIO_U8;
-            break;
-        case 16:
-            spec->format = AUDIO_S16LSB;
-            break;
-        case 24: /* Has been shifted to 32 bits. */
-        case 32:
-            spec->format = AUDIO_S32LSB;
-            break;
-        default:
-            /* Just in case something unexpected happened in the checks. */
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    }
-
-    spec->silence = SDL_SilenceValueForFormat(spec->format);
-
     /* Report the end position back to the cleanup code. */
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return 0;
 }
@@ -2134,4 +2246,300 @@ void SDL_FreeWAV(Uint8 *audio_buf)
     SDL_free(audio_buf);
 }
 
+/* Streaming WAVE reader. It shares the header parsing and the decoders with
+ * SDL_LoadWAV_RW(), but only ever holds one ADPCM block in memory.
+ */
+struct _SDL_WAVStream
+{
+    SDL_RWops *src;
+    int freesrc;
+    WaveFile file;
+    SDL_AudioSpec spec;
+    Sint64 endposition;   /* Where to leave src when closing, like SDL_LoadWAV_RW(). */
+    Uint64 totalbytes;    /* Decoded size of the whole data chunk. */
+    Uint64 bytesleft;     /* Decoded bytes not produced yet. */
+    Uint32 dataleft;      /* Bytes of the data chunk not read yet. */
+    size_t inframesize;   /* Size of a sample frame in the file (PCM and companded). */
+    size_t outframesize;  /* Size of a decoded sample frame. */
+
+    /* ADPCM decoding state. Decoded blocks wait in adpcm.output. */
+    ADPCM_DecoderState adpcm;
+    ADPCM_DecodeFunc decodeheader;
+    ADPCM_DecodeFunc decodedata;
+    size_t decodedpos;
+    size_t decodedlen;
+};
+
+static int WaveStreamReadSamples(SDL_WAVStream *stream, Uint8 *dst, size_t len)
+{
+    const WaveFormat *format = &stream->file.format;
+    size_t frames = len / stream->outframesize;
+    size_t got;
+
+    if (frames > stream->bytesleft / stream->outframesize) {
+        frames = (size_t)(stream->bytesleft / stream->outframesize);
+    }
+    if (frames > stream->dataleft / stream->inframesize) {
+        frames = stream->dataleft / stream->inframesize;
+    }
+    if (frames == 0) {
+        return 0;
+    }
+
+    /* The file's samples are never bigger than the decoded ones, so they are
+     * read into the start of dst and expanded in-place.
+     */
+    got = SDL_RWread(stream->src, dst, stream->inframesize, frames);
+    if (got == 0) {
+        stream->bytesleft = 0; /* Truncated file or I/O error. Stop here. */
+        return 0;
+    }
+    stream->dataleft -= (Uint32)(got * stream->inframesize);
+    stream->bytesleft -= got * stream->outframesize;
+
+    if (format->encoding == ALAW_CODE || format->encoding == MULAW_CODE) {
+        LAW_ExpandInPlace(format->encoding, dst, got * format->channels);
+    } else if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+        PCM_ExpandSint24InPlace(dst, got * format->channels);
+    }
+
+    return (int)(got * stream->outframesize);
+}
+
+static int WaveStreamDecodeBlock(SDL_WAVStream *stream)
+{
+    ADPCM_DecoderState *state = &stream->adpcm;
+    size_t blocksize = state->blocksize;
+    size_t got;
+
+    if (blocksize > stream->dataleft) {
+        blocksize = stream->dataleft;
+    }
+    if (stream->bytesleft == 0 || blocksize < state->blockheadersize) {
+        return 0;
+    }
+
+    got = SDL_RWread(stream->src, state->input.data, 1, blocksize);
+    stream->dataleft -= (Uint32)got;
+    if (got < state->blockheadersize) {
+        stream->bytesleft = 0; /* Truncated file or I/O error. Stop here. */
+        return 0;
+    }
+
+    state->block.data = state->input.data;
+    state->block.size = got;
+    state->block.pos = 0;
+    state->output.pos = 0;
+    state->framesleft = (Sint64)(stream->bytesleft / stream->outframesize);
+
+    if (stream->decodeheader(state) < 0) {
+        return -1;
+    } else if (stream->decodedata(state) < 0) {
+        /* Truncated block. Keep the complete sample frames and stop after them. */
+        stream->dataleft = 0;
+    }
+
+    stream->decodedpos = 0;
+    stream->decodedlen = state->output.pos * sizeof(Sint16);
+    if (stream->decodedlen > stream->bytesleft) {
+        stream->decodedlen = (size_t)stream->bytesleft;
+    }
+    stream->bytesleft -= stream->decodedlen;
+
+    return (int)stream->decodedlen;
+}
+
+static int WaveStreamReadADPCM(SDL_WAVStream *stream, Uint8 *dst, size_t len)
+{
+    size_t avail = stream->decodedlen - stream->decodedpos;
+
+    if (avail == 0) {
+        const int result = WaveStreamDecodeBlock(stream);
+        if (result <= 0) {
+            return result;
+        }
+        avail = stream->decodedlen;
+    }
+
+    if (len > avail) {
+        len = avail;
+    }
+    SDL_memcpy(dst, (Uint8 *)stream->adpcm.output.data + stream->decodedpos, len);
+    stream->decodedpos += len;
+
+    return (int)len;
+}
+
+static int WaveStreamSetup(SDL_WAVStream *stream)
+{
+    WaveFile *file = &stream->file;
+    WaveFormat *format = &file->format;
+    ADPCM_DecoderState *state = &stream->adpcm;
+    Uint64 frames = (Uint64)file->sampleframes;
+    size_t cstatesize;
+
+    stream->outframesize = (size_t)(SDL_AUDIO_BITSIZE(stream->spec.format) / 8) * format->channels;
+
+    switch (format->encoding) {
+    case PCM_CODE:
+    case IEEE_FLOAT_CODE:
+        stream->inframesize = (size_t)(format->bitspersample / 8) * format->channels;
+        /* Same as PCM_Decode(): the sample frame count is in blocks there. */
+        if (format->bitspersample != 24) {
+            stream->totalbytes = frames * format->blockalign;
+            return 0;
+        }
+        break;
+    case ALAW_CODE:
+    case MULAW_CODE:
+        stream->inframesize = format->channels;
+        break;
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        if (format->encoding == MS_ADPCM_CODE) {
+            state->blockheadersize = (size_t)format->channels * 7;
+            stream->decodeheader = MS_ADPCM_DecodeBlockHeader;
+            stream->decodedata = MS_ADPCM_DecodeBlockData;
+            cstatesize = sizeof(MS_ADPCM_ChannelState) * 2;
+        } else {
+            state->blockheadersize = (size_t)format->channels * 4;
+            stream->decodeheader = IMA_ADPCM_DecodeBlockHeader;
+            stream->decodedata = IMA_ADPCM_DecodeBlockData;
+            cstatesize = format->channels;
+        }
+        state->channels = format->channels;
+        state->blocksize = format->blockalign;
+        state->samplesperblock = format->samplesperblock;
+        state->framesize = state->channels * sizeof(Sint16);
+        state->ddata = file->decoderdata;
+        state->input.size = state->blocksize;
+        state->input.data = (Uint8 *)SDL_malloc(state->blocksize);
+        state->output.size = state->samplesperblock * state->channels;
+        state->output.data = (Sint16 *)SDL_malloc(state->output.size * sizeof(Sint16));
+        state->cstate = SDL_calloc(1, cstatesize);
+        if (!state->input.data || !state->output.data || !state->cstate) {
+            return SDL_OutOfMemory();
+        }
+        break;
+    }
+
+    stream->totalbytes = frames * stream->outframesize;
+    return 0;
+}
+
+int SDL_RewindWAVStream(SDL_WAVStream *stream)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (SDL_RWseek(stream->src, stream->file.chunk.position, RW_SEEK_SET) != stream->file.chunk.position) {
+        return SDL_SetError("Could not seek to WAVE data chunk");
+    }
+    stream->bytesleft = stream->totalbytes;
+    stream->dataleft = stream->file.chunk.length;
+    stream->decodedpos = 0;
+    stream->decodedlen = 0;
+    return 0;
+}
+
+SDL_WAVStream *SDL_OpenWAVStream_RW(SDL_RWops *src, int freesrc, SDL_AudioSpec *spec, Uint32 *audio_len)
+{
+    SDL_WAVStream *stream;
+
+    if (!src) {
+        /* Error may come from RWops. */
+        return NULL;
+    } else if (!spec) {
+        SDL_InvalidParamError("spec");
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        return NULL;
+    }
+
+    stream = (SDL_WAVStream *)SDL_calloc(1, sizeof(*stream));
+    if (!stream) {
+        SDL_OutOfMemory();
+        if (freesrc) {
+            SDL_RWclose(src);
+        }
+        return NULL;
+    }
+    stream->src = src;
+    stream->freesrc = freesrc;
+    stream->file.riffhint = WaveGetRiffSizeHint();
+    stream->file.trunchint = WaveGetTruncationHint();
+    stream->file.facthint = WaveGetFactChunkHint();
+
+    if (WaveLoadHeaders(src, &stream->file, &stream->spec, &stream->endposition) < 0 ||
+        WaveStreamSetup(stream) < 0 ||
+        SDL_RewindWAVStream(stream) < 0) {
+        /* Leave src where SDL_LoadWAV_RW() would have left it after an error. */
+        stream->endposition = stream->file.chunk.position;
+        SDL_CloseWAVStream(stream);
+        return NULL;
+    }
+
+    *spec = stream->spec;
+    if (audio_len) {
+        *audio_len = (Uint32)SDL_min(stream->totalbytes, SDL_MAX_UINT32);
+    }
+    return stream;
+}
+
+int SDL_ReadWAVStream(SDL_WAVStream *stream, void *buf, int len)
+{
+    Uint8 *dst = (Uint8 *)buf;
+    int total = 0;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    len -= len % (int)stream->outframesize;
+    while (len > 0) {
+        int got;
+
+        if (stream->file.format.encoding == MS_ADPCM_CODE || stream->file.format.encoding == IMA_ADPCM_CODE) {
+            got = WaveStreamReadADPCM(stream, dst, (size_t)len);
+        } else {
+            got = WaveStreamReadSamples(stream, dst, (size_t)len);
+        }
+
+        if (got < 0) {
+            return -1;
+        } else if (got == 0) {
+            break;
+        }
+        dst += got;
+        len -= got;
+        total += got;
+    }
+
+    return total;
+}
+
+void SDL_CloseWAVStream(SDL_WAVStream *stream)
+{
+    if (!stream) {
+        return;
+    }
+
+    if (stream->freesrc) {
+        SDL_RWclose(stream->src);
+    } else {
+        SDL_RWseek(stream->src, stream->endposition, RW_SEEK_SET);
+    }
+    WaveFreeChunkData(&stream->file.chunk);
+    SDL_free(stream->file.decoderdata);
+    SDL_free(stream->adpcm.input.data);
+    SDL_free(stream->adpcm.output.data);
+    SDL_free(stream->adpcm.cstate);
+    SDL_free(stream);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
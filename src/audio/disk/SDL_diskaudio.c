@@ -22,37 +22,80 @@
 
 #ifdef SDL_AUDIO_DRIVER_DISK
 
-/* Output raw audio data to a file. */
+/* Output raw audio data or a WAVE file to a file. */
 
 #ifdef HAVE_STDIO_H
 #include <stdio.h>
 #endif
 
+#include "SDL_hints.h"
 #include "SDL_rwops.h"
 #include "SDL_timer.h"
 #include "SDL_audio.h"
 #include "../SDL_audio_c.h"
+#include "../SDL_wave.h"
 #include "SDL_diskaudio.h"
 
-/* !!! FIXME: these should be SDL hints, not environment variables. */
-/* environment variables and defaults. */
-#define DISKENVR_OUTFILE    "SDL_DISKAUDIOFILE"
-#define DISKDEFAULT_OUTFILE "sdlaudio.raw"
-#define DISKENVR_INFILE     "SDL_DISKAUDIOFILEIN"
-#define DISKDEFAULT_INFILE  "sdlaudio-in.raw"
-#define DISKENVR_IODELAY    "SDL_DISKAUDIODELAY"
+/* default file names. */
+#define DISKDEFAULT_OUTFILE         "sdlaudio.raw"
+#define DISKDEFAULT_OFFLINE_OUTFILE "sdlaudio.wav"
+#define DISKDEFAULT_INFILE          "sdlaudio-in.raw"
+
+/* The canonical WAVE header: RIFF chunk, 16 byte fmt chunk, data chunk header. */
+#define WAVE_HEADER_SIZE 44
 
 /* This function waits until it is possible to write a full sound buffer */
 static void DISKAUDIO_WaitDevice(_THIS)
 {
-    SDL_Delay(_this->hidden->io_delay);
+    /* In offline mode the next buffer is due right away, unless we're paused
+       and there's nothing to render. */
+    if (!_this->hidden->offline || _this->period_paused) {
+        SDL_Delay(_this->hidden->io_delay);
+    }
+}
+
+static SDL_bool DISKAUDIO_WriteWaveHeader(_THIS)
+{
+    struct SDL_PrivateAudioData *h = _this->hidden;
+    const Uint16 formattag = SDL_AUDIO_ISFLOAT(_this->spec.format) ? IEEE_FLOAT_CODE : PCM_CODE;
+    const Uint16 bitspersample = (Uint16)SDL_AUDIO_BITSIZE(_this->spec.format);
+    const Uint16 blockalign = (Uint16)(_this->spec.channels * (bitspersample / 8));
+    /* Sizes saturate; anything past 4 GiB can't be described by RIFF anyway. */
+    const Uint32 datasize = (Uint32)SDL_min(h->data_bytes, 0xFFFFFFFF - (WAVE_HEADER_SIZE - 8));
+    size_t written = 0;
+
+    if (SDL_RWseek(h->io, 0, RW_SEEK_SET) != 0) {
+        return SDL_FALSE;
+    }
+    written += SDL_WriteLE32(h->io, RIFF);
+    written += SDL_WriteLE32(h->io, (WAVE_HEADER_SIZE - 8) + datasize);
+    written += SDL_WriteLE32(h->io, WAVE);
+    written += SDL_WriteLE32(h->io, FMT);
+    written += SDL_WriteLE32(h->io, 16);
+    written += SDL_WriteLE16(h->io, formattag);
+    written += SDL_WriteLE16(h->io, _this->spec.channels);
+    written += SDL_WriteLE32(h->io, (Uint32)_this->spec.freq);
+    written += SDL_WriteLE32(h->io, (Uint32)_this->spec.freq * blockalign);
+    written += SDL_WriteLE16(h->io, blockalign);
+    written += SDL_WriteLE16(h->io, bitspersample);
+    written += SDL_WriteLE32(h->io, DATA);
+    written += SDL_WriteLE32(h->io, datasize);
+    return (written == 13) ? SDL_TRUE : SDL_FALSE;
 }
 
 static void DISKAUDIO_PlayDevice(_THIS)
 {
-    const size_t written = SDL_RWwrite(_this->hidden->io,
-                                       _this->hidden->mixbuf,
-                                       1, _this->spec.size);
+    struct SDL_PrivateAudioData *h = _this->hidden;
+    size_t written;
+
+    /* Offline renders only contain what the app played, so they don't
+       depend on how long the device sat paused in real time. */
+    if (h->offline && _this->period_paused) {
+        return;
+    }
+
+    written = SDL_RWwrite(h->io, h->mixbuf, 1, _this->spec.size);
+    h->data_bytes += written;
 
     /* If we couldn't write, assume fatal error for now */
     if (written != _this->spec.size) {
@@ -73,7 +116,9 @@ static int DISKAUDIO_CaptureFromDevice(_THIS, void *buffer, int buflen)
     struct SDL_PrivateAudioData *h = _this->hidden;
     const int origbuflen = buflen;
 
-    SDL_Delay(h->io_delay);
+    if (!h->offline) {
+        SDL_Delay(h->io_delay);
+    }
 
     if (h->io) {
         const size_t br = SDL_RWread(h->io, buffer, 1, buflen);
@@ -99,30 +144,61 @@ static void DISKAUDIO_FlushCapture(_THIS)
 static void DISKAUDIO_CloseDevice(_THIS)
 {
     if (_this->hidden->io) {
+        if (_this->hidden->wave) {
+            /* Now that we know how much we wrote, fill in the real sizes. */
+            DISKAUDIO_WriteWaveHeader(_this);
+        }
         SDL_RWclose(_this->hidden->io);
     }
     SDL_free(_this->hidden->mixbuf);
     SDL_free(_this->hidden);
 }
 
-static const char *get_filename(const SDL_bool iscapture, const char *devname)
+static const char *get_filename(const SDL_bool iscapture, const SDL_bool offline, const char *devname)
 {
     if (!devname) {
-        devname = SDL_getenv(iscapture ? DISKENVR_INFILE : DISKENVR_OUTFILE);
-        if (!devname) {
-            devname = iscapture ? DISKDEFAULT_INFILE : DISKDEFAULT_OUTFILE;
+        devname = SDL_GetHint(iscapture ? SDL_HINT_AUDIO_DISK_INPUT_FILE : SDL_HINT_AUDIO_DISK_OUTPUT_FILE);
+        if (!devname || !*devname) {
+            if (iscapture) {
+                devname = DISKDEFAULT_INFILE;
+            } else {
+                devname = offline ? DISKDEFAULT_OFFLINE_OUTFILE : DISKDEFAULT_OUTFILE;
+            }
         }
     }
     return devname;
 }
 
+static SDL_bool is_wave_filename(const char *fname)
+{
+    const size_t len = SDL_strlen(fname);
+    return (len >= 4 && SDL_strcasecmp(fname + len - 4, ".wav") == 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* WAVE files only hold little-endian data, and 8-bit data is unsigned. */
+static SDL_AudioFormat get_wave_format(SDL_AudioFormat format)
+{
+    if (SDL_AUDIO_ISFLOAT(format)) {
+        return AUDIO_F32LSB;
+    }
+    switch (SDL_AUDIO_BITSIZE(format)) {
+    case 8:
+        return AUDIO_U8;
+    case 32:
+        return AUDIO_S32LSB;
+    default:
+        return AUDIO_S16LSB;
+    }
+}
+
 static int DISKAUDIO_OpenDevice(_THIS, const char *devname)
 {
     void *handle = _this->handle;
     /* handle != NULL means "user specified the placeholder name on the fake detected device list" */
     SDL_bool iscapture = _this->iscapture;
-    const char *fname = get_filename(iscapture, handle ? NULL : devname);
-    const char *envr = SDL_getenv(DISKENVR_IODELAY);
+    const SDL_bool offline = SDL_GetHintBoolean(SDL_HINT_AUDIO_DISK_OFFLINE, SDL_FALSE);
+    const char *fname = get_filename(iscapture, offline, handle ? NULL : devname);
+    const char *envr = SDL_GetHint(SDL_HINT_AUDIO_DISK_DELAY);
 
     _this->hidden = (struct SDL_PrivateAudioData *)
         SDL_malloc(sizeof(*_this->hidden));
@@ -130,6 +206,13 @@ static int DISKAUDIO_OpenDevice(_THIS, const char *devname)
         return SDL_OutOfMemory();
     }
     SDL_zerop(_this->hidden);
+    _this->hidden->offline = offline;
+    _this->hidden->wave = (!iscapture && is_wave_filename(fname)) ? SDL_TRUE : SDL_FALSE;
+
+    if (_this->hidden->wave) {
+        _this->spec.format = get_wave_format(_this->spec.format);
+        SDL_CalculateAudioSpec(&_this->spec);
+    }
 
     if (envr) {
         _this->hidden->io_delay = SDL_atoi(envr);
@@ -143,6 +226,11 @@ static int DISKAUDIO_OpenDevice(_THIS, const char *devname)
         return -1;
     }
 
+    /* Write a placeholder header; the sizes are filled in when we close. */
+    if (_this->hidden->wave && !DISKAUDIO_WriteWaveHeader(_this)) {
+        return SDL_SetError("Couldn't write WAVE header to %s", fname);
+    }
+
     /* Allocate mixing buffer */
     if (!iscapture) {
         _this->hidden->mixbuf = (Uint8 *)SDL_malloc(_this->spec.size);
@@ -155,8 +243,8 @@ static int DISKAUDIO_OpenDevice(_THIS, const char *devname)
     SDL_LogCritical(SDL_LOG_CATEGORY_AUDIO,
                     "You are using the SDL disk i/o audio driver!\n");
     SDL_LogCritical(SDL_LOG_CATEGORY_AUDIO,
-                    " %s file [%s].\n", iscapture ? "Reading from" : "Writing to",
-                    fname);
+                    " %s file [%s]%s.\n", iscapture ? "Reading from" : "Writing to",
+                    fname, offline ? ", faster than real time" : "");
 
     /* We're ready to rock and roll. :-) */
     return 0;
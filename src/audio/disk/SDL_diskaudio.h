@@ -35,6 +35,9 @@ struct SDL_PrivateAudioData
     SDL_RWops *io;
     Uint32 io_delay;
     Uint8 *mixbuf;
+    SDL_bool offline;   /* SDL_HINT_AUDIO_DISK_OFFLINE: never sleep while playing. */
+    SDL_bool wave;      /* Output is a WAVE file, header rewritten on close. */
+    Uint64 data_bytes;  /* Audio data written so far, for the WAVE header. */
 };
 
 #endif /* SDL_diskaudio_h_ */
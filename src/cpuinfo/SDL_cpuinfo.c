@@ -21,6 +21,8 @@
 #ifdef TEST_MAIN
 #include "SDL_config.h"
 #else
+/* This file defines the SIMD allocation functions that the allocation tags wrap */
+#define SDL_DISABLE_SIMD_ALLOCATION_TAGS 1
 #include "../SDL_internal.h"
 #endif
 
@@ -40,6 +42,10 @@
 
 #include "SDL_cpuinfo.h"
 #include "SDL_assert.h"
+#include "SDL_error.h"
+#include "SDL_hints.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo_c.h"
 
 #ifdef HAVE_SYSCONF
 #include <unistd.h>
@@ -71,6 +77,11 @@
 #include <sys/syspage.h>
 #endif
 
+#if defined(__LINUX__) || defined(__ANDROID__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #if (defined(__LINUX__) || defined(__ANDROID__)) && defined(__arm__)
 #include <unistd.h>
 #include <sys/types.h>
@@ -1003,7 +1014,90 @@ static Uint32 SDL_GetCPUFeatures(void)
     return SDL_CPUFeatures;
 }
 
-#define CPU_FEATURE_AVAILABLE(f) ((SDL_GetCPUFeatures() & f) ? SDL_TRUE : SDL_FALSE)
+static const struct
+{
+    const char *name;
+    Uint32 feature;
+} SDL_CPUFeatureNames[] = {
+    { "altivec", CPU_HAS_ALTIVEC },
+    { "mmx", CPU_HAS_MMX },
+    { "3dnow", CPU_HAS_3DNOW },
+    { "sse", CPU_HAS_SSE },
+    { "sse2", CPU_HAS_SSE2 },
+    { "sse3", CPU_HAS_SSE3 },
+    { "sse41", CPU_HAS_SSE41 },
+    { "sse42", CPU_HAS_SSE42 },
+    { "avx", CPU_HAS_AVX },
+    { "avx2", CPU_HAS_AVX2 },
+    { "avx512f", CPU_HAS_AVX512F },
+    { "arm-simd", CPU_HAS_ARM_SIMD },
+    { "neon", CPU_HAS_NEON },
+    { "lsx", CPU_HAS_LSX },
+    { "lasx", CPU_HAS_LASX },
+};
+
+/* Features disabled by SDL_HINT_CPU_FEATURE_MASK are cleared here */
+static SDL_atomic_t SDL_CPUFeatureMask = { (int)0xFFFFFFFF };
+
+static Uint32 SDL_ParseCPUFeatureMask(const char *hint)
+{
+    Uint32 mask = 0xFFFFFFFF;
+    const char *spot = hint;
+
+    while (spot && *spot) {
+        const char *end = SDL_strchr(spot, ',');
+        size_t len = end ? (size_t)(end - spot) : SDL_strlen(spot);
+        SDL_bool enable = SDL_TRUE;
+        Uint32 features = 0;
+        size_t i;
+
+        if (*spot == '-' || *spot == '+') {
+            enable = (*spot == '+');
+            ++spot;
+            --len;
+        }
+
+        if (len == 3 && SDL_strncasecmp(spot, "all", len) == 0) {
+            for (i = 0; i < SDL_arraysize(SDL_CPUFeatureNames); ++i) {
+                features |= SDL_CPUFeatureNames[i].feature;
+            }
+        } else {
+            for (i = 0; i < SDL_arraysize(SDL_CPUFeatureNames); ++i) {
+                if (SDL_strlen(SDL_CPUFeatureNames[i].name) == len &&
+                    SDL_strncasecmp(spot, SDL_CPUFeatureNames[i].name, len) == 0) {
+                    features = SDL_CPUFeatureNames[i].feature;
+                    break;
+                }
+            }
+        }
+
+        if (enable) {
+            mask |= features;
+        } else {
+            mask &= ~features;
+        }
+        spot = end ? end + 1 : NULL;
+    }
+    return mask;
+}
+
+static void SDLCALL SDL_CPUFeatureMaskChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_AtomicSet(&SDL_CPUFeatureMask, (int)SDL_ParseCPUFeatureMask(hint));
+}
+
+void SDL_InitCPUFeatureMask(void)
+{
+    SDL_AddHintCallback(SDL_HINT_CPU_FEATURE_MASK, SDL_CPUFeatureMaskChanged, NULL);
+}
+
+void SDL_QuitCPUFeatureMask(void)
+{
+    /* The hint callback was removed along with the hints by SDL_ClearHints() */
+    SDL_AtomicSet(&SDL_CPUFeatureMask, (int)0xFFFFFFFF);
+}
+
+#define CPU_FEATURE_AVAILABLE(f) ((SDL_GetCPUFeatures() & (Uint32)SDL_AtomicGet(&SDL_CPUFeatureMask) & f) ? SDL_TRUE : SDL_FALSE)
 
 SDL_bool SDL_HasRDTSC(void)
 {
@@ -1167,6 +1261,449 @@ int SDL_GetSystemRAM(void)
     return SDL_SystemRAM;
 }
 
+int SDL_ParseCPUList(const char *text, int *cpus, int max_cpus)
+{
+    int count = 0;
+
+    while (*text) {
+        char *end;
+        long first, last, cpu;
+
+        first = SDL_strtol(text, &end, 10);
+        if (end == text || first < 0 || first >= SDL_MAX_LOGICAL_CPUS) {
+            break;
+        }
+        last = first;
+        text = end;
+        if (*text == '-') {
+            ++text;
+            last = SDL_strtol(text, &end, 10);
+            if (end == text || last < first) {
+                break;
+            }
+            text = end;
+        }
+        last = SDL_min(last, SDL_MAX_LOGICAL_CPUS - 1);
+        for (cpu = first; cpu <= last && count < SDL_MAX_LOGICAL_CPUS; ++cpu) {
+            if (count < max_cpus) {
+                cpus[count] = (int)cpu;
+            }
+            ++count;
+        }
+        if (*text != ',') {
+            break;
+        }
+        ++text;
+    }
+    return count;
+}
+
+#if !defined(SDL_CPUINFO_DISABLED) && (defined(__LINUX__) || defined(__ANDROID__))
+static SDL_bool SDL_ReadSysfsFile(const char *path, char *buf, size_t buflen)
+{
+    ssize_t len;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0) {
+        return SDL_FALSE;
+    }
+    len = read(fd, buf, buflen - 1);
+    close(fd);
+    if (len < 0) {
+        return SDL_FALSE;
+    }
+    buf[len] = '\0';
+    return SDL_TRUE;
+}
+
+static int SDL_ReadSysfsInt(const char *path, int fallback)
+{
+    char buf[32];
+
+    if (!SDL_ReadSysfsFile(path, buf, sizeof(buf))) {
+        return fallback;
+    }
+    return SDL_atoi(buf);
+}
+
+/* The kernel's ids can be sparse, so number them in order of appearance */
+static int SDL_GetDenseIndex(int *ids, int *num_ids, int id)
+{
+    int i;
+
+    for (i = 0; i < *num_ids; ++i) {
+        if (ids[i] == id) {
+            return i;
+        }
+    }
+    ids[*num_ids] = id;
+    return (*num_ids)++;
+}
+
+static SDL_LogicalCPU *SDL_FindLogicalCPU(SDL_LogicalCPU *cpus, int num_cpus, int id)
+{
+    int i;
+
+    for (i = 0; i < num_cpus; ++i) {
+        if (cpus[i].id == id) {
+            return &cpus[i];
+        }
+    }
+    return NULL;
+}
+
+/* Marks the CPUs in a sysfs list file, returning SDL_FALSE if it's missing */
+static SDL_bool SDL_MarkCPUList(const char *path, SDL_LogicalCPU *cpus, int num_cpus, int *ids, SDL_CPUCoreType core_type, int numa_node)
+{
+    char buf[4096];
+    int i, count;
+
+    if (!SDL_ReadSysfsFile(path, buf, sizeof(buf))) {
+        return SDL_FALSE;
+    }
+    count = SDL_min(SDL_ParseCPUList(buf, ids, num_cpus), num_cpus);
+    for (i = 0; i < count; ++i) {
+        SDL_LogicalCPU *cpu = SDL_FindLogicalCPU(cpus, num_cpus, ids[i]);
+        if (cpu) {
+            if (core_type != SDL_CPU_CORE_UNKNOWN) {
+                cpu->core_type = core_type;
+            }
+            if (numa_node >= 0) {
+                cpu->numa_node = numa_node;
+            }
+        }
+    }
+    return SDL_TRUE;
+}
+
+static int SDL_ParseCacheSize(const char *text)
+{
+    char *end;
+    long size = SDL_strtol(text, &end, 10);
+
+    if (*end == 'K') {
+        size *= 1024;
+    } else if (*end == 'M') {
+        size *= 1024 * 1024;
+    }
+    return (int)size;
+}
+
+static int SDL_ReadCPUTopology(SDL_LogicalCPU **cpus_out, SDL_CPUTopology *topology)
+{
+    char path[128];
+    char buf[4096];
+    SDL_LogicalCPU *cpus;
+    int *ids;
+    int i, num_cpus, num_nodes;
+    int num_cores = 0, num_packages = 0;
+    int min_capacity = SDL_MAX_SINT32, max_capacity = 0;
+
+    if (!SDL_ReadSysfsFile("/sys/devices/system/cpu/online", buf, sizeof(buf))) {
+        return -1;
+    }
+    num_cpus = SDL_ParseCPUList(buf, NULL, 0);
+    if (num_cpus <= 0) {
+        return -1;
+    }
+
+    cpus = (SDL_LogicalCPU *)SDL_calloc(num_cpus, sizeof(*cpus));
+    ids = (int *)SDL_malloc(3 * num_cpus * sizeof(*ids));
+    if (!cpus || !ids) {
+        SDL_free(cpus);
+        SDL_free(ids);
+        return SDL_OutOfMemory();
+    }
+    SDL_ParseCPUList(buf, ids, num_cpus);
+    for (i = 0; i < num_cpus; ++i) {
+        cpus[i].id = ids[i];
+    }
+
+    /* Core ids are only unique within a package */
+    for (i = 0; i < num_cpus; ++i) {
+        int package, core;
+
+        (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpus[i].id);
+        package = SDL_max(SDL_ReadSysfsInt(path, 0), 0);
+        (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/core_id", cpus[i].id);
+        core = SDL_ReadSysfsInt(path, cpus[i].id);
+
+        cpus[i].package = SDL_GetDenseIndex(&ids[num_cpus], &num_packages, package);
+        cpus[i].core = SDL_GetDenseIndex(&ids[2 * num_cpus], &num_cores, (package << 16) | (core & 0xFFFF));
+    }
+
+    /* Each online NUMA node lists its CPUs */
+    num_nodes = 0;
+    if (SDL_ReadSysfsFile("/sys/devices/system/node/online", buf, sizeof(buf))) {
+        int *nodes;
+
+        num_nodes = SDL_ParseCPUList(buf, NULL, 0);
+        nodes = (int *)SDL_malloc(num_nodes * sizeof(*nodes));
+        if (nodes) {
+            SDL_ParseCPUList(buf, nodes, num_nodes);
+            for (i = 0; i < num_nodes; ++i) {
+                (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", nodes[i]);
+                SDL_MarkCPUList(path, cpus, num_cpus, ids, SDL_CPU_CORE_UNKNOWN, i);
+            }
+            SDL_free(nodes);
+        }
+    }
+
+    /* Intel hybrid CPUs have a separate PMU for each kind of core */
+    if (!SDL_MarkCPUList("/sys/devices/cpu_core/cpus", cpus, num_cpus, ids, SDL_CPU_CORE_PERFORMANCE, -1) ||
+        !SDL_MarkCPUList("/sys/devices/cpu_atom/cpus", cpus, num_cpus, ids, SDL_CPU_CORE_EFFICIENCY, -1)) {
+        /* ARM big.LITTLE reports the relative capacity of each core */
+        for (i = 0; i < num_cpus; ++i) {
+            (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpu_capacity", cpus[i].id);
+            ids[i] = SDL_ReadSysfsInt(path, 0);
+            min_capacity = SDL_min(min_capacity, ids[i]);
+            max_capacity = SDL_max(max_capacity, ids[i]);
+        }
+        if (min_capacity > 0 && min_capacity < max_capacity) {
+            for (i = 0; i < num_cpus; ++i) {
+                cpus[i].core_type = (ids[i] == max_capacity) ? SDL_CPU_CORE_PERFORMANCE : SDL_CPU_CORE_EFFICIENCY;
+            }
+        }
+    }
+
+    /* Take the cache sizes from the first CPU */
+    SDL_zerop(topology);
+    for (i = 0; i < 10; ++i) {
+        int level;
+
+        (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/type", cpus[0].id, i);
+        if (!SDL_ReadSysfsFile(path, buf, sizeof(buf))) {
+            break;
+        }
+        if (SDL_strncmp(buf, "Instruction", 11) == 0) {
+            continue;
+        }
+        (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/level", cpus[0].id, i);
+        level = SDL_ReadSysfsInt(path, 0);
+        (void)SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/size", cpus[0].id, i);
+        if (!SDL_ReadSysfsFile(path, buf, sizeof(buf))) {
+            continue;
+        }
+        if (level == 1) {
+            topology->l1d_cache_size = SDL_ParseCacheSize(buf);
+        } else if (level == 2) {
+            topology->l2_cache_size = SDL_ParseCacheSize(buf);
+        } else if (level == 3) {
+            topology->l3_cache_size = SDL_ParseCacheSize(buf);
+        }
+    }
+    topology->num_cpus = num_cpus;
+    topology->num_cores = num_cores;
+    topology->num_packages = num_packages;
+    topology->num_numa_nodes = SDL_max(num_nodes, 1);
+
+    SDL_free(ids);
+    *cpus_out = cpus;
+    return num_cpus;
+}
+
+#elif !defined(SDL_CPUINFO_DISABLED) && defined(__WIN32__) && !defined(__WINRT__)
+typedef BOOL(WINAPI *pfnGetLogicalProcessorInformation)(PSYSTEM_LOGICAL_PROCESSOR_INFORMATION, PDWORD);
+
+/* This only sees the CPUs in the process's processor group, at most 64 of them */
+static int SDL_ReadCPUTopology(SDL_LogicalCPU **cpus_out, SDL_CPUTopology *topology)
+{
+    const int max_cpus = sizeof(ULONG_PTR) * 8;
+    pfnGetLogicalProcessorInformation pGetLogicalProcessorInformation;
+    PSYSTEM_LOGICAL_PROCESSOR_INFORMATION info;
+    SDL_LogicalCPU all_cpus[sizeof(ULONG_PTR) * 8];
+    SDL_LogicalCPU *cpus;
+    ULONG_PTR present = 0;
+    DWORD len = 0;
+    int i, j, count;
+    int num_cpus = 0, num_cores = 0, num_packages = 0, num_nodes = 0;
+
+    pGetLogicalProcessorInformation = (pfnGetLogicalProcessorInformation)GetProcAddress(GetModuleHandle(TEXT("kernel32.dll")), "GetLogicalProcessorInformation");
+    if (!pGetLogicalProcessorInformation) {
+        return -1;
+    }
+    pGetLogicalProcessorInformation(NULL, &len);
+    if (len == 0) {
+        return -1;
+    }
+    info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION)SDL_malloc(len);
+    if (!info) {
+        return SDL_OutOfMemory();
+    }
+    if (!pGetLogicalProcessorInformation(info, &len)) {
+        SDL_free(info);
+        return -1;
+    }
+    count = (int)(len / sizeof(*info));
+
+    SDL_zeroa(all_cpus);
+    SDL_zerop(topology);
+    for (i = 0; i < count; ++i) {
+        switch (info[i].Relationship) {
+        case RelationProcessorCore:
+            present |= info[i].ProcessorMask;
+            for (j = 0; j < max_cpus; ++j) {
+                if (info[i].ProcessorMask & ((ULONG_PTR)1 << j)) {
+                    all_cpus[j].core = num_cores;
+                }
+            }
+            ++num_cores;
+            break;
+        case RelationProcessorPackage:
+            for (j = 0; j < max_cpus; ++j) {
+                if (info[i].ProcessorMask & ((ULONG_PTR)1 << j)) {
+                    all_cpus[j].package = num_packages;
+                }
+            }
+            ++num_packages;
+            break;
+        case RelationNumaNode:
+            for (j = 0; j < max_cpus; ++j) {
+                if (info[i].ProcessorMask & ((ULONG_PTR)1 << j)) {
+                    all_cpus[j].numa_node = num_nodes;
+                }
+            }
+            ++num_nodes;
+            break;
+        case RelationCache:
+            if (info[i].Cache.Type == CacheData || info[i].Cache.Type == CacheUnified) {
+                if (info[i].Cache.Level == 1) {
+                    topology->l1d_cache_size = (int)info[i].Cache.Size;
+                } else if (info[i].Cache.Level == 2) {
+                    topology->l2_cache_size = (int)info[i].Cache.Size;
+                } else if (info[i].Cache.Level == 3) {
+                    topology->l3_cache_size = (int)info[i].Cache.Size;
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    SDL_free(info);
+
+    cpus = (SDL_LogicalCPU *)SDL_calloc(max_cpus, sizeof(*cpus));
+    if (!cpus) {
+        return SDL_OutOfMemory();
+    }
+    for (j = 0; j < max_cpus; ++j) {
+        if (present & ((ULONG_PTR)1 << j)) {
+            cpus[num_cpus] = all_cpus[j];
+            cpus[num_cpus].id = j;
+            ++num_cpus;
+        }
+    }
+    if (num_cpus == 0) {
+        SDL_free(cpus);
+        return -1;
+    }
+    topology->num_cpus = num_cpus;
+    topology->num_cores = num_cores;
+    topology->num_packages = SDL_max(num_packages, 1);
+    topology->num_numa_nodes = SDL_max(num_nodes, 1);
+
+    *cpus_out = cpus;
+    return num_cpus;
+}
+
+#else
+static int SDL_ReadCPUTopology(SDL_LogicalCPU **cpus_out, SDL_CPUTopology *topology)
+{
+    return -1;
+}
+#endif
+
+/* If the topology can't be read, treat every CPU as a core of its own */
+static int SDL_GetCPUTopologyInternal(SDL_LogicalCPU **cpus_out, SDL_CPUTopology *topology)
+{
+    SDL_LogicalCPU *cpus;
+    int i, num_cpus;
+
+    num_cpus = SDL_ReadCPUTopology(cpus_out, topology);
+    if (num_cpus > 0) {
+        return num_cpus;
+    }
+
+    num_cpus = SDL_GetCPUCount();
+    cpus = (SDL_LogicalCPU *)SDL_calloc(num_cpus, sizeof(*cpus));
+    if (!cpus) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < num_cpus; ++i) {
+        cpus[i].id = i;
+        cpus[i].core = i;
+    }
+    SDL_zerop(topology);
+    topology->num_cpus = num_cpus;
+    topology->num_cores = num_cpus;
+    topology->num_packages = 1;
+    topology->num_numa_nodes = 1;
+
+    *cpus_out = cpus;
+    return num_cpus;
+}
+
+/* Reading the topology touches dozens of sysfs files, so it's done once */
+static SDL_SpinLock SDL_CPUTopologyLock;
+static SDL_LogicalCPU *SDL_CachedCPUs;
+static int SDL_NumCachedCPUs;
+static SDL_CPUTopology SDL_CachedTopology;
+
+/* This must be called with SDL_CPUTopologyLock held */
+static int SDL_LoadCPUTopology(void)
+{
+    if (!SDL_CachedCPUs) {
+        SDL_NumCachedCPUs = SDL_GetCPUTopologyInternal(&SDL_CachedCPUs, &SDL_CachedTopology);
+        if (SDL_NumCachedCPUs < 0) {
+            SDL_CachedCPUs = NULL;
+            return -1;
+        }
+    }
+    return SDL_NumCachedCPUs;
+}
+
+void SDL_QuitCPUTopology(void)
+{
+    SDL_AtomicLock(&SDL_CPUTopologyLock);
+    SDL_free(SDL_CachedCPUs);
+    SDL_CachedCPUs = NULL;
+    SDL_NumCachedCPUs = 0;
+    SDL_AtomicUnlock(&SDL_CPUTopologyLock);
+}
+
+int SDL_GetCPUTopology(SDL_CPUTopology *topology)
+{
+    int result = 0;
+
+    if (!topology) {
+        return SDL_InvalidParamError("topology");
+    }
+    SDL_AtomicLock(&SDL_CPUTopologyLock);
+    if (SDL_LoadCPUTopology() < 0) {
+        result = -1;
+    } else {
+        *topology = SDL_CachedTopology;
+    }
+    SDL_AtomicUnlock(&SDL_CPUTopologyLock);
+    return result;
+}
+
+int SDL_GetLogicalCPUs(SDL_LogicalCPU *cpus, int max_cpus)
+{
+    int num_cpus;
+
+    if (max_cpus < 0) {
+        return SDL_InvalidParamError("max_cpus");
+    }
+    SDL_AtomicLock(&SDL_CPUTopologyLock);
+    num_cpus = SDL_LoadCPUTopology();
+    if (num_cpus > 0 && cpus) {
+        SDL_memcpy(cpus, SDL_CachedCPUs, SDL_min(num_cpus, max_cpus) * sizeof(*cpus));
+    }
+    SDL_AtomicUnlock(&SDL_CPUTopologyLock);
+    return num_cpus;
+}
+
 size_t SDL_SIMDGetAlignment(void)
 {
     if (SDL_SIMDAlignment == 0xFFFFFFFF) {
@@ -1176,7 +1713,7 @@ size_t SDL_SIMDGetAlignment(void)
     return SDL_SIMDAlignment;
 }
 
-void *SDL_SIMDAlloc(const size_t len)
+void *SDL_TaggedSIMDAlloc(const size_t len, const char *file)
 {
     const size_t alignment = SDL_SIMDGetAlignment();
     const size_t padding = (alignment - (len % alignment)) % alignment;
@@ -1190,7 +1727,7 @@ void *SDL_SIMDAlloc(const size_t len)
         return NULL;
     }
 
-    ptr = (Uint8 *)SDL_malloc(to_allocate);
+    ptr = (Uint8 *)SDL_TaggedMalloc(to_allocate, file);
     if (ptr) {
         /* store the actual allocated pointer right before our aligned pointer. */
         retval = ptr + sizeof(void *);
@@ -1200,7 +1737,7 @@ void *SDL_SIMDAlloc(const size_t len)
     return retval;
 }
 
-void *SDL_SIMDRealloc(void *mem, const size_t len)
+void *SDL_TaggedSIMDRealloc(void *mem, const size_t len, const char *file)
 {
     const size_t alignment = SDL_SIMDGetAlignment();
     const size_t padding = (alignment - (len % alignment)) % alignment;
@@ -1223,7 +1760,7 @@ void *SDL_SIMDRealloc(void *mem, const size_t len)
         memdiff = ((size_t)oldmem) - ((size_t)mem);
     }
 
-    ptr = (Uint8 *)SDL_realloc(mem, to_allocate);
+    ptr = (Uint8 *)SDL_TaggedRealloc(mem, to_allocate, file);
 
     if (!ptr) {
         return NULL; /* Out of memory, bail! */
@@ -1252,6 +1789,16 @@ void *SDL_SIMDRealloc(void *mem, const size_t len)
     return retval;
 }
 
+void *SDL_SIMDAlloc(const size_t len)
+{
+    return SDL_TaggedSIMDAlloc(len, NULL);
+}
+
+void *SDL_SIMDRealloc(void *mem, const size_t len)
+{
+    return SDL_TaggedSIMDRealloc(mem, len, NULL);
+}
+
 void SDL_SIMDFree(void *ptr)
 {
     if (ptr) {
@@ -1286,6 +1833,13 @@ int main(void)
     printf("LSX: %d\n", SDL_HasLSX());
     printf("LASX: %d\n", SDL_HasLASX());
     printf("RAM: %d MB\n", SDL_GetSystemRAM());
+    {
+        SDL_CPUTopology topology;
+        if (SDL_GetCPUTopology(&topology) == 0) {
+            printf("Topology: %d CPUs, %d cores, %d packages, %d NUMA nodes\n", topology.num_cpus, topology.num_cores, topology.num_packages, topology.num_numa_nodes);
+            printf("Caches: L1d %d, L2 %d, L3 %d bytes\n", topology.l1d_cache_size, topology.l2_cache_size, topology.l3_cache_size);
+        }
+    }
     return 0;
 }
 
@@ -0,0 +1,45 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef SDL_cpuinfo_c_h_
+#define SDL_cpuinfo_c_h_
+
+/* The most CPUs SDL keeps track of, the same as glibc's CPU_SETSIZE */
+#define SDL_MAX_LOGICAL_CPUS 1024
+
+/* Parses a list of CPUs like "0-3,8,10-11", as used by Linux sysfs and
+   SDL_HINT_THREAD_AFFINITY. Fills in up to max_cpus of them and returns how
+   many there are in total. CPU ids at or above SDL_MAX_LOGICAL_CPUS are
+   dropped, and at most SDL_MAX_LOGICAL_CPUS are counted.
+ */
+extern int SDL_ParseCPUList(const char *text, int *cpus, int max_cpus);
+
+/* Start and stop following SDL_HINT_CPU_FEATURE_MASK */
+extern void SDL_InitCPUFeatureMask(void);
+extern void SDL_QuitCPUFeatureMask(void);
+
+/* Free the cached CPU topology */
+extern void SDL_QuitCPUTopology(void);
+
+#endif /* SDL_cpuinfo_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
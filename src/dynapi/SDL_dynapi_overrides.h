@@ -898,3 +898,45 @@
 #define SDL_DestroyWindowSurface SDL_DestroyWindowSurface_REAL
 #define SDL_GDKGetDefaultUser SDL_GDKGetDefaultUser_REAL
 #define SDL_GameControllerGetSteamHandle SDL_GameControllerGetSteamHandle_REAL
+#define SDL_AudioStreamPeek SDL_AudioStreamPeek_REAL
+#define SDL_AudioStreamCommitRead SDL_AudioStreamCommitRead_REAL
+#define SDL_GetAudioDeviceFramesPlayed SDL_GetAudioDeviceFramesPlayed_REAL
+#define SDL_OpenWAVStream_RW SDL_OpenWAVStream_RW_REAL
+#define SDL_ReadWAVStream SDL_ReadWAVStream_REAL
+#define SDL_RewindWAVStream SDL_RewindWAVStream_REAL
+#define SDL_CloseWAVStream SDL_CloseWAVStream_REAL
+#define SDL_GetAudioDeviceStats SDL_GetAudioDeviceStats_REAL
+#define SDL_SetAudioDeviceVolume SDL_SetAudioDeviceVolume_REAL
+#define SDL_ResetAudioDeviceStats SDL_ResetAudioDeviceStats_REAL
+#define SDL_BindAudioStream SDL_BindAudioStream_REAL
+#define SDL_UnbindAudioStream SDL_UnbindAudioStream_REAL
+#define SDL_SetBoundAudioStreamGain SDL_SetBoundAudioStreamGain_REAL
+#define SDL_SetAudioStreamResamplingQuality SDL_SetAudioStreamResamplingQuality_REAL
+#define SDL_DequeueAudioTimestamped SDL_DequeueAudioTimestamped_REAL
+#define SDL_RenderGetVSyncStats SDL_RenderGetVSyncStats_REAL
+#define SDL_DelayNS SDL_DelayNS_REAL
+#define SDL_CreateJobGroup SDL_CreateJobGroup_REAL
+#define SDL_SubmitJob SDL_SubmitJob_REAL
+#define SDL_WaitJobGroup SDL_WaitJobGroup_REAL
+#define SDL_DestroyJobGroup SDL_DestroyJobGroup_REAL
+#define SDL_ParallelFor SDL_ParallelFor_REAL
+#define SDL_GetNumJobWorkers SDL_GetNumJobWorkers_REAL
+#define SDL_CreateRWLock SDL_CreateRWLock_REAL
+#define SDL_LockRWLockForReading SDL_LockRWLockForReading_REAL
+#define SDL_LockRWLockForWriting SDL_LockRWLockForWriting_REAL
+#define SDL_TryLockRWLockForReading SDL_TryLockRWLockForReading_REAL
+#define SDL_TryLockRWLockForWriting SDL_TryLockRWLockForWriting_REAL
+#define SDL_UnlockRWLock SDL_UnlockRWLock_REAL
+#define SDL_DestroyRWLock SDL_DestroyRWLock_REAL
+#define SDL_SetLockName SDL_SetLockName_REAL
+#define SDL_GetLockStats SDL_GetLockStats_REAL
+#define SDL_LogLockStats SDL_LogLockStats_REAL
+#define SDL_ResetLockStats SDL_ResetLockStats_REAL
+#define SDL_GetCPUTopology SDL_GetCPUTopology_REAL
+#define SDL_GetLogicalCPUs SDL_GetLogicalCPUs_REAL
+#define SDL_SetThreadAffinity SDL_SetThreadAffinity_REAL
+#define SDL_GetThreadAffinity SDL_GetThreadAffinity_REAL
+#define SDL_AddTimerNS SDL_AddTimerNS_REAL
+#define SDL_GetMemoryStats SDL_GetMemoryStats_REAL
+#define SDL_LogMemoryStats SDL_LogMemoryStats_REAL
+#define SDL_ResetMemoryStats SDL_ResetMemoryStats_REAL
@@ -985,3 +985,45 @@ SDL_DYNAPI_PROC(int,SDL_DestroyWindowSurface,(SDL_Window *a),(a),return)
 SDL_DYNAPI_PROC(int,SDL_GDKGetDefaultUser,(XUserHandle *a),(a),return)
 #endif
 SDL_DYNAPI_PROC(Uint64,SDL_GameControllerGetSteamHandle,(SDL_GameController *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamPeek,(SDL_AudioStream *a, const void **b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamCommitRead,(SDL_AudioStream *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(Uint64,SDL_GetAudioDeviceFramesPlayed,(SDL_AudioDeviceID a),(a),return)
+SDL_DYNAPI_PROC(SDL_WAVStream*,SDL_OpenWAVStream_RW,(SDL_RWops *a, int b, SDL_AudioSpec *c, Uint32 *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_ReadWAVStream,(SDL_WAVStream *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_RewindWAVStream,(SDL_WAVStream *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_CloseWAVStream,(SDL_WAVStream *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDeviceStats,(SDL_AudioDeviceID a, SDL_AudioDeviceStats *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioDeviceVolume,(SDL_AudioDeviceID a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_ResetAudioDeviceStats,(SDL_AudioDeviceID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_BindAudioStream,(SDL_AudioDeviceID a, SDL_AudioStream *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_UnbindAudioStream,(SDL_AudioDeviceID a, SDL_AudioStream *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SetBoundAudioStreamGain,(SDL_AudioDeviceID a, SDL_AudioStream *b, float c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioStreamResamplingQuality,(SDL_AudioStream *a, SDL_AudioResamplingQuality b),(a,b),return)
+SDL_DYNAPI_PROC(Uint32,SDL_DequeueAudioTimestamped,(SDL_AudioDeviceID a, void *b, Uint32 c, Uint64 *d, Uint32 *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(int,SDL_RenderGetVSyncStats,(SDL_Renderer *a, SDL_RenderVSyncStats *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_DelayNS,(Uint64 a),(a),)
+SDL_DYNAPI_PROC(SDL_JobGroup*,SDL_CreateJobGroup,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_SubmitJob,(SDL_JobGroup *a, SDL_JobFunction b, void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_WaitJobGroup,(SDL_JobGroup *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobGroup,(SDL_JobGroup *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_ParallelFor,(int a, int b, SDL_ParallelForFunction c, void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_GetNumJobWorkers,(void),(),return)
+SDL_DYNAPI_PROC(SDL_RWLock*,SDL_CreateRWLock,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_LockRWLockForReading,(SDL_RWLock *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_LockRWLockForWriting,(SDL_RWLock *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_TryLockRWLockForReading,(SDL_RWLock *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_TryLockRWLockForWriting,(SDL_RWLock *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_UnlockRWLock,(SDL_RWLock *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyRWLock,(SDL_RWLock *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_SetLockName,(const void *a, const char *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetLockStats,(SDL_LockStats *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_LogLockStats,(int a),(a),)
+SDL_DYNAPI_PROC(void,SDL_ResetLockStats,(void),(),)
+SDL_DYNAPI_PROC(int,SDL_GetCPUTopology,(SDL_CPUTopology *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_GetLogicalCPUs,(SDL_LogicalCPU *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SetThreadAffinity,(const int *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetThreadAffinity,(int *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_TimerID,SDL_AddTimerNS,(Uint64 a, SDL_NSTimerCallback b, void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetMemoryStats,(SDL_MemoryStats *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_LogMemoryStats,(void),(),)
+SDL_DYNAPI_PROC(void,SDL_ResetMemoryStats,(void),(),)
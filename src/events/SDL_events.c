@@ -91,6 +91,64 @@ static struct
     SDL_SysWMEntry *wmmsg_free;
 } SDL_EventQ = { NULL, SDL_FALSE, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
 
+#ifndef SDL_THREADS_DISABLED
+
+/* Events pushed from threads other than the one that started the event loop
+   go through a bounded lock-free queue, so that producers never wait on the
+   thread reading events and don't allocate unless it's full. It's a multiple producer, single
+   consumer ring where each cell carries a sequence number saying whether it's
+   free for position N (N) or holds the event for position N (N + 1).
+
+   The reading thread merges it into SDL_EventQ whenever the queue is pumped
+   or read, and that's when the event filter and watchers see these events.
+   A producer that finds the ring full appends to an overflow list instead,
+   and keeps doing so until the reader has merged the list, so that each
+   thread's events stay in the order it pushed them. The reader only takes
+   the overflow list once the ring is empty, and only holds its lock while
+   unlinking events, so producers never wait on a watcher. The overflow list
+   holds at most SDL_MAX_QUEUED_EVENTS events, past that pushes fail the same
+   way they would with a full event queue.
+
+   This is off unless SDL_HINT_EVENT_INGRESS_QUEUE is set, because it changes
+   where and when the event filter and watchers run for these events.
+
+   SDL_StopEventLoop() clears the active flag and then waits for producers
+   that are still in the middle of a push before freeing the ring.
+ */
+#define SDL_EVENT_INGRESS_SIZE 1024 /* Must be a power of two */
+
+typedef struct
+{
+    SDL_atomic_t sequence;
+    SDL_Event event;
+} SDL_EventIngressCell;
+
+typedef struct SDL_EventIngressOverflow
+{
+    SDL_Event event;
+    struct SDL_EventIngressOverflow *next;
+} SDL_EventIngressOverflow;
+
+static struct
+{
+    SDL_EventIngressCell *cells;
+    SDL_threadID thread;
+    SDL_atomic_t enqueue_pos;
+    SDL_atomic_t pending;
+    SDL_mutex *lock; /* Serializes readers, producers never take it */
+    Uint32 dequeue_pos;
+    SDL_bool draining;
+    SDL_atomic_t active;
+    SDL_atomic_t producers; /* Threads in the middle of a push */
+    SDL_mutex *overflow_lock;
+    SDL_EventIngressOverflow *overflow_head;
+    SDL_EventIngressOverflow *overflow_tail;
+    int overflow_count;
+    SDL_atomic_t overflowed; /* Set while the overflow list has events */
+} SDL_EventIngress;
+
+#endif /* !SDL_THREADS_DISABLED */
+
 #ifndef SDL_JOYSTICK_DISABLED
 
 static SDL_bool SDL_update_joysticks = SDL_TRUE;
@@ -582,6 +640,39 @@ void SDL_StopEventLoop(void)
     SDL_EventQ.wmmsg_free = NULL;
     SDL_AtomicSet(&SDL_sentinel_pending, 0);
 
+#ifndef SDL_THREADS_DISABLED
+    /* Wait for producers that saw the ingress queue active, then drop any
+       events still in it */
+    if (SDL_AtomicCAS(&SDL_EventIngress.active, 1, 0)) {
+        while (SDL_AtomicGet(&SDL_EventIngress.producers) > 0) {
+            SDL_Delay(0);
+        }
+    }
+    while (SDL_EventIngress.overflow_head) {
+        SDL_EventIngressOverflow *next = SDL_EventIngress.overflow_head->next;
+        SDL_free(SDL_EventIngress.overflow_head);
+        SDL_EventIngress.overflow_head = next;
+    }
+    SDL_EventIngress.overflow_tail = NULL;
+    SDL_EventIngress.overflow_count = 0;
+    SDL_AtomicSet(&SDL_EventIngress.overflowed, 0);
+    if (SDL_EventIngress.overflow_lock) {
+        SDL_DestroyMutex(SDL_EventIngress.overflow_lock);
+        SDL_EventIngress.overflow_lock = NULL;
+    }
+    if (SDL_EventIngress.cells) {
+        SDL_free(SDL_EventIngress.cells);
+        SDL_EventIngress.cells = NULL;
+    }
+    if (SDL_EventIngress.lock) {
+        SDL_DestroyMutex(SDL_EventIngress.lock);
+        SDL_EventIngress.lock = NULL;
+    }
+    SDL_AtomicSet(&SDL_EventIngress.enqueue_pos, 0);
+    SDL_AtomicSet(&SDL_EventIngress.pending, 0);
+    SDL_EventIngress.dequeue_pos = 0;
+#endif
+
     /* Clear disabled event state */
     for (i = 0; i < SDL_arraysize(SDL_disabled_events); ++i) {
         SDL_free(SDL_disabled_events[i]);
@@ -623,6 +714,7 @@ int SDL_StartEventLoop(void)
         if (SDL_EventQ.lock == NULL) {
             return -1;
         }
+        SDL_SetLockName(SDL_EventQ.lock, "SDL_EventQ.lock");
     }
     SDL_LockMutex(SDL_EventQ.lock);
 
@@ -632,6 +724,39 @@ int SDL_StartEventLoop(void)
             SDL_UnlockMutex(SDL_EventQ.lock);
             return -1;
         }
+        SDL_SetLockName(SDL_event_watchers_lock, "SDL_event_watchers_lock");
+    }
+
+    if (SDL_EventIngress.cells == NULL && SDL_GetHintBoolean(SDL_HINT_EVENT_INGRESS_QUEUE, SDL_FALSE)) {
+        SDL_EventIngress.lock = SDL_CreateMutex();
+        SDL_EventIngress.overflow_lock = SDL_CreateMutex();
+        SDL_EventIngress.cells = (SDL_EventIngressCell *)SDL_malloc(SDL_EVENT_INGRESS_SIZE * sizeof(*SDL_EventIngress.cells));
+        if (SDL_EventIngress.lock && SDL_EventIngress.overflow_lock && SDL_EventIngress.cells) {
+            int i;
+
+            SDL_SetLockName(SDL_EventIngress.lock, "SDL_EventIngress.lock");
+            SDL_SetLockName(SDL_EventIngress.overflow_lock, "SDL_EventIngress.overflow_lock");
+            for (i = 0; i < SDL_EVENT_INGRESS_SIZE; ++i) {
+                SDL_AtomicSet(&SDL_EventIngress.cells[i].sequence, i);
+            }
+            SDL_EventIngress.thread = SDL_ThreadID();
+
+            /* Producers must see the initialized ring before the flag */
+            SDL_MemoryBarrierRelease();
+            SDL_AtomicSet(&SDL_EventIngress.active, 1);
+        } else {
+            /* Not fatal, every thread will use the locked path */
+            SDL_free(SDL_EventIngress.cells);
+            SDL_EventIngress.cells = NULL;
+            if (SDL_EventIngress.lock) {
+                SDL_DestroyMutex(SDL_EventIngress.lock);
+                SDL_EventIngress.lock = NULL;
+            }
+            if (SDL_EventIngress.overflow_lock) {
+                SDL_DestroyMutex(SDL_EventIngress.overflow_lock);
+                SDL_EventIngress.overflow_lock = NULL;
+            }
+        }
     }
 #endif /* !SDL_THREADS_DISABLED */
 
@@ -754,12 +879,274 @@ static int SDL_SendWakeupEvent(void)
     return 0;
 }
 
+/* Run the event filter and watchers, returns SDL_FALSE if the event was filtered */
+static SDL_bool SDL_DispatchEventWatchers(SDL_Event *event)
+{
+    if (SDL_EventOK.callback || SDL_event_watchers_count > 0) {
+        SDL_LockMutex(SDL_event_watchers_lock);
+        {
+            if (SDL_EventOK.callback && !SDL_EventOK.callback(SDL_EventOK.userdata, event)) {
+                SDL_UnlockMutex(SDL_event_watchers_lock);
+                return SDL_FALSE;
+            }
+
+            if (SDL_event_watchers_count > 0) {
+                /* Make sure we only dispatch the current watcher list */
+                int i, event_watchers_count = SDL_event_watchers_count;
+
+                SDL_event_watchers_dispatching = SDL_TRUE;
+                for (i = 0; i < event_watchers_count; ++i) {
+                    if (!SDL_event_watchers[i].removed) {
+                        SDL_event_watchers[i].callback(SDL_event_watchers[i].userdata, event);
+                    }
+                }
+                SDL_event_watchers_dispatching = SDL_FALSE;
+
+                if (SDL_event_watchers_removed) {
+                    for (i = SDL_event_watchers_count; i--;) {
+                        if (SDL_event_watchers[i].removed) {
+                            --SDL_event_watchers_count;
+                            if (i < SDL_event_watchers_count) {
+                                SDL_memmove(&SDL_event_watchers[i], &SDL_event_watchers[i + 1], (SDL_event_watchers_count - i) * sizeof(SDL_event_watchers[i]));
+                            }
+                        }
+                    }
+                    SDL_event_watchers_removed = SDL_FALSE;
+                }
+            }
+        }
+        SDL_UnlockMutex(SDL_event_watchers_lock);
+    }
+    return SDL_TRUE;
+}
+
+#ifndef SDL_THREADS_DISABLED
+
+/* Add an event to the ingress ring, returns SDL_FALSE if it's full */
+static SDL_bool SDL_PushEventIngressRing(const SDL_Event *event)
+{
+    SDL_EventIngressCell *cell;
+    Uint32 pos = (Uint32)SDL_AtomicGet(&SDL_EventIngress.enqueue_pos);
+
+    for (;;) {
+        int diff;
+
+        cell = &SDL_EventIngress.cells[pos & (SDL_EVENT_INGRESS_SIZE - 1)];
+        diff = (int)((Uint32)SDL_AtomicGet(&cell->sequence) - pos);
+        if (diff == 0) {
+            /* The cell is free, try to claim this position */
+            if (SDL_AtomicCAS(&SDL_EventIngress.enqueue_pos, (int)pos, (int)(pos + 1))) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* The reader hasn't caught up, the ring is full */
+            return SDL_FALSE;
+        }
+        /* Another producer got here first */
+        pos = (Uint32)SDL_AtomicGet(&SDL_EventIngress.enqueue_pos);
+    }
+
+    cell->event = *event;
+    SDL_AtomicSet(&cell->sequence, (int)(pos + 1));
+    SDL_AtomicIncRef(&SDL_EventIngress.pending);
+    return SDL_TRUE;
+}
+
+/* Add an event to the ingress queue.
+   Returns 1 if it was queued, 0 if the queue isn't active, or -1 if it's full or we're out of memory. */
+static int SDL_PushEventIngress(const SDL_Event *event)
+{
+    SDL_EventIngressOverflow *entry;
+    int result = 0;
+
+    SDL_AtomicIncRef(&SDL_EventIngress.producers);
+    if (!SDL_AtomicGet(&SDL_EventIngress.active)) {
+        goto done;
+    }
+
+    /* Once anything has overflowed, later events have to follow it */
+    if (!SDL_AtomicGet(&SDL_EventIngress.overflowed) && SDL_PushEventIngressRing(event)) {
+        result = 1;
+        goto done;
+    }
+
+    /* Falling back to the event queue here would put this event ahead of ones we already queued */
+    result = -1;
+
+    entry = (SDL_EventIngressOverflow *)SDL_malloc(sizeof(*entry));
+    if (!entry) {
+        SDL_OutOfMemory();
+        goto done;
+    }
+    entry->event = *event;
+    entry->next = NULL;
+
+    SDL_LockMutex(SDL_EventIngress.overflow_lock);
+    if (SDL_EventIngress.overflow_count >= SDL_MAX_QUEUED_EVENTS) {
+        SDL_UnlockMutex(SDL_EventIngress.overflow_lock);
+        SDL_free(entry);
+        SDL_SetError("Event queue is full (%d events)", SDL_EventIngress.overflow_count + SDL_EVENT_INGRESS_SIZE);
+        goto done;
+    }
+    if (SDL_EventIngress.overflow_tail) {
+        SDL_EventIngress.overflow_tail->next = entry;
+    } else {
+        SDL_EventIngress.overflow_head = entry;
+    }
+    SDL_EventIngress.overflow_tail = entry;
+    ++SDL_EventIngress.overflow_count;
+    SDL_AtomicSet(&SDL_EventIngress.overflowed, 1);
+    SDL_UnlockMutex(SDL_EventIngress.overflow_lock);
+
+    SDL_AtomicIncRef(&SDL_EventIngress.pending);
+    result = 1;
+
+done:
+    SDL_AtomicAdd(&SDL_EventIngress.producers, -1);
+    return result;
+}
+
+/* Take up to max_events from the overflow list, if the ring is empty.
+   Anything in the ring was pushed before the overflow list started. */
+static int SDL_TakeEventIngressOverflow(SDL_Event *events, int max_events)
+{
+    int count = 0;
+
+    if (!SDL_AtomicGet(&SDL_EventIngress.overflowed)) {
+        return 0;
+    }
+
+    SDL_LockMutex(SDL_EventIngress.overflow_lock);
+    if ((Uint32)SDL_AtomicGet(&SDL_EventIngress.enqueue_pos) == SDL_EventIngress.dequeue_pos) {
+        while (count < max_events && SDL_EventIngress.overflow_head) {
+            SDL_EventIngressOverflow *entry = SDL_EventIngress.overflow_head;
+
+            SDL_EventIngress.overflow_head = entry->next;
+            --SDL_EventIngress.overflow_count;
+            events[count++] = entry->event;
+            SDL_free(entry);
+        }
+        if (!SDL_EventIngress.overflow_head) {
+            SDL_EventIngress.overflow_tail = NULL;
+            SDL_AtomicSet(&SDL_EventIngress.overflowed, 0);
+        }
+    }
+    SDL_UnlockMutex(SDL_EventIngress.overflow_lock);
+
+    return count;
+}
+
+static SDL_bool SDL_EventIngressPending(void)
+{
+    /* This is a read-modify-write so that it's a full memory barrier,
+       SDL_WaitEventTimeout_Device() relies on that */
+    return SDL_AtomicAdd(&SDL_EventIngress.pending, 0) > 0;
+}
+
+static void SDL_SendIngressWakeupEvent(void)
+{
+    SDL_VideoDevice *_this = SDL_GetVideoDevice();
+
+    /* SDL_WaitEventTimeout_Device() checks for pending ingress events after
+       setting the wakeup window, so we only need the wakeup lock if a waiting
+       thread might have missed this event. */
+    if (_this && _this->wakeup_window) {
+        SDL_SendWakeupEvent();
+    }
+}
+
+/* Move events from the ingress queue into the event queue, in the order they were pushed */
+static void SDL_DrainEventIngress(void)
+{
+    SDL_Event events[32];
+    int i, count, used;
+    SDL_bool added = SDL_FALSE;
+
+    if (!SDL_EventIngress.cells || !SDL_EventIngressPending()) {
+        return;
+    }
+
+    /* If another thread is already draining, it'll merge these events.
+       Readers don't wait for it, since it may be running a watcher that's waiting on them. */
+    if (SDL_TryLockMutex(SDL_EventIngress.lock) != 0) {
+        return;
+    }
+    if (SDL_EventIngress.draining) {
+        /* We were called from a watcher, leave the rest to the outer drain */
+        SDL_UnlockMutex(SDL_EventIngress.lock);
+        return;
+    }
+    SDL_EventIngress.draining = SDL_TRUE;
+
+    do {
+        count = 0;
+        while (count < SDL_arraysize(events)) {
+            const Uint32 pos = SDL_EventIngress.dequeue_pos;
+            SDL_EventIngressCell *cell = &SDL_EventIngress.cells[pos & (SDL_EVENT_INGRESS_SIZE - 1)];
+
+            if ((Uint32)SDL_AtomicGet(&cell->sequence) != pos + 1) {
+                /* Empty, or the next producer hasn't finished writing */
+                break;
+            }
+            events[count++] = cell->event;
+            SDL_AtomicSet(&cell->sequence, (int)(pos + SDL_EVENT_INGRESS_SIZE));
+            SDL_EventIngress.dequeue_pos = pos + 1;
+        }
+        if (count < SDL_arraysize(events)) {
+            count += SDL_TakeEventIngressOverflow(&events[count], SDL_arraysize(events) - count);
+        }
+        if (count == 0) {
+            break;
+        }
+        SDL_AtomicAdd(&SDL_EventIngress.pending, -count);
+
+        used = 0;
+        for (i = 0; i < count; ++i) {
+            if (SDL_DispatchEventWatchers(&events[i])) {
+                events[used++] = events[i];
+            }
+        }
+
+        SDL_LockMutex(SDL_EventQ.lock);
+        if (SDL_EventQ.active) {
+            for (i = 0; i < used; ++i) {
+                SDL_AddEvent(&events[i]);
+            }
+        } else {
+            used = 0;
+        }
+        SDL_UnlockMutex(SDL_EventQ.lock);
+
+        for (i = 0; i < used; ++i) {
+            SDL_GestureProcessEvent(&events[i]);
+            added = SDL_TRUE;
+        }
+    } while (count == SDL_arraysize(events));
+
+    SDL_EventIngress.draining = SDL_FALSE;
+    SDL_UnlockMutex(SDL_EventIngress.lock);
+
+    if (added) {
+        /* In case another thread is waiting and didn't get to drain these itself */
+        SDL_SendWakeupEvent();
+    }
+}
+
+#endif /* !SDL_THREADS_DISABLED */
+
 /* Lock the event queue, take a peep at it, and unlock it */
 static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_eventaction action,
                                   Uint32 minType, Uint32 maxType, SDL_bool include_sentinel)
 {
     int i, used, sentinels_expected = 0;
 
+#ifndef SDL_THREADS_DISABLED
+    /* Events pushed from other threads are merged in before reading */
+    if (action != SDL_ADDEVENT) {
+        SDL_DrainEventIngress();
+    }
+#endif
+
     /* Lock the event queue */
     used = 0;
 
@@ -886,6 +1273,11 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     SDL_PumpEvents();
 #endif
 
+#ifndef SDL_THREADS_DISABLED
+    /* Events pushed from other threads are merged in so they get flushed too */
+    SDL_DrainEventIngress();
+#endif
+
     /* Lock the event queue */
     SDL_LockMutex(SDL_EventQ.lock);
     {
@@ -934,6 +1326,11 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
 
     SDL_SendPendingSignalEvents(); /* in case we had a signal handler fire, etc. */
 
+#ifndef SDL_THREADS_DISABLED
+    /* Merge events pushed from other threads before marking the end of this poll cycle */
+    SDL_DrainEventIngress();
+#endif
+
     if (push_sentinel && SDL_GetEventState(SDL_POLLSENTINEL) == SDL_ENABLE) {
         SDL_Event sentinel;
 
@@ -990,6 +1387,7 @@ static int SDL_WaitEventTimeout_Device(_THIS, SDL_Window *wakeup_window, SDL_Eve
            d) Signals received in WaitEventTimeout() are turned into SDL events
         */
         int status;
+        SDL_bool ingress_pending = SDL_FALSE;
         SDL_PumpEventsInternal(SDL_TRUE);
 
         SDL_LockMutex(_this->wakeup_lock);
@@ -998,12 +1396,24 @@ static int SDL_WaitEventTimeout_Device(_THIS, SDL_Window *wakeup_window, SDL_Eve
             /* If status == 0 we are going to block so wakeup will be needed. */
             if (status == 0) {
                 _this->wakeup_window = wakeup_window;
+#ifndef SDL_THREADS_DISABLED
+                /* Threads pushing through the ingress queue only send a wakeup
+                   event if they see the wakeup window, so check for any that
+                   pushed before it was set. */
+                if (SDL_EventIngress.cells && SDL_EventIngressPending()) {
+                    _this->wakeup_window = NULL;
+                    ingress_pending = SDL_TRUE;
+                }
+#endif
             } else {
                 _this->wakeup_window = NULL;
             }
         }
         SDL_UnlockMutex(_this->wakeup_lock);
 
+        if (ingress_pending) {
+            continue;
+        }
         if (status < 0) {
             /* Got an error: return */
             break;
@@ -1173,40 +1583,23 @@ int SDL_PushEvent(SDL_Event *event)
 {
     event->common.timestamp = SDL_GetTicks();
 
-    if (SDL_EventOK.callback || SDL_event_watchers_count > 0) {
-        SDL_LockMutex(SDL_event_watchers_lock);
-        {
-            if (SDL_EventOK.callback && !SDL_EventOK.callback(SDL_EventOK.userdata, event)) {
-                SDL_UnlockMutex(SDL_event_watchers_lock);
-                return 0;
-            }
-
-            if (SDL_event_watchers_count > 0) {
-                /* Make sure we only dispatch the current watcher list */
-                int i, event_watchers_count = SDL_event_watchers_count;
-
-                SDL_event_watchers_dispatching = SDL_TRUE;
-                for (i = 0; i < event_watchers_count; ++i) {
-                    if (!SDL_event_watchers[i].removed) {
-                        SDL_event_watchers[i].callback(SDL_event_watchers[i].userdata, event);
-                    }
-                }
-                SDL_event_watchers_dispatching = SDL_FALSE;
-
-                if (SDL_event_watchers_removed) {
-                    for (i = SDL_event_watchers_count; i--;) {
-                        if (SDL_event_watchers[i].removed) {
-                            --SDL_event_watchers_count;
-                            if (i < SDL_event_watchers_count) {
-                                SDL_memmove(&SDL_event_watchers[i], &SDL_event_watchers[i + 1], (SDL_event_watchers_count - i) * sizeof(SDL_event_watchers[i]));
-                            }
-                        }
-                    }
-                    SDL_event_watchers_removed = SDL_FALSE;
-                }
-            }
+#ifndef SDL_THREADS_DISABLED
+    /* SDL_SYSWMEVENT points at data the ring can't hold, and the poll
+       sentinel has to stay in step with SDL_sentinel_pending */
+    if (event->type != SDL_SYSWMEVENT && event->type != SDL_POLLSENTINEL &&
+        SDL_ThreadID() != SDL_EventIngress.thread) {
+        const int result = SDL_PushEventIngress(event);
+        if (result > 0) {
+            SDL_SendIngressWakeupEvent();
+            return 1;
+        } else if (result < 0) {
+            return -1;
         }
-        SDL_UnlockMutex(SDL_event_watchers_lock);
+    }
+#endif
+
+    if (!SDL_DispatchEventWatchers(event)) {
+        return 0;
     }
 
     if (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) <= 0) {
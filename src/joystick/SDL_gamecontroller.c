@@ -114,17 +114,53 @@ typedef struct _ControllerMapping_t
     char *name _guarded;
     char *mapping _guarded;
     SDL_ControllerMappingPriority priority _guarded;
+    Uint32 order _guarded; /* built-in mappings use their database index, the rest are numbered after them */
     struct _ControllerMapping_t *next _guarded;
+    struct _ControllerMapping_t *next_by_guid _guarded;
+    struct _ControllerMapping_t *next_by_guid_noversion _guarded;
 } ControllerMapping_t;
 
+/* A built-in mapping that hasn't been parsed yet */
+typedef struct _PendingControllerMapping_t
+{
+    const char *mapping _guarded;
+    SDL_JoystickGUID guid _guarded;
+    struct _PendingControllerMapping_t *next _guarded;
+} PendingControllerMapping_t;
+
 #undef _guarded
 
+/* The mappings are kept in a list in the order they were added, and indexed
+   by GUID both with and without the version, for fast matching. The CRC is
+   never part of the key, it's matched against the mapping string instead.
+
+   Built-in mappings are parsed lazily, but are still put in database order
+   ahead of everything else, so the list and the GUID chains look the same
+   as if they had all been parsed at init.
+ */
+#define SDL_CONTROLLER_MAPPING_BUCKETS 1024
+
 static SDL_JoystickGUID s_zeroGUID;
 static ControllerMapping_t *s_pSupportedControllers SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static ControllerMapping_t *s_pSupportedControllersTail SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static ControllerMapping_t *s_pMappingsByGUID[SDL_CONTROLLER_MAPPING_BUCKETS] SDL_GUARDED_BY(SDL_joystick_lock);
+static ControllerMapping_t *s_pMappingsByGUIDNoVersion[SDL_CONTROLLER_MAPPING_BUCKETS] SDL_GUARDED_BY(SDL_joystick_lock);
+static PendingControllerMapping_t *s_pPendingMappings SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static PendingControllerMapping_t *s_pPendingMappingsByGUID[SDL_CONTROLLER_MAPPING_BUCKETS] SDL_GUARDED_BY(SDL_joystick_lock);
+static int s_nPendingMappings SDL_GUARDED_BY(SDL_joystick_lock) = 0;
+static int s_nBuiltinMappings SDL_GUARDED_BY(SDL_joystick_lock) = 0;
+static int s_iLoadingBuiltinMapping SDL_GUARDED_BY(SDL_joystick_lock) = -1;
+static Uint32 s_unNextMappingOrder SDL_GUARDED_BY(SDL_joystick_lock) = 0;
+static ControllerMapping_t *s_pLastInsertedMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static ControllerMapping_t *s_pDefaultMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static ControllerMapping_t *s_pXInputMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static char gamecontroller_magic;
 
+/* Open controllers indexed by joystick instance ID */
+#define SDL_CONTROLLER_INSTANCE_BUCKETS 16
+
+static SDL_GameController *SDL_gamecontrollers_by_id[SDL_CONTROLLER_INSTANCE_BUCKETS] SDL_GUARDED_BY(SDL_joystick_lock);
+
 #define _guarded SDL_GUARDED_BY(SDL_joystick_lock)
 
 /* The SDL game controller structure */
@@ -144,7 +180,17 @@ struct _SDL_GameController
     Uint8 *last_hat_mask _guarded;
     Uint32 guide_button_down _guarded;
 
+    /* The bindings for each joystick input, in mapping order. The bindings
+       for axis N are input_bindings[axis_bindings[N]] up to, but not
+       including, input_bindings[axis_bindings[N + 1]], and the same for
+       buttons and hats. */
+    SDL_ExtendedGameControllerBind **input_bindings _guarded;
+    int *axis_bindings _guarded;
+    int *button_bindings _guarded;
+    int *hat_bindings _guarded;
+
     struct _SDL_GameController *next _guarded; /* pointer to next game controller we have allocated */
+    struct _SDL_GameController *next_by_instance_id _guarded;
 };
 
 #undef _guarded
@@ -198,29 +244,31 @@ static void ResetOutput(SDL_GameController *gamecontroller, SDL_ExtendedGameCont
 
 static void HandleJoystickAxis(SDL_GameController *gamecontroller, int axis, int value)
 {
-    int i;
+    int i, end;
     SDL_ExtendedGameControllerBind *last_match;
     SDL_ExtendedGameControllerBind *match = NULL;
 
     SDL_AssertJoysticksLocked();
 
+    if (!gamecontroller->axis_bindings) {
+        return;
+    }
+
     last_match = gamecontroller->last_match_axis[axis];
-    for (i = 0; i < gamecontroller->num_bindings; ++i) {
-        SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
-        if (binding->inputType == SDL_CONTROLLER_BINDTYPE_AXIS &&
-            axis == binding->input.axis.axis) {
-            if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
-                if (value >= binding->input.axis.axis_min &&
-                    value <= binding->input.axis.axis_max) {
-                    match = binding;
-                    break;
-                }
-            } else {
-                if (value >= binding->input.axis.axis_max &&
-                    value <= binding->input.axis.axis_min) {
-                    match = binding;
-                    break;
-                }
+    end = gamecontroller->axis_bindings[axis + 1];
+    for (i = gamecontroller->axis_bindings[axis]; i < end; ++i) {
+        SDL_ExtendedGameControllerBind *binding = gamecontroller->input_bindings[i];
+        if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
+            if (value >= binding->input.axis.axis_min &&
+                value <= binding->input.axis.axis_max) {
+                match = binding;
+                break;
+            }
+        } else {
+            if (value >= binding->input.axis.axis_max &&
+                value <= binding->input.axis.axis_min) {
+                match = binding;
+                break;
             }
         }
     }
@@ -253,47 +301,50 @@ static void HandleJoystickAxis(SDL_GameController *gamecontroller, int axis, int
 
 static void HandleJoystickButton(SDL_GameController *gamecontroller, int button, Uint8 state)
 {
-    int i;
+    SDL_ExtendedGameControllerBind *binding;
 
     SDL_AssertJoysticksLocked();
 
-    for (i = 0; i < gamecontroller->num_bindings; ++i) {
-        SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
-        if (binding->inputType == SDL_CONTROLLER_BINDTYPE_BUTTON &&
-            button == binding->input.button) {
-            if (binding->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
-                int value = state ? binding->output.axis.axis_max : binding->output.axis.axis_min;
-                SDL_PrivateGameControllerAxis(gamecontroller, binding->output.axis.axis, (Sint16)value);
-            } else {
-                SDL_PrivateGameControllerButton(gamecontroller, binding->output.button, state);
-            }
-            break;
-        }
+    if (!gamecontroller->button_bindings ||
+        gamecontroller->button_bindings[button] == gamecontroller->button_bindings[button + 1]) {
+        return;
+    }
+
+    /* Only the first binding for a button is used */
+    binding = gamecontroller->input_bindings[gamecontroller->button_bindings[button]];
+    if (binding->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
+        int value = state ? binding->output.axis.axis_max : binding->output.axis.axis_min;
+        SDL_PrivateGameControllerAxis(gamecontroller, binding->output.axis.axis, (Sint16)value);
+    } else {
+        SDL_PrivateGameControllerButton(gamecontroller, binding->output.button, state);
     }
 }
 
 static void HandleJoystickHat(SDL_GameController *gamecontroller, int hat, Uint8 value)
 {
-    int i;
+    int i, end;
     Uint8 last_mask, changed_mask;
 
     SDL_AssertJoysticksLocked();
 
+    if (!gamecontroller->hat_bindings) {
+        return;
+    }
+
     last_mask = gamecontroller->last_hat_mask[hat];
     changed_mask = (last_mask ^ value);
-    for (i = 0; i < gamecontroller->num_bindings; ++i) {
-        SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
-        if (binding->inputType == SDL_CONTROLLER_BINDTYPE_HAT && hat == binding->input.hat.hat) {
-            if ((changed_mask & binding->input.hat.hat_mask) != 0) {
-                if (value & binding->input.hat.hat_mask) {
-                    if (binding->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
-                        SDL_PrivateGameControllerAxis(gamecontroller, binding->output.axis.axis, (Sint16)binding->output.axis.axis_max);
-                    } else {
-                        SDL_PrivateGameControllerButton(gamecontroller, binding->output.button, SDL_PRESSED);
-                    }
+    end = gamecontroller->hat_bindings[hat + 1];
+    for (i = gamecontroller->hat_bindings[hat]; i < end; ++i) {
+        SDL_ExtendedGameControllerBind *binding = gamecontroller->input_bindings[i];
+        if ((changed_mask & binding->input.hat.hat_mask) != 0) {
+            if (value & binding->input.hat.hat_mask) {
+                if (binding->outputType == SDL_CONTROLLER_BINDTYPE_AXIS) {
+                    SDL_PrivateGameControllerAxis(gamecontroller, binding->output.axis.axis, (Sint16)binding->output.axis.axis_max);
                 } else {
-                    ResetOutput(gamecontroller, binding);
+                    SDL_PrivateGameControllerButton(gamecontroller, binding->output.button, SDL_PRESSED);
                 }
+            } else {
+                ResetOutput(gamecontroller, binding);
             }
         }
     }
@@ -324,6 +375,22 @@ static void RecenterGameController(SDL_GameController *gamecontroller)
     }
 }
 
+static SDL_GameController *SDL_PrivateGetGameControllerForInstanceID(SDL_JoystickID instance_id)
+{
+    SDL_GameController *controller;
+
+    SDL_AssertJoysticksLocked();
+
+    controller = SDL_gamecontrollers_by_id[(Uint32)instance_id % SDL_CONTROLLER_INSTANCE_BUCKETS];
+    while (controller) {
+        if (controller->joystick->instance_id == instance_id) {
+            return controller;
+        }
+        controller = controller->next_by_instance_id;
+    }
+    return NULL;
+}
+
 /*
  * Event filter to fire controller events from joystick ones
  */
@@ -336,11 +403,9 @@ static int SDLCALL SDL_GameControllerEventWatcher(void *userdata, SDL_Event *eve
     {
         SDL_AssertJoysticksLocked();
 
-        for (controller = SDL_gamecontrollers; controller; controller = controller->next) {
-            if (controller->joystick->instance_id == event->jaxis.which) {
-                HandleJoystickAxis(controller, event->jaxis.axis, event->jaxis.value);
-                break;
-            }
+        controller = SDL_PrivateGetGameControllerForInstanceID(event->jaxis.which);
+        if (controller) {
+            HandleJoystickAxis(controller, event->jaxis.axis, event->jaxis.value);
         }
     } break;
     case SDL_JOYBUTTONDOWN:
@@ -348,22 +413,18 @@ static int SDLCALL SDL_GameControllerEventWatcher(void *userdata, SDL_Event *eve
     {
         SDL_AssertJoysticksLocked();
 
-        for (controller = SDL_gamecontrollers; controller; controller = controller->next) {
-            if (controller->joystick->instance_id == event->jbutton.which) {
-                HandleJoystickButton(controller, event->jbutton.button, event->jbutton.state);
-                break;
-            }
+        controller = SDL_PrivateGetGameControllerForInstanceID(event->jbutton.which);
+        if (controller) {
+            HandleJoystickButton(controller, event->jbutton.button, event->jbutton.state);
         }
     } break;
     case SDL_JOYHATMOTION:
     {
         SDL_AssertJoysticksLocked();
 
-        for (controller = SDL_gamecontrollers; controller; controller = controller->next) {
-            if (controller->joystick->instance_id == event->jhat.which) {
-                HandleJoystickHat(controller, event->jhat.hat, event->jhat.value);
-                break;
-            }
+        controller = SDL_PrivateGetGameControllerForInstanceID(event->jhat.which);
+        if (controller) {
+            HandleJoystickHat(controller, event->jhat.hat, event->jhat.value);
         }
     } break;
     case SDL_JOYDEVICEADDED:
@@ -379,11 +440,9 @@ static int SDLCALL SDL_GameControllerEventWatcher(void *userdata, SDL_Event *eve
     {
         SDL_AssertJoysticksLocked();
 
-        for (controller = SDL_gamecontrollers; controller; controller = controller->next) {
-            if (controller->joystick->instance_id == event->jdevice.which) {
-                RecenterGameController(controller);
-                break;
-            }
+        controller = SDL_PrivateGetGameControllerForInstanceID(event->jdevice.which);
+        if (controller) {
+            RecenterGameController(controller);
         }
 
         /* We don't know if this was a game controller, so go ahead and send an event */
@@ -685,6 +744,167 @@ static ControllerMapping_t *SDL_CreateMappingForWGIController(SDL_JoystickGUID g
     return SDL_PrivateAddMappingForGUID(guid, mapping_string, &existing, SDL_CONTROLLER_MAPPING_PRIORITY_DEFAULT);
 }
 
+static Uint32 SDL_PrivateHashControllerGUID(SDL_JoystickGUID guid)
+{
+    /* FNV-1a */
+    Uint32 hash = 2166136261u;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(guid.data); ++i) {
+        hash ^= guid.data[i];
+        hash *= 16777619u;
+    }
+    return hash % SDL_CONTROLLER_MAPPING_BUCKETS;
+}
+
+static SDL_JoystickGUID SDL_PrivateGetVersionlessGUID(SDL_JoystickGUID guid)
+{
+    SDL_SetJoystickGUIDCRC(&guid, 0);
+    SDL_SetJoystickGUIDVersion(&guid, 0);
+    return guid;
+}
+
+/*
+ * Helper function to add a mapping to the GUID indices
+ */
+static void SDL_PrivateIndexControllerMapping(ControllerMapping_t *mapping)
+{
+    ControllerMapping_t **link;
+
+    SDL_AssertJoysticksLocked();
+
+    if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
+        /* These mappings are never matched by GUID */
+        return;
+    }
+
+    /* Chains are kept in mapping order so earlier mappings match first */
+    link = &s_pMappingsByGUID[SDL_PrivateHashControllerGUID(mapping->guid)];
+    while (*link && (*link)->order < mapping->order) {
+        link = &(*link)->next_by_guid;
+    }
+    mapping->next_by_guid = *link;
+    *link = mapping;
+
+    link = &s_pMappingsByGUIDNoVersion[SDL_PrivateHashControllerGUID(SDL_PrivateGetVersionlessGUID(mapping->guid))];
+    while (*link && (*link)->order < mapping->order) {
+        link = &(*link)->next_by_guid_noversion;
+    }
+    mapping->next_by_guid_noversion = *link;
+    *link = mapping;
+}
+
+/*
+ * Helper function to add a new mapping to the list and the GUID indices
+ */
+static void SDL_PrivateInsertControllerMapping(ControllerMapping_t *mapping)
+{
+    ControllerMapping_t **link;
+
+    SDL_AssertJoysticksLocked();
+
+    if (!s_pSupportedControllersTail || s_pSupportedControllersTail->order < mapping->order) {
+        /* Add the mapping to the end of the list */
+        if (s_pSupportedControllersTail) {
+            s_pSupportedControllersTail->next = mapping;
+        } else {
+            s_pSupportedControllers = mapping;
+        }
+        s_pSupportedControllersTail = mapping;
+    } else {
+        /* A built-in mapping parsed after later mappings were added. Pending
+           mappings are mostly parsed in database order, so start the search
+           after the last one we inserted when we can. */
+        if (s_pLastInsertedMapping && s_pLastInsertedMapping->order < mapping->order) {
+            link = &s_pLastInsertedMapping->next;
+        } else {
+            link = &s_pSupportedControllers;
+        }
+        while ((*link)->order < mapping->order) {
+            link = &(*link)->next;
+        }
+        mapping->next = *link;
+        *link = mapping;
+    }
+    s_pLastInsertedMapping = mapping;
+
+    SDL_PrivateIndexControllerMapping(mapping);
+}
+
+static int SDL_PrivateGameControllerAddMapping(const char *mappingString, SDL_ControllerMappingPriority priority);
+
+/*
+ * Helper function to parse a built-in mapping, keeping its place in the database order
+ */
+static void SDL_PrivateAddBuiltinMapping(int index, const char *mappingString)
+{
+    const int previous = s_iLoadingBuiltinMapping;
+
+    SDL_AssertJoysticksLocked();
+
+    s_iLoadingBuiltinMapping = index;
+    SDL_PrivateGameControllerAddMapping(mappingString, SDL_CONTROLLER_MAPPING_PRIORITY_DEFAULT);
+    s_iLoadingBuiltinMapping = previous;
+}
+
+/*
+ * Helper function to parse the built-in mappings that could match a GUID
+ */
+static void SDL_PrivateLoadPendingMappingsForGUID(SDL_JoystickGUID guid)
+{
+    PendingControllerMapping_t **link;
+    PendingControllerMapping_t *matches = NULL;
+    PendingControllerMapping_t **matches_tail = &matches;
+
+    SDL_AssertJoysticksLocked();
+
+    if (!s_nPendingMappings) {
+        return;
+    }
+
+    /* Unlink all of them before adding any, adding a mapping looks up this GUID again */
+    guid = SDL_PrivateGetVersionlessGUID(guid);
+    link = &s_pPendingMappingsByGUID[SDL_PrivateHashControllerGUID(guid)];
+    while (*link) {
+        PendingControllerMapping_t *pending = *link;
+        if (SDL_memcmp(&pending->guid, &guid, sizeof(guid)) == 0) {
+            *link = pending->next;
+            pending->next = NULL;
+            *matches_tail = pending;
+            matches_tail = &pending->next;
+            --s_nPendingMappings;
+        } else {
+            link = &pending->next;
+        }
+    }
+
+    /* Then add them in database order */
+    while (matches) {
+        PendingControllerMapping_t *pending = matches;
+        const char *mapping = pending->mapping;
+
+        matches = pending->next;
+        pending->mapping = NULL;
+        SDL_PrivateAddBuiltinMapping((int)(pending - s_pPendingMappings), mapping);
+    }
+}
+
+/*
+ * Helper function to parse all the remaining built-in mappings
+ */
+static void SDL_PrivateLoadPendingMappings(void)
+{
+    int i;
+
+    SDL_AssertJoysticksLocked();
+
+    for (i = 0; s_nPendingMappings && i < s_nBuiltinMappings; ++i) {
+        if (s_pPendingMappings[i].mapping) {
+            SDL_PrivateLoadPendingMappingsForGUID(s_pPendingMappings[i].guid);
+        }
+    }
+}
+
 /*
  * Helper function to scan the mappings database for a controller with the specified GUID
  */
@@ -695,6 +915,8 @@ static ControllerMapping_t *SDL_PrivateMatchControllerMappingForGUID(SDL_Joystic
 
     SDL_AssertJoysticksLocked();
 
+    SDL_PrivateLoadPendingMappingsForGUID(guid);
+
     SDL_GetJoystickGUIDInfo(guid, NULL, NULL, NULL, &crc);
 
     /* Clear the CRC from the GUID for matching, the mappings never include it in the GUID */
@@ -702,15 +924,14 @@ static ControllerMapping_t *SDL_PrivateMatchControllerMappingForGUID(SDL_Joystic
 
     if (!match_version) {
         SDL_SetJoystickGUIDVersion(&guid, 0);
+        mapping = s_pMappingsByGUIDNoVersion[SDL_PrivateHashControllerGUID(guid)];
+    } else {
+        mapping = s_pMappingsByGUID[SDL_PrivateHashControllerGUID(guid)];
     }
 
-    for (mapping = s_pSupportedControllers; mapping; mapping = mapping->next) {
+    while (mapping) {
         SDL_JoystickGUID mapping_guid;
 
-        if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
-            continue;
-        }
-
         SDL_memcpy(&mapping_guid, &mapping->guid, sizeof(mapping_guid));
         if (!match_version) {
             SDL_SetJoystickGUIDVersion(&mapping_guid, 0);
@@ -721,20 +942,18 @@ static ControllerMapping_t *SDL_PrivateMatchControllerMappingForGUID(SDL_Joystic
             if (crc_string) {
                 Uint16 mapping_crc = (Uint16)SDL_strtol(crc_string + SDL_CONTROLLER_CRC_FIELD_SIZE, NULL, 16);
 
-                if (mapping_crc != crc) {
-                    /* This mapping specified a CRC and they don't match */
-                    continue;
+                if (mapping_crc == crc) {
+                    /* An exact match, including CRC */
+                    return mapping;
                 }
 
-                /* An exact match, including CRC */
-                return mapping;
-            }
-
-
-            if (!best_match) {
+                /* This mapping specified a CRC and they don't match */
+            } else if (!best_match) {
                 best_match = mapping;
             }
         }
+
+        mapping = match_version ? mapping->next_by_guid : mapping->next_by_guid_noversion;
     }
     return best_match;
 }
@@ -1101,6 +1320,65 @@ static void SDL_UpdateGameControllerType(SDL_GameController *gamecontroller)
     }
 }
 
+/*
+ * Helper function to add the bindings for one type of joystick input to the table,
+ * grouped by input, and fill in where each input's bindings start
+ */
+static int SDL_PrivateBuildBindingTable(SDL_GameController *gamecontroller, SDL_GameControllerBindType type, int num_inputs, int *offsets, int count)
+{
+    int input, i;
+
+    for (input = 0; input < num_inputs; ++input) {
+        offsets[input] = count;
+        for (i = 0; i < gamecontroller->num_bindings; ++i) {
+            SDL_ExtendedGameControllerBind *binding = &gamecontroller->bindings[i];
+            if (binding->inputType != type) {
+                continue;
+            }
+            if ((type == SDL_CONTROLLER_BINDTYPE_AXIS && binding->input.axis.axis == input) ||
+                (type == SDL_CONTROLLER_BINDTYPE_BUTTON && binding->input.button == input) ||
+                (type == SDL_CONTROLLER_BINDTYPE_HAT && binding->input.hat.hat == input)) {
+                gamecontroller->input_bindings[count++] = binding;
+            }
+        }
+    }
+    offsets[num_inputs] = count;
+    return count;
+}
+
+/*
+ * Helper function to build the tables from joystick inputs to bindings
+ */
+static void SDL_PrivateBuildBindingTables(SDL_GameController *gamecontroller)
+{
+    SDL_Joystick *joystick = gamecontroller->joystick;
+    size_t num_offsets = (size_t)joystick->naxes + 1 + joystick->nbuttons + 1 + joystick->nhats + 1;
+    void *tables;
+    int count;
+
+    SDL_AssertJoysticksLocked();
+
+    /* The bindings are stored first, followed by the offsets for each input type */
+    tables = SDL_realloc(gamecontroller->input_bindings, gamecontroller->num_bindings * sizeof(*gamecontroller->input_bindings) + num_offsets * sizeof(int));
+    if (!tables) {
+        SDL_free(gamecontroller->input_bindings);
+        gamecontroller->input_bindings = NULL;
+        gamecontroller->axis_bindings = NULL;
+        gamecontroller->button_bindings = NULL;
+        gamecontroller->hat_bindings = NULL;
+        SDL_OutOfMemory();
+        return;
+    }
+    gamecontroller->input_bindings = (SDL_ExtendedGameControllerBind **)tables;
+    gamecontroller->axis_bindings = (int *)(gamecontroller->input_bindings + gamecontroller->num_bindings);
+    gamecontroller->button_bindings = gamecontroller->axis_bindings + joystick->naxes + 1;
+    gamecontroller->hat_bindings = gamecontroller->button_bindings + joystick->nbuttons + 1;
+
+    count = SDL_PrivateBuildBindingTable(gamecontroller, SDL_CONTROLLER_BINDTYPE_AXIS, joystick->naxes, gamecontroller->axis_bindings, 0);
+    count = SDL_PrivateBuildBindingTable(gamecontroller, SDL_CONTROLLER_BINDTYPE_BUTTON, joystick->nbuttons, gamecontroller->button_bindings, count);
+    SDL_PrivateBuildBindingTable(gamecontroller, SDL_CONTROLLER_BINDTYPE_HAT, joystick->nhats, gamecontroller->hat_bindings, count);
+}
+
 /*
  * Make a new button mapping struct
  */
@@ -1119,6 +1397,8 @@ static void SDL_PrivateLoadButtonMapping(SDL_GameController *gamecontroller, Con
 
     SDL_PrivateGameControllerParseControllerConfigString(gamecontroller, pControllerMapping->mapping);
 
+    SDL_PrivateBuildBindingTables(gamecontroller);
+
     SDL_UpdateGameControllerType(gamecontroller);
 
     /* Set the zero point for triggers */
@@ -1136,6 +1416,31 @@ static void SDL_PrivateLoadButtonMapping(SDL_GameController *gamecontroller, Con
     }
 }
 
+/*
+ * convert an old style guid string from a mapping string in place
+ */
+static void SDL_PrivateFixupControllerGUIDString(char *pchGUID)
+{
+    /* Convert old style GUIDs to the new style in 2.0.5 */
+#if defined(__WIN32__) || defined(__WINGDK__)
+    if (SDL_strlen(pchGUID) == 32 &&
+        SDL_memcmp(&pchGUID[20], "504944564944", 12) == 0) {
+        SDL_memcpy(&pchGUID[20], "000000000000", 12);
+        SDL_memcpy(&pchGUID[16], &pchGUID[4], 4);
+        SDL_memcpy(&pchGUID[8], &pchGUID[0], 4);
+        SDL_memcpy(&pchGUID[0], "03000000", 8);
+    }
+#elif defined(__MACOSX__)
+    if (SDL_strlen(pchGUID) == 32 &&
+        SDL_memcmp(&pchGUID[4], "000000000000", 12) == 0 &&
+        SDL_memcmp(&pchGUID[20], "000000000000", 12) == 0) {
+        SDL_memcpy(&pchGUID[20], "000000000000", 12);
+        SDL_memcpy(&pchGUID[8], &pchGUID[0], 4);
+        SDL_memcpy(&pchGUID[0], "03000000", 8);
+    }
+#endif
+}
+
 /*
  * grab the guid string from a mapping string
  */
@@ -1150,25 +1455,7 @@ static char *SDL_PrivateGetControllerGUIDFromMappingString(const char *pMapping)
         }
         SDL_memcpy(pchGUID, pMapping, pFirstComma - pMapping);
         pchGUID[pFirstComma - pMapping] = '\0';
-
-        /* Convert old style GUIDs to the new style in 2.0.5 */
-#if defined(__WIN32__) || defined(__WINGDK__)
-        if (SDL_strlen(pchGUID) == 32 &&
-            SDL_memcmp(&pchGUID[20], "504944564944", 12) == 0) {
-            SDL_memcpy(&pchGUID[20], "000000000000", 12);
-            SDL_memcpy(&pchGUID[16], &pchGUID[4], 4);
-            SDL_memcpy(&pchGUID[8], &pchGUID[0], 4);
-            SDL_memcpy(&pchGUID[0], "03000000", 8);
-        }
-#elif defined(__MACOSX__)
-        if (SDL_strlen(pchGUID) == 32 &&
-            SDL_memcmp(&pchGUID[4], "000000000000", 12) == 0 &&
-            SDL_memcmp(&pchGUID[20], "000000000000", 12) == 0) {
-            SDL_memcpy(&pchGUID[20], "000000000000", 12);
-            SDL_memcpy(&pchGUID[8], &pchGUID[0], 4);
-            SDL_memcpy(&pchGUID[0], "03000000", 8);
-        }
-#endif
+        SDL_PrivateFixupControllerGUIDString(pchGUID);
         return pchGUID;
     }
     return NULL;
@@ -1336,20 +1623,13 @@ static ControllerMapping_t *SDL_PrivateAddMappingForGUID(SDL_JoystickGUID jGUID,
         pControllerMapping->mapping = pchMapping;
         pControllerMapping->next = NULL;
         pControllerMapping->priority = priority;
-
-        if (s_pSupportedControllers) {
-            /* Add the mapping to the end of the list */
-            ControllerMapping_t *pCurrMapping, *pPrevMapping;
-
-            for (pPrevMapping = s_pSupportedControllers, pCurrMapping = pPrevMapping->next;
-                 pCurrMapping;
-                 pPrevMapping = pCurrMapping, pCurrMapping = pCurrMapping->next) {
-                /* continue; */
-            }
-            pPrevMapping->next = pControllerMapping;
+        if (s_iLoadingBuiltinMapping >= 0) {
+            pControllerMapping->order = (Uint32)s_iLoadingBuiltinMapping;
         } else {
-            s_pSupportedControllers = pControllerMapping;
+            pControllerMapping->order = s_unNextMappingOrder++;
         }
+
+        SDL_PrivateInsertControllerMapping(pControllerMapping);
         *existing = SDL_FALSE;
     }
     return pControllerMapping;
@@ -1701,6 +1981,8 @@ int SDL_GameControllerNumMappings(void)
     {
         ControllerMapping_t *mapping;
 
+        SDL_PrivateLoadPendingMappings();
+
         for (mapping = s_pSupportedControllers; mapping; mapping = mapping->next) {
             if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
                 continue;
@@ -1776,6 +2058,8 @@ char *SDL_GameControllerMappingForIndex(int mapping_index)
     {
         ControllerMapping_t *mapping;
 
+        SDL_PrivateLoadPendingMappings();
+
         for (mapping = s_pSupportedControllers; mapping; mapping = mapping->next) {
             if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
                 continue;
@@ -1883,6 +2167,46 @@ static SDL_bool SDL_GetControllerMappingFilePath(char *path, size_t size)
 #endif
 }
 
+/*
+ * Helper function to defer parsing a built-in mapping, returns SDL_FALSE if it should be added now
+ */
+static SDL_bool SDL_PrivateAddPendingMapping(PendingControllerMapping_t *pending, const char *pMappingString)
+{
+    const char *pFirstComma = SDL_strchr(pMappingString, ',');
+    char pchGUID[33];
+    PendingControllerMapping_t **link;
+
+    SDL_AssertJoysticksLocked();
+
+    if (!pFirstComma || (pFirstComma - pMappingString) != 32) {
+        /* This is a special mapping like "default" or "xinput" */
+        return SDL_FALSE;
+    }
+    if (SDL_strstr(pMappingString, SDL_CONTROLLER_HINT_FIELD)) {
+        /* Hints should be checked when the mapping database is loaded */
+        return SDL_FALSE;
+    }
+    SDL_memcpy(pchGUID, pMappingString, 32);
+    pchGUID[32] = '\0';
+    SDL_PrivateFixupControllerGUIDString(pchGUID);
+
+    pending->mapping = pMappingString;
+    pending->guid = SDL_PrivateGetVersionlessGUID(SDL_JoystickGetGUIDFromString(pchGUID));
+    pending->next = NULL;
+    if (SDL_memcmp(&pending->guid, &s_zeroGUID, sizeof(pending->guid)) == 0) {
+        return SDL_FALSE;
+    }
+
+    /* Keep the database order within each bucket */
+    link = &s_pPendingMappingsByGUID[SDL_PrivateHashControllerGUID(pending->guid)];
+    while (*link) {
+        link = &(*link)->next;
+    }
+    *link = pending;
+    ++s_nPendingMappings;
+    return SDL_TRUE;
+}
+
 /*
  * Initialize the game controller system, mostly load our DB of controller config mappings
  */
@@ -1894,9 +2218,27 @@ int SDL_GameControllerInitMappings(void)
 
     SDL_AssertJoysticksLocked();
 
+    /* The built-in mappings are parsed when a controller with a matching
+       GUID is first looked up, so just index them by GUID here. */
+    while (s_ControllerMappings[i]) {
+        i++;
+    }
+    s_nBuiltinMappings = i;
+    s_unNextMappingOrder = (Uint32)i;
+    s_pPendingMappings = (PendingControllerMapping_t *)SDL_malloc(i * sizeof(*s_pPendingMappings));
+    if (!s_pPendingMappings) {
+        s_nBuiltinMappings = 0;
+    }
+
+    i = 0;
     pMappingString = s_ControllerMappings[i];
     while (pMappingString) {
-        SDL_PrivateGameControllerAddMapping(pMappingString, SDL_CONTROLLER_MAPPING_PRIORITY_DEFAULT);
+        if (!s_pPendingMappings || !SDL_PrivateAddPendingMapping(&s_pPendingMappings[i], pMappingString)) {
+            if (s_pPendingMappings) {
+                s_pPendingMappings[i].mapping = NULL;
+            }
+            SDL_PrivateAddBuiltinMapping(i, pMappingString);
+        }
 
         i++;
         pMappingString = s_ControllerMappings[i];
@@ -2153,22 +2495,18 @@ SDL_GameController *SDL_GameControllerOpen(int joystick_index)
 {
     SDL_JoystickID instance_id;
     SDL_GameController *gamecontroller;
-    SDL_GameController *gamecontrollerlist;
+    SDL_GameController **bucket;
     ControllerMapping_t *pSupportedController = NULL;
 
     SDL_LockJoysticks();
 
-    gamecontrollerlist = SDL_gamecontrollers;
     /* If the controller is already open, return it */
     instance_id = SDL_JoystickGetDeviceInstanceID(joystick_index);
-    while (gamecontrollerlist) {
-        if (instance_id == gamecontrollerlist->joystick->instance_id) {
-            gamecontroller = gamecontrollerlist;
-            ++gamecontroller->ref_count;
-            SDL_UnlockJoysticks();
-            return gamecontroller;
-        }
-        gamecontrollerlist = gamecontrollerlist->next;
+    gamecontroller = SDL_PrivateGetGameControllerForInstanceID(instance_id);
+    if (gamecontroller) {
+        ++gamecontroller->ref_count;
+        SDL_UnlockJoysticks();
+        return gamecontroller;
     }
 
     /* Find a controller mapping */
@@ -2224,6 +2562,9 @@ SDL_GameController *SDL_GameControllerOpen(int joystick_index)
     /* Link the controller in the list */
     gamecontroller->next = SDL_gamecontrollers;
     SDL_gamecontrollers = gamecontroller;
+    bucket = &SDL_gamecontrollers_by_id[(Uint32)instance_id % SDL_CONTROLLER_INSTANCE_BUCKETS];
+    gamecontroller->next_by_instance_id = *bucket;
+    *bucket = gamecontroller;
 
     SDL_UnlockJoysticks();
 
@@ -2821,16 +3162,9 @@ SDL_GameController *SDL_GameControllerFromInstanceID(SDL_JoystickID joyid)
     SDL_GameController *gamecontroller;
 
     SDL_LockJoysticks();
-    gamecontroller = SDL_gamecontrollers;
-    while (gamecontroller) {
-        if (gamecontroller->joystick->instance_id == joyid) {
-            SDL_UnlockJoysticks();
-            return gamecontroller;
-        }
-        gamecontroller = gamecontroller->next;
-    }
+    gamecontroller = SDL_PrivateGetGameControllerForInstanceID(joyid);
     SDL_UnlockJoysticks();
-    return NULL;
+    return gamecontroller;
 }
 
 /**
@@ -3000,6 +3334,7 @@ int SDL_GameControllerSendEffect(SDL_GameController *gamecontroller, const void
 void SDL_GameControllerClose(SDL_GameController *gamecontroller)
 {
     SDL_GameController *gamecontrollerlist, *gamecontrollerlistprev;
+    SDL_GameController **bucket;
 
     SDL_LockJoysticks();
 
@@ -3014,6 +3349,16 @@ void SDL_GameControllerClose(SDL_GameController *gamecontroller)
         return;
     }
 
+    /* Unlink it before the joystick is closed, the instance ID is the key */
+    bucket = &SDL_gamecontrollers_by_id[(Uint32)gamecontroller->joystick->instance_id % SDL_CONTROLLER_INSTANCE_BUCKETS];
+    while (*bucket) {
+        if (*bucket == gamecontroller) {
+            *bucket = gamecontroller->next_by_instance_id;
+            break;
+        }
+        bucket = &(*bucket)->next_by_instance_id;
+    }
+
     SDL_JoystickClose(gamecontroller->joystick);
 
     gamecontrollerlist = SDL_gamecontrollers;
@@ -3034,6 +3379,7 @@ void SDL_GameControllerClose(SDL_GameController *gamecontroller)
 
     gamecontroller->magic = NULL;
     SDL_free(gamecontroller->bindings);
+    SDL_free(gamecontroller->input_bindings);
     SDL_free(gamecontroller->last_match_axis);
     SDL_free(gamecontroller->last_hat_mask);
     SDL_free(gamecontroller);
@@ -3067,6 +3413,17 @@ void SDL_GameControllerQuitMappings(void)
         SDL_free(pControllerMap->mapping);
         SDL_free(pControllerMap);
     }
+    s_pSupportedControllersTail = NULL;
+    s_pLastInsertedMapping = NULL;
+    s_unNextMappingOrder = 0;
+    SDL_zeroa(s_pMappingsByGUID);
+    SDL_zeroa(s_pMappingsByGUIDNoVersion);
+
+    SDL_free(s_pPendingMappings);
+    s_pPendingMappings = NULL;
+    SDL_zeroa(s_pPendingMappingsByGUID);
+    s_nPendingMappings = 0;
+    s_nBuiltinMappings = 0;
 
     SDL_DelEventWatch(SDL_GameControllerEventWatcher, NULL);
 
@@ -616,6 +616,7 @@ int SDL_JoystickInit(void)
     /* Create the joystick list lock */
     if (SDL_joystick_lock == NULL) {
         SDL_joystick_lock = SDL_CreateMutex();
+        SDL_SetLockName(SDL_joystick_lock, "SDL_joystick_lock");
     }
 
 #ifndef SDL_EVENTS_DISABLED
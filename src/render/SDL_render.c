@@ -28,6 +28,8 @@
 #include "SDL_sysrender.h"
 #include "software/SDL_render_sw_c.h"
 #include "../video/SDL_pixels_c.h"
+#include "../SDL_scratch_c.h"
+#include "../SDL_hints_c.h"
 
 #if defined(__ANDROID__)
 #include "../core/android/SDL_android.h"
@@ -526,10 +528,9 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
 
     if (cmd) {
         if (use_rendergeometry) {
-            SDL_bool isstack1;
-            SDL_bool isstack2;
-            float *xy = SDL_small_alloc(float, 4 * 2 * count, &isstack1);
-            int *indices = SDL_small_alloc(int, 6 * count, &isstack2);
+            const size_t scratch = SDL_GetScratchMark();
+            float *xy = (float *)SDL_AllocScratch(4 * 2 * count * sizeof(*xy));
+            int *indices = (int *)SDL_AllocScratch(6 * count * sizeof(*indices));
 
             if (xy && indices) {
                 int i;
@@ -577,8 +578,7 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
                     cmd->command = SDL_RENDERCMD_NO_OP;
                 }
             }
-            SDL_small_free(xy, isstack1);
-            SDL_small_free(indices, isstack2);
+            SDL_ReleaseScratch(scratch);
 
         } else {
             retval = renderer->QueueFillRects(renderer, cmd, rects, count);
@@ -677,6 +677,26 @@ static void GetWindowViewportValues(SDL_Renderer *renderer, int *logical_w, int
     SDL_UnlockMutex(renderer->target_mutex);
 }
 
+static void SDL_CalculateSimulatedVSyncInterval(SDL_Renderer *renderer, SDL_Window *window)
+{
+    /* FIXME: SDL refresh rate API should return numerator/denominator */
+    int refresh_rate = 0;
+    int display_index = SDL_GetWindowDisplayIndex(window);
+    SDL_DisplayMode mode;
+
+    if (display_index < 0) {
+        display_index = 0;
+    }
+    if (SDL_GetDesktopDisplayMode(display_index, &mode) == 0) {
+        refresh_rate = mode.refresh_rate;
+    }
+    if (!refresh_rate) {
+        /* Pick a good default refresh rate */
+        refresh_rate = 60;
+    }
+    SDL_SetFramePacerRate(&renderer->vsync_pacer, refresh_rate, 1);
+}
+
 static int SDLCALL SDL_RendererEventWatch(void *userdata, SDL_Event *event)
 {
     SDL_Renderer *renderer = (SDL_Renderer *)userdata;
@@ -688,6 +708,11 @@ static int SDLCALL SDL_RendererEventWatch(void *userdata, SDL_Event *event)
                 renderer->WindowEvent(renderer, &event->window);
             }
 
+            if (event->window.event == SDL_WINDOWEVENT_DISPLAY_CHANGED) {
+                /* The new display may have a different refresh rate */
+                SDL_CalculateSimulatedVSyncInterval(renderer, window);
+            }
+
             /* In addition to size changes, we also want to do this block for
              * window display changes as well! If the new display has a new DPI,
              * we need to update the viewport for the new window/drawable ratio.
@@ -909,15 +934,16 @@ static SDL_INLINE void VerifyDrawQueueFunctions(const SDL_Renderer *renderer)
     SDL_assert(renderer->RunCommandQueue != NULL);
 }
 
+static int SDL_ParseRenderLineMethod(const char *hint)
+{
+    return hint ? SDL_atoi(hint) : 0;
+}
+
 static SDL_RenderLineMethod SDL_GetRenderLineMethod(void)
 {
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_LINE_METHOD);
+    static SDL_CachedHint hint = SDL_CACHED_HINT(SDL_HINT_RENDER_LINE_METHOD, SDL_ParseRenderLineMethod);
 
-    int method = 0;
-    if (hint) {
-        method = SDL_atoi(hint);
-    }
-    switch (method) {
+    switch (SDL_GetCachedHintValue(&hint)) {
     case 1:
         return SDL_RENDERLINEMETHOD_POINTS;
     case 2:
@@ -929,25 +955,6 @@ static SDL_RenderLineMethod SDL_GetRenderLineMethod(void)
     }
 }
 
-static void SDL_CalculateSimulatedVSyncInterval(SDL_Renderer *renderer, SDL_Window *window)
-{
-    /* FIXME: SDL refresh rate API should return numerator/denominator */
-    int refresh_rate = 0;
-    int display_index = SDL_GetWindowDisplayIndex(window);
-    SDL_DisplayMode mode;
-
-    if (display_index < 0) {
-        display_index = 0;
-    }
-    if (SDL_GetDesktopDisplayMode(display_index, &mode) == 0) {
-        refresh_rate = mode.refresh_rate;
-    }
-    if (!refresh_rate) {
-        /* Pick a good default refresh rate */
-        refresh_rate = 60;
-    }
-    renderer->simulate_vsync_interval = (1000 / refresh_rate);
-}
 #endif /* !SDL_RENDER_DISABLED */
 
 SDL_Renderer *SDL_CreateRenderer(SDL_Window *window, int index, Uint32 flags)
@@ -1241,10 +1248,8 @@ static Uint32 GetClosestSupportedFormat(SDL_Renderer *renderer, Uint32 format)
     return renderer->info.texture_formats[0];
 }
 
-static SDL_ScaleMode SDL_GetScaleMode(void)
+static int SDL_ParseScaleMode(const char *hint)
 {
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
-
     if (!hint || SDL_strcasecmp(hint, "nearest") == 0) {
         return SDL_ScaleModeNearest;
     } else if (SDL_strcasecmp(hint, "linear") == 0) {
@@ -1252,10 +1257,17 @@ static SDL_ScaleMode SDL_GetScaleMode(void)
     } else if (SDL_strcasecmp(hint, "best") == 0) {
         return SDL_ScaleModeBest;
     } else {
-        return (SDL_ScaleMode)SDL_atoi(hint);
+        return SDL_atoi(hint);
     }
 }
 
+static SDL_ScaleMode SDL_GetScaleMode(void)
+{
+    static SDL_CachedHint hint = SDL_CACHED_HINT(SDL_HINT_RENDER_SCALE_QUALITY, SDL_ParseScaleMode);
+
+    return (SDL_ScaleMode)SDL_GetCachedHintValue(&hint);
+}
+
 SDL_Texture *SDL_CreateTexture(SDL_Renderer *renderer, Uint32 format, int access, int w, int h)
 {
     SDL_Texture *texture;
@@ -2668,7 +2680,7 @@ static int RenderDrawPointsWithRects(SDL_Renderer *renderer,
                                      const SDL_Point *points, const int count)
 {
     int retval;
-    SDL_bool isstack;
+    size_t scratch;
     SDL_FRect *frects;
     int i;
 
@@ -2676,7 +2688,8 @@ static int RenderDrawPointsWithRects(SDL_Renderer *renderer,
         return 0;
     }
 
-    frects = SDL_small_alloc(SDL_FRect, count, &isstack);
+    scratch = SDL_GetScratchMark();
+    frects = (SDL_FRect *)SDL_AllocScratch(count * sizeof(*frects));
     if (!frects) {
         return SDL_OutOfMemory();
     }
@@ -2690,7 +2703,7 @@ static int RenderDrawPointsWithRects(SDL_Renderer *renderer,
 
     retval = QueueCmdFillRects(renderer, frects, count);
 
-    SDL_small_free(frects, isstack);
+    SDL_ReleaseScratch(scratch);
 
     return retval;
 }
@@ -2701,7 +2714,7 @@ int SDL_RenderDrawPoints(SDL_Renderer *renderer,
     SDL_FPoint *fpoints;
     int i;
     int retval;
-    SDL_bool isstack;
+    size_t scratch;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
@@ -2722,7 +2735,8 @@ int SDL_RenderDrawPoints(SDL_Renderer *renderer,
     if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
         retval = RenderDrawPointsWithRects(renderer, points, count);
     } else {
-        fpoints = SDL_small_alloc(SDL_FPoint, count, &isstack);
+        scratch = SDL_GetScratchMark();
+        fpoints = (SDL_FPoint *)SDL_AllocScratch(count * sizeof(*fpoints));
         if (!fpoints) {
             return SDL_OutOfMemory();
         }
@@ -2733,7 +2747,7 @@ int SDL_RenderDrawPoints(SDL_Renderer *renderer,
 
         retval = QueueCmdDrawPoints(renderer, fpoints, count);
 
-        SDL_small_free(fpoints, isstack);
+        SDL_ReleaseScratch(scratch);
     }
     return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
 }
@@ -2742,7 +2756,7 @@ static int RenderDrawPointsWithRectsF(SDL_Renderer *renderer,
                                       const SDL_FPoint *fpoints, const int count)
 {
     int retval;
-    SDL_bool isstack;
+    size_t scratch;
     SDL_FRect *frects;
     int i;
 
@@ -2750,7 +2764,8 @@ static int RenderDrawPointsWithRectsF(SDL_Renderer *renderer,
         return 0;
     }
 
-    frects = SDL_small_alloc(SDL_FRect, count, &isstack);
+    scratch = SDL_GetScratchMark();
+    frects = (SDL_FRect *)SDL_AllocScratch(count * sizeof(*frects));
     if (!frects) {
         return SDL_OutOfMemory();
     }
@@ -2764,7 +2779,7 @@ static int RenderDrawPointsWithRectsF(SDL_Renderer *renderer,
 
     retval = QueueCmdFillRects(renderer, frects, count);
 
-    SDL_small_free(frects, isstack);
+    SDL_ReleaseScratch(scratch);
 
     return retval;
 }
@@ -2825,7 +2840,7 @@ static int RenderDrawLineBresenham(SDL_Renderer *renderer, int x1, int y1, int x
     int x, xinc1, xinc2;
     int y, yinc1, yinc2;
     int retval;
-    SDL_bool isstack;
+    size_t scratch;
     SDL_FPoint *points;
     SDL_Rect clip_rect;
 
@@ -2879,7 +2894,8 @@ static int RenderDrawLineBresenham(SDL_Renderer *renderer, int x1, int y1, int x
         --numpixels;
     }
 
-    points = SDL_small_alloc(SDL_FPoint, numpixels, &isstack);
+    scratch = SDL_GetScratchMark();
+    points = (SDL_FPoint *)SDL_AllocScratch(numpixels * sizeof(*points));
     if (!points) {
         return SDL_OutOfMemory();
     }
@@ -2904,7 +2920,7 @@ static int RenderDrawLineBresenham(SDL_Renderer *renderer, int x1, int y1, int x
         retval = QueueCmdDrawPoints(renderer, points, numpixels);
     }
 
-    SDL_small_free(points, isstack);
+    SDL_ReleaseScratch(scratch);
 
     return retval;
 }
@@ -2918,11 +2934,12 @@ static int RenderDrawLinesWithRectsF(SDL_Renderer *renderer,
     SDL_FRect *frects;
     int i, nrects = 0;
     int retval = 0;
-    SDL_bool isstack;
+    size_t scratch;
     SDL_bool drew_line = SDL_FALSE;
     SDL_bool draw_last = SDL_FALSE;
 
-    frects = SDL_small_alloc(SDL_FRect, count - 1, &isstack);
+    scratch = SDL_GetScratchMark();
+    frects = (SDL_FRect *)SDL_AllocScratch((count - 1) * sizeof(*frects));
     if (!frects) {
         return SDL_OutOfMemory();
     }
@@ -2975,7 +2992,7 @@ static int RenderDrawLinesWithRectsF(SDL_Renderer *renderer,
         retval += QueueCmdFillRects(renderer, frects, nrects);
     }
 
-    SDL_small_free(frects, isstack);
+    SDL_ReleaseScratch(scratch);
 
     if (retval < 0) {
         retval = -1;
@@ -2989,7 +3006,7 @@ int SDL_RenderDrawLines(SDL_Renderer *renderer,
     SDL_FPoint *fpoints;
     int i;
     int retval;
-    SDL_bool isstack;
+    size_t scratch;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
@@ -3007,7 +3024,8 @@ int SDL_RenderDrawLines(SDL_Renderer *renderer,
     }
 #endif
 
-    fpoints = SDL_small_alloc(SDL_FPoint, count, &isstack);
+    scratch = SDL_GetScratchMark();
+    fpoints = (SDL_FPoint *)SDL_AllocScratch(count * sizeof(*fpoints));
     if (!fpoints) {
         return SDL_OutOfMemory();
     }
@@ -3019,7 +3037,7 @@ int SDL_RenderDrawLines(SDL_Renderer *renderer,
 
     retval = SDL_RenderDrawLinesF(renderer, fpoints, count);
 
-    SDL_small_free(fpoints, isstack);
+    SDL_ReleaseScratch(scratch);
 
     return retval;
 }
@@ -3048,13 +3066,11 @@ int SDL_RenderDrawLinesF(SDL_Renderer *renderer,
     if (renderer->line_method == SDL_RENDERLINEMETHOD_POINTS) {
         retval = RenderDrawLinesWithRectsF(renderer, points, count);
     } else if (renderer->line_method == SDL_RENDERLINEMETHOD_GEOMETRY) {
-        SDL_bool isstack1;
-        SDL_bool isstack2;
+        const size_t scratch = SDL_GetScratchMark();
         const float scale_x = renderer->scale.x;
         const float scale_y = renderer->scale.y;
-        float *xy = SDL_small_alloc(float, 4 * 2 * count, &isstack1);
-        int *indices = SDL_small_alloc(int,
-                                       (4) * 3 * (count - 1) + (2) * 3 * (count), &isstack2);
+        float *xy = (float *)SDL_AllocScratch(4 * 2 * count * sizeof(*xy));
+        int *indices = (int *)SDL_AllocScratch(((4) * 3 * (count - 1) + (2) * 3 * (count)) * sizeof(*indices));
 
         if (xy && indices) {
             int i;
@@ -3164,8 +3180,7 @@ int SDL_RenderDrawLinesF(SDL_Renderer *renderer,
                                       1.0f, 1.0f);
         }
 
-        SDL_small_free(xy, isstack1);
-        SDL_small_free(indices, isstack2);
+        SDL_ReleaseScratch(scratch);
 
     } else if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
         retval = RenderDrawLinesWithRectsF(renderer, points, count);
@@ -3314,7 +3329,7 @@ int SDL_RenderFillRects(SDL_Renderer *renderer,
     SDL_FRect *frects;
     int i;
     int retval;
-    SDL_bool isstack;
+    size_t scratch;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
@@ -3332,7 +3347,8 @@ int SDL_RenderFillRects(SDL_Renderer *renderer,
     }
 #endif
 
-    frects = SDL_small_alloc(SDL_FRect, count, &isstack);
+    scratch = SDL_GetScratchMark();
+    frects = (SDL_FRect *)SDL_AllocScratch(count * sizeof(*frects));
     if (!frects) {
         return SDL_OutOfMemory();
     }
@@ -3345,7 +3361,7 @@ int SDL_RenderFillRects(SDL_Renderer *renderer,
 
     retval = QueueCmdFillRects(renderer, frects, count);
 
-    SDL_small_free(frects, isstack);
+    SDL_ReleaseScratch(scratch);
 
     return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
 }
@@ -3356,7 +3372,7 @@ int SDL_RenderFillRectsF(SDL_Renderer *renderer,
     SDL_FRect *frects;
     int i;
     int retval;
-    SDL_bool isstack;
+    size_t scratch;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
@@ -3374,7 +3390,8 @@ int SDL_RenderFillRectsF(SDL_Renderer *renderer,
     }
 #endif
 
-    frects = SDL_small_alloc(SDL_FRect, count, &isstack);
+    scratch = SDL_GetScratchMark();
+    frects = (SDL_FRect *)SDL_AllocScratch(count * sizeof(*frects));
     if (!frects) {
         return SDL_OutOfMemory();
     }
@@ -3387,7 +3404,7 @@ int SDL_RenderFillRectsF(SDL_Renderer *renderer,
 
     retval = QueueCmdFillRects(renderer, frects, count);
 
-    SDL_small_free(frects, isstack);
+    SDL_ReleaseScratch(scratch);
 
     return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
 }
@@ -4228,33 +4245,6 @@ int SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
                                       format, pixels, pitch);
 }
 
-static void SDL_RenderSimulateVSync(SDL_Renderer *renderer)
-{
-    Uint32 now, elapsed;
-    const Uint32 interval = renderer->simulate_vsync_interval;
-
-    if (!interval) {
-        /* We can't do sub-ms delay, so just return here */
-        return;
-    }
-
-    now = SDL_GetTicks();
-    elapsed = (now - renderer->last_present);
-    if (elapsed < interval) {
-        Uint32 duration = (interval - elapsed);
-        SDL_Delay(duration);
-        now = SDL_GetTicks();
-    }
-
-    elapsed = (now - renderer->last_present);
-    if (!renderer->last_present || elapsed > 1000) {
-        /* It's been too long, reset the presentation timeline */
-        renderer->last_present = now;
-    } else {
-        renderer->last_present += (elapsed / interval) * interval;
-    }
-}
-
 void SDL_RenderPresent(SDL_Renderer *renderer)
 {
     SDL_bool presented = SDL_TRUE;
@@ -4275,7 +4265,7 @@ void SDL_RenderPresent(SDL_Renderer *renderer)
 
     if (renderer->simulate_vsync ||
         (!presented && renderer->wanted_vsync)) {
-        SDL_RenderSimulateVSync(renderer);
+        SDL_WaitFramePacer(&renderer->vsync_pacer);
     }
 }
 
@@ -4535,4 +4525,19 @@ int SDL_RenderSetVSync(SDL_Renderer *renderer, int vsync)
     return 0;
 }
 
+int SDL_RenderGetVSyncStats(SDL_Renderer *renderer, SDL_RenderVSyncStats *stats)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    stats->frames = renderer->vsync_pacer.frames;
+    stats->missed = renderer->vsync_pacer.missed;
+    stats->skipped = renderer->vsync_pacer.skipped;
+    stats->late_ns_max = renderer->vsync_pacer.late_ns_max;
+    return 0;
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -27,6 +27,7 @@
 #include "SDL_events.h"
 #include "SDL_mutex.h"
 #include "SDL_yuv_sw_c.h"
+#include "../timer/SDL_timer_c.h"
 
 /* Set up for C function definitions, even when using C++ */
 #ifdef __cplusplus
@@ -212,8 +213,7 @@ struct SDL_Renderer
     /* Whether we should simulate vsync */
     SDL_bool wanted_vsync;
     SDL_bool simulate_vsync;
-    Uint32 simulate_vsync_interval;
-    Uint32 last_present;
+    SDL_FramePacer vsync_pacer;
 
     /* The logical resolution for rendering */
     int logical_w;
@@ -325,6 +325,11 @@ extern void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t num
 extern int SDL_PrivateLowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst, SDL_Rect *dstrect, SDL_ScaleMode scaleMode);
 extern int SDL_PrivateUpperBlitScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, SDL_Rect *dstrect, SDL_ScaleMode scaleMode);
 
+/* the software renderer uses this for temporary surfaces; the pixels live in the
+   thread's scratch arena, so the surface must be freed before the scope that
+   created it is released (see SDL_scratch_c.h) */
+extern SDL_Surface *SDL_CreateScratchSurface(int width, int height, Uint32 format);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -41,6 +41,7 @@ Andreas Schiffler -- aschiffler at ferzkopp dot net
 
 #include "SDL.h"
 #include "SDL_rotate.h"
+#include "../SDL_sysrender.h"
 
 /* ---- Internally used structures */
 
@@ -484,7 +485,8 @@ When using the NONE and MOD modes, color and alpha modulation must be applied be
 \param cangle The angle cosine
 \param sangle The angle sine
 \param center The true coordinate of the center of rotation
-\return The new rotated surface.
+\return The new rotated surface. Its pixels are in the scratch arena, so it
+must be freed before the caller's scratch scope is released.
 
 */
 
@@ -523,7 +525,7 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
     rz_dst = NULL;
     if (is8bit) {
         /* Target surface is 8 bit */
-        rz_dst = SDL_CreateRGBSurfaceWithFormat(0, rect_dest->w, rect_dest->h + GUARD_ROWS, 8, src->format->format);
+        rz_dst = SDL_CreateScratchSurface(rect_dest->w, rect_dest->h + GUARD_ROWS, src->format->format);
         if (rz_dst) {
             if (src->format->palette) {
                 for (i = 0; i < src->format->palette->ncolors; i++) {
@@ -534,9 +536,7 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
         }
     } else {
         /* Target surface is 32 bit with source RGBA ordering */
-        rz_dst = SDL_CreateRGBSurface(0, rect_dest->w, rect_dest->h + GUARD_ROWS, 32,
-                                      src->format->Rmask, src->format->Gmask,
-                                      src->format->Bmask, src->format->Amask);
+        rz_dst = SDL_CreateScratchSurface(rect_dest->w, rect_dest->h + GUARD_ROWS, src->format->format);
     }
 
     /* Check target */
@@ -28,6 +28,8 @@
 #include "SDL_triangle.h"
 
 #include "../../video/SDL_blit.h"
+#include "../../SDL_scratch_c.h"
+#include "../SDL_sysrender.h"
 
 /* fixed points bits precision
  * Set to 1, so that it can start rendering wth middle of a pixel precision.
@@ -235,6 +237,7 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
     int is_uniform;
 
     SDL_Surface *tmp = NULL;
+    size_t scratch = 0;
 
     if (!dst) {
         return -1;
@@ -287,7 +290,8 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
         }
 
         /* Use an intermediate surface */
-        tmp = SDL_CreateRGBSurfaceWithFormat(0, dstrect.w, dstrect.h, 0, format);
+        scratch = SDL_GetScratchMark();
+        tmp = SDL_CreateScratchSurface(dstrect.w, dstrect.h, format);
         if (!tmp) {
             ret = -1;
             goto end;
@@ -435,6 +439,7 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
     if (tmp) {
         SDL_BlitSurface(tmp, NULL, dst, &dstrect);
         SDL_FreeSurface(tmp);
+        SDL_ReleaseScratch(scratch);
     }
 
 end:
@@ -73,6 +73,7 @@ int SDL_SensorInit(void)
     /* Create the sensor list lock */
     if (SDL_sensor_lock == NULL) {
         SDL_sensor_lock = SDL_CreateMutex();
+        SDL_SetLockName(SDL_sensor_lock, "SDL_sensor_lock");
     }
 
 #ifndef SDL_EVENTS_DISABLED
@@ -34,6 +34,7 @@
 #endif
 
 #include "SDL_stdinc.h"
+#include "../SDL_hints_c.h"
 
 #if (defined(__WIN32__) || defined(__WINGDK__)) && (!defined(HAVE_SETENV) || !defined(HAVE_GETENV))
 /* Note this isn't thread-safe! */
@@ -44,7 +45,7 @@ static size_t SDL_envmemlen = 0;
 /* Put a variable into the environment */
 /* Note: Name may not contain a '=' character. (Reference: http://www.unix.com/man-page/Linux/3/setenv/) */
 #if defined(HAVE_SETENV)
-int SDL_setenv(const char *name, const char *value, int overwrite)
+static int SDL_setenv_internal(const char *name, const char *value, int overwrite)
 {
     /* Input validation */
     if (!name || *name == '\0' || SDL_strchr(name, '=') != NULL || !value) {
@@ -54,7 +55,7 @@ int SDL_setenv(const char *name, const char *value, int overwrite)
     return setenv(name, value, overwrite);
 }
 #elif defined(__WIN32__) || defined(__WINGDK__)
-int SDL_setenv(const char *name, const char *value, int overwrite)
+static int SDL_setenv_internal(const char *name, const char *value, int overwrite)
 {
     /* Input validation */
     if (!name || *name == '\0' || SDL_strchr(name, '=') != NULL || !value) {
@@ -73,7 +74,7 @@ int SDL_setenv(const char *name, const char *value, int overwrite)
 }
 /* We have a real environment table, but no real setenv? Fake it w/ putenv. */
 #elif (defined(HAVE_GETENV) && defined(HAVE_PUTENV) && !defined(HAVE_SETENV))
-int SDL_setenv(const char *name, const char *value, int overwrite)
+static int SDL_setenv_internal(const char *name, const char *value, int overwrite)
 {
     size_t len;
     char *new_variable;
@@ -103,7 +104,7 @@ int SDL_setenv(const char *name, const char *value, int overwrite)
 }
 #else /* roll our own */
 static char **SDL_env = (char **)0;
-int SDL_setenv(const char *name, const char *value, int overwrite)
+static int SDL_setenv_internal(const char *name, const char *value, int overwrite)
 {
     int added;
     size_t len, i;
@@ -166,6 +167,17 @@ int SDL_setenv(const char *name, const char *value, int overwrite)
 }
 #endif
 
+int SDL_setenv(const char *name, const char *value, int overwrite)
+{
+    const int result = SDL_setenv_internal(name, value, overwrite);
+
+    if (result == 0) {
+        /* Hints cache their environment variables */
+        SDL_HintsEnvironmentChanged();
+    }
+    return result;
+}
+
 /* Retrieve a variable named "name" from the environment */
 #if defined(HAVE_GETENV)
 char *SDL_getenv(const char *name)
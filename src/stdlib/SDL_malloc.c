@@ -23,12 +23,16 @@
 #define SDL_DISABLE_ANALYZE_MACROS 1
 #endif
 
+/* This file defines the functions that the allocation tags wrap */
+#define SDL_DISABLE_ALLOCATION_TAGS 1
+
 #include "../SDL_internal.h"
 
 /* This file contains portable memory management functions for SDL */
 #include "SDL_stdinc.h"
 #include "SDL_atomic.h"
 #include "SDL_error.h"
+#include "SDL_memprofile_c.h"
 
 #ifndef HAVE_MALLOC
 #define LACKS_SYS_TYPES_H
@@ -5284,7 +5288,7 @@ int SDL_GetNumAllocations(void)
     return SDL_AtomicGet(&s_mem.num_allocations);
 }
 
-void *SDL_malloc(size_t size)
+void *SDL_TaggedMalloc(size_t size, const char *file)
 {
     void *mem;
 
@@ -5295,11 +5299,14 @@ void *SDL_malloc(size_t size)
     mem = s_mem.malloc_func(size);
     if (mem) {
         SDL_AtomicIncRef(&s_mem.num_allocations);
+        if (SDL_memory_profile_enabled) {
+            SDL_TrackAllocation(mem, size, SDL_GetMemoryTag(file));
+        }
     }
     return mem;
 }
 
-void *SDL_calloc(size_t nmemb, size_t size)
+void *SDL_TaggedCalloc(size_t nmemb, size_t size, const char *file)
 {
     void *mem;
 
@@ -5311,31 +5318,69 @@ void *SDL_calloc(size_t nmemb, size_t size)
     mem = s_mem.calloc_func(nmemb, size);
     if (mem) {
         SDL_AtomicIncRef(&s_mem.num_allocations);
+        if (SDL_memory_profile_enabled) {
+            SDL_TrackAllocation(mem, nmemb * size, SDL_GetMemoryTag(file));
+        }
     }
     return mem;
 }
 
-void *SDL_realloc(void *ptr, size_t size)
+void *SDL_TaggedRealloc(void *ptr, size_t size, const char *file)
 {
     void *mem;
+    size_t old_size = 0;
+    SDL_MemoryTag old_tag = SDL_MEMORY_TAG_OTHER;
+    SDL_bool tracked = SDL_FALSE;
 
     if (!ptr && !size) {
         size = 1;
     }
 
+    /* The old block is forgotten first, since once it's freed another thread can be given its address */
+    if (ptr && SDL_memory_profile_enabled) {
+        tracked = SDL_UntrackAllocation(ptr, &old_size, &old_tag);
+    }
+
     mem = s_mem.realloc_func(ptr, size);
     if (mem && !ptr) {
         SDL_AtomicIncRef(&s_mem.num_allocations);
     }
+
+    if (SDL_memory_profile_enabled) {
+        if (mem) {
+            SDL_TrackAllocation(mem, size, SDL_GetMemoryTag(file));
+        } else if (tracked && size) {
+            /* The old block is still there */
+            SDL_TrackAllocation(ptr, old_size, old_tag);
+        }
+    }
     return mem;
 }
 
+void *SDL_malloc(size_t size)
+{
+    return SDL_TaggedMalloc(size, NULL);
+}
+
+void *SDL_calloc(size_t nmemb, size_t size)
+{
+    return SDL_TaggedCalloc(nmemb, size, NULL);
+}
+
+void *SDL_realloc(void *ptr, size_t size)
+{
+    return SDL_TaggedRealloc(ptr, size, NULL);
+}
+
 void SDL_free(void *ptr)
 {
     if (!ptr) {
         return;
     }
 
+    if (SDL_memory_profile_enabled) {
+        SDL_UntrackAllocation(ptr, NULL, NULL);
+    }
     s_mem.free_func(ptr);
     (void)SDL_AtomicDecRef(&s_mem.num_allocations);
 }
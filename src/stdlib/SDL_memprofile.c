@@ -0,0 +1,473 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Heap profiling by subsystem */
+
+#include "SDL_atomic.h"
+#include "SDL_hints.h"
+#include "SDL_log.h"
+#include "SDL_timer.h"
+#include "SDL_memprofile_c.h"
+#include "../SDL_hints_c.h"
+
+/* The table of live blocks comes straight from the original allocator, so
+   that keeping it never comes back through SDL_malloc(). It starts with room
+   for this many blocks and doubles whenever it's half full. */
+#define MIN_ALLOCATION_RECORDS 4096
+
+/* Source files are mapped to subsystems once, and the answer is kept in a
+   fixed table so that it can be looked up without locking */
+#define MAX_FILE_RECORDS 512
+#define FILE_BUCKETS     64
+
+typedef struct
+{
+    void *mem; /* NULL while unused */
+    size_t size;
+    SDL_MemoryTag tag;
+} SDL_AllocationRecord;
+
+typedef struct
+{
+    Uint64 live_bytes;
+    Uint64 peak_bytes;
+    Uint64 live_allocations;
+    Uint64 allocations;
+    Uint64 window_start;
+    Uint64 window_allocations;
+    float allocations_per_second;
+} SDL_MemoryTagRecord;
+
+typedef struct SDL_MemoryFileRecord
+{
+    const char *file;
+    SDL_MemoryTag tag;
+    struct SDL_MemoryFileRecord *next;
+} SDL_MemoryFileRecord;
+
+static const char *SDL_memory_tag_names[SDL_NUM_MEMORY_TAGS] = {
+    "other", "application", "render", "video", "audio", "events", "joystick"
+};
+
+SDL_bool SDL_memory_profile_enabled;
+
+/* Everything but the file records is guarded by SDL_memory_profile_lock */
+static SDL_SpinLock SDL_memory_profile_lock;
+static SDL_calloc_func SDL_memory_profile_calloc;
+static SDL_free_func SDL_memory_profile_free;
+static SDL_AllocationRecord *SDL_allocation_records;
+static size_t SDL_allocation_mask;
+static size_t SDL_num_allocation_records;
+static SDL_MemoryTagRecord SDL_memory_tags[SDL_NUM_MEMORY_TAGS];
+static Uint64 SDL_memory_profile_freq;
+
+/* Buckets are only ever pushed onto, so they can be searched without locking.
+   Adding records is guarded by SDL_file_records_lock. */
+static SDL_MemoryFileRecord SDL_file_records[MAX_FILE_RECORDS];
+static int SDL_num_file_records;
+static SDL_MemoryFileRecord *SDL_file_buckets[FILE_BUCKETS];
+static SDL_SpinLock SDL_file_records_lock;
+
+/* SDL_AtomicLock() may keep lock statistics, which would count every allocation.
+   This backs off the same way, so a preempted holder isn't spun against. */
+static void SDL_MemoryProfileSpin(SDL_SpinLock *lock)
+{
+    int iterations = 0;
+
+    while (!SDL_AtomicTryLock(lock)) {
+        if (iterations < 32) {
+            iterations++;
+            SDL_CPUPauseInstruction();
+        } else {
+            SDL_Delay(0);
+        }
+    }
+}
+
+static SDL_MemoryTag SDL_ClassifySourceFile(const char *file)
+{
+    static const struct
+    {
+        const char *dir;
+        SDL_MemoryTag tag;
+    } dirs[] = {
+        { "render", SDL_MEMORY_TAG_RENDER },
+        { "video", SDL_MEMORY_TAG_VIDEO },
+        { "audio", SDL_MEMORY_TAG_AUDIO },
+        { "events", SDL_MEMORY_TAG_EVENTS },
+        { "joystick", SDL_MEMORY_TAG_JOYSTICK },
+        { "hidapi", SDL_MEMORY_TAG_JOYSTICK }
+    };
+    const char *subdir = NULL;
+    const char *p;
+    size_t i;
+
+    /* The subsystem is the directory under the last "src" in the path */
+    for (p = file; *p; ++p) {
+        if ((p == file || p[-1] == '/' || p[-1] == '\\') &&
+            SDL_strncmp(p, "src", 3) == 0 && (p[3] == '/' || p[3] == '\\')) {
+            subdir = p + 4;
+        }
+    }
+    if (!subdir) {
+        return SDL_MEMORY_TAG_OTHER;
+    }
+
+    for (i = 0; i < SDL_arraysize(dirs); ++i) {
+        const size_t len = SDL_strlen(dirs[i].dir);
+        if (SDL_strncmp(subdir, dirs[i].dir, len) == 0 && (subdir[len] == '/' || subdir[len] == '\\')) {
+            return dirs[i].tag;
+        }
+    }
+    return SDL_MEMORY_TAG_OTHER;
+}
+
+static Uint32 SDL_HashPointer(const void *ptr, int bits)
+{
+    return (Uint32)(((Uint64)((uintptr_t)ptr >> 4) * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+}
+
+SDL_MemoryTag SDL_GetMemoryTag(const char *file)
+{
+    const Uint32 bucket = SDL_HashPointer(file, 6);
+    SDL_MemoryFileRecord *record;
+    SDL_MemoryTag tag;
+
+    if (!file) {
+        return SDL_MEMORY_TAG_APPLICATION;
+    }
+
+    record = (SDL_MemoryFileRecord *)SDL_AtomicGetPtr((void **)&SDL_file_buckets[bucket]);
+    while (record) {
+        if (record->file == file) {
+            return record->tag;
+        }
+        record = record->next;
+    }
+
+    tag = SDL_ClassifySourceFile(file);
+
+    SDL_MemoryProfileSpin(&SDL_file_records_lock);
+    for (record = SDL_file_buckets[bucket]; record; record = record->next) {
+        if (record->file == file) {
+            break;
+        }
+    }
+    if (!record && SDL_num_file_records < MAX_FILE_RECORDS) {
+        record = &SDL_file_records[SDL_num_file_records++];
+        record->file = file;
+        record->tag = tag;
+        record->next = SDL_file_buckets[bucket];
+        SDL_AtomicSetPtr((void **)&SDL_file_buckets[bucket], record);
+    }
+    SDL_AtomicUnlock(&SDL_file_records_lock);
+
+    return tag;
+}
+
+static void SDL_UpdateAllocationRate(SDL_MemoryTagRecord *record, Uint64 now)
+{
+    const Uint64 elapsed = now - record->window_start;
+
+    if (elapsed >= SDL_memory_profile_freq) {
+        record->allocations_per_second = (float)((double)record->window_allocations * SDL_memory_profile_freq / elapsed);
+        record->window_start = now;
+        record->window_allocations = 0;
+    }
+}
+
+/* This is called with SDL_memory_profile_lock held */
+static SDL_AllocationRecord *SDL_FindAllocationRecord(void *mem)
+{
+    size_t i = SDL_HashPointer(mem, 32) & SDL_allocation_mask;
+
+    while (SDL_allocation_records[i].mem) {
+        if (SDL_allocation_records[i].mem == mem) {
+            return &SDL_allocation_records[i];
+        }
+        i = (i + 1) & SDL_allocation_mask;
+    }
+    return &SDL_allocation_records[i];
+}
+
+/* This is called with SDL_memory_profile_lock held */
+static SDL_bool SDL_GrowAllocationRecords(void)
+{
+    SDL_AllocationRecord *old_records = SDL_allocation_records;
+    const size_t old_count = SDL_allocation_mask + 1;
+    SDL_AllocationRecord *records;
+    size_t i;
+
+    records = (SDL_AllocationRecord *)SDL_memory_profile_calloc(old_count * 2, sizeof(*records));
+    if (!records) {
+        return SDL_FALSE;
+    }
+
+    SDL_allocation_records = records;
+    SDL_allocation_mask = old_count * 2 - 1;
+    for (i = 0; i < old_count; ++i) {
+        if (old_records[i].mem) {
+            *SDL_FindAllocationRecord(old_records[i].mem) = old_records[i];
+        }
+    }
+    SDL_memory_profile_free(old_records);
+    return SDL_TRUE;
+}
+
+/* This is called with SDL_memory_profile_lock held */
+static void SDL_RemoveAllocationRecord(SDL_AllocationRecord *record)
+{
+    SDL_MemoryTagRecord *tag = &SDL_memory_tags[record->tag];
+    size_t i = record - SDL_allocation_records;
+    size_t j = i;
+
+    tag->live_bytes -= record->size;
+    --tag->live_allocations;
+    --SDL_num_allocation_records;
+
+    /* Shift later records back so that no lookup stops early at the hole */
+    for (;;) {
+        size_t home;
+
+        j = (j + 1) & SDL_allocation_mask;
+        if (!SDL_allocation_records[j].mem) {
+            break;
+        }
+        home = SDL_HashPointer(SDL_allocation_records[j].mem, 32) & SDL_allocation_mask;
+        if (((j - home) & SDL_allocation_mask) >= ((j - i) & SDL_allocation_mask)) {
+            SDL_allocation_records[i] = SDL_allocation_records[j];
+            i = j;
+        }
+    }
+    SDL_allocation_records[i].mem = NULL;
+}
+
+void SDL_TrackAllocation(void *mem, size_t size, SDL_MemoryTag tag)
+{
+    SDL_MemoryTagRecord *record = &SDL_memory_tags[tag];
+    SDL_AllocationRecord *entry;
+
+    SDL_MemoryProfileSpin(&SDL_memory_profile_lock);
+    if (!SDL_allocation_records) {
+        /* Profiling was turned off since the caller checked */
+        SDL_AtomicUnlock(&SDL_memory_profile_lock);
+        return;
+    }
+
+    SDL_UpdateAllocationRate(record, SDL_GetPerformanceCounter());
+    ++record->allocations;
+    ++record->window_allocations;
+
+    if ((SDL_num_allocation_records + 1) * 2 > SDL_allocation_mask + 1 && !SDL_GrowAllocationRecords()) {
+        /* The block can't be recorded, so it won't be counted as live */
+        SDL_AtomicUnlock(&SDL_memory_profile_lock);
+        return;
+    }
+
+    entry = SDL_FindAllocationRecord(mem);
+    if (entry->mem) {
+        /* A block that was freed without being seen, replaced by this one */
+        SDL_RemoveAllocationRecord(entry);
+        entry = SDL_FindAllocationRecord(mem);
+    }
+    entry->mem = mem;
+    entry->size = size;
+    entry->tag = tag;
+    ++SDL_num_allocation_records;
+
+    record->live_bytes += size;
+    ++record->live_allocations;
+    if (record->live_bytes > record->peak_bytes) {
+        record->peak_bytes = record->live_bytes;
+    }
+    SDL_AtomicUnlock(&SDL_memory_profile_lock);
+}
+
+SDL_bool SDL_UntrackAllocation(void *mem, size_t *size, SDL_MemoryTag *tag)
+{
+    SDL_AllocationRecord *entry;
+    SDL_bool found = SDL_FALSE;
+
+    SDL_MemoryProfileSpin(&SDL_memory_profile_lock);
+    if (SDL_allocation_records) {
+        entry = SDL_FindAllocationRecord(mem);
+        if (entry->mem) {
+            if (size) {
+                *size = entry->size;
+            }
+            if (tag) {
+                *tag = entry->tag;
+            }
+            SDL_RemoveAllocationRecord(entry);
+            found = SDL_TRUE;
+        }
+    }
+    SDL_AtomicUnlock(&SDL_memory_profile_lock);
+
+    return found;
+}
+
+static void SDL_StartMemoryProfile(void)
+{
+    SDL_AllocationRecord *records;
+    Uint64 now;
+    int i;
+
+    SDL_GetOriginalMemoryFunctions(NULL, &SDL_memory_profile_calloc, NULL, &SDL_memory_profile_free);
+    records = (SDL_AllocationRecord *)SDL_memory_profile_calloc(MIN_ALLOCATION_RECORDS, sizeof(*records));
+    if (!records) {
+        return;
+    }
+
+    SDL_memory_profile_freq = SDL_GetPerformanceFrequency();
+    now = SDL_GetPerformanceCounter();
+
+    SDL_MemoryProfileSpin(&SDL_memory_profile_lock);
+    if (SDL_allocation_records) {
+        /* Another thread started profiling first */
+        SDL_AtomicUnlock(&SDL_memory_profile_lock);
+        SDL_memory_profile_free(records);
+        return;
+    }
+    SDL_allocation_records = records;
+    SDL_allocation_mask = MIN_ALLOCATION_RECORDS - 1;
+    SDL_num_allocation_records = 0;
+    SDL_zeroa(SDL_memory_tags);
+    for (i = 0; i < SDL_NUM_MEMORY_TAGS; ++i) {
+        SDL_memory_tags[i].window_start = now;
+    }
+    SDL_memory_profile_enabled = SDL_TRUE;
+    SDL_AtomicUnlock(&SDL_memory_profile_lock);
+}
+
+static void SDL_StopMemoryProfile(void)
+{
+    SDL_AllocationRecord *records;
+
+    SDL_MemoryProfileSpin(&SDL_memory_profile_lock);
+    SDL_memory_profile_enabled = SDL_FALSE;
+    records = SDL_allocation_records;
+    SDL_allocation_records = NULL;
+    SDL_AtomicUnlock(&SDL_memory_profile_lock);
+
+    if (records) {
+        SDL_memory_profile_free(records);
+    }
+}
+
+static void SDLCALL SDL_MemoryProfileChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    const SDL_bool enabled = SDL_GetStringBoolean(hint, SDL_FALSE);
+
+    if (enabled && !SDL_memory_profile_enabled) {
+        SDL_StartMemoryProfile();
+    } else if (!enabled && SDL_memory_profile_enabled) {
+        SDL_StopMemoryProfile();
+    }
+}
+
+void SDL_InitMemoryProfile(void)
+{
+    SDL_AddHintCallback(SDL_HINT_MEMORY_PROFILE, SDL_MemoryProfileChanged, NULL);
+}
+
+void SDL_QuitMemoryProfile(void)
+{
+    /* The hint callback was removed along with the hints by SDL_ClearHints().
+       The statistics themselves stay around, so they can still be read. */
+    SDL_StopMemoryProfile();
+}
+
+int SDL_GetMemoryStats(SDL_MemoryStats *stats, int count)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+    int i;
+
+    if (!stats) {
+        return SDL_NUM_MEMORY_TAGS;
+    }
+    count = SDL_clamp(count, 0, SDL_NUM_MEMORY_TAGS);
+
+    SDL_MemoryProfileSpin(&SDL_memory_profile_lock);
+    for (i = 0; i < count; ++i) {
+        SDL_MemoryTagRecord *record = &SDL_memory_tags[i];
+        SDL_MemoryStats *entry = &stats[i];
+
+        if (SDL_memory_profile_enabled) {
+            SDL_UpdateAllocationRate(record, now);
+        }
+        entry->tag = (SDL_MemoryTag)i;
+        entry->name = SDL_memory_tag_names[i];
+        entry->live_bytes = record->live_bytes;
+        entry->peak_bytes = record->peak_bytes;
+        entry->live_allocations = record->live_allocations;
+        entry->allocations = record->allocations;
+        entry->allocations_per_second = record->allocations_per_second;
+    }
+    SDL_AtomicUnlock(&SDL_memory_profile_lock);
+
+    return count;
+}
+
+void SDL_LogMemoryStats(void)
+{
+    SDL_MemoryStats stats[SDL_NUM_MEMORY_TAGS];
+    Uint64 live_bytes = 0, live_allocations = 0, allocations = 0;
+    int i, count;
+
+    count = SDL_GetMemoryStats(stats, SDL_arraysize(stats));
+    for (i = 0; i < count; ++i) {
+        const SDL_MemoryStats *entry = &stats[i];
+
+        if (!entry->allocations && !entry->live_allocations) {
+            continue;
+        }
+        SDL_Log("%-12s %12" SDL_PRIu64 " bytes live %12" SDL_PRIu64 " peak %8" SDL_PRIu64 " blocks %10" SDL_PRIu64 " allocated %10.1f/s\n",
+                entry->name, entry->live_bytes, entry->peak_bytes, entry->live_allocations,
+                entry->allocations, entry->allocations_per_second);
+        live_bytes += entry->live_bytes;
+        live_allocations += entry->live_allocations;
+        allocations += entry->allocations;
+    }
+    SDL_Log("%-12s %12" SDL_PRIu64 " bytes live %17s %8" SDL_PRIu64 " blocks %10" SDL_PRIu64 " allocated\n",
+            "total", live_bytes, "", live_allocations, allocations);
+}
+
+void SDL_ResetMemoryStats(void)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+    int i;
+
+    SDL_MemoryProfileSpin(&SDL_memory_profile_lock);
+    for (i = 0; i < SDL_NUM_MEMORY_TAGS; ++i) {
+        SDL_MemoryTagRecord *record = &SDL_memory_tags[i];
+
+        record->peak_bytes = record->live_bytes;
+        record->allocations = 0;
+        record->window_start = now;
+        record->window_allocations = 0;
+        record->allocations_per_second = 0.0f;
+    }
+    SDL_AtomicUnlock(&SDL_memory_profile_lock);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,47 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef SDL_memprofile_c_h_
+#define SDL_memprofile_c_h_
+
+/* Heap profiling, enabled with SDL_HINT_MEMORY_PROFILE.
+
+   The allocation functions check SDL_memory_profile_enabled before doing
+   anything else, so the only cost while profiling is off is that test.
+   When it's on, each new block is recorded with its size and subsystem,
+   and a block is forgotten before it's freed, so that its address can't be
+   handed to another thread while it's still recorded. */
+extern SDL_bool SDL_memory_profile_enabled;
+
+extern void SDL_InitMemoryProfile(void);
+extern void SDL_QuitMemoryProfile(void);
+
+/* Returns the subsystem for an allocation made from the given source file,
+   or SDL_MEMORY_TAG_APPLICATION if file is NULL */
+extern SDL_MemoryTag SDL_GetMemoryTag(const char *file);
+
+extern void SDL_TrackAllocation(void *mem, size_t size, SDL_MemoryTag tag);
+extern SDL_bool SDL_UntrackAllocation(void *mem, size_t *size, SDL_MemoryTag *tag);
+
+#endif /* SDL_memprofile_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
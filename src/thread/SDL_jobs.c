@@ -0,0 +1,499 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* A work-stealing job system on top of SDL's threads */
+
+#include "SDL_thread.h"
+#include "SDL_thread_c.h"
+#include "SDL_systhread.h"
+#include "SDL_hints.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_timer.h"
+
+/* Jobs a queue can hold; past that, SDL_SubmitJob() runs the job itself */
+#define JOB_QUEUE_SIZE 1024
+
+/* How many times an idle thread looks for work before it sleeps */
+#define JOB_SPIN_COUNT 100
+
+#define MAX_JOB_WORKERS 256
+
+struct SDL_JobGroup
+{
+    SDL_atomic_t pending;
+};
+
+typedef struct SDL_Job
+{
+    SDL_JobFunction fn;
+    void *data;
+    SDL_JobGroup *group;
+} SDL_Job;
+
+/* The owner pushes and pops at the bottom, other threads steal from the top */
+typedef struct SDL_JobQueue
+{
+    SDL_SpinLock lock;
+    SDL_atomic_t count;
+    Uint32 top;
+    Uint32 bottom;
+    SDL_Job jobs[JOB_QUEUE_SIZE];
+} SDL_JobQueue;
+
+/* SDL_JobSystem::state */
+#define JOBS_UNINITIALIZED 0
+#define JOBS_INITIALIZING  1
+#define JOBS_READY         2
+
+typedef struct SDL_JobSystem
+{
+    SDL_atomic_t state;
+    SDL_atomic_t quit;
+    /* Without threads, jobs run as soon as they're submitted */
+    SDL_bool run_inline;
+    int num_workers;
+    SDL_Thread **threads;
+    /* One queue per worker, plus a last one shared by every other thread */
+    SDL_JobQueue *queues;
+    SDL_atomic_t next_victim;
+
+    /* Idle workers sleep on this, NULL if run_inline */
+    SDL_sem *wake;
+    SDL_atomic_t sleeping;
+
+    /* Signaled when a group runs out of jobs, NULL if run_inline */
+    SDL_mutex *done_lock;
+    SDL_cond *done;
+} SDL_JobSystem;
+
+static SDL_JobSystem SDL_jobs;
+static SDL_TLSID SDL_jobs_worker;
+
+static SDL_bool SDL_PushJob(SDL_JobQueue *queue, const SDL_Job *job)
+{
+    SDL_bool pushed = SDL_FALSE;
+
+    SDL_AtomicLock(&queue->lock);
+    if ((queue->bottom - queue->top) < JOB_QUEUE_SIZE) {
+        queue->jobs[queue->bottom % JOB_QUEUE_SIZE] = *job;
+        ++queue->bottom;
+        /* This is also the barrier between the push and checking for sleepers */
+        SDL_AtomicAdd(&queue->count, 1);
+        pushed = SDL_TRUE;
+    }
+    SDL_AtomicUnlock(&queue->lock);
+
+    return pushed;
+}
+
+static SDL_bool SDL_PopJob(SDL_JobQueue *queue, SDL_Job *job, SDL_bool steal)
+{
+    SDL_bool popped = SDL_FALSE;
+
+    if (SDL_AtomicGet(&queue->count) == 0) {
+        return SDL_FALSE;
+    }
+
+    SDL_AtomicLock(&queue->lock);
+    if (queue->bottom != queue->top) {
+        if (steal) {
+            *job = queue->jobs[queue->top % JOB_QUEUE_SIZE];
+            ++queue->top;
+        } else {
+            --queue->bottom;
+            *job = queue->jobs[queue->bottom % JOB_QUEUE_SIZE];
+        }
+        SDL_AtomicAdd(&queue->count, -1);
+        popped = SDL_TRUE;
+    }
+    SDL_AtomicUnlock(&queue->lock);
+
+    return popped;
+}
+
+/* The queue owned by the calling thread: its own if it's a worker, otherwise the shared one */
+static int SDL_GetJobQueueIndex(void)
+{
+    const uintptr_t worker = (uintptr_t)SDL_TLSGet(SDL_jobs_worker);
+
+    return worker ? (int)(worker - 1) : SDL_jobs.num_workers;
+}
+
+static SDL_bool SDL_FindJob(int index, SDL_Job *job)
+{
+    const int num_queues = SDL_jobs.num_workers + 1;
+    int i, victim;
+
+    if (SDL_PopJob(&SDL_jobs.queues[index], job, SDL_FALSE)) {
+        return SDL_TRUE;
+    }
+
+    /* Spread the thieves out over the queues */
+    victim = (int)((unsigned int)SDL_AtomicAdd(&SDL_jobs.next_victim, 1) % num_queues);
+    for (i = 0; i < num_queues; ++i) {
+        if (victim != index && SDL_PopJob(&SDL_jobs.queues[victim], job, SDL_TRUE)) {
+            return SDL_TRUE;
+        }
+        if (++victim == num_queues) {
+            victim = 0;
+        }
+    }
+    return SDL_FALSE;
+}
+
+static void SDL_RunJob(const SDL_Job *job)
+{
+    SDL_JobGroup *group = job->group;
+
+    job->fn(job->data);
+
+    /* The group may be freed as soon as the count drops to zero */
+    if (SDL_AtomicAdd(&group->pending, -1) == 1 && !SDL_jobs.run_inline) {
+        SDL_LockMutex(SDL_jobs.done_lock);
+        SDL_CondBroadcast(SDL_jobs.done);
+        SDL_UnlockMutex(SDL_jobs.done_lock);
+    }
+}
+
+static int SDLCALL SDL_JobWorkerThread(void *data)
+{
+    const int index = (int)(intptr_t)data;
+    SDL_Job job;
+    int spins = 0;
+
+    SDL_TLSSet(SDL_jobs_worker, (void *)(uintptr_t)(index + 1), NULL);
+
+    while (!SDL_AtomicGet(&SDL_jobs.quit)) {
+        if (SDL_FindJob(index, &job)) {
+            SDL_RunJob(&job);
+            spins = 0;
+            continue;
+        }
+
+        if (++spins < JOB_SPIN_COUNT) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+        spins = 0;
+
+        /* Announce that we're going to sleep, then look once more, so a job
+           pushed in between either gets found here or wakes us up */
+        SDL_AtomicIncRef(&SDL_jobs.sleeping);
+        if (SDL_FindJob(index, &job)) {
+            SDL_AtomicAdd(&SDL_jobs.sleeping, -1);
+            SDL_RunJob(&job);
+            continue;
+        }
+        if (!SDL_AtomicGet(&SDL_jobs.quit)) {
+            SDL_SemWait(SDL_jobs.wake);
+        }
+        SDL_AtomicAdd(&SDL_jobs.sleeping, -1);
+    }
+    return 0;
+}
+
+#ifndef SDL_THREADS_DISABLED
+static int SDL_GetJobWorkersHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_JOB_WORKERS);
+
+    if (hint && *hint) {
+        return SDL_clamp(SDL_atoi(hint), 0, MAX_JOB_WORKERS);
+    }
+    return SDL_clamp(SDL_GetCPUCount() - 1, 0, MAX_JOB_WORKERS);
+}
+#endif
+
+static void SDL_DestroyJobSystem(void)
+{
+    if (SDL_jobs.wake) {
+        SDL_DestroySemaphore(SDL_jobs.wake);
+    }
+    if (SDL_jobs.done_lock) {
+        SDL_DestroyMutex(SDL_jobs.done_lock);
+    }
+    if (SDL_jobs.done) {
+        SDL_DestroyCond(SDL_jobs.done);
+    }
+    SDL_free(SDL_jobs.threads);
+    SDL_free(SDL_jobs.queues);
+    SDL_zero(SDL_jobs);
+}
+
+/* Called by the one thread that moved the state to JOBS_INITIALIZING */
+static int SDL_CreateJobSystem(void)
+{
+    int num_workers, i;
+
+#ifdef SDL_THREADS_DISABLED
+    num_workers = 0;
+    SDL_jobs.run_inline = SDL_TRUE;
+#else
+    num_workers = SDL_GetJobWorkersHint();
+#endif
+
+    if (!SDL_jobs_worker) {
+        SDL_jobs_worker = SDL_TLSCreate();
+        if (!SDL_jobs_worker) {
+            goto failed;
+        }
+    }
+    SDL_jobs.queues = (SDL_JobQueue *)SDL_calloc(num_workers + 1, sizeof(*SDL_jobs.queues));
+    SDL_jobs.threads = (SDL_Thread **)SDL_calloc(num_workers + 1, sizeof(*SDL_jobs.threads));
+    if (!SDL_jobs.queues || !SDL_jobs.threads) {
+        SDL_OutOfMemory();
+        goto failed;
+    }
+    if (!SDL_jobs.run_inline) {
+        SDL_jobs.wake = SDL_CreateSemaphore(0);
+        if (!SDL_jobs.wake) {
+            goto failed;
+        }
+        SDL_jobs.done_lock = SDL_CreateMutex();
+        if (!SDL_jobs.done_lock) {
+            goto failed;
+        }
+        SDL_jobs.done = SDL_CreateCond();
+        if (!SDL_jobs.done) {
+            goto failed;
+        }
+    }
+
+    /* The queue indices are fixed before any worker starts, so a
+       thread that can't be created leaves its queue to be stolen from */
+    SDL_jobs.num_workers = num_workers;
+    for (i = 0; i < num_workers; ++i) {
+        SDL_jobs.threads[i] = SDL_CreateThreadInternal(SDL_JobWorkerThread, "SDLJobWorker", 0, (void *)(intptr_t)i);
+    }
+    SDL_AtomicSet(&SDL_jobs.state, JOBS_READY);
+    return 0;
+
+failed:
+    /* This also puts the state back to JOBS_UNINITIALIZED, so the next call tries again */
+    SDL_DestroyJobSystem();
+    return -1;
+}
+
+static int SDL_InitJobs(void)
+{
+    /* Creating the worker threads takes a while, so the other threads wait
+       for it by sleeping instead of spinning on a lock */
+    while (SDL_AtomicGet(&SDL_jobs.state) != JOBS_READY) {
+        if (SDL_AtomicCAS(&SDL_jobs.state, JOBS_UNINITIALIZED, JOBS_INITIALIZING)) {
+            return SDL_CreateJobSystem();
+        }
+        SDL_Delay(1);
+    }
+    return 0;
+}
+
+void SDL_QuitJobs(void)
+{
+    SDL_Job job;
+    int i;
+
+    if (SDL_AtomicGet(&SDL_jobs.state) != JOBS_READY) {
+        return;
+    }
+
+    SDL_AtomicSet(&SDL_jobs.quit, 1);
+    for (i = 0; i < SDL_jobs.num_workers; ++i) {
+        SDL_SemPost(SDL_jobs.wake);
+    }
+    for (i = 0; i < SDL_jobs.num_workers; ++i) {
+        if (SDL_jobs.threads[i]) {
+            SDL_WaitThread(SDL_jobs.threads[i], NULL);
+        }
+    }
+
+    /* Run whatever the workers left behind, so no group waits forever on a
+       job that was dropped. Those may queue more jobs, which end up here too. */
+    while (SDL_FindJob(SDL_jobs.num_workers, &job)) {
+        SDL_RunJob(&job);
+    }
+
+    SDL_DestroyJobSystem();
+}
+
+SDL_JobGroup *SDL_CreateJobGroup(void)
+{
+    SDL_JobGroup *group = (SDL_JobGroup *)SDL_calloc(1, sizeof(*group));
+
+    if (!group) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    return group;
+}
+
+int SDL_SubmitJob(SDL_JobGroup *group, SDL_JobFunction fn, void *data)
+{
+    SDL_Job job;
+
+    if (!group) {
+        return SDL_InvalidParamError("group");
+    }
+    if (!fn) {
+        return SDL_InvalidParamError("fn");
+    }
+    if (SDL_InitJobs() < 0) {
+        return -1;
+    }
+
+    job.fn = fn;
+    job.data = data;
+    job.group = group;
+    SDL_AtomicIncRef(&group->pending);
+
+    if (SDL_jobs.run_inline) {
+        SDL_RunJob(&job);
+        return 0;
+    }
+
+    if (!SDL_PushJob(&SDL_jobs.queues[SDL_GetJobQueueIndex()], &job)) {
+        /* The queue is full, there's plenty of work for the other threads */
+        SDL_RunJob(&job);
+        return 0;
+    }
+
+    if (SDL_AtomicGet(&SDL_jobs.sleeping) > SDL_SemValue(SDL_jobs.wake)) {
+        SDL_SemPost(SDL_jobs.wake);
+    }
+    return 0;
+}
+
+void SDL_WaitJobGroup(SDL_JobGroup *group)
+{
+    SDL_Job job;
+    int index, spins = 0;
+
+    if (!group || SDL_AtomicGet(&group->pending) == 0) {
+        return;
+    }
+
+    index = SDL_GetJobQueueIndex();
+    while (SDL_AtomicGet(&group->pending) > 0) {
+        if (SDL_FindJob(index, &job)) {
+            SDL_RunJob(&job);
+            spins = 0;
+            continue;
+        }
+
+        if (++spins < JOB_SPIN_COUNT) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+        spins = 0;
+
+        /* The rest of the group is running on other threads. Those may
+           still queue more jobs, so come back to look for them regularly. */
+        SDL_LockMutex(SDL_jobs.done_lock);
+        if (SDL_AtomicGet(&group->pending) > 0) {
+            SDL_CondWaitTimeout(SDL_jobs.done, SDL_jobs.done_lock, 1);
+        }
+        SDL_UnlockMutex(SDL_jobs.done_lock);
+    }
+}
+
+void SDL_DestroyJobGroup(SDL_JobGroup *group)
+{
+    if (group) {
+        SDL_WaitJobGroup(group);
+        SDL_free(group);
+    }
+}
+
+typedef struct SDL_ParallelForData
+{
+    SDL_ParallelForFunction fn;
+    void *data;
+    int count;
+    int grain;
+    int num_ranges;
+    SDL_atomic_t next_range;
+} SDL_ParallelForData;
+
+/* Every job hands out ranges until none are left, so a slow thread
+   just ends up processing fewer of them */
+static void SDLCALL SDL_ParallelForJob(void *data)
+{
+    SDL_ParallelForData *loop = (SDL_ParallelForData *)data;
+    int range, start;
+
+    while ((range = SDL_AtomicAdd(&loop->next_range, 1)) < loop->num_ranges) {
+        start = range * loop->grain;
+        loop->fn(loop->data, start, start + SDL_min(loop->grain, loop->count - start));
+    }
+}
+
+int SDL_ParallelFor(int count, int grain, SDL_ParallelForFunction fn, void *data)
+{
+    SDL_ParallelForData loop;
+    SDL_JobGroup group;
+    int num_threads, num_jobs, i;
+
+    if (!fn) {
+        return SDL_InvalidParamError("fn");
+    }
+    if (count <= 0) {
+        return 0;
+    }
+    if (SDL_InitJobs() < 0) {
+        return -1;
+    }
+
+    num_threads = SDL_jobs.num_workers + 1;
+    if (grain <= 0) {
+        /* A few ranges per thread, so uneven ones still balance out */
+        grain = SDL_max(count / (num_threads * 4), 1);
+    }
+
+    loop.fn = fn;
+    loop.data = data;
+    loop.count = count;
+    loop.grain = grain;
+    loop.num_ranges = (count / grain) + ((count % grain) ? 1 : 0);
+    SDL_AtomicSet(&loop.next_range, 0);
+
+    SDL_zero(group);
+    num_jobs = SDL_min(num_threads, loop.num_ranges);
+    for (i = 1; i < num_jobs; ++i) {
+        if (SDL_SubmitJob(&group, SDL_ParallelForJob, &loop) < 0) {
+            break;
+        }
+    }
+
+    /* Take part instead of just waiting */
+    SDL_ParallelForJob(&loop);
+    SDL_WaitJobGroup(&group);
+    return 0;
+}
+
+int SDL_GetNumJobWorkers(void)
+{
+    if (SDL_InitJobs() < 0) {
+        return -1;
+    }
+    return SDL_jobs.num_workers;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,419 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Lock contention statistics */
+
+#include "SDL_atomic.h"
+#include "SDL_hints.h"
+#include "SDL_log.h"
+#include "SDL_thread.h"
+#include "SDL_timer.h"
+#include "SDL_lockstats_c.h"
+#include "../SDL_hints_c.h"
+#include "../timer/SDL_timer_c.h"
+
+/* Records live in a fixed table, so keeping statistics never allocates
+   memory or takes an SDL lock, either of which would come back here. */
+#define MAX_LOCK_RECORDS 256
+#define LOCK_BUCKETS     64
+#define MAX_LOCK_THREADS 64
+
+typedef struct SDL_LockRecord
+{
+    const void *lock; /* NULL while unused and after the lock is destroyed */
+    SDL_LockType type;
+    SDL_SpinLock spinlock;
+    char name[32];
+    SDL_threadID holder;
+    SDL_threadID contended_holder;
+    Uint64 acquisitions;
+    Uint64 contended;
+    Uint64 wait_ticks;
+    Uint64 max_wait_ticks;
+    struct SDL_LockRecord *next;
+} SDL_LockRecord;
+
+typedef struct SDL_LockThread
+{
+    SDL_threadID id;
+    char name[32];
+} SDL_LockThread;
+
+SDL_bool SDL_lock_stats_enabled;
+
+/* Buckets are only ever pushed onto, so they can be searched without locking.
+   Adding and reusing records, and the thread names, are guarded by SDL_lock_records_lock. */
+static SDL_LockRecord SDL_lock_records[MAX_LOCK_RECORDS];
+static int SDL_num_lock_records;
+static SDL_LockRecord *SDL_lock_buckets[LOCK_BUCKETS];
+static SDL_SpinLock SDL_lock_records_lock;
+static SDL_LockThread SDL_lock_threads[MAX_LOCK_THREADS];
+static int SDL_next_lock_thread;
+
+/* SDL_AtomicLock() keeps statistics itself, so this can't use it */
+static void SDL_LockStatsSpin(SDL_SpinLock *lock)
+{
+    while (!SDL_AtomicTryLock(lock)) {
+        SDL_CPUPauseInstruction();
+    }
+}
+
+static Uint32 SDL_HashLock(const void *lock)
+{
+    return ((Uint32)((uintptr_t)lock >> 3) * 0x9E3779B1u) >> 26;
+}
+
+static SDL_LockRecord *SDL_FindLockRecord(const void *lock)
+{
+    SDL_LockRecord *record;
+
+    record = (SDL_LockRecord *)SDL_AtomicGetPtr((void **)&SDL_lock_buckets[SDL_HashLock(lock)]);
+    while (record) {
+        if (SDL_AtomicGetPtr((void **)&record->lock) == lock) {
+            return record;
+        }
+        record = record->next;
+    }
+    return NULL;
+}
+
+static SDL_LockRecord *SDL_AddLockRecord(const void *lock, SDL_LockType type)
+{
+    const Uint32 bucket = SDL_HashLock(lock);
+    SDL_LockRecord *record;
+    SDL_bool reused = SDL_FALSE;
+
+    /* Reuse the record of a destroyed lock, unless it's worth reporting */
+    for (record = SDL_lock_buckets[bucket]; record; record = record->next) {
+        if (!record->lock && !(record->name[0] && record->contended)) {
+            reused = SDL_TRUE;
+            break;
+        }
+    }
+    if (!record) {
+        if (SDL_num_lock_records == MAX_LOCK_RECORDS) {
+            return NULL;
+        }
+        record = &SDL_lock_records[SDL_num_lock_records++];
+    }
+
+    SDL_LockStatsSpin(&record->spinlock);
+    record->type = type;
+    record->name[0] = '\0';
+    record->holder = 0;
+    record->contended_holder = 0;
+    record->acquisitions = 0;
+    record->contended = 0;
+    record->wait_ticks = 0;
+    record->max_wait_ticks = 0;
+    SDL_AtomicUnlock(&record->spinlock);
+
+    SDL_AtomicSetPtr((void **)&record->lock, (void *)lock);
+    if (!reused) {
+        record->next = SDL_lock_buckets[bucket];
+        SDL_AtomicSetPtr((void **)&SDL_lock_buckets[bucket], record);
+    }
+    return record;
+}
+
+static SDL_LockRecord *SDL_GetLockRecord(const void *lock, SDL_LockType type)
+{
+    SDL_LockRecord *record = SDL_FindLockRecord(lock);
+
+    if (!record) {
+        SDL_LockStatsSpin(&SDL_lock_records_lock);
+        record = SDL_FindLockRecord(lock);
+        if (!record) {
+            record = SDL_AddLockRecord(lock, type);
+        }
+        SDL_AtomicUnlock(&SDL_lock_records_lock);
+    }
+    return record;
+}
+
+Uint64 SDL_LockStatsWaitBegin(const void *lock, SDL_LockType type)
+{
+    SDL_LockRecord *record = SDL_GetLockRecord(lock, type);
+
+    if (record) {
+        SDL_LockStatsSpin(&record->spinlock);
+        record->contended_holder = record->holder;
+        SDL_AtomicUnlock(&record->spinlock);
+    }
+    return SDL_GetPerformanceCounter();
+}
+
+void SDL_LockStatsAcquired(const void *lock, SDL_LockType type, Uint64 wait_start)
+{
+    SDL_LockRecord *record;
+    Uint64 waited = 0;
+
+    if (wait_start) {
+        waited = SDL_GetPerformanceCounter() - wait_start;
+    }
+
+    record = SDL_GetLockRecord(lock, type);
+    if (record) {
+        SDL_LockStatsSpin(&record->spinlock);
+        record->type = type;
+        ++record->acquisitions;
+        if (wait_start) {
+            ++record->contended;
+            record->wait_ticks += waited;
+            if (waited > record->max_wait_ticks) {
+                record->max_wait_ticks = waited;
+            }
+        }
+        record->holder = SDL_ThreadID();
+        SDL_AtomicUnlock(&record->spinlock);
+    }
+}
+
+void SDL_LockStatsDestroyed(const void *lock)
+{
+    SDL_LockRecord *record = SDL_FindLockRecord(lock);
+
+    if (record) {
+        SDL_LockStatsSpin(&SDL_lock_records_lock);
+        SDL_AtomicSetPtr((void **)&record->lock, NULL);
+        SDL_AtomicUnlock(&SDL_lock_records_lock);
+    }
+}
+
+/* Names outlive their threads, since a lock may have been held by a thread
+   that is gone by the time statistics are read. The oldest name makes room
+   for a new one, and a thread ID that the system reuses gets the new name. */
+void SDL_LockStatsThreadStarted(const char *name)
+{
+    const SDL_threadID id = SDL_ThreadID();
+    SDL_LockThread *thread = NULL;
+    int i;
+
+    SDL_LockStatsSpin(&SDL_lock_records_lock);
+    for (i = 0; i < MAX_LOCK_THREADS; ++i) {
+        if (SDL_lock_threads[i].id == id) {
+            thread = &SDL_lock_threads[i];
+            break;
+        }
+    }
+    if (!thread) {
+        thread = &SDL_lock_threads[SDL_next_lock_thread];
+        SDL_next_lock_thread = (SDL_next_lock_thread + 1) % MAX_LOCK_THREADS;
+    }
+    thread->id = id;
+    SDL_strlcpy(thread->name, name ? name : "", sizeof(thread->name));
+    SDL_AtomicUnlock(&SDL_lock_records_lock);
+}
+
+/* This is called with SDL_lock_records_lock held */
+static void SDL_GetLockThreadName(SDL_threadID id, char *name, size_t maxlen)
+{
+    int i;
+
+    if (!id) {
+        *name = '\0';
+        return;
+    }
+    for (i = 0; i < MAX_LOCK_THREADS; ++i) {
+        if (SDL_lock_threads[i].id == id && SDL_lock_threads[i].name[0]) {
+            SDL_strlcpy(name, SDL_lock_threads[i].name, maxlen);
+            return;
+        }
+    }
+    (void)SDL_snprintf(name, maxlen, "thread %lu", id);
+}
+
+static void SDLCALL SDL_LockStatsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_lock_stats_enabled = SDL_GetStringBoolean(hint, SDL_FALSE);
+}
+
+void SDL_InitLockStats(void)
+{
+    SDL_LockStatsThreadStarted("main");
+    SDL_AddHintCallback(SDL_HINT_LOCK_STATS, SDL_LockStatsChanged, NULL);
+}
+
+void SDL_QuitLockStats(void)
+{
+    /* The hint callback was removed along with the hints by SDL_ClearHints().
+       The statistics themselves stay around, so they can still be read. */
+    SDL_lock_stats_enabled = SDL_FALSE;
+}
+
+int SDL_SetLockName(const void *lock, const char *name)
+{
+    SDL_LockRecord *record;
+
+    if (!lock) {
+        return SDL_InvalidParamError("lock");
+    }
+
+    record = SDL_GetLockRecord(lock, SDL_LOCKTYPE_MUTEX);
+    if (!record) {
+        return SDL_SetError("Too many locks to keep statistics for");
+    }
+    SDL_LockStatsSpin(&record->spinlock);
+    SDL_strlcpy(record->name, name ? name : "", sizeof(record->name));
+    SDL_AtomicUnlock(&record->spinlock);
+    return 0;
+}
+
+/* Waiting to be signaled is what semaphores and condition variables are for,
+   so their waits are kept apart from the contention of the other locks */
+static SDL_bool SDL_IsWaitLockType(SDL_LockType type)
+{
+    return (type == SDL_LOCKTYPE_SEMAPHORE || type == SDL_LOCKTYPE_CONDITION) ? SDL_TRUE : SDL_FALSE;
+}
+
+static int SDLCALL SDL_CompareLockStats(const void *a, const void *b)
+{
+    const SDL_LockStats *A = (const SDL_LockStats *)a;
+    const SDL_LockStats *B = (const SDL_LockStats *)b;
+
+    if (SDL_IsWaitLockType(A->type) != SDL_IsWaitLockType(B->type)) {
+        return SDL_IsWaitLockType(A->type) ? 1 : -1;
+    }
+    if (A->wait_ns != B->wait_ns) {
+        return (A->wait_ns > B->wait_ns) ? -1 : 1;
+    }
+    if (A->contended != B->contended) {
+        return (A->contended > B->contended) ? -1 : 1;
+    }
+    if (A->acquisitions != B->acquisitions) {
+        return (A->acquisitions > B->acquisitions) ? -1 : 1;
+    }
+    return 0;
+}
+
+int SDL_GetLockStats(SDL_LockStats *stats, int count)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    SDL_LockStats *all;
+    int i, num_records, total = 0;
+
+    if (stats && count <= 0) {
+        return 0;
+    }
+
+    /* Allocate before taking the lock, since the allocator may use locks of its own */
+    all = (SDL_LockStats *)SDL_malloc(MAX_LOCK_RECORDS * sizeof(*all));
+    if (!all) {
+        return SDL_OutOfMemory();
+    }
+
+    SDL_LockStatsSpin(&SDL_lock_records_lock);
+    num_records = SDL_num_lock_records;
+    for (i = 0; i < num_records; ++i) {
+        SDL_LockRecord *record = &SDL_lock_records[i];
+        SDL_LockStats *entry = &all[total];
+
+        SDL_LockStatsSpin(&record->spinlock);
+        if (record->acquisitions > 0 && (record->lock || (record->name[0] && record->contended))) {
+            SDL_strlcpy(entry->name, record->name, sizeof(entry->name));
+            entry->lock = record->lock;
+            entry->type = record->type;
+            entry->acquisitions = record->acquisitions;
+            entry->contended = record->contended;
+            entry->wait_ns = SDL_PerformanceCounterToNS(record->wait_ticks, freq);
+            entry->max_wait_ns = SDL_PerformanceCounterToNS(record->max_wait_ticks, freq);
+            SDL_GetLockThreadName(SDL_IsWaitLockType(record->type) ? 0 : record->contended_holder, entry->holder, sizeof(entry->holder));
+            ++total;
+        }
+        SDL_AtomicUnlock(&record->spinlock);
+    }
+    SDL_AtomicUnlock(&SDL_lock_records_lock);
+
+    if (stats) {
+        SDL_qsort(all, total, sizeof(*all), SDL_CompareLockStats);
+        total = SDL_min(total, count);
+        SDL_memcpy(stats, all, total * sizeof(*stats));
+    }
+    SDL_free(all);
+
+    return total;
+}
+
+void SDL_LogLockStats(int count)
+{
+    static const char *types[] = { "mutex", "semaphore", "condition", "spinlock" };
+    SDL_LockStats *stats;
+    char name[32];
+    SDL_bool waits = SDL_FALSE;
+    int i;
+
+    if (count <= 0) {
+        return;
+    }
+
+    stats = (SDL_LockStats *)SDL_malloc(count * sizeof(*stats));
+    if (!stats) {
+        SDL_OutOfMemory();
+        return;
+    }
+
+    count = SDL_GetLockStats(stats, count);
+    for (i = 0; i < count; ++i) {
+        const SDL_LockStats *entry = &stats[i];
+
+        if (i == 0 && !SDL_IsWaitLockType(entry->type)) {
+            SDL_Log("Lock contention:\n");
+        }
+        if (!waits && SDL_IsWaitLockType(entry->type)) {
+            SDL_Log("Semaphore and condition variable waits:\n");
+            waits = SDL_TRUE;
+        }
+
+        if (entry->name[0]) {
+            SDL_strlcpy(name, entry->name, sizeof(name));
+        } else {
+            (void)SDL_snprintf(name, sizeof(name), "%p", entry->lock);
+        }
+        SDL_Log("%-31s %-9s %10" SDL_PRIu64 " acquired %10" SDL_PRIu64 " contended %10.3f ms waited %8.3f ms max%s%s\n",
+                name, types[entry->type], entry->acquisitions, entry->contended,
+                entry->wait_ns / 1000000.0, entry->max_wait_ns / 1000000.0,
+                entry->holder[0] ? "  held by " : "", entry->holder);
+    }
+    SDL_free(stats);
+}
+
+void SDL_ResetLockStats(void)
+{
+    int i, num_records;
+
+    SDL_LockStatsSpin(&SDL_lock_records_lock);
+    num_records = SDL_num_lock_records;
+    for (i = 0; i < num_records; ++i) {
+        SDL_LockRecord *record = &SDL_lock_records[i];
+
+        SDL_LockStatsSpin(&record->spinlock);
+        record->contended_holder = 0;
+        record->acquisitions = 0;
+        record->contended = 0;
+        record->wait_ticks = 0;
+        record->max_wait_ticks = 0;
+        SDL_AtomicUnlock(&record->spinlock);
+    }
+    SDL_AtomicUnlock(&SDL_lock_records_lock);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,51 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef SDL_lockstats_c_h_
+#define SDL_lockstats_c_h_
+
+#include "SDL_mutex.h"
+
+/* Lock contention statistics, enabled with SDL_HINT_LOCK_STATS.
+
+   The lock backends check SDL_lock_stats_enabled before doing anything else,
+   so the only cost while statistics are off is that test. When they are on,
+   a lock function first tries to take the lock without blocking. If that
+   fails it calls SDL_LockStatsWaitBegin() before blocking, and it passes the
+   result to SDL_LockStatsAcquired() once it has the lock. Uncontended
+   acquisitions pass 0.
+ */
+extern SDL_bool SDL_lock_stats_enabled;
+
+extern void SDL_InitLockStats(void);
+extern void SDL_QuitLockStats(void);
+
+extern Uint64 SDL_LockStatsWaitBegin(const void *lock, SDL_LockType type);
+extern void SDL_LockStatsAcquired(const void *lock, SDL_LockType type, Uint64 wait_start);
+extern void SDL_LockStatsDestroyed(const void *lock);
+
+/* Thread names are remembered so that lock holders can be reported by name */
+extern void SDL_LockStatsThreadStarted(const char *name);
+
+#endif /* SDL_lockstats_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -51,6 +51,13 @@ extern void SDL_SYS_SetupThread(const char *name);
 /* This function sets the current thread priority */
 extern int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority);
 
+/* This function restricts the current thread to a set of CPUs,
+   or lets it run anywhere if num_cpus is 0 */
+extern int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus);
+
+/* This function gets the CPUs the current thread may run on */
+extern int SDL_SYS_GetThreadAffinity(int *cpus, int max_cpus);
+
 /* This function waits for the thread to finish and frees any data
    allocated by SDL_SYS_CreateThread()
  */
@@ -22,11 +22,14 @@
 
 /* System independent thread management routines for SDL */
 
+#include "SDL_cpuinfo.h"
 #include "SDL_thread.h"
 #include "SDL_thread_c.h"
+#include "SDL_lockstats_c.h"
 #include "SDL_systhread.h"
 #include "SDL_hints.h"
 #include "../SDL_error_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
 /* The storage is local to the thread, but the IDs are global for the process */
 
@@ -316,6 +319,115 @@ SDL_error *SDL_GetErrBuf(void)
 #endif /* SDL_THREADS_DISABLED */
 }
 
+/* Finds the value for a thread name in a "name=value;prefix*=value" list */
+static SDL_bool SDL_GetThreadNameSetting(const char *list, const char *name, char *value, size_t maxlen)
+{
+    while (*list) {
+        const char *end = SDL_strchr(list, ';');
+        const char *equals = SDL_strchr(list, '=');
+
+        if (!end) {
+            end = list + SDL_strlen(list);
+        }
+        if (equals && equals < end) {
+            size_t len = (size_t)(equals - list);
+            SDL_bool match;
+
+            if (len > 0 && list[len - 1] == '*') {
+                match = (SDL_strncmp(name, list, len - 1) == 0) ? SDL_TRUE : SDL_FALSE;
+            } else {
+                match = (SDL_strlen(name) == len && SDL_strncmp(name, list, len) == 0) ? SDL_TRUE : SDL_FALSE;
+            }
+            if (match) {
+                SDL_strlcpy(value, equals + 1, SDL_min(maxlen, (size_t)(end - equals)));
+                return SDL_TRUE;
+            }
+        }
+        list = *end ? end + 1 : end;
+    }
+    return SDL_FALSE;
+}
+
+static int SDL_SetThreadAffinityFromString(const char *value)
+{
+    SDL_CPUCoreType core_type = SDL_CPU_CORE_UNKNOWN;
+    int *cpus;
+    int i, num_cpus, result;
+
+    if (SDL_strcmp(value, "performance") == 0) {
+        core_type = SDL_CPU_CORE_PERFORMANCE;
+    } else if (SDL_strcmp(value, "efficiency") == 0) {
+        core_type = SDL_CPU_CORE_EFFICIENCY;
+    }
+
+    if (core_type != SDL_CPU_CORE_UNKNOWN) {
+        SDL_LogicalCPU *logical_cpus;
+        int count = SDL_GetLogicalCPUs(NULL, 0);
+
+        if (count <= 0) {
+            return -1;
+        }
+        logical_cpus = (SDL_LogicalCPU *)SDL_malloc(count * (sizeof(*logical_cpus) + sizeof(*cpus)));
+        if (!logical_cpus) {
+            return SDL_OutOfMemory();
+        }
+        cpus = (int *)&logical_cpus[count];
+        count = SDL_min(SDL_GetLogicalCPUs(logical_cpus, count), count);
+        num_cpus = 0;
+        for (i = 0; i < count; ++i) {
+            if (logical_cpus[i].core_type == core_type) {
+                cpus[num_cpus++] = logical_cpus[i].id;
+            }
+        }
+        /* Without cores of different kinds, the thread can run anywhere */
+        result = num_cpus ? SDL_SYS_SetThreadAffinity(cpus, num_cpus) : 0;
+        SDL_free(logical_cpus);
+        return result;
+    }
+
+    num_cpus = SDL_ParseCPUList(value, NULL, 0);
+    if (num_cpus == 0) {
+        return SDL_SetError("Couldn't parse CPU list \"%s\"", value);
+    }
+    cpus = (int *)SDL_malloc(num_cpus * sizeof(*cpus));
+    if (!cpus) {
+        return SDL_OutOfMemory();
+    }
+    SDL_ParseCPUList(value, cpus, num_cpus);
+    result = SDL_SYS_SetThreadAffinity(cpus, num_cpus);
+    SDL_free(cpus);
+    return result;
+}
+
+/* Applies SDL_HINT_THREAD_AFFINITY and SDL_HINT_THREAD_PRIORITIES to a new thread */
+static void SDL_ApplyThreadNameHints(const char *name)
+{
+    const char *hint;
+    char value[256];
+
+    if (!name) {
+        return;
+    }
+
+    hint = SDL_GetHint(SDL_HINT_THREAD_AFFINITY);
+    if (hint && SDL_GetThreadNameSetting(hint, name, value, sizeof(value))) {
+        SDL_SetThreadAffinityFromString(value);
+    }
+
+    hint = SDL_GetHint(SDL_HINT_THREAD_PRIORITIES);
+    if (hint && SDL_GetThreadNameSetting(hint, name, value, sizeof(value))) {
+        if (SDL_strcmp(value, "low") == 0) {
+            SDL_SYS_SetThreadPriority(SDL_THREAD_PRIORITY_LOW);
+        } else if (SDL_strcmp(value, "normal") == 0) {
+            SDL_SYS_SetThreadPriority(SDL_THREAD_PRIORITY_NORMAL);
+        } else if (SDL_strcmp(value, "high") == 0) {
+            SDL_SYS_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+        } else if (SDL_strcmp(value, "time_critical") == 0) {
+            SDL_SYS_SetThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+        }
+    }
+}
+
 void SDL_RunThread(SDL_Thread *thread)
 {
     void *userdata = thread->userdata;
@@ -328,6 +440,8 @@ void SDL_RunThread(SDL_Thread *thread)
 
     /* Get the thread id */
     thread->threadid = SDL_ThreadID();
+    SDL_LockStatsThreadStarted(thread->name);
+    SDL_ApplyThreadNameHints(thread->name);
 
     /* Run the function */
     *statusloc = userfunc(userdata);
@@ -479,6 +593,22 @@ int SDL_SetThreadPriority(SDL_ThreadPriority priority)
     return SDL_SYS_SetThreadPriority(priority);
 }
 
+int SDL_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    if (num_cpus < 0 || (num_cpus > 0 && !cpus)) {
+        return SDL_InvalidParamError("cpus");
+    }
+    return SDL_SYS_SetThreadAffinity(cpus, num_cpus);
+}
+
+int SDL_GetThreadAffinity(int *cpus, int max_cpus)
+{
+    if (max_cpus < 0 || (max_cpus > 0 && !cpus)) {
+        return SDL_InvalidParamError("cpus");
+    }
+    return SDL_SYS_GetThreadAffinity(cpus, max_cpus);
+}
+
 void SDL_WaitThread(SDL_Thread *thread, int *status)
 {
     if (thread) {
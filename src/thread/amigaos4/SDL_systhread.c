@@ -287,6 +287,18 @@ SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return 0;
 }
 
+int
+SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    return SDL_Unsupported();
+}
+
+int
+SDL_SYS_GetThreadAffinity(int *cpus, int max_cpus)
+{
+    return SDL_Unsupported();
+}
+
 static BOOL
 OS4_StartJoining(OS4_ThreadNode * waiterNode, SDL_Thread * thread)
 {
@@ -0,0 +1,162 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+/* Condition variables built directly on Linux futexes.
+
+   Waiters sleep on a sequence number that every signal bumps, so a signal
+   sent between releasing the mutex and going to sleep isn't lost. Signaling
+   only enters the kernel when there is somebody waiting.
+ */
+
+#include <limits.h>
+
+#include "SDL_thread.h"
+#include "SDL_sysmutex_c.h"
+#include "../SDL_lockstats_c.h"
+
+struct SDL_cond
+{
+    int seq;
+    int waiters;
+};
+
+/* Create a condition variable */
+SDL_cond *SDL_CreateCond(void)
+{
+    SDL_cond *cond;
+
+    cond = (SDL_cond *)SDL_calloc(1, sizeof(*cond));
+    if (!cond) {
+        SDL_OutOfMemory();
+    }
+    return cond;
+}
+
+/* Destroy a condition variable */
+void SDL_DestroyCond(SDL_cond *cond)
+{
+    if (cond) {
+        SDL_LockStatsDestroyed(cond);
+        SDL_free(cond);
+    }
+}
+
+static void SDL_CondWake(SDL_cond *cond, int count)
+{
+    __atomic_add_fetch(&cond->seq, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&cond->waiters, __ATOMIC_SEQ_CST) > 0) {
+        SDL_FutexWake(&cond->seq, count);
+    }
+}
+
+/* Restart one of the threads that are waiting on the condition variable */
+int SDL_CondSignal(SDL_cond *cond)
+{
+    if (!cond) {
+        return SDL_InvalidParamError("cond");
+    }
+
+    SDL_CondWake(cond, 1);
+    return 0;
+}
+
+/* Restart all threads that are waiting on the condition variable */
+int SDL_CondBroadcast(SDL_cond *cond)
+{
+    if (!cond) {
+        return SDL_InvalidParamError("cond");
+    }
+
+    SDL_CondWake(cond, INT_MAX);
+    return 0;
+}
+
+static int SDL_CondWaitDeadline(SDL_cond *cond, SDL_mutex *mutex, const struct timespec *deadline)
+{
+    int retval = 0;
+    int seq, recursive;
+    Uint64 wait_start = 0;
+
+    if (!cond) {
+        return SDL_InvalidParamError("cond");
+    }
+    if (!mutex) {
+        return SDL_InvalidParamError("mutex");
+    }
+    if (__atomic_load_n(&mutex->owner, __ATOMIC_RELAXED) != pthread_self()) {
+        return SDL_SetError("mutex not owned by this thread");
+    }
+
+    if (SDL_lock_stats_enabled) {
+        wait_start = SDL_LockStatsWaitBegin(cond, SDL_LOCKTYPE_CONDITION);
+    }
+
+    __atomic_add_fetch(&cond->waiters, 1, __ATOMIC_SEQ_CST);
+    seq = __atomic_load_n(&cond->seq, __ATOMIC_SEQ_CST);
+
+    /* Release the mutex completely, even if it's locked recursively */
+    recursive = mutex->recursive;
+    mutex->recursive = 0;
+    SDL_UnlockMutex(mutex);
+
+    for (;;) {
+        if (SDL_FutexWait(&cond->seq, seq, deadline) == 0 || errno == EAGAIN) {
+            break;
+        }
+        if (errno == ETIMEDOUT) {
+            retval = SDL_MUTEX_TIMEDOUT;
+            break;
+        }
+    }
+
+    __atomic_sub_fetch(&cond->waiters, 1, __ATOMIC_SEQ_CST);
+
+    SDL_LockMutexContended(mutex);
+    __atomic_store_n(&mutex->owner, pthread_self(), __ATOMIC_RELAXED);
+    mutex->recursive = recursive;
+
+    if (retval == 0 && wait_start) {
+        SDL_LockStatsAcquired(cond, SDL_LOCKTYPE_CONDITION, wait_start);
+    }
+    return retval;
+}
+
+int SDL_CondWaitTimeout(SDL_cond *cond, SDL_mutex *mutex, Uint32 ms)
+{
+    struct timespec deadline;
+
+    if (ms == SDL_MUTEX_MAXWAIT) {
+        return SDL_CondWaitDeadline(cond, mutex, NULL);
+    }
+    SDL_FutexDeadline(ms, &deadline);
+    return SDL_CondWaitDeadline(cond, mutex, &deadline);
+}
+
+/* Wait on the condition variable, unlocking the provided mutex.
+   The mutex must be locked before entering this function!
+ */
+int SDL_CondWait(SDL_cond *cond, SDL_mutex *mutex)
+{
+    return SDL_CondWaitDeadline(cond, mutex, NULL);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,75 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#ifndef SDL_sysfutex_c_h_
+#define SDL_sysfutex_c_h_
+
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+
+/* The most times a thread spins on a busy lock before sleeping in the kernel */
+#define SDL_FUTEX_MAX_SPINS 100
+
+/* Sleep while *addr is still value, until woken or until the absolute
+   CLOCK_MONOTONIC deadline passes, if there is one.
+   Returns 0 when woken, or -1 with errno set to ETIMEDOUT, EAGAIN or EINTR.
+ */
+static SDL_INLINE int SDL_FutexWait(int *addr, int value, const struct timespec *deadline)
+{
+    return (int)syscall(SYS_futex, addr, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG, value, deadline, NULL, FUTEX_BITSET_MATCH_ANY);
+}
+
+/* Wake up to count threads sleeping on addr */
+static SDL_INLINE void SDL_FutexWake(int *addr, int count)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, count, NULL, NULL, 0);
+}
+
+/* The deadline is on the monotonic clock, so changing the system time
+   doesn't stretch or cut short a timeout.
+ */
+static SDL_INLINE void SDL_FutexDeadline(Uint32 ms, struct timespec *deadline)
+{
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+
+    deadline->tv_sec += ms / 1000;
+    deadline->tv_nsec += (long)(ms % 1000) * 1000000;
+    if (deadline->tv_nsec >= 1000000000) {
+        deadline->tv_sec += 1;
+        deadline->tv_nsec -= 1000000000;
+    }
+}
+
+/* Spinning only helps if the lock holder is running on another core */
+static SDL_INLINE SDL_bool SDL_FutexCanSpin(void)
+{
+    return (SDL_GetCPUCount() > 1) ? SDL_TRUE : SDL_FALSE;
+}
+
+#endif /* SDL_sysfutex_c_h_ */
+/* vi: set ts=4 sw=4 expandtab: */
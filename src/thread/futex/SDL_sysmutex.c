@@ -0,0 +1,177 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+/* Mutexes built directly on Linux futexes.
+
+   Locking an unlocked mutex is a single compare and swap, and unlocking one
+   that nobody is waiting for is a single exchange, so neither enters the
+   kernel. A thread that finds the mutex busy spins for a while, since the
+   owner is usually about to release it, and only then sleeps on the futex.
+   How long to spin adapts to how long spinning took to succeed recently.
+ */
+
+#include "SDL_thread.h"
+#include "SDL_sysmutex_c.h"
+#include "../SDL_lockstats_c.h"
+
+SDL_mutex *SDL_CreateMutex(void)
+{
+    SDL_mutex *mutex;
+
+    /* Allocate the structure */
+    mutex = (SDL_mutex *)SDL_calloc(1, sizeof(*mutex));
+    if (!mutex) {
+        SDL_OutOfMemory();
+    }
+    return mutex;
+}
+
+void SDL_DestroyMutex(SDL_mutex *mutex)
+{
+    if (mutex) {
+        SDL_LockStatsDestroyed(mutex);
+        SDL_free(mutex);
+    }
+}
+
+static SDL_bool SDL_TryLockMutexState(SDL_mutex *mutex)
+{
+    int expected = 0;
+
+    return __atomic_compare_exchange_n(&mutex->state, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Only the lock holder updates the spin estimate, but waiters read it without the lock */
+static void SDL_UpdateMutexSpins(SDL_mutex *mutex, int spins)
+{
+    const int estimate = __atomic_load_n(&mutex->spins, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&mutex->spins, estimate + (spins - estimate) / 8, __ATOMIC_RELAXED);
+}
+
+static void SDL_LockMutexSlow(SDL_mutex *mutex)
+{
+    int spins = 0;
+    int max_spins = 0;
+
+    if (SDL_FutexCanSpin()) {
+        max_spins = SDL_min(SDL_FUTEX_MAX_SPINS, __atomic_load_n(&mutex->spins, __ATOMIC_RELAXED) * 2 + 10);
+    }
+    while (spins < max_spins) {
+        ++spins;
+        SDL_CPUPauseInstruction();
+        if (__atomic_load_n(&mutex->state, __ATOMIC_RELAXED) == 0 && SDL_TryLockMutexState(mutex)) {
+            SDL_UpdateMutexSpins(mutex, spins);
+            return;
+        }
+    }
+
+    SDL_LockMutexContended(mutex);
+    SDL_UpdateMutexSpins(mutex, spins);
+}
+
+/* Lock the mutex */
+int SDL_LockMutex(SDL_mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS /* clang doesn't know about NULL mutexes */
+{
+    pthread_t this_thread;
+    Uint64 wait_start = 0;
+
+    if (mutex == NULL) {
+        return 0;
+    }
+
+    this_thread = pthread_self();
+    if (__atomic_load_n(&mutex->owner, __ATOMIC_RELAXED) == this_thread) {
+        ++mutex->recursive;
+        return 0;
+    }
+
+    if (!SDL_TryLockMutexState(mutex)) {
+        if (SDL_lock_stats_enabled) {
+            wait_start = SDL_LockStatsWaitBegin(mutex, SDL_LOCKTYPE_MUTEX);
+        }
+        SDL_LockMutexSlow(mutex);
+    }
+
+    /* The order of operations is important.
+       We set the locking thread id after we obtain the lock
+       so unlocks from other threads will fail.
+     */
+    __atomic_store_n(&mutex->owner, this_thread, __ATOMIC_RELAXED);
+    mutex->recursive = 0;
+
+    if (SDL_lock_stats_enabled) {
+        SDL_LockStatsAcquired(mutex, SDL_LOCKTYPE_MUTEX, wait_start);
+    }
+    return 0;
+}
+
+int SDL_TryLockMutex(SDL_mutex *mutex)
+{
+    pthread_t this_thread;
+
+    if (!mutex) {
+        return 0;
+    }
+
+    this_thread = pthread_self();
+    if (__atomic_load_n(&mutex->owner, __ATOMIC_RELAXED) == this_thread) {
+        ++mutex->recursive;
+        return 0;
+    }
+
+    if (!SDL_TryLockMutexState(mutex)) {
+        return SDL_MUTEX_TIMEDOUT;
+    }
+    __atomic_store_n(&mutex->owner, this_thread, __ATOMIC_RELAXED);
+    mutex->recursive = 0;
+    return 0;
+}
+
+int SDL_UnlockMutex(SDL_mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS /* clang doesn't know about NULL mutexes */
+{
+    if (mutex == NULL) {
+        return 0;
+    }
+
+    /* We can only unlock the mutex if we own it */
+    if (__atomic_load_n(&mutex->owner, __ATOMIC_RELAXED) != pthread_self()) {
+        return SDL_SetError("mutex not owned by this thread");
+    }
+
+    if (mutex->recursive) {
+        --mutex->recursive;
+    } else {
+        /* The order of operations is important.
+           First reset the owner so another thread doesn't lock
+           the mutex and set the ownership before we reset it,
+           then release the lock and wake a sleeper if there may be one.
+         */
+        __atomic_store_n(&mutex->owner, 0, __ATOMIC_RELAXED);
+        if (__atomic_exchange_n(&mutex->state, 0, __ATOMIC_RELEASE) == 2) {
+            SDL_FutexWake(&mutex->state, 1);
+        }
+    }
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,50 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#ifndef SDL_mutex_c_h_
+#define SDL_mutex_c_h_
+
+#include <pthread.h>
+
+#include "SDL_sysfutex_c.h"
+
+struct SDL_mutex
+{
+    int state; /* 0: unlocked, 1: locked, 2: locked and other threads may be sleeping */
+    int recursive;
+    int spins; /* running average of how long spinning took to get the lock */
+    pthread_t owner;
+};
+
+/* Take the lock the slow way, marking it as having sleepers.
+   The condition variable uses this after being woken up, since
+   other waiters are likely to be going after the mutex as well.
+ */
+static SDL_INLINE void SDL_LockMutexContended(SDL_mutex *mutex)
+{
+    while (__atomic_exchange_n(&mutex->state, 2, __ATOMIC_ACQUIRE) != 0) {
+        SDL_FutexWait(&mutex->state, 2, NULL);
+    }
+}
+
+#endif /* SDL_mutex_c_h_ */
+/* vi: set ts=4 sw=4 expandtab: */
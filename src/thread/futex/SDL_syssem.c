@@ -0,0 +1,191 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+/* Semaphores built directly on Linux futexes.
+
+   The count is the futex word. Waiting and posting only enter the kernel
+   when a thread actually has to sleep, or has to wake a sleeping thread.
+ */
+
+#include <limits.h>
+
+#include "SDL_thread.h"
+#include "SDL_sysfutex_c.h"
+#include "../SDL_lockstats_c.h"
+
+struct SDL_semaphore
+{
+    int count;
+    int waiters;
+};
+
+/* Create a semaphore, initialized with value */
+SDL_sem *SDL_CreateSemaphore(Uint32 initial_value)
+{
+    SDL_sem *sem;
+
+    if (initial_value > INT_MAX) {
+        SDL_InvalidParamError("initial_value");
+        return NULL;
+    }
+
+    sem = (SDL_sem *)SDL_malloc(sizeof(*sem));
+    if (sem) {
+        sem->count = (int)initial_value;
+        sem->waiters = 0;
+    } else {
+        SDL_OutOfMemory();
+    }
+    return sem;
+}
+
+void SDL_DestroySemaphore(SDL_sem *sem)
+{
+    if (sem) {
+        SDL_LockStatsDestroyed(sem);
+        SDL_free(sem);
+    }
+}
+
+static SDL_bool SDL_SemTryDecrement(SDL_sem *sem)
+{
+    int count = __atomic_load_n(&sem->count, __ATOMIC_SEQ_CST);
+
+    while (count > 0) {
+        if (__atomic_compare_exchange_n(&sem->count, &count, count - 1, 1, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+static int SDL_SemWaitDeadline(SDL_sem *sem, const struct timespec *deadline)
+{
+    int retval = SDL_MUTEX_TIMEDOUT;
+    Uint64 wait_start = 0;
+    int spins;
+
+    if (SDL_SemTryDecrement(sem)) {
+        if (SDL_lock_stats_enabled) {
+            SDL_LockStatsAcquired(sem, SDL_LOCKTYPE_SEMAPHORE, 0);
+        }
+        return 0;
+    }
+
+    if (SDL_lock_stats_enabled) {
+        wait_start = SDL_LockStatsWaitBegin(sem, SDL_LOCKTYPE_SEMAPHORE);
+    }
+
+    /* A post is often just about to happen, so spin a little before sleeping */
+    if (SDL_FutexCanSpin()) {
+        for (spins = 0; spins < SDL_FUTEX_MAX_SPINS; ++spins) {
+            SDL_CPUPauseInstruction();
+            if (__atomic_load_n(&sem->count, __ATOMIC_RELAXED) > 0 && SDL_SemTryDecrement(sem)) {
+                retval = 0;
+                break;
+            }
+        }
+    }
+
+    if (retval != 0) {
+        /* Posters check for waiters after raising the count,
+           so we have to be counted before checking the count again.
+         */
+        __atomic_add_fetch(&sem->waiters, 1, __ATOMIC_SEQ_CST);
+        for (;;) {
+            if (SDL_SemTryDecrement(sem)) {
+                retval = 0;
+                break;
+            }
+            if (SDL_FutexWait(&sem->count, 0, deadline) < 0 && errno == ETIMEDOUT) {
+                retval = SDL_SemTryDecrement(sem) ? 0 : SDL_MUTEX_TIMEDOUT;
+                break;
+            }
+        }
+        __atomic_sub_fetch(&sem->waiters, 1, __ATOMIC_SEQ_CST);
+    }
+
+    if (retval == 0 && wait_start) {
+        SDL_LockStatsAcquired(sem, SDL_LOCKTYPE_SEMAPHORE, wait_start);
+    }
+    return retval;
+}
+
+int SDL_SemTryWait(SDL_sem *sem)
+{
+    if (!sem) {
+        return SDL_InvalidParamError("sem");
+    }
+    return SDL_SemTryDecrement(sem) ? 0 : SDL_MUTEX_TIMEDOUT;
+}
+
+int SDL_SemWait(SDL_sem *sem)
+{
+    if (!sem) {
+        return SDL_InvalidParamError("sem");
+    }
+    return SDL_SemWaitDeadline(sem, NULL);
+}
+
+int SDL_SemWaitTimeout(SDL_sem *sem, Uint32 timeout)
+{
+    struct timespec deadline;
+
+    if (!sem) {
+        return SDL_InvalidParamError("sem");
+    }
+
+    /* Try the easy cases first */
+    if (timeout == 0) {
+        return SDL_SemTryWait(sem);
+    }
+    if (timeout == SDL_MUTEX_MAXWAIT) {
+        return SDL_SemWait(sem);
+    }
+
+    SDL_FutexDeadline(timeout, &deadline);
+    return SDL_SemWaitDeadline(sem, &deadline);
+}
+
+Uint32 SDL_SemValue(SDL_sem *sem)
+{
+    if (!sem) {
+        SDL_InvalidParamError("sem");
+        return 0;
+    }
+    return (Uint32)__atomic_load_n(&sem->count, __ATOMIC_RELAXED);
+}
+
+int SDL_SemPost(SDL_sem *sem)
+{
+    if (!sem) {
+        return SDL_InvalidParamError("sem");
+    }
+
+    __atomic_add_fetch(&sem->count, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) > 0) {
+        SDL_FutexWake(&sem->count, 1);
+    }
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,199 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+/* An implementation of read/write locks using a mutex and condition variables */
+
+#include "SDL_thread.h"
+#include "SDL_systhread_c.h"
+
+struct SDL_RWLock
+{
+#ifndef SDL_THREADS_DISABLED
+    SDL_mutex *lock;
+    SDL_cond *can_read;
+    SDL_cond *can_write;
+    int readers;         /* threads holding the lock for reading */
+    int waiting_writers; /* new readers wait while these are queued, so writers don't starve */
+    SDL_bool writing;
+#else
+    int unused;
+#endif
+};
+
+/* Create a read/write lock */
+SDL_RWLock *SDL_CreateRWLock(void)
+{
+    SDL_RWLock *rwlock;
+
+    rwlock = (SDL_RWLock *)SDL_calloc(1, sizeof(*rwlock));
+    if (!rwlock) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+#ifndef SDL_THREADS_DISABLED
+    rwlock->lock = SDL_CreateMutex();
+    rwlock->can_read = SDL_CreateCond();
+    rwlock->can_write = SDL_CreateCond();
+    if (!rwlock->lock || !rwlock->can_read || !rwlock->can_write) {
+        SDL_DestroyRWLock(rwlock);
+        return NULL;
+    }
+#endif /* !SDL_THREADS_DISABLED */
+
+    return rwlock;
+}
+
+/* Free the read/write lock */
+void SDL_DestroyRWLock(SDL_RWLock *rwlock)
+{
+    if (rwlock) {
+#ifndef SDL_THREADS_DISABLED
+        if (rwlock->lock) {
+            SDL_DestroyMutex(rwlock->lock);
+        }
+        if (rwlock->can_read) {
+            SDL_DestroyCond(rwlock->can_read);
+        }
+        if (rwlock->can_write) {
+            SDL_DestroyCond(rwlock->can_write);
+        }
+#endif
+        SDL_free(rwlock);
+    }
+}
+
+int SDL_LockRWLockForReading(SDL_RWLock *rwlock) SDL_NO_THREAD_SAFETY_ANALYSIS /* clang doesn't know about NULL mutexes */
+{
+#ifndef SDL_THREADS_DISABLED
+    if (rwlock == NULL) {
+        return 0;
+    }
+
+    if (SDL_LockMutex(rwlock->lock) < 0) {
+        return -1;
+    }
+    while (rwlock->writing || rwlock->waiting_writers) {
+        SDL_CondWait(rwlock->can_read, rwlock->lock);
+    }
+    ++rwlock->readers;
+    SDL_UnlockMutex(rwlock->lock);
+#endif
+    return 0;
+}
+
+int SDL_LockRWLockForWriting(SDL_RWLock *rwlock) SDL_NO_THREAD_SAFETY_ANALYSIS /* clang doesn't know about NULL mutexes */
+{
+#ifndef SDL_THREADS_DISABLED
+    if (rwlock == NULL) {
+        return 0;
+    }
+
+    if (SDL_LockMutex(rwlock->lock) < 0) {
+        return -1;
+    }
+    ++rwlock->waiting_writers;
+    while (rwlock->writing || rwlock->readers) {
+        SDL_CondWait(rwlock->can_write, rwlock->lock);
+    }
+    --rwlock->waiting_writers;
+    rwlock->writing = SDL_TRUE;
+    SDL_UnlockMutex(rwlock->lock);
+#endif
+    return 0;
+}
+
+int SDL_TryLockRWLockForReading(SDL_RWLock *rwlock)
+{
+    int retval = 0;
+
+#ifndef SDL_THREADS_DISABLED
+    if (rwlock == NULL) {
+        return 0;
+    }
+
+    if (SDL_LockMutex(rwlock->lock) < 0) {
+        return -1;
+    }
+    if (rwlock->writing || rwlock->waiting_writers) {
+        retval = SDL_MUTEX_TIMEDOUT;
+    } else {
+        ++rwlock->readers;
+    }
+    SDL_UnlockMutex(rwlock->lock);
+#endif
+    return retval;
+}
+
+int SDL_TryLockRWLockForWriting(SDL_RWLock *rwlock)
+{
+    int retval = 0;
+
+#ifndef SDL_THREADS_DISABLED
+    if (rwlock == NULL) {
+        return 0;
+    }
+
+    if (SDL_LockMutex(rwlock->lock) < 0) {
+        return -1;
+    }
+    if (rwlock->writing || rwlock->readers) {
+        retval = SDL_MUTEX_TIMEDOUT;
+    } else {
+        rwlock->writing = SDL_TRUE;
+    }
+    SDL_UnlockMutex(rwlock->lock);
+#endif
+    return retval;
+}
+
+int SDL_UnlockRWLock(SDL_RWLock *rwlock) SDL_NO_THREAD_SAFETY_ANALYSIS /* clang doesn't know about NULL mutexes */
+{
+#ifndef SDL_THREADS_DISABLED
+    if (rwlock == NULL) {
+        return 0;
+    }
+
+    if (SDL_LockMutex(rwlock->lock) < 0) {
+        return -1;
+    }
+    if (rwlock->writing) {
+        rwlock->writing = SDL_FALSE;
+    } else if (rwlock->readers > 0) {
+        --rwlock->readers;
+    } else {
+        SDL_UnlockMutex(rwlock->lock);
+        return SDL_SetError("rwlock not locked");
+    }
+
+    /* Writers go first; readers only run once none are waiting */
+    if (rwlock->readers == 0 && rwlock->waiting_writers) {
+        SDL_CondSignal(rwlock->can_write);
+    } else if (!rwlock->waiting_writers) {
+        SDL_CondBroadcast(rwlock->can_read);
+    }
+    SDL_UnlockMutex(rwlock->lock);
+#endif
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
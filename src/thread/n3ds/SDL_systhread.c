@@ -116,6 +116,16 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority sdl_priority)
     return (int)svcSetThreadPriority(CUR_THREAD_HANDLE, svc_priority);
 }
 
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    return SDL_Unsupported();
+}
+
+int SDL_SYS_GetThreadAffinity(int *cpus, int max_cpus)
+{
+    return SDL_Unsupported();
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     Result res = threadJoin(thread->handle, U64_MAX);
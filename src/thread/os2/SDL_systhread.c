@@ -108,6 +108,16 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return 0;
 }
 
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    return SDL_Unsupported();
+}
+
+int SDL_SYS_GetThreadAffinity(int *cpus, int max_cpus)
+{
+    return SDL_Unsupported();
+}
+
 void SDL_SYS_WaitThread(SDL_Thread * thread)
 {
     ULONG ulRC = DosWaitThread((PTID)&thread->handle, DCWW_WAIT);
@@ -134,6 +134,16 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return ChangeThreadPriority(GetThreadId(), value);
 }
 
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    return SDL_Unsupported();
+}
+
+int SDL_SYS_GetThreadAffinity(int *cpus, int max_cpus)
+{
+    return SDL_Unsupported();
+}
+
 #endif /* SDL_THREAD_PS2 */
 
 /* vim: ts=4 sw=4
@@ -28,6 +28,7 @@
 
 #include "SDL_thread.h"
 #include "SDL_sysmutex_c.h"
+#include "../SDL_lockstats_c.h"
 
 struct SDL_cond
 {
@@ -54,6 +55,7 @@ SDL_cond *SDL_CreateCond(void)
 void SDL_DestroyCond(SDL_cond *cond)
 {
     if (cond) {
+        SDL_LockStatsDestroyed(cond);
         pthread_cond_destroy(&cond->cond);
         SDL_free(cond);
     }
@@ -98,11 +100,16 @@ int SDL_CondWaitTimeout(SDL_cond *cond, SDL_mutex *mutex, Uint32 ms)
     struct timeval delta;
 #endif
     struct timespec abstime;
+    Uint64 wait_start = 0;
 
     if (!cond) {
         return SDL_InvalidParamError("cond");
     }
 
+    if (SDL_lock_stats_enabled) {
+        wait_start = SDL_LockStatsWaitBegin(cond, SDL_LOCKTYPE_CONDITION);
+    }
+
 #ifdef HAVE_CLOCK_GETTIME
     clock_gettime(CLOCK_REALTIME, &abstime);
 
@@ -129,6 +136,9 @@ tryagain:
         retval = SDL_MUTEX_TIMEDOUT;
         break;
     case 0:
+        if (wait_start) {
+            SDL_LockStatsAcquired(cond, SDL_LOCKTYPE_CONDITION, wait_start);
+        }
         break;
     default:
         retval = SDL_SetError("pthread_cond_timedwait() failed");
@@ -141,11 +151,21 @@ tryagain:
  */
 int SDL_CondWait(SDL_cond *cond, SDL_mutex *mutex)
 {
+    Uint64 wait_start = 0;
+
     if (!cond) {
         return SDL_InvalidParamError("cond");
-    } else if (pthread_cond_wait(&cond->cond, &mutex->id) != 0) {
+    }
+
+    if (SDL_lock_stats_enabled) {
+        wait_start = SDL_LockStatsWaitBegin(cond, SDL_LOCKTYPE_CONDITION);
+    }
+    if (pthread_cond_wait(&cond->cond, &mutex->id) != 0) {
         return SDL_SetError("pthread_cond_wait() failed");
     }
+    if (wait_start) {
+        SDL_LockStatsAcquired(cond, SDL_LOCKTYPE_CONDITION, wait_start);
+    }
     return 0;
 }
 
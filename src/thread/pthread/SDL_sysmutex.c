@@ -24,6 +24,7 @@
 #include <pthread.h>
 
 #include "SDL_thread.h"
+#include "../SDL_lockstats_c.h"
 
 #if !(defined(SDL_THREAD_PTHREAD_RECURSIVE_MUTEX) || \
     defined(SDL_THREAD_PTHREAD_RECURSIVE_MUTEX_NP))
@@ -69,6 +70,7 @@ SDL_mutex *SDL_CreateMutex(void)
 void SDL_DestroyMutex(SDL_mutex *mutex)
 {
     if (mutex) {
+        SDL_LockStatsDestroyed(mutex);
         pthread_mutex_destroy(&mutex->id);
         SDL_free(mutex);
     }
@@ -80,11 +82,20 @@ int SDL_LockMutex(SDL_mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS /* clang doesn
 #ifdef FAKE_RECURSIVE_MUTEX
     pthread_t this_thread;
 #endif
+    Uint64 wait_start = 0;
 
     if (mutex == NULL) {
         return 0;
     }
 
+    if (SDL_lock_stats_enabled) {
+        if (SDL_TryLockMutex(mutex) == 0) {
+            SDL_LockStatsAcquired(mutex, SDL_LOCKTYPE_MUTEX, 0);
+            return 0;
+        }
+        wait_start = SDL_LockStatsWaitBegin(mutex, SDL_LOCKTYPE_MUTEX);
+    }
+
 #ifdef FAKE_RECURSIVE_MUTEX
     this_thread = pthread_self();
     if (mutex->owner == this_thread) {
@@ -106,6 +117,9 @@ int SDL_LockMutex(SDL_mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS /* clang doesn
         return SDL_SetError("pthread_mutex_lock() failed");
     }
 #endif
+    if (wait_start) {
+        SDL_LockStatsAcquired(mutex, SDL_LOCKTYPE_MUTEX, wait_start);
+    }
     return 0;
 }
 
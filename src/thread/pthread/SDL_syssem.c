@@ -28,6 +28,7 @@
 
 #include "SDL_thread.h"
 #include "SDL_timer.h"
+#include "../SDL_lockstats_c.h"
 
 /* Wrapper around POSIX 1003.1b semaphores */
 
@@ -60,6 +61,7 @@ SDL_sem *SDL_CreateSemaphore(Uint32 initial_value)
 void SDL_DestroySemaphore(SDL_sem *sem)
 {
     if (sem) {
+        SDL_LockStatsDestroyed(sem);
         sem_destroy(&sem->sem);
         SDL_free(sem);
     }
@@ -82,17 +84,28 @@ int SDL_SemTryWait(SDL_sem *sem)
 int SDL_SemWait(SDL_sem *sem)
 {
     int retval;
+    Uint64 wait_start = 0;
 
     if (!sem) {
         return SDL_InvalidParamError("sem");
     }
 
+    if (SDL_lock_stats_enabled) {
+        if (sem_trywait(&sem->sem) == 0) {
+            SDL_LockStatsAcquired(sem, SDL_LOCKTYPE_SEMAPHORE, 0);
+            return 0;
+        }
+        wait_start = SDL_LockStatsWaitBegin(sem, SDL_LOCKTYPE_SEMAPHORE);
+    }
+
     do {
         retval = sem_wait(&sem->sem);
     } while (retval < 0 && errno == EINTR);
 
     if (retval < 0) {
         retval = SDL_SetError("sem_wait() failed");
+    } else if (wait_start) {
+        SDL_LockStatsAcquired(sem, SDL_LOCKTYPE_SEMAPHORE, wait_start);
     }
     return retval;
 }
@@ -108,6 +121,7 @@ int SDL_SemWaitTimeout(SDL_sem *sem, Uint32 timeout)
 #else
     Uint32 end;
 #endif
+    Uint64 wait_start = 0;
 
     if (!sem) {
         return SDL_InvalidParamError("sem");
@@ -121,6 +135,14 @@ int SDL_SemWaitTimeout(SDL_sem *sem, Uint32 timeout)
         return SDL_SemWait(sem);
     }
 
+    if (SDL_lock_stats_enabled) {
+        if (sem_trywait(&sem->sem) == 0) {
+            SDL_LockStatsAcquired(sem, SDL_LOCKTYPE_SEMAPHORE, 0);
+            return 0;
+        }
+        wait_start = SDL_LockStatsWaitBegin(sem, SDL_LOCKTYPE_SEMAPHORE);
+    }
+
 #ifdef HAVE_SEM_TIMEDWAIT
     /* Setup the timeout. sem_timedwait doesn't wait for
      * a lapse of time, but until we reach a certain time.
@@ -168,6 +190,9 @@ int SDL_SemWaitTimeout(SDL_sem *sem, Uint32 timeout)
     }
 #endif /* HAVE_SEM_TIMEDWAIT */
 
+    if (retval == 0 && wait_start) {
+        SDL_LockStatsAcquired(sem, SDL_LOCKTYPE_SEMAPHORE, wait_start);
+    }
     return retval;
 }
 
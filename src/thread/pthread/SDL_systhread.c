@@ -31,6 +31,7 @@
 
 #include <signal.h>
 #include <errno.h>
+#include <sched.h>
 
 #ifdef __LINUX__
 #include <sys/time.h>
@@ -285,6 +286,59 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
 #endif /* #if __NACL__ || __RISCOS__ */
 }
 
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+#if defined(__LINUX__) || defined(__ANDROID__)
+    cpu_set_t set;
+    int i;
+
+    CPU_ZERO(&set);
+    if (num_cpus == 0) {
+        /* The kernel leaves out CPUs that don't exist or aren't allowed */
+        for (i = 0; i < CPU_SETSIZE; ++i) {
+            CPU_SET(i, &set);
+        }
+    } else {
+        for (i = 0; i < num_cpus; ++i) {
+            if (cpus[i] < 0 || cpus[i] >= CPU_SETSIZE) {
+                return SDL_InvalidParamError("cpus");
+            }
+            CPU_SET(cpus[i], &set);
+        }
+    }
+    /* On Linux, pid 0 is the calling thread rather than the whole process */
+    if (sched_setaffinity(0, sizeof(set), &set) < 0) {
+        return SDL_SetError("sched_setaffinity() failed");
+    }
+    return 0;
+#else
+    return SDL_Unsupported();
+#endif
+}
+
+int SDL_SYS_GetThreadAffinity(int *cpus, int max_cpus)
+{
+#if defined(__LINUX__) || defined(__ANDROID__)
+    cpu_set_t set;
+    int i, count = 0;
+
+    if (sched_getaffinity(0, sizeof(set), &set) < 0) {
+        return SDL_SetError("sched_getaffinity() failed");
+    }
+    for (i = 0; i < CPU_SETSIZE; ++i) {
+        if (CPU_ISSET(i, &set)) {
+            if (count < max_cpus) {
+                cpus[count] = i;
+            }
+            ++count;
+        }
+    }
+    return count;
+#else
+    return SDL_Unsupported();
+#endif
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     pthread_join(thread->handle, 0);
@@ -25,6 +25,7 @@
 
 #include "../generic/SDL_syscond_c.h"
 #include "SDL_sysmutex_c.h"
+#include "../SDL_lockstats_c.h"
 
 typedef SDL_cond *(*pfnSDL_CreateCond)(void);
 typedef void (*pfnSDL_DestroyCond)(SDL_cond *);
@@ -261,6 +262,9 @@ SDL_cond *SDL_CreateCond(void)
 
 void SDL_DestroyCond(SDL_cond *cond)
 {
+    if (cond) {
+        SDL_LockStatsDestroyed(cond);
+    }
     SDL_cond_impl_active.Destroy(cond);
 }
 
@@ -276,11 +280,26 @@ int SDL_CondBroadcast(SDL_cond *cond)
 
 int SDL_CondWaitTimeout(SDL_cond *cond, SDL_mutex *mutex, Uint32 ms)
 {
-    return SDL_cond_impl_active.WaitTimeout(cond, mutex, ms);
+    Uint64 wait_start;
+    int retval;
+
+    if (!SDL_lock_stats_enabled || !cond) {
+        return SDL_cond_impl_active.WaitTimeout(cond, mutex, ms);
+    }
+
+    wait_start = SDL_LockStatsWaitBegin(cond, SDL_LOCKTYPE_CONDITION);
+    retval = SDL_cond_impl_active.WaitTimeout(cond, mutex, ms);
+    if (retval == 0) {
+        SDL_LockStatsAcquired(cond, SDL_LOCKTYPE_CONDITION, wait_start);
+    }
+    return retval;
 }
 
 int SDL_CondWait(SDL_cond *cond, SDL_mutex *mutex)
 {
+    if (SDL_lock_stats_enabled) {
+        return SDL_CondWaitTimeout(cond, mutex, SDL_MUTEX_MAXWAIT);
+    }
     return SDL_cond_impl_active.Wait(cond, mutex);
 }
 
@@ -34,6 +34,7 @@
 #include "SDL_hints.h"
 
 #include "SDL_sysmutex_c.h"
+#include "../SDL_lockstats_c.h"
 
 /* Implementation will be chosen at runtime based on available Kernel features */
 SDL_mutex_impl_t SDL_mutex_impl_active = { 0 };
@@ -254,17 +255,34 @@ SDL_mutex *SDL_CreateMutex(void)
 void SDL_DestroyMutex(SDL_mutex *mutex)
 {
     if (mutex) {
+        SDL_LockStatsDestroyed(mutex);
         SDL_mutex_impl_active.Destroy(mutex);
     }
 }
 
 int SDL_LockMutex(SDL_mutex *mutex)
 {
+    Uint64 wait_start;
+    int retval;
+
     if (!mutex) {
         return 0;
     }
 
-    return SDL_mutex_impl_active.Lock(mutex);
+    if (!SDL_lock_stats_enabled) {
+        return SDL_mutex_impl_active.Lock(mutex);
+    }
+
+    if (SDL_mutex_impl_active.TryLock(mutex) == 0) {
+        SDL_LockStatsAcquired(mutex, SDL_LOCKTYPE_MUTEX, 0);
+        return 0;
+    }
+    wait_start = SDL_LockStatsWaitBegin(mutex, SDL_LOCKTYPE_MUTEX);
+    retval = SDL_mutex_impl_active.Lock(mutex);
+    if (retval == 0) {
+        SDL_LockStatsAcquired(mutex, SDL_LOCKTYPE_MUTEX, wait_start);
+    }
+    return retval;
 }
 
 int SDL_TryLockMutex(SDL_mutex *mutex)
@@ -38,6 +38,7 @@
 #include "SDL_hints.h"
 #include "SDL_thread.h"
 #include "SDL_timer.h"
+#include "../SDL_lockstats_c.h"
 
 typedef SDL_sem * (*pfnSDL_CreateSemaphore)(Uint32);
 typedef void (*pfnSDL_DestroySemaphore)(SDL_sem *);
@@ -411,12 +412,31 @@ SDL_sem *SDL_CreateSemaphore(Uint32 initial_value)
 
 void SDL_DestroySemaphore(SDL_sem *sem)
 {
+    if (sem) {
+        SDL_LockStatsDestroyed(sem);
+    }
     SDL_sem_impl_active.Destroy(sem);
 }
 
 int SDL_SemWaitTimeout(SDL_sem *sem, Uint32 timeout)
 {
-    return SDL_sem_impl_active.WaitTimeout(sem, timeout);
+    Uint64 wait_start;
+    int retval;
+
+    if (!SDL_lock_stats_enabled || !sem || timeout == 0) {
+        return SDL_sem_impl_active.WaitTimeout(sem, timeout);
+    }
+
+    if (SDL_sem_impl_active.TryWait(sem) == 0) {
+        SDL_LockStatsAcquired(sem, SDL_LOCKTYPE_SEMAPHORE, 0);
+        return 0;
+    }
+    wait_start = SDL_LockStatsWaitBegin(sem, SDL_LOCKTYPE_SEMAPHORE);
+    retval = SDL_sem_impl_active.WaitTimeout(sem, timeout);
+    if (retval == 0) {
+        SDL_LockStatsAcquired(sem, SDL_LOCKTYPE_SEMAPHORE, wait_start);
+    }
+    return retval;
 }
 
 int SDL_SemTryWait(SDL_sem *sem)
@@ -426,6 +446,9 @@ int SDL_SemTryWait(SDL_sem *sem)
 
 int SDL_SemWait(SDL_sem *sem)
 {
+    if (SDL_lock_stats_enabled) {
+        return SDL_SemWaitTimeout(sem, SDL_MUTEX_MAXWAIT);
+    }
     return SDL_sem_impl_active.Wait(sem);
 }
 
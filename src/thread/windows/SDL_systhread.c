@@ -188,6 +188,57 @@ int SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return 0;
 }
 
+int SDL_SYS_SetThreadAffinity(const int *cpus, int num_cpus)
+{
+    DWORD_PTR mask = 0;
+    DWORD_PTR system_mask;
+    int i;
+
+    /* Only the CPUs in the thread's processor group can be used */
+    if (num_cpus == 0) {
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &mask, &system_mask)) {
+            return WIN_SetError("GetProcessAffinityMask()");
+        }
+    } else {
+        for (i = 0; i < num_cpus; ++i) {
+            if (cpus[i] < 0 || cpus[i] >= (int)(sizeof(mask) * 8)) {
+                return SDL_InvalidParamError("cpus");
+            }
+            mask |= (DWORD_PTR)1 << cpus[i];
+        }
+    }
+    if (!SetThreadAffinityMask(GetCurrentThread(), mask)) {
+        return WIN_SetError("SetThreadAffinityMask()");
+    }
+    return 0;
+}
+
+int SDL_SYS_GetThreadAffinity(int *cpus, int max_cpus)
+{
+    DWORD_PTR process_mask, system_mask, mask;
+    int i, count = 0;
+
+    /* There's no way to read the thread's mask except by replacing it */
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+        return WIN_SetError("GetProcessAffinityMask()");
+    }
+    mask = SetThreadAffinityMask(GetCurrentThread(), process_mask);
+    if (!mask) {
+        return WIN_SetError("SetThreadAffinityMask()");
+    }
+    SetThreadAffinityMask(GetCurrentThread(), mask);
+
+    for (i = 0; i < (int)(sizeof(mask) * 8); ++i) {
+        if (mask & ((DWORD_PTR)1 << i)) {
+            if (count < max_cpus) {
+                cpus[count] = i;
+            }
+            ++count;
+        }
+    }
+    return count;
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     WaitForSingleObjectEx(thread->handle, INFINITE, FALSE);
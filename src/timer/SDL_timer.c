@@ -23,9 +23,41 @@
 #include "SDL_timer.h"
 #include "SDL_timer_c.h"
 #include "SDL_atomic.h"
+#include "SDL_hints.h"
 #include "SDL_cpuinfo.h"
 #include "../thread/SDL_systhread.h"
 
+#if defined(SDL_TIMER_UNIX) && defined(HAVE_NANOSLEEP) && !defined(__EMSCRIPTEN__)
+#define SDL_DELAYNS_NANOSLEEP
+#include <errno.h>
+#include <time.h>
+#endif
+
+/* SDL_DelayNS() stops sleeping this long before the target and spins the
+   rest of the way, since sleeps can overshoot by the scheduler's timer slack
+   or, going through SDL_Delay(), by up to a millisecond of rounding. */
+#ifdef SDL_DELAYNS_NANOSLEEP
+#define DELAYNS_SPIN_NS 200000
+#else
+#define DELAYNS_SPIN_NS 2000000
+#endif
+
+#define NS_PER_MS 1000000
+
+static void SDL_SleepNS(Uint64 ns)
+{
+#ifdef SDL_DELAYNS_NANOSLEEP
+    struct timespec tv;
+
+    tv.tv_sec = (time_t)(ns / 1000000000);
+    tv.tv_nsec = (long)(ns % 1000000000);
+    /* An interrupted sleep just returns early; the caller checks the clock */
+    nanosleep(&tv, NULL);
+#else
+    SDL_Delay((Uint32)SDL_min(ns / 1000000, 0xFFFFFFFF));
+#endif
+}
+
 /* #define DEBUG_TIMERS */
 
 #if !defined(__EMSCRIPTEN__) || !defined(SDL_THREADS_DISABLED)
@@ -34,9 +66,10 @@ typedef struct _SDL_Timer
 {
     int timerID;
     SDL_TimerCallback callback;
+    SDL_NSTimerCallback callback_ns;
     void *param;
-    Uint32 interval;
-    Uint32 scheduled;
+    Uint64 interval;  /* nanoseconds */
+    Uint64 scheduled; /* performance counter */
     SDL_atomic_t canceled;
     struct _SDL_Timer *next;
 } SDL_Timer;
@@ -56,6 +89,7 @@ typedef struct
     SDL_atomic_t nextID;
     SDL_TimerMap *timermap;
     SDL_mutex *timermap_lock;
+    SDL_atomic_t slack_us;
 
     /* Padding to separate cache lines between threads */
     char cache_pad[SDL_CACHELINE_SIZE];
@@ -66,6 +100,8 @@ typedef struct
     SDL_Timer *pending;
     SDL_Timer *freelist;
     SDL_atomic_t active;
+    Uint64 sleep_until;   /* 0 while the timer thread is awake */
+    SDL_bool wakeup_sent; /* the semaphore was posted for this sleep */
 
     /* List of timers - this is only touched by the timer thread */
     SDL_Timer *timers;
@@ -73,19 +109,39 @@ typedef struct
 
 static SDL_TimerData SDL_timer_data;
 
+/* Semaphore waits only have millisecond precision, so the timer thread
+   waits on the semaphore until the deadline is this close and sleeps the
+   rest of the way. New timers can't interrupt that last sleep, so they may
+   be up to this late if they're due before the current deadline. */
+#ifdef SDL_DELAYNS_NANOSLEEP
+#define TIMER_PRECISE_SLEEP_NS (2 * NS_PER_MS)
+#endif
+
 /* The idea here is that any thread might add a timer, but a single
  * thread manages the active timer queue, sorted by scheduling time.
  *
  * Timers are removed by simply setting a canceled flag
  */
 
+static void SDLCALL SDL_TimerSlackChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_TimerData *data = (SDL_TimerData *)userdata;
+
+    SDL_AtomicSet(&data->slack_us, hint ? SDL_max(SDL_atoi(hint), 0) : 0);
+}
+
+static Uint64 SDL_GetTimerSlack(SDL_TimerData *data, Uint64 freq)
+{
+    return SDL_NSToPerformanceCounter((Uint64)SDL_AtomicGet(&data->slack_us) * 1000, freq);
+}
+
 static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
 {
     SDL_Timer *prev, *curr;
 
     prev = NULL;
     for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if ((Sint32)(timer->scheduled - curr->scheduled) < 0) {
+        if (timer->scheduled < curr->scheduled) {
             break;
         }
     }
@@ -99,19 +155,36 @@ static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
     timer->next = curr;
 }
 
+/* Wait for up to ns nanoseconds, or until a timer is added that's due sooner */
+static void SDL_TimerSleep(SDL_TimerData *data, Uint64 ns)
+{
+#ifdef SDL_DELAYNS_NANOSLEEP
+    if (ns <= TIMER_PRECISE_SLEEP_NS) {
+        SDL_SleepNS(ns);
+        return;
+    }
+    ns -= NS_PER_MS;
+    SDL_SemWaitTimeout(data->sem, (Uint32)SDL_min(ns / NS_PER_MS, SDL_MUTEX_MAXWAIT - 1));
+#else
+    SDL_SemWaitTimeout(data->sem, (Uint32)SDL_min((ns + NS_PER_MS - 1) / NS_PER_MS, SDL_MUTEX_MAXWAIT - 1));
+#endif
+}
+
 static int SDLCALL SDL_TimerThread(void *_data)
 {
     SDL_TimerData *data = (SDL_TimerData *)_data;
+    const Uint64 freq = SDL_GetPerformanceFrequency();
     SDL_Timer *pending;
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
-    Uint32 tick, now, interval, delay;
+    Uint64 tick, now, interval, wake;
+    SDL_bool sleep;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
      *  2. Handle any timers that should dispatch this cycle
-     *  3. Wait until next dispatch time or new timer arrives
+     *  3. Wait until next dispatch time or a sooner timer arrives
      */
     for (;;) {
         /* Pending and freelist maintenance */
@@ -121,6 +194,10 @@ static int SDLCALL SDL_TimerThread(void *_data)
             pending = data->pending;
             data->pending = NULL;
 
+            /* We're awake, so timers added from here on don't need to wake us */
+            data->sleep_until = 0;
+            data->wakeup_sent = SDL_FALSE;
+
             /* Make any unused timer structures available */
             if (freelist_head) {
                 freelist_tail->next = data->freelist;
@@ -143,18 +220,14 @@ static int SDLCALL SDL_TimerThread(void *_data)
             break;
         }
 
-        /* Initial delay if there are no timers */
-        delay = SDL_MUTEX_MAXWAIT;
-
-        tick = SDL_GetTicks();
+        tick = SDL_GetPerformanceCounter();
 
-        /* Process all the pending timers for this tick */
+        /* Process all the timers that are due */
         while (data->timers) {
             current = data->timers;
 
-            if ((Sint32)(tick - current->scheduled) < 0) {
-                /* Scheduled for the future, wait a bit */
-                delay = (current->scheduled - tick);
+            if (current->scheduled > tick) {
+                /* Scheduled for the future */
                 break;
             }
 
@@ -163,14 +236,28 @@ static int SDLCALL SDL_TimerThread(void *_data)
 
             if (SDL_AtomicGet(&current->canceled)) {
                 interval = 0;
+            } else if (current->callback_ns) {
+                interval = current->callback_ns(current->interval, current->param);
             } else {
-                interval = current->callback(current->interval, current->param);
+                interval = (Uint64)current->callback((Uint32)(current->interval / NS_PER_MS), current->param) * NS_PER_MS;
             }
 
             if (interval > 0) {
-                /* Reschedule this timer */
+                const Uint64 ticks = SDL_NSToPerformanceCounter(interval, freq);
+
                 current->interval = interval;
-                current->scheduled = tick + interval;
+                if (current->callback_ns) {
+                    /* Reschedule this timer on its original timeline, skipping
+                       any deadlines that have already passed */
+                    current->scheduled += ticks;
+                    if (current->scheduled <= tick) {
+                        current->scheduled += ((tick - current->scheduled) / ticks + 1) * ticks;
+                    }
+                } else {
+                    /* SDL_AddTimer() timers have always been rescheduled from
+                       when this pass started, so keep doing that */
+                    current->scheduled = tick + ticks;
+                }
                 SDL_AddTimerInternal(data, current);
             } else {
                 if (!freelist_head) {
@@ -185,21 +272,35 @@ static int SDLCALL SDL_TimerThread(void *_data)
             }
         }
 
-        /* Adjust the delay based on processing time */
-        now = SDL_GetTicks();
-        interval = (now - tick);
-        if (interval > delay) {
-            delay = 0;
+        /* Wake up for the next deadline, letting it slip by the allowed
+           slack so that any other timers due by then fire in the same pass */
+        if (data->timers) {
+            wake = data->timers->scheduled + SDL_GetTimerSlack(data, freq);
         } else {
-            delay -= interval;
+            wake = SDL_MAX_UINT64;
         }
 
-        /* Note that each time a timer is added, this will return
-           immediately, but we process the timers added all at once.
-           That's okay, it just means we run through the loop a few
-           extra times.
-         */
-        SDL_SemWaitTimeout(data->sem, delay);
+        SDL_AtomicLock(&data->lock);
+        {
+            /* Timers added while we were busy didn't wake us, so look at them first */
+            sleep = data->pending ? SDL_FALSE : SDL_TRUE;
+            if (sleep) {
+                data->sleep_until = wake;
+            }
+        }
+        SDL_AtomicUnlock(&data->lock);
+
+        if (!sleep) {
+            continue;
+        }
+        if (wake == SDL_MAX_UINT64) {
+            SDL_SemWait(data->sem);
+        } else {
+            now = SDL_GetPerformanceCounter();
+            if (wake > now) {
+                SDL_TimerSleep(data, SDL_PerformanceCounterToNS(wake - now, freq));
+            }
+        }
     }
     return 0;
 }
@@ -221,6 +322,12 @@ int SDL_TimerInit(void)
             return -1;
         }
 
+        SDL_SetLockName(&data->lock, "SDL_timer_data.lock");
+        SDL_SetLockName(data->timermap_lock, "SDL_timer_data.timermap_lock");
+        SDL_SetLockName(data->sem, "SDL_timer_data.sem");
+
+        SDL_AddHintCallback(SDL_HINT_TIMER_SLACK, SDL_TimerSlackChanged, data);
+
         SDL_AtomicSet(&data->active, 1);
 
         /* Timer threads use a callback into the app, so we can't set a limited stack size here. */
@@ -249,8 +356,12 @@ void SDL_TimerQuit(void)
             data->thread = NULL;
         }
 
+        SDL_DelHintCallback(SDL_HINT_TIMER_SLACK, SDL_TimerSlackChanged, data);
+
         SDL_DestroySemaphore(data->sem);
         data->sem = NULL;
+        data->sleep_until = 0;
+        data->wakeup_sent = SDL_FALSE;
 
         /* Clean up the timer entries */
         while (data->timers) {
@@ -274,11 +385,13 @@ void SDL_TimerQuit(void)
     }
 }
 
-SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
+static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback, SDL_NSTimerCallback callback_ns, void *param)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
     SDL_TimerMap *entry;
+    Uint64 freq;
+    SDL_bool wakeup = SDL_FALSE;
 
     SDL_AtomicLock(&data->lock);
     if (!SDL_AtomicGet(&data->active)) {
@@ -303,11 +416,13 @@ SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *para
             return 0;
         }
     }
+    freq = SDL_GetPerformanceFrequency();
     timer->timerID = SDL_AtomicIncRef(&data->nextID);
     timer->callback = callback;
+    timer->callback_ns = callback_ns;
     timer->param = param;
     timer->interval = interval;
-    timer->scheduled = SDL_GetTicks() + interval;
+    timer->scheduled = SDL_GetPerformanceCounter() + SDL_NSToPerformanceCounter(interval, freq);
     SDL_AtomicSet(&timer->canceled, 0);
 
     entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
@@ -328,14 +443,33 @@ SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *para
     SDL_AtomicLock(&data->lock);
     timer->next = data->pending;
     data->pending = timer;
+
+    /* Wake up the timer thread only if it's asleep and wouldn't wake in time
+       for this timer. One wakeup picks up every timer added since, and an
+       awake timer thread checks the pending list before it sleeps again. */
+    if (!data->wakeup_sent && timer->scheduled + SDL_GetTimerSlack(data, freq) < data->sleep_until) {
+        data->wakeup_sent = SDL_TRUE;
+        wakeup = SDL_TRUE;
+    }
     SDL_AtomicUnlock(&data->lock);
 
-    /* Wake up the timer thread if necessary */
-    SDL_SemPost(data->sem);
+    if (wakeup) {
+        SDL_SemPost(data->sem);
+    }
 
     return entry->timerID;
 }
 
+SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
+{
+    return SDL_CreateTimer((Uint64)interval * NS_PER_MS, callback, NULL, param);
+}
+
+SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *param)
+{
+    return SDL_CreateTimer(interval, NULL, callback, param);
+}
+
 SDL_bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
@@ -378,6 +512,8 @@ typedef struct _SDL_TimerMap
     int timeoutID;
     Uint32 interval;
     SDL_TimerCallback callback;
+    Uint64 interval_ns;
+    SDL_NSTimerCallback callback_ns;
     void *param;
     struct _SDL_TimerMap *next;
 } SDL_TimerMap;
@@ -401,6 +537,17 @@ static void SDL_Emscripten_TimerHelper(void *userdata)
     }
 }
 
+static void SDL_Emscripten_TimerHelperNS(void *userdata)
+{
+    SDL_TimerMap *entry = (SDL_TimerMap *)userdata;
+    entry->interval_ns = entry->callback_ns(entry->interval_ns, entry->param);
+    if (entry->interval_ns > 0) {
+        entry->timeoutID = emscripten_set_timeout(&SDL_Emscripten_TimerHelperNS,
+                                                  (double)entry->interval_ns / NS_PER_MS,
+                                                  entry);
+    }
+}
+
 int SDL_TimerInit(void)
 {
     return 0;
@@ -430,6 +577,7 @@ SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *para
     }
     entry->timerID = ++data->nextID;
     entry->callback = callback;
+    entry->callback_ns = NULL;
     entry->param = param;
     entry->interval = interval;
 
@@ -443,6 +591,32 @@ SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *para
     return entry->timerID;
 }
 
+SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *param)
+{
+    SDL_TimerData *data = &SDL_timer_data;
+    SDL_TimerMap *entry;
+
+    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
+    if (!entry) {
+        SDL_OutOfMemory();
+        return 0;
+    }
+    entry->timerID = ++data->nextID;
+    entry->callback = NULL;
+    entry->callback_ns = callback;
+    entry->param = param;
+    entry->interval_ns = interval;
+
+    entry->timeoutID = emscripten_set_timeout(&SDL_Emscripten_TimerHelperNS,
+                                              (double)entry->interval_ns / NS_PER_MS,
+                                              entry);
+
+    entry->next = data->timermap;
+    data->timermap = entry;
+
+    return entry->timerID;
+}
+
 SDL_bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
@@ -481,4 +655,130 @@ Uint32 SDL_GetTicks(void)
     return (Uint32)(SDL_GetTicks64() & 0xFFFFFFFF);
 }
 
+Uint64 SDL_NSToPerformanceCounter(Uint64 ns, Uint64 freq)
+{
+    if (ns / 1000000000 + 1 >= SDL_MAX_UINT64 / freq) {
+        return SDL_MAX_UINT64;
+    }
+    return ((ns / 1000000000) * freq) + (((ns % 1000000000) * freq) + 999999999) / 1000000000;
+}
+
+Uint64 SDL_PerformanceCounterToNS(Uint64 ticks, Uint64 freq)
+{
+    if (ticks / freq + 1 >= SDL_MAX_UINT64 / 1000000000) {
+        return SDL_MAX_UINT64;
+    }
+    return ((ticks / freq) * 1000000000) + (((ticks % freq) * 1000000000) + freq - 1) / freq;
+}
+
+void SDL_DelayNS(Uint64 ns)
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const Uint64 ticks = SDL_NSToPerformanceCounter(ns, freq);
+    /* Clamp the deadline instead of wrapping around for huge delays */
+    const Uint64 target = (ticks > SDL_MAX_UINT64 - start) ? SDL_MAX_UINT64 : (start + ticks);
+    Uint64 now;
+
+    while ((now = SDL_GetPerformanceCounter()) < target) {
+        const Uint64 remaining = SDL_PerformanceCounterToNS(target - now, freq);
+        if (remaining > DELAYNS_SPIN_NS) {
+            SDL_SleepNS(remaining - DELAYNS_SPIN_NS);
+        } else {
+            SDL_CPUPauseInstruction();
+        }
+    }
+}
+
+/* Sleep until the performance counter reaches target, without spinning */
+static void SDL_SleepUntil(Uint64 target, Uint64 freq)
+{
+    Uint64 now;
+
+    while ((now = SDL_GetPerformanceCounter()) < target) {
+        const Uint64 remaining = SDL_PerformanceCounterToNS(target - now, freq);
+#ifdef SDL_DELAYNS_NANOSLEEP
+        SDL_SleepNS(remaining);
+#else
+        /* Round up, or the last millisecond would turn into SDL_Delay(0) calls */
+        SDL_Delay((Uint32)SDL_min((remaining + NS_PER_MS - 1) / NS_PER_MS, 0xFFFFFFFF));
+#endif
+    }
+}
+
+static void SDL_AdvanceFramePacer(SDL_FramePacer *pacer, Uint64 frames)
+{
+    const Uint64 remainder = pacer->deadline_remainder + frames * pacer->interval_remainder;
+
+    pacer->deadline += frames * pacer->interval + remainder / pacer->numerator;
+    pacer->deadline_remainder = remainder % pacer->numerator;
+}
+
+void SDL_SetFramePacerRate(SDL_FramePacer *pacer, Uint32 numerator, Uint32 denominator)
+{
+    if (numerator && denominator) {
+        const Uint64 ticks = (Uint64)denominator * SDL_GetPerformanceFrequency();
+
+        /* The fractional part of the deadline is kept in units of 1/numerator ticks */
+        if (pacer->numerator) {
+            pacer->deadline_remainder = pacer->deadline_remainder * numerator / pacer->numerator;
+        }
+        pacer->freq = SDL_GetPerformanceFrequency();
+        pacer->numerator = numerator;
+        pacer->interval = ticks / numerator;
+        pacer->interval_remainder = ticks % numerator;
+    } else {
+        pacer->numerator = 0;
+        pacer->interval = 0;
+        pacer->interval_remainder = 0;
+        pacer->deadline = 0;
+        pacer->deadline_remainder = 0;
+    }
+}
+
+void SDL_WaitFramePacer(SDL_FramePacer *pacer)
+{
+    Uint64 now, late;
+
+    if (!pacer->numerator) {
+        return;
+    }
+
+    ++pacer->frames;
+    now = SDL_GetPerformanceCounter();
+
+    if (!pacer->deadline) {
+        /* First frame, start the timeline here */
+        pacer->deadline = now;
+        SDL_AdvanceFramePacer(pacer, 1);
+        return;
+    }
+
+    if (now < pacer->deadline) {
+        /* Waking a little late is fine, the next deadline stays on the same
+           timeline, so don't keep a core spinning every frame */
+        SDL_SleepUntil(pacer->deadline, pacer->freq);
+        SDL_AdvanceFramePacer(pacer, 1);
+        return;
+    }
+
+    /* Missed the deadline, so don't wait now, but keep the next deadline on
+       the same timeline instead of pushing every following frame back */
+    late = now - pacer->deadline;
+    ++pacer->missed;
+    pacer->late_ns_max = SDL_max(pacer->late_ns_max, SDL_PerformanceCounterToNS(late, pacer->freq));
+
+    if (late > pacer->freq) {
+        /* It's been too long, reset the presentation timeline */
+        pacer->deadline = now;
+        pacer->deadline_remainder = 0;
+        SDL_AdvanceFramePacer(pacer, 1);
+    } else {
+        const Uint64 skipped = pacer->interval ? (late / pacer->interval) : 0;
+
+        pacer->skipped += skipped;
+        SDL_AdvanceFramePacer(pacer, skipped + 1);
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
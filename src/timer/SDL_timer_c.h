@@ -35,6 +35,34 @@ extern void SDL_TicksQuit(void);
 extern int SDL_TimerInit(void);
 extern void SDL_TimerQuit(void);
 
+/* Convert between nanoseconds and performance counter ticks, rounding up.
+   Values too large to convert come back as SDL_MAX_UINT64. */
+extern Uint64 SDL_NSToPerformanceCounter(Uint64 ns, Uint64 freq);
+extern Uint64 SDL_PerformanceCounterToNS(Uint64 ticks, Uint64 freq);
+
+/* Paces a loop to a rational rate on the performance counter.
+   The deadline advances by whole intervals plus a carried remainder,
+   so a rate like 60000/1001 doesn't drift over time. */
+typedef struct SDL_FramePacer
+{
+    Uint64 freq;
+    Uint64 interval;            /* whole counter ticks per frame */
+    Uint64 interval_remainder;  /* plus this many 1/numerator ticks */
+    Uint64 numerator;
+    Uint64 deadline;            /* counter value of the next frame, 0 before the first one */
+    Uint64 deadline_remainder;
+    Uint64 frames;              /* calls to SDL_WaitFramePacer() */
+    Uint64 missed;              /* calls that came after their deadline */
+    Uint64 skipped;             /* whole intervals skipped by late calls */
+    Uint64 late_ns_max;         /* longest time a call was late */
+} SDL_FramePacer;
+
+/* Set a zeroed pacer to numerator/denominator frames per second, or disable it if either is 0.
+   Changing the rate later keeps the pacer's timeline and statistics. */
+extern void SDL_SetFramePacerRate(SDL_FramePacer *pacer, Uint32 numerator, Uint32 denominator);
+/* Sleep until the next frame is due, this doesn't spin like SDL_DelayNS() */
+extern void SDL_WaitFramePacer(SDL_FramePacer *pacer);
+
 #endif /* SDL_timer_c_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -92,8 +92,43 @@
 #include "SDL_blit.h"
 #include "SDL_RLEaccel_c.h"
 
+#if defined(__SSE2__)
+#define HAVE_SSE2_INTRINSICS
+#endif
+
+#if defined(__ARM_NEON)
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+/*
+ * Runs are usually short, so copy them with inline 16-byte moves instead of
+ * paying for a call to SDL_memcpy() per run. The intrinsics are only used
+ * when the compiler already targets them, so no runtime check is needed.
+ */
+static SDL_INLINE void RLE_CopyRun(Uint8 *dst, const Uint8 *src, size_t len)
+{
+#if defined(HAVE_SSE2_INTRINSICS)
+    while (len >= 16) {
+        _mm_storeu_si128((__m128i *)dst, _mm_loadu_si128((const __m128i *)src));
+        dst += 16;
+        src += 16;
+        len -= 16;
+    }
+#elif defined(HAVE_NEON_INTRINSICS)
+    while (len >= 16) {
+        vst1q_u8(dst, vld1q_u8(src));
+        dst += 16;
+        src += 16;
+        len -= 16;
+    }
+#endif
+    if (len) {
+        SDL_memcpy(dst, src, len);
+    }
+}
+
 #define PIXEL_COPY(to, from, len, bpp) \
-    SDL_memcpy(to, from, (size_t)(len) * (bpp))
+    RLE_CopyRun((Uint8 *)(to), (const Uint8 *)(from), (size_t)(len) * (bpp))
 
 /*
  * Various colorkey blit methods, for opaque and per-surface alpha
@@ -577,6 +612,58 @@ done:
         dst = d1 | d | 0xff000000;                       \
     } while (0)
 
+/*
+ * Blend a run of translucent 32bpp pixels. The vector paths compute
+ * d + (s - d) * alpha / 256 for each component separately, four pixels at
+ * a time.
+ */
+static void RLE_BlendTranslucentRun888(Uint32 *dst, const Uint32 *src, unsigned n)
+{
+    unsigned i = 0;
+
+#if defined(HAVE_SSE2_INTRINSICS)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opaque = _mm_set1_epi32((int)0xff000000);
+
+    for (; i + 4 <= n; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i s_lo = _mm_unpacklo_epi8(s, zero);
+        __m128i s_hi = _mm_unpackhi_epi8(s, zero);
+        __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+        __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+        __m128i a_lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_lo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        __m128i a_hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s_hi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+        /* (d * 256 + s * a - d * a) >> 8, the sum always fits in 16 bits */
+        d_lo = _mm_srli_epi16(_mm_add_epi16(_mm_slli_epi16(d_lo, 8),
+                                            _mm_sub_epi16(_mm_mullo_epi16(s_lo, a_lo), _mm_mullo_epi16(d_lo, a_lo))),
+                              8);
+        d_hi = _mm_srli_epi16(_mm_add_epi16(_mm_slli_epi16(d_hi, 8),
+                                            _mm_sub_epi16(_mm_mullo_epi16(s_hi, a_hi), _mm_mullo_epi16(d_hi, a_hi))),
+                              8);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_packus_epi16(d_lo, d_hi), opaque));
+    }
+#elif defined(HAVE_NEON_INTRINSICS)
+    const uint32x4_t opaque = vdupq_n_u32(0xff000000);
+
+    for (; i + 4 <= n; i += 4) {
+        const uint8x16_t s = vreinterpretq_u8_u32(vld1q_u32(src + i));
+        const uint8x16_t d = vreinterpretq_u8_u32(vld1q_u32(dst + i));
+        /* broadcast the alpha byte of each pixel to all four of its bytes */
+        const uint8x16_t a = vreinterpretq_u8_u32(vmulq_n_u32(vshrq_n_u32(vreinterpretq_u32_u8(s), 24), 0x01010101));
+        uint16x8_t lo = vshll_n_u8(vget_low_u8(d), 8);
+        uint16x8_t hi = vshll_n_u8(vget_high_u8(d), 8);
+        lo = vsubq_u16(vaddq_u16(lo, vmull_u8(vget_low_u8(s), vget_low_u8(a))), vmull_u8(vget_low_u8(d), vget_low_u8(a)));
+        hi = vsubq_u16(vaddq_u16(hi, vmull_u8(vget_high_u8(s), vget_high_u8(a))), vmull_u8(vget_high_u8(d), vget_high_u8(a)));
+        vst1q_u32(dst + i, vorrq_u32(vreinterpretq_u32_u8(vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8))), opaque));
+    }
+#endif
+    for (; i < n; i++) {
+        BLIT_TRANSL_888(src[i], dst[i]);
+    }
+}
+
 /*
  * For 16bpp pixels, we have stored the 5 most significant alpha bits in
  * bits 5-10. As before, we can process all 3 RGB components at the same time.
@@ -605,6 +692,18 @@ done:
         dst = (Uint16)(d | d >> 16);       \
     } while (0)
 
+/* Blend a run of translucent pixels for the RLEALPHABLIT macros */
+#define BLIT_TRANSL_RUN(do_blend, src, dst, n) \
+    do {                                       \
+        unsigned i_;                           \
+        for (i_ = 0; i_ < (unsigned)(n); i_++) \
+            do_blend((src)[i_], (dst)[i_]);    \
+    } while (0)
+
+#define BLIT_TRANSL_RUN_888(src, dst, n) RLE_BlendTranslucentRun888(dst, src, n)
+#define BLIT_TRANSL_RUN_565(src, dst, n) BLIT_TRANSL_RUN(BLIT_TRANSL_565, src, dst, n)
+#define BLIT_TRANSL_RUN_555(src, dst, n) BLIT_TRANSL_RUN(BLIT_TRANSL_555, src, dst, n)
+
 /* used to save the destination format in the encoding. Designed to be
    macro-compatible with SDL_PixelFormat but without the unneeded fields */
 typedef struct
@@ -632,10 +731,10 @@ static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
     SDL_PixelFormat *df = surf_dst->format;
     /*
      * clipped blitter: Ptype is the destination pixel type,
-     * Ctype the translucent count type, and do_blend the macro
-     * to blend one pixel.
+     * Ctype the translucent count type, and do_blend_run the macro
+     * to blend a run of pixels.
      */
-#define RLEALPHACLIPBLIT(Ptype, Ctype, do_blend)                          \
+#define RLEALPHACLIPBLIT(Ptype, Ctype, do_blend_run)                      \
     do {                                                                  \
         int linecount = srcrect->h;                                       \
         int left = srcrect->x;                                            \
@@ -691,9 +790,7 @@ static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
                     if (crun > 0) {                                       \
                         Ptype *dst = (Ptype *)dstbuf + cofs;              \
                         Uint32 *src = (Uint32 *)srcbuf + (cofs - ofs);    \
-                        int i;                                            \
-                        for (i = 0; i < crun; i++)                        \
-                            do_blend(src[i], dst[i]);                     \
+                        do_blend_run(src, dst, crun);                     \
                     }                                                     \
                     srcbuf += run * 4;                                    \
                     ofs += run;                                           \
@@ -706,13 +803,13 @@ static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
     switch (df->BytesPerPixel) {
     case 2:
         if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_565);
+            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_RUN_565);
         } else {
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_555);
+            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_RUN_555);
         }
         break;
     case 4:
-        RLEALPHACLIPBLIT(Uint32, Uint16, BLIT_TRANSL_888);
+        RLEALPHACLIPBLIT(Uint32, Uint16, BLIT_TRANSL_RUN_888);
         break;
     }
 }
@@ -803,10 +900,10 @@ static int SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
 
         /*
          * non-clipped blitter. Ptype is the destination pixel type,
-         * Ctype the translucent count type, and do_blend the
-         * macro to blend one pixel.
+         * Ctype the translucent count type, and do_blend_run the
+         * macro to blend a run of pixels.
          */
-#define RLEALPHABLIT(Ptype, Ctype, do_blend)                         \
+#define RLEALPHABLIT(Ptype, Ctype, do_blend_run)                     \
     do {                                                             \
         int linecount = srcrect->h;                                  \
         do {                                                         \
@@ -836,14 +933,9 @@ static int SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
                 run = ((Uint16 *)srcbuf)[1];                         \
                 srcbuf += 4;                                         \
                 if (run) {                                           \
-                    Ptype *dst = (Ptype *)dstbuf + ofs;              \
-                    unsigned i;                                      \
-                    for (i = 0; i < run; i++) {                      \
-                        Uint32 src = *(Uint32 *)srcbuf;              \
-                        do_blend(src, *dst);                         \
-                        srcbuf += 4;                                 \
-                        dst++;                                       \
-                    }                                                \
+                    do_blend_run((Uint32 *)srcbuf,                   \
+                                 (Ptype *)dstbuf + ofs, run);        \
+                    srcbuf += run * 4;                               \
                     ofs += run;                                      \
                 }                                                    \
             } while (ofs < w);                                       \
@@ -854,13 +946,13 @@ static int SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
         switch (df->BytesPerPixel) {
         case 2:
             if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_565);
+                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_RUN_565);
             } else {
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_555);
+                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_RUN_555);
             }
             break;
         case 4:
-            RLEALPHABLIT(Uint32, Uint16, BLIT_TRANSL_888);
+            RLEALPHABLIT(Uint32, Uint16, BLIT_TRANSL_RUN_888);
             break;
         }
     }
@@ -1009,7 +1101,7 @@ static int uncopy_32(Uint32 *dst, void *src, int n,
     ((unsigned)((((pixel)&fmt->Amask) >> fmt->Ashift) - 1U) < 254U)
 
 /* convert surface to be quickly alpha-blittable onto dest, if possible */
-static int RLEAlphaSurface(SDL_Surface *surface)
+static int RLEAlphaSurface(SDL_Surface *surface, void **encoded)
 {
     SDL_Surface *dest;
     SDL_PixelFormat *df;
@@ -1213,24 +1305,13 @@ static int RLEAlphaSurface(SDL_Surface *surface)
 #undef ADD_OPAQUE_COUNTS
 #undef ADD_TRANSL_COUNTS
 
-    /* Now that we have it encoded, release the original pixels */
-    if (!(surface->flags & SDL_PREALLOC)) {
-        if (surface->flags & SDL_SIMD_ALIGNED) {
-            SDL_SIMDFree(surface->pixels);
-            surface->flags &= ~SDL_SIMD_ALIGNED;
-        } else {
-            SDL_free(surface->pixels);
-        }
-        surface->pixels = NULL;
-    }
-
     /* reallocate the buffer to release unused memory */
     {
         Uint8 *p = SDL_realloc(rlebuf, dst - rlebuf);
         if (!p) {
             p = rlebuf;
         }
-        surface->map->data = p;
+        *encoded = p;
     }
 
     return 0;
@@ -1266,7 +1347,7 @@ static const getpix_func getpixes[4] = {
     getpix_8, getpix_16, getpix_24, getpix_32
 };
 
-static int RLEColorkeySurface(SDL_Surface *surface)
+static int RLEColorkeySurface(SDL_Surface *surface, void **encoded)
 {
     Uint8 *rlebuf, *dst;
     int maxn;
@@ -1380,17 +1461,6 @@ static int RLEColorkeySurface(SDL_Surface *surface)
 
 #undef ADD_COUNTS
 
-    /* Now that we have it encoded, release the original pixels */
-    if (!(surface->flags & SDL_PREALLOC)) {
-        if (surface->flags & SDL_SIMD_ALIGNED) {
-            SDL_SIMDFree(surface->pixels);
-            surface->flags &= ~SDL_SIMD_ALIGNED;
-        } else {
-            SDL_free(surface->pixels);
-        }
-        surface->pixels = NULL;
-    }
-
     /* reallocate the buffer to release unused memory */
     {
         /* If SDL_realloc returns NULL, the original block is left intact */
@@ -1398,15 +1468,186 @@ static int RLEColorkeySurface(SDL_Surface *surface)
         if (!p) {
             p = rlebuf;
         }
-        surface->map->data = p;
+        *encoded = p;
     }
 
     return 0;
 }
 
+/*
+ * Encodings are cached per source surface, independently of the blit map
+ * they were made for. Blitting the same surface to several destinations
+ * reuses the encoding matching each target instead of decoding and
+ * re-encoding the surface whenever the blit map is recalculated.
+ *
+ * The first encoding releases the original pixels, as it always did. Once
+ * the surface had to be decoded again (for a new destination or a lock) the
+ * decoded pixels are kept alongside the encodings, so later switches are
+ * just pointer swaps.
+ */
+#define RLE_CACHE_MAX_ENCODINGS 4
+
+typedef struct SDL_RLEEncoding
+{
+    int kind;        /* SDL_COPY_RLE_COLORKEY or SDL_COPY_RLE_ALPHAKEY */
+    Uint32 colorkey; /* colorkey of SDL_COPY_RLE_COLORKEY encodings */
+    void *data;
+    struct SDL_RLEEncoding *next;
+} SDL_RLEEncoding;
+
+typedef struct SDL_RLECache
+{
+    SDL_RLEEncoding *encodings; /* most recently used first */
+    void *pixels;               /* decoded pixels kept while encoded */
+    SDL_bool pixels_aligned;    /* pixels were allocated with SDL_SIMDAlloc() */
+    SDL_bool retain_pixels;     /* keep the pixels around when encoding */
+} SDL_RLECache;
+
+static void FreeRLEEncodings(SDL_RLECache *cache)
+{
+    while (cache->encodings) {
+        SDL_RLEEncoding *encoding = cache->encodings;
+        cache->encodings = encoding->next;
+        SDL_free(encoding->data);
+        SDL_free(encoding);
+    }
+}
+
+static SDL_bool RLEEncodingMatches(const SDL_RLEEncoding *encoding, int kind, SDL_Surface *surface)
+{
+    if (encoding->kind != kind) {
+        return SDL_FALSE;
+    }
+    if (kind == SDL_COPY_RLE_COLORKEY) {
+        const Uint32 rgbmask = ~surface->format->Amask;
+        return ((encoding->colorkey & rgbmask) == (surface->map->info.colorkey & rgbmask)) ? SDL_TRUE : SDL_FALSE;
+    } else {
+        const RLEDestFormat *r = (const RLEDestFormat *)encoding->data;
+        const SDL_PixelFormat *df = surface->map->dst->format;
+        return (r->BytesPerPixel == df->BytesPerPixel &&
+                r->Rmask == df->Rmask && r->Gmask == df->Gmask &&
+                r->Bmask == df->Bmask && r->Amask == df->Amask) ? SDL_TRUE : SDL_FALSE;
+    }
+}
+
+/* Find or create the encoding for the current blit map, and move it to the
+   front of the cache */
+static SDL_RLEEncoding *GetRLEEncoding(SDL_Surface *surface, int kind)
+{
+    SDL_RLECache *cache = (SDL_RLECache *)surface->map->rle_cache;
+    SDL_RLEEncoding *encoding, *prev = NULL;
+    void *data = NULL;
+    int count = 0;
+
+    if (!cache) {
+        cache = (SDL_RLECache *)SDL_calloc(1, sizeof(*cache));
+        if (!cache) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        surface->map->rle_cache = cache;
+    }
+
+    for (encoding = cache->encodings; encoding; prev = encoding, encoding = encoding->next) {
+        if (RLEEncodingMatches(encoding, kind, surface)) {
+            if (prev) {
+                prev->next = encoding->next;
+                encoding->next = cache->encodings;
+                cache->encodings = encoding;
+            }
+            return encoding;
+        }
+        ++count;
+    }
+
+    /* Encoding needs the pixels, which we may have released earlier */
+    if (!surface->pixels) {
+        return NULL;
+    }
+    if (kind == SDL_COPY_RLE_COLORKEY) {
+        if (RLEColorkeySurface(surface, &data) < 0) {
+            return NULL;
+        }
+    } else {
+        if (RLEAlphaSurface(surface, &data) < 0) {
+            return NULL;
+        }
+    }
+
+    encoding = (SDL_RLEEncoding *)SDL_malloc(sizeof(*encoding));
+    if (!encoding) {
+        SDL_free(data);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    encoding->kind = kind;
+    encoding->colorkey = surface->map->info.colorkey;
+    encoding->data = data;
+    encoding->next = cache->encodings;
+    cache->encodings = encoding;
+
+    /* Drop the least recently used encoding if there are too many */
+    if (count >= RLE_CACHE_MAX_ENCODINGS) {
+        for (prev = encoding; prev->next->next; prev = prev->next) {
+        }
+        SDL_free(prev->next->data);
+        SDL_free(prev->next);
+        prev->next = NULL;
+    }
+    return encoding;
+}
+
+/* Now that the surface is encoded, release or stash the original pixels */
+static void ReleaseRLEPixels(SDL_Surface *surface)
+{
+    SDL_RLECache *cache = (SDL_RLECache *)surface->map->rle_cache;
+
+    if (surface->flags & SDL_PREALLOC) {
+        return;
+    }
+    if (cache->retain_pixels) {
+        cache->pixels = surface->pixels;
+        cache->pixels_aligned = (surface->flags & SDL_SIMD_ALIGNED) ? SDL_TRUE : SDL_FALSE;
+    } else if (surface->flags & SDL_SIMD_ALIGNED) {
+        SDL_SIMDFree(surface->pixels);
+    } else {
+        SDL_free(surface->pixels);
+    }
+    surface->flags &= ~SDL_SIMD_ALIGNED;
+    surface->pixels = NULL;
+}
+
+void SDL_InvalidateRLECache(SDL_Surface *surface)
+{
+    SDL_RLECache *cache = (SDL_RLECache *)surface->map->rle_cache;
+
+    if (cache) {
+        FreeRLEEncodings(cache);
+    }
+}
+
+void SDL_FreeRLECache(SDL_BlitMap *map)
+{
+    SDL_RLECache *cache = (SDL_RLECache *)map->rle_cache;
+
+    if (cache) {
+        FreeRLEEncodings(cache);
+        if (cache->pixels) {
+            if (cache->pixels_aligned) {
+                SDL_SIMDFree(cache->pixels);
+            } else {
+                SDL_free(cache->pixels);
+            }
+        }
+        SDL_free(cache);
+        map->rle_cache = NULL;
+    }
+}
+
 int SDL_RLESurface(SDL_Surface *surface)
 {
     int flags;
+    SDL_RLEEncoding *encoding;
 
     /* Clear any previous RLE conversion */
     if ((surface->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
@@ -1446,18 +1687,23 @@ int SDL_RLESurface(SDL_Surface *surface)
         if (!surface->map->identity) {
             return -1;
         }
-        if (RLEColorkeySurface(surface) < 0) {
+        encoding = GetRLEEncoding(surface, SDL_COPY_RLE_COLORKEY);
+        if (!encoding) {
             return -1;
         }
         surface->map->blit = SDL_RLEBlit;
         surface->map->info.flags |= SDL_COPY_RLE_COLORKEY;
     } else {
-        if (RLEAlphaSurface(surface) < 0) {
+        encoding = GetRLEEncoding(surface, SDL_COPY_RLE_ALPHAKEY);
+        if (!encoding) {
             return -1;
         }
         surface->map->blit = SDL_RLEAlphaBlit;
         surface->map->info.flags |= SDL_COPY_RLE_ALPHAKEY;
     }
+    surface->map->data = encoding->data;
+
+    ReleaseRLEPixels(surface);
 
     /* The surface is now accelerated */
     surface->flags |= SDL_RLEACCEL;
@@ -1550,10 +1796,19 @@ end_function:
 void SDL_UnRLESurface(SDL_Surface *surface, int recode)
 {
     if (surface->flags & SDL_RLEACCEL) {
+        SDL_RLECache *cache = (SDL_RLECache *)surface->map->rle_cache;
+
         surface->flags &= ~SDL_RLEACCEL;
 
         if (recode && !(surface->flags & SDL_PREALLOC)) {
-            if (surface->map->info.flags & SDL_COPY_RLE_COLORKEY) {
+            if (cache->pixels) {
+                /* we kept the decoded pixels around */
+                surface->pixels = cache->pixels;
+                if (cache->pixels_aligned) {
+                    surface->flags |= SDL_SIMD_ALIGNED;
+                }
+                cache->pixels = NULL;
+            } else if (surface->map->info.flags & SDL_COPY_RLE_COLORKEY) {
                 SDL_Rect full;
 
                 /* re-create the original surface */
@@ -1580,12 +1835,19 @@ void SDL_UnRLESurface(SDL_Surface *surface, int recode)
                     return;
                 }
             }
+            /* The surface is used in more than one way, keep the pixels
+               next time it's encoded */
+            cache->retain_pixels = SDL_TRUE;
         }
         surface->map->info.flags &=
             ~(SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY);
 
-        SDL_free(surface->map->data);
+        /* the encoding itself stays in the cache */
         surface->map->data = NULL;
+
+        if (!recode) {
+            SDL_FreeRLECache(surface->map);
+        }
     }
 }
 
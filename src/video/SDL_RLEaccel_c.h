@@ -28,6 +28,8 @@
 
 extern int SDL_RLESurface(SDL_Surface *surface);
 extern void SDL_UnRLESurface(SDL_Surface *surface, int recode);
+extern void SDL_InvalidateRLECache(SDL_Surface *surface);
+extern void SDL_FreeRLECache(SDL_BlitMap *map);
 
 #endif /* SDL_RLEaccel_c_h_ */
 
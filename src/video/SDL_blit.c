@@ -219,6 +219,8 @@ int SDL_CalculateBlit(SDL_Surface *surface)
         if (SDL_RLESurface(surface) == 0) {
             return 0;
         }
+    } else {
+        SDL_FreeRLECache(map);
     }
 #endif
 
@@ -88,6 +88,9 @@ typedef struct
     SDL_BlitFunc func;
 } SDL_BlitFuncEntry;
 
+/* A destination palette's RGB555 lookup table, shared by N->1 blit maps */
+typedef struct SDL_PaletteMap SDL_PaletteMap;
+
 /* Blit mapping definition */
 /* typedef'ed in SDL_surface.h */
 struct SDL_BlitMap
@@ -97,11 +100,15 @@ struct SDL_BlitMap
     SDL_blit blit;
     void *data;
     SDL_BlitInfo info;
+    SDL_PaletteMap *palette_map; /* owns info.table for N->1 blits */
 
     /* the version count matches the destination; mismatch indicates
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+    /* RLE encodings of the source surface, kept across invalidations of
+       the map (see SDL_RLEaccel.c) */
+    void *rle_cache;
 };
 
 /* Functions found in SDL_blit.c */
@@ -125,6 +132,13 @@ extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface);
 #define DECLARE_ALIGNED(t, v, a) t v
 #endif
 
+/* N->1 blits look up the destination palette index in a table indexed by
+   the RGB 5-5-5 value of the source pixel (see MapNto1 in SDL_pixels.c).
+   Without a table the destination is the RGB 3-3-2 palette. */
+#define PALMAP_SIZE (1 << 15)
+#define PALMAP_RGB555(r, g, b) ((((r) >> 3) << 10) | (((g) >> 3) << 5) | ((b) >> 3))
+#define PACK_RGB332(r, g, b)   ((((r) >> 5) << (3 + 2)) | (((g) >> 5) << (2)) | (((b) >> 6) << (0)))
+
 /* Load pixel of the specified format from a buffer and get its R-G-B values */
 #define RGB_FROM_PIXEL(Pixel, fmt, r, g, b)                                     \
     {                                                                           \
@@ -61,7 +61,7 @@ static void BlitNto1SurfaceAlpha(SDL_BlitInfo *info)
         if ( palmap == NULL ) {
             *dst =((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0));
         } else {
-            *dst = palmap[((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0))];
+            *dst = palmap[PALMAP_RGB555(dR, dG, dB)];
         }
         dst++;
         src += srcbpp;
@@ -106,7 +106,7 @@ static void BlitNto1PixelAlpha(SDL_BlitInfo *info)
         if ( palmap == NULL ) {
             *dst =((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0));
         } else {
-            *dst = palmap[((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0))];
+            *dst = palmap[PALMAP_RGB555(dR, dG, dB)];
         }
         dst++;
         src += srcbpp;
@@ -154,7 +154,7 @@ static void BlitNto1SurfaceAlphaKey(SDL_BlitInfo *info)
             if ( palmap == NULL ) {
                 *dst =((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0));
             } else {
-                *dst = palmap[((dR>>5)<<(3+2))|((dG>>5)<<(2))|((dB>>6)<<(0))];
+                *dst = palmap[PALMAP_RGB555(dR, dG, dB)];
             }
         }
         dst++;
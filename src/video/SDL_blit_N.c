@@ -25,6 +25,7 @@
 #include "SDL_video.h"
 #include "SDL_endian.h"
 #include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
 #include "SDL_blit.h"
 #include "SDL_blit_copy.h"
 
@@ -957,6 +958,13 @@ static void Blit_RGB444_RGB888ARMSIMD(SDL_BlitInfo *info)
                       (((src)&0x0000E000) >> 11) | \
                       (((src)&0x000000C0) >> 6));  \
     }
+/* Palette map index for RGB 8-8-8 */
+#define RGB888_PALMAP(dst, src)                  \
+    {                                            \
+        dst = (int)((((src)&0x00F80000) >> 9) |  \
+                    (((src)&0x0000F800) >> 6) |  \
+                    (((src)&0x000000F8) >> 3));  \
+    }
 static void Blit_RGB888_index8(SDL_BlitInfo *info)
 {
 #ifndef USE_DUFFS_LOOP
@@ -1020,7 +1028,7 @@ static void Blit_RGB888_index8(SDL_BlitInfo *info)
 #ifdef USE_DUFFS_LOOP
             /* *INDENT-OFF* */ /* clang-format off */
             DUFFS_LOOP(
-                RGB888_RGB332(Pixel, *src);
+                RGB888_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             , width);
@@ -1028,32 +1036,32 @@ static void Blit_RGB888_index8(SDL_BlitInfo *info)
 #else
             for (c = width / 4; c; --c) {
                 /* Pack RGB into 8bit pixel */
-                RGB888_RGB332(Pixel, *src);
+                RGB888_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB888_RGB332(Pixel, *src);
+                RGB888_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB888_RGB332(Pixel, *src);
+                RGB888_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB888_RGB332(Pixel, *src);
+                RGB888_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             }
             switch (width & 3) {
             case 3:
-                RGB888_RGB332(Pixel, *src);
+                RGB888_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
                 SDL_FALLTHROUGH;
             case 2:
-                RGB888_RGB332(Pixel, *src);
+                RGB888_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
                 SDL_FALLTHROUGH;
             case 1:
-                RGB888_RGB332(Pixel, *src);
+                RGB888_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             }
@@ -1071,6 +1079,13 @@ static void Blit_RGB888_index8(SDL_BlitInfo *info)
                       (((src)&0x000E0000) >> 15) | \
                       (((src)&0x00000300) >> 8));  \
     }
+/* Palette map index for RGB 10-10-10 */
+#define RGB101010_PALMAP(dst, src)                \
+    {                                             \
+        dst = (int)((((src)&0x3E000000) >> 15) |  \
+                    (((src)&0x000F8000) >> 10) |  \
+                    (((src)&0x000003E0) >> 5));   \
+    }
 static void Blit_RGB101010_index8(SDL_BlitInfo *info)
 {
 #ifndef USE_DUFFS_LOOP
@@ -1134,7 +1149,7 @@ static void Blit_RGB101010_index8(SDL_BlitInfo *info)
 #ifdef USE_DUFFS_LOOP
             /* *INDENT-OFF* */ /* clang-format off */
             DUFFS_LOOP(
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             , width);
@@ -1142,32 +1157,32 @@ static void Blit_RGB101010_index8(SDL_BlitInfo *info)
 #else
             for (c = width / 4; c; --c) {
                 /* Pack RGB into 8bit pixel */
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             }
             switch (width & 3) {
             case 3:
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
                 SDL_FALLTHROUGH;
             case 2:
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
                 SDL_FALLTHROUGH;
             case 1:
-                RGB101010_RGB332(Pixel, *src);
+                RGB101010_PALMAP(Pixel, *src);
                 *dst++ = map[Pixel];
                 ++src;
             }
@@ -2156,9 +2171,7 @@ static void BlitNto1(SDL_BlitInfo *info)
                                 sR, sG, sB);
                 if ( 1 ) {
                     /* Pack RGB into 8bit pixel */
-                    *dst = map[((sR>>5)<<(3+2))|
-                           ((sG>>5)<<(2))  |
-                           ((sB>>6)<<(0))  ];
+                    *dst = map[PALMAP_RGB555(sR, sG, sB)];
                 }
                 dst++;
                 src += srcbpp;
@@ -2169,8 +2182,7 @@ static void BlitNto1(SDL_BlitInfo *info)
                 DISEMBLE_RGB(src, srcbpp, srcfmt, Pixel, sR, sG, sB);
                 if (1) {
                     /* Pack RGB into 8bit pixel */
-                    *dst = map[((sR >> 5) << (3 + 2)) |
-                               ((sG >> 5) << (2)) | ((sB >> 6) << (0))];
+                    *dst = map[PALMAP_RGB555(sR, sG, sB)];
                 }
                 dst++;
                 src += srcbpp;
@@ -2182,6 +2194,59 @@ static void BlitNto1(SDL_BlitInfo *info)
     }
 }
 
+/* 4x4 Bayer matrix, scaled and centered around zero, for ordered dithering */
+static const Sint8 ordered_dither_4x4[4][4] = {
+    { -15, 1, -11, 5 },
+    { 9, -7, 13, -3 },
+    { -9, 7, -13, 3 },
+    { 15, -1, 11, -5 }
+};
+
+#define DITHER_COMPONENT(v, d) \
+    (((int)(v) + (d)) < 0 ? 0 : (((int)(v) + (d)) > 255 ? 255 : ((int)(v) + (d))))
+
+#define DITHER_PIXEL_INDEX8(dst, map, x, y, sR, sG, sB)       \
+    {                                                          \
+        const int d = ordered_dither_4x4[(y)&3][(x)&3];        \
+        const int dR = DITHER_COMPONENT(sR, d);                \
+        const int dG = DITHER_COMPONENT(sG, d);                \
+        const int dB = DITHER_COMPONENT(sB, d);                \
+        if (map) {                                             \
+            dst = map[PALMAP_RGB555(dR, dG, dB)];              \
+        } else {                                               \
+            dst = (Uint8)PACK_RGB332(dR, dG, dB);              \
+        }                                                      \
+    }
+
+/* N->1 blit with ordered dithering, the pattern is anchored at the
+   top-left corner of the destination rectangle */
+static void BlitNto1Dither(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    const Uint8 *map = info->table;
+    SDL_PixelFormat *srcfmt = info->src_fmt;
+    int srcbpp = srcfmt->BytesPerPixel;
+    Uint32 Pixel;
+    unsigned sR, sG, sB;
+    int x, y;
+
+    for (y = 0; y < height; ++y) {
+        for (x = 0; x < width; ++x) {
+            DISEMBLE_RGB(src, srcbpp, srcfmt, Pixel, sR, sG, sB);
+            DITHER_PIXEL_INDEX8(*dst, map, x, y, sR, sG, sB);
+            dst++;
+            src += srcbpp;
+        }
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
 /* blits 32 bit RGB<->RGBA with both surfaces having the same R,G,B fields */
 static void Blit4to4MaskAlpha(SDL_BlitInfo *info)
 {
@@ -2543,9 +2608,7 @@ static void BlitNto1Key(SDL_BlitInfo *info)
                                 sR, sG, sB);
                 if ( (Pixel & rgbmask) != ckey ) {
                     /* Pack RGB into 8bit pixel */
-                    *dst = (Uint8)palmap[((sR>>5)<<(3+2))|
-                                         ((sG>>5)<<(2))  |
-                                         ((sB>>6)<<(0))  ];
+                    *dst = (Uint8)palmap[PALMAP_RGB555(sR, sG, sB)];
                 }
                 dst++;
                 src += srcbpp;
@@ -2558,6 +2621,39 @@ static void BlitNto1Key(SDL_BlitInfo *info)
     }
 }
 
+static void BlitNto1KeyDither(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    const Uint8 *map = info->table;
+    SDL_PixelFormat *srcfmt = info->src_fmt;
+    Uint32 ckey = info->colorkey;
+    Uint32 rgbmask = ~srcfmt->Amask;
+    int srcbpp = srcfmt->BytesPerPixel;
+    Uint32 Pixel;
+    unsigned sR, sG, sB;
+    int x, y;
+
+    ckey &= rgbmask;
+
+    for (y = 0; y < height; ++y) {
+        for (x = 0; x < width; ++x) {
+            DISEMBLE_RGB(src, srcbpp, srcfmt, Pixel, sR, sG, sB);
+            if ((Pixel & rgbmask) != ckey) {
+                DITHER_PIXEL_INDEX8(*dst, map, x, y, sR, sG, sB);
+            }
+            dst++;
+            src += srcbpp;
+        }
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
 static void Blit2to2Key(SDL_BlitInfo *info)
 {
     int width = info->dst_w;
@@ -3339,6 +3435,16 @@ static const struct blit_table *const normal_blit[] = {
     normal_blit_1, normal_blit_2, normal_blit_3, normal_blit_4
 };
 
+static SDL_bool UsePaletteDither(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_SURFACE_PALETTE_DITHER);
+
+    if (hint && (*hint == '1' || SDL_strcasecmp(hint, "ordered") == 0)) {
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
 /* Mask matches table, or table entry is zero */
 #define MASKOK(x, y) (((x) == (y)) || ((y) == 0x00000000))
 
@@ -3363,7 +3469,9 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
     case 0:
         blitfun = NULL;
         if (dstfmt->BitsPerPixel == 8) {
-            if ((srcfmt->BytesPerPixel == 4) &&
+            if (UsePaletteDither()) {
+                blitfun = BlitNto1Dither;
+            } else if ((srcfmt->BytesPerPixel == 4) &&
                 (srcfmt->Rmask == 0x00FF0000) &&
                 (srcfmt->Gmask == 0x0000FF00) &&
                 (srcfmt->Bmask == 0x000000FF)) {
@@ -3435,7 +3543,7 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
         if (srcfmt->BytesPerPixel == 2 && surface->map->identity != 0) {
             return Blit2to2Key;
         } else if (dstfmt->BytesPerPixel == 1) {
-            return BlitNto1Key;
+            return UsePaletteDither() ? BlitNto1KeyDither : BlitNto1Key;
         } else {
 #ifdef SDL_ALTIVEC_BLITTERS
             if ((srcfmt->BytesPerPixel == 4) && (dstfmt->BytesPerPixel == 4) && SDL_HasAltiVec()) {
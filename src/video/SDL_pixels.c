@@ -653,6 +653,298 @@ void SDL_FreeFormat(SDL_PixelFormat *format)
     SDL_free(format);
 }
 
+/*
+ * Palette maps for N->1 blits
+ *
+ * Blits from truecolor surfaces to a palette look up each pixel in a table
+ * indexed by its RGB555 value.  There is one such table per palette, shared
+ * by every blit map drawing to it and rebuilt lazily when palette->version
+ * changes, like the blit maps themselves.
+ *
+ * The table is filled with the help of an inverse colormap: the RGB cube is
+ * split into 8x8x8 cells, and for every cell we list the palette entries
+ * that can possibly be the closest match for a color inside it.  This only
+ * pays off for bulk lookups, so SDL_FindColor() keeps doing a plain search.
+ */
+#define INVMAP_CELL_BITS  3
+#define INVMAP_CELL_SHIFT (8 - INVMAP_CELL_BITS)
+#define INVMAP_CELL_SIZE  (1 << INVMAP_CELL_SHIFT)
+#define INVMAP_NUM_CELLS  (1 << (3 * INVMAP_CELL_BITS))
+#define PALMAP_BUCKETS    64
+
+typedef struct
+{
+    int ncolors;
+    SDL_Color colors[256];              /* the palette colors the table was built from */
+    Uint32 cells[INVMAP_NUM_CELLS + 1]; /* offsets into candidates */
+    Uint8 *candidates;
+} SDL_InverseColormap;
+
+struct SDL_PaletteMap
+{
+    SDL_atomic_t refcount;
+    Uint32 version; /* the palette version the table was built for */
+    Uint8 table[PALMAP_SIZE];
+};
+
+typedef struct SDL_PaletteMapEntry
+{
+    SDL_Palette *palette;
+    SDL_PaletteMap *map; /* NULL if not built yet */
+    struct SDL_PaletteMapEntry *next;
+} SDL_PaletteMapEntry;
+
+static SDL_PaletteMapEntry *palmaps[PALMAP_BUCKETS];
+static SDL_SpinLock palmaps_locks[PALMAP_BUCKETS];
+
+#define PALMAP_BUCKET(palette) ((int)(((uintptr_t)(palette) >> 4) % PALMAP_BUCKETS))
+#define INVMAP_CELL(r, g, b)                                          \
+    ((((r) >> INVMAP_CELL_SHIFT) << (2 * INVMAP_CELL_BITS)) |          \
+     (((g) >> INVMAP_CELL_SHIFT) << INVMAP_CELL_BITS) |                \
+     ((b) >> INVMAP_CELL_SHIFT))
+
+/* Squared distances from a color component to the nearest and farthest
+   values of the cell range [lo, lo + INVMAP_CELL_SIZE - 1] */
+#define INVMAP_AXIS_DIST(c, lo, mind, maxd)        \
+    {                                              \
+        const int hi = (lo) + INVMAP_CELL_SIZE - 1; \
+        int d;                                     \
+        if ((c) < (lo)) {                          \
+            d = (lo) - (c);                        \
+            mind += d * d;                         \
+            d = hi - (c);                          \
+        } else if ((c) > hi) {                     \
+            d = (c) - hi;                          \
+            mind += d * d;                         \
+            d = (c) - (lo);                        \
+        } else {                                   \
+            d = SDL_max((c) - (lo), hi - (c));     \
+        }                                          \
+        maxd += d * d;                             \
+    }
+
+static void SDL_FreeInverseColormap(SDL_InverseColormap *invmap)
+{
+    if (invmap) {
+        SDL_free(invmap->candidates);
+        SDL_free(invmap);
+    }
+}
+
+/* Build an inverse colormap for opaque lookups in the current palette colors */
+static SDL_InverseColormap *SDL_BuildInverseColormap(const SDL_Palette *pal)
+{
+    const int ncolors = pal->ncolors;
+    unsigned int mindist[256];
+    unsigned int alphadist[256];
+    SDL_InverseColormap *invmap;
+    const SDL_Color *colors;
+    Uint8 *candidates;
+    Uint32 count = 0;
+    int cell, i;
+
+    if (ncolors > 256) {
+        return NULL; /* indices wouldn't fit in a Uint8 */
+    }
+
+    invmap = (SDL_InverseColormap *)SDL_calloc(1, sizeof(*invmap));
+    candidates = (Uint8 *)SDL_malloc((size_t)ncolors * INVMAP_NUM_CELLS);
+    if (!invmap || !candidates) {
+        SDL_free(invmap);
+        SDL_free(candidates);
+        return NULL;
+    }
+    invmap->ncolors = ncolors;
+    SDL_memcpy(invmap->colors, pal->colors, ncolors * sizeof(*pal->colors));
+    colors = invmap->colors;
+
+    /* For opaque lookups the alpha term is a per-entry constant */
+    for (i = 0; i < ncolors; ++i) {
+        const int ad = colors[i].a - SDL_ALPHA_OPAQUE;
+        alphadist[i] = ad * ad;
+    }
+
+    for (cell = 0; cell < INVMAP_NUM_CELLS; ++cell) {
+        const int r0 = ((cell >> (2 * INVMAP_CELL_BITS)) & ((1 << INVMAP_CELL_BITS) - 1)) << INVMAP_CELL_SHIFT;
+        const int g0 = ((cell >> INVMAP_CELL_BITS) & ((1 << INVMAP_CELL_BITS) - 1)) << INVMAP_CELL_SHIFT;
+        const int b0 = (cell & ((1 << INVMAP_CELL_BITS) - 1)) << INVMAP_CELL_SHIFT;
+        unsigned int smallest_max = ~0U;
+
+        /* Any color in the cell is at most smallest_max away from some
+           entry, so entries that can't get that close are never the answer */
+        for (i = 0; i < ncolors; ++i) {
+            unsigned int mind = alphadist[i];
+            unsigned int maxd = alphadist[i];
+            INVMAP_AXIS_DIST(colors[i].r, r0, mind, maxd);
+            INVMAP_AXIS_DIST(colors[i].g, g0, mind, maxd);
+            INVMAP_AXIS_DIST(colors[i].b, b0, mind, maxd);
+            mindist[i] = mind;
+            if (maxd < smallest_max) {
+                smallest_max = maxd;
+            }
+        }
+
+        invmap->cells[cell] = count;
+        for (i = 0; i < ncolors; ++i) {
+            if (mindist[i] <= smallest_max) {
+                candidates[count++] = (Uint8)i;
+            }
+        }
+    }
+    invmap->cells[INVMAP_NUM_CELLS] = count;
+    invmap->candidates = candidates;
+    return invmap;
+}
+
+static Uint8 SDL_FindColorInverseColormap(const SDL_InverseColormap *invmap, Uint8 r, Uint8 g, Uint8 b)
+{
+    const SDL_Color *colors = invmap->colors;
+    const int cell = INVMAP_CELL(r, g, b);
+    const Uint8 *candidate = invmap->candidates + invmap->cells[cell];
+    const Uint8 *end = invmap->candidates + invmap->cells[cell + 1];
+    unsigned int smallest = ~0U;
+    unsigned int distance;
+    int rd, gd, bd, ad;
+    Uint8 pixel = 0;
+
+    /* Candidates are in palette order, so ties resolve like the full search */
+    for (; candidate < end; ++candidate) {
+        const SDL_Color *color = &colors[*candidate];
+        rd = color->r - r;
+        gd = color->g - g;
+        bd = color->b - b;
+        ad = color->a - SDL_ALPHA_OPAQUE;
+        distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            pixel = *candidate;
+            if (distance == 0) { /* Perfect match! */
+                break;
+            }
+            smallest = distance;
+        }
+    }
+    return pixel;
+}
+
+static void SDL_FillPaletteMap(SDL_Palette *palette, Uint8 *map)
+{
+    SDL_InverseColormap *invmap = SDL_BuildInverseColormap(palette);
+    int r, g, b;
+
+    for (r = 0; r < 32; ++r) {
+        const Uint8 R = (Uint8)((r << 3) | (r >> 2));
+        for (g = 0; g < 32; ++g) {
+            const Uint8 G = (Uint8)((g << 3) | (g >> 2));
+            for (b = 0; b < 32; ++b) {
+                const Uint8 B = (Uint8)((b << 3) | (b >> 2));
+                if (invmap) {
+                    *map++ = SDL_FindColorInverseColormap(invmap, R, G, B);
+                } else {
+                    *map++ = SDL_FindColor(palette, R, G, B, SDL_ALPHA_OPAQUE);
+                }
+            }
+        }
+    }
+    SDL_FreeInverseColormap(invmap);
+}
+
+static void SDL_ReleasePaletteMap(SDL_PaletteMap *map)
+{
+    if (map && SDL_AtomicDecRef(&map->refcount)) {
+        SDL_free(map);
+    }
+}
+
+/* Returns a reference to the RGB555 table for the current palette colors,
+   building it if needed. Release it with SDL_ReleasePaletteMap(). */
+static SDL_PaletteMap *SDL_AcquirePaletteMap(SDL_Palette *palette)
+{
+    const int bucket = PALMAP_BUCKET(palette);
+    SDL_PaletteMapEntry *entry;
+    SDL_PaletteMap *map = NULL, *stale = NULL;
+
+    SDL_AtomicLock(&palmaps_locks[bucket]);
+    for (entry = palmaps[bucket]; entry; entry = entry->next) {
+        if (entry->palette == palette) {
+            if (entry->map && entry->map->version == palette->version) {
+                map = entry->map;
+                SDL_AtomicIncRef(&map->refcount);
+            }
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&palmaps_locks[bucket]);
+    if (map) {
+        return map;
+    }
+
+    /* Build outside the lock, then share it if the palette is registered */
+    map = (SDL_PaletteMap *)SDL_malloc(sizeof(*map));
+    if (!map) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    SDL_AtomicSet(&map->refcount, 1);
+    map->version = palette->version;
+    SDL_FillPaletteMap(palette, map->table);
+
+    SDL_AtomicLock(&palmaps_locks[bucket]);
+    for (entry = palmaps[bucket]; entry; entry = entry->next) {
+        if (entry->palette == palette) {
+            stale = entry->map;
+            entry->map = map;
+            SDL_AtomicIncRef(&map->refcount);
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&palmaps_locks[bucket]);
+    SDL_ReleasePaletteMap(stale);
+
+    return map;
+}
+
+static void SDL_RegisterPalette(SDL_Palette *palette)
+{
+    SDL_PaletteMapEntry *entry;
+    int bucket;
+
+    entry = (SDL_PaletteMapEntry *)SDL_calloc(1, sizeof(*entry));
+    if (!entry) {
+        return; /* not fatal, each blit map will build its own table */
+    }
+    entry->palette = palette;
+
+    bucket = PALMAP_BUCKET(palette);
+    SDL_AtomicLock(&palmaps_locks[bucket]);
+    entry->next = palmaps[bucket];
+    palmaps[bucket] = entry;
+    SDL_AtomicUnlock(&palmaps_locks[bucket]);
+}
+
+static void SDL_UnregisterPalette(SDL_Palette *palette)
+{
+    SDL_PaletteMapEntry *entry, *prev = NULL;
+    const int bucket = PALMAP_BUCKET(palette);
+
+    SDL_AtomicLock(&palmaps_locks[bucket]);
+    for (entry = palmaps[bucket]; entry; prev = entry, entry = entry->next) {
+        if (entry->palette == palette) {
+            if (prev) {
+                prev->next = entry->next;
+            } else {
+                palmaps[bucket] = entry->next;
+            }
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&palmaps_locks[bucket]);
+
+    if (entry) {
+        SDL_ReleasePaletteMap(entry->map);
+        SDL_free(entry);
+    }
+}
+
 SDL_Palette *SDL_AllocPalette(int ncolors)
 {
     SDL_Palette *palette;
@@ -681,6 +973,8 @@ SDL_Palette *SDL_AllocPalette(int ncolors)
 
     SDL_memset(palette->colors, 0xFF, ncolors * sizeof(*palette->colors));
 
+    SDL_RegisterPalette(palette);
+
     return palette;
 }
 
@@ -746,6 +1040,7 @@ void SDL_FreePalette(SDL_Palette *palette)
     if (--palette->refcount > 0) {
         return;
     }
+    SDL_UnregisterPalette(palette);
     SDL_free(palette->colors);
     SDL_free(palette);
 }
@@ -987,18 +1282,25 @@ static Uint8 *Map1toN(SDL_PixelFormat *src, Uint8 Rmod, Uint8 Gmod, Uint8 Bmod,
     return map;
 }
 
-/* Map from BitField to Dithered-Palette to Palette */
-static Uint8 *MapNto1(SDL_PixelFormat *src, SDL_PixelFormat *dst, int *identical)
+/* Map from BitField to Palette, through the palette's shared RGB555 lookup table */
+static Uint8 *MapNto1(SDL_PixelFormat *dst, SDL_PaletteMap **palette_map, int *identical)
 {
-    /* Generate a 256 color dither palette */
-    SDL_Palette dithered;
-    SDL_Color colors[256];
     SDL_Palette *pal = dst->palette;
 
-    dithered.ncolors = 256;
-    SDL_DitherColors(colors, 8);
-    dithered.colors = colors;
-    return Map1to1(&dithered, pal, identical);
+    /* If the destination is the RGB 3-3-2 palette, the blitters can pack
+       the pixels directly without a table */
+    if (pal->ncolors >= 256) {
+        SDL_Color colors[256];
+
+        SDL_DitherColors(colors, 8);
+        if (SDL_memcmp(pal->colors, colors, sizeof(colors)) == 0) {
+            *identical = 1;
+            return NULL;
+        }
+    }
+    *identical = 0;
+    *palette_map = SDL_AcquirePaletteMap(pal);
+    return *palette_map ? (*palette_map)->table : NULL;
 }
 
 SDL_BlitMap *SDL_AllocBlitMap(void)
@@ -1046,7 +1348,12 @@ void SDL_InvalidateMap(SDL_BlitMap *map)
     map->dst = NULL;
     map->src_palette_version = 0;
     map->dst_palette_version = 0;
-    SDL_free(map->info.table);
+    if (map->palette_map) {
+        SDL_ReleasePaletteMap(map->palette_map);
+        map->palette_map = NULL;
+    } else {
+        SDL_free(map->info.table);
+    }
     map->info.table = NULL;
 }
 
@@ -1094,7 +1401,7 @@ int SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
     } else {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
             /* BitField --> Palette */
-            map->info.table = MapNto1(srcfmt, dstfmt, &map->identity);
+            map->info.table = MapNto1(dstfmt, &map->palette_map, &map->identity);
             if (!map->identity) {
                 if (!map->info.table) {
                     return -1;
@@ -1136,6 +1443,9 @@ void SDL_FreeBlitMap(SDL_BlitMap *map)
 {
     if (map) {
         SDL_InvalidateMap(map);
+#if SDL_HAVE_RLE
+        SDL_FreeRLECache(map);
+#endif
         SDL_free(map);
     }
 }
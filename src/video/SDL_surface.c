@@ -27,6 +27,7 @@
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
 #include "../render/SDL_sysrender.h"
+#include "../SDL_scratch_c.h"
 
 /* Check to make sure we can safely check multiplication of surface w and pitch and it won't overflow size_t */
 SDL_COMPILE_TIME_ASSERT(surface_size_assumptions,
@@ -295,6 +296,57 @@ SDL_Surface *SDL_CreateRGBSurfaceWithFormatFrom(void *pixels,
     return surface;
 }
 
+/*
+ * Create a zeroed surface whose pixels come from the calling thread's
+ * scratch arena, for temporaries that don't outlive the current scratch scope
+ */
+SDL_Surface *SDL_CreateScratchSurface(int width, int height, Uint32 format)
+{
+    SDL_Surface *surface;
+    size_t pitch, size;
+
+    if (width < 0) {
+        SDL_InvalidParamError("width");
+        return NULL;
+    }
+
+    if (height < 0) {
+        SDL_InvalidParamError("height");
+        return NULL;
+    }
+
+    if (SDL_ISPIXELFORMAT_FOURCC(format)) {
+        SDL_SetError("invalid format");
+        return NULL;
+    }
+
+    pitch = SDL_CalculatePitch(format, width, SDL_FALSE);
+    if (pitch > SDL_MAX_SINT32 || SDL_size_mul_overflow(height, pitch, &size)) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 0, 0, 0, format);
+    if (!surface) {
+        return NULL;
+    }
+    if (size) {
+        surface->pixels = SDL_AllocScratch(size);
+        if (!surface->pixels) {
+            SDL_FreeSurface(surface);
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        SDL_memset(surface->pixels, 0, size);
+    }
+    surface->flags |= SDL_PREALLOC;
+    surface->w = width;
+    surface->h = height;
+    surface->pitch = (int)pitch;
+    SDL_SetClipRect(surface, NULL);
+    return surface;
+}
+
 int SDL_SetSurfacePalette(SDL_Surface *surface, SDL_Palette *palette)
 {
     if (!surface) {
@@ -1072,6 +1124,8 @@ int SDL_LockSurface(SDL_Surface *surface)
         /* Perform the lock */
         if (surface->flags & SDL_RLEACCEL) {
             SDL_UnRLESurface(surface, 1);
+            /* the pixels may change, the cached encodings are stale */
+            SDL_InvalidateRLECache(surface);
             surface->flags |= SDL_RLEACCEL; /* save accel'd state */
         }
 #endif
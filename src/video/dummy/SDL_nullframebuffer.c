@@ -23,6 +23,7 @@
 #ifdef SDL_VIDEO_DRIVER_DUMMY
 
 #include "../SDL_sysvideo.h"
+#include "../../SDL_hints_c.h"
 #include "SDL_nullframebuffer_c.h"
 
 #define DUMMY_SURFACE "_SDL_DummySurface"
@@ -54,6 +55,7 @@ int SDL_DUMMY_CreateWindowFramebuffer(_THIS, SDL_Window *window, Uint32 *format,
 int SDL_DUMMY_UpdateWindowFramebuffer(_THIS, SDL_Window *window, const SDL_Rect *rects, int numrects)
 {
     static int frame_number;
+    static SDL_CachedHint save_frames = SDL_CACHED_HINT("SDL_VIDEO_DUMMY_SAVE_FRAMES", NULL);
     SDL_Surface *surface;
 
     surface = (SDL_Surface *)SDL_GetWindowData(window, DUMMY_SURFACE);
@@ -62,7 +64,7 @@ int SDL_DUMMY_UpdateWindowFramebuffer(_THIS, SDL_Window *window, const SDL_Rect
     }
 
     /* Send the data to the display */
-    if (SDL_getenv("SDL_VIDEO_DUMMY_SAVE_FRAMES")) {
+    if (SDL_GetCachedHint(&save_frames)) {
         char file[128];
         (void)SDL_snprintf(file, sizeof(file), "SDL_window%" SDL_PRIu32 "-%8.8d.bmp",
                            SDL_GetWindowID(window), ++frame_number);
@@ -0,0 +1,201 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of the individual sample type, byte order and channel converters,
+   comparing the SIMD implementations with the scalar ones.
+   Build SDL with optimizations for this, the intrinsics are slow at -O0. */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define BUFFER_FRAMES 4096
+
+static const char *FormatName(SDL_AudioFormat format)
+{
+    switch (format) {
+    case AUDIO_S8:
+        return "S8";
+    case AUDIO_U8:
+        return "U8";
+    case AUDIO_S16LSB:
+        return "S16LSB";
+    case AUDIO_S16MSB:
+        return "S16MSB";
+    case AUDIO_U16LSB:
+        return "U16LSB";
+    case AUDIO_U16MSB:
+        return "U16MSB";
+    case AUDIO_S32LSB:
+        return "S32LSB";
+    case AUDIO_S32MSB:
+        return "S32MSB";
+    case AUDIO_F32LSB:
+        return "F32LSB";
+    case AUDIO_F32MSB:
+        return "F32MSB";
+    default:
+        return "???";
+    }
+}
+
+/* Returns the time per frame in nanoseconds, or a negative value on failure */
+static double Benchmark(SDL_AudioFormat src_format, Uint8 src_channels,
+                        SDL_AudioFormat dst_format, Uint8 dst_channels,
+                        int iterations)
+{
+    const int src_frame_size = (SDL_AUDIO_BITSIZE(src_format) / 8) * src_channels;
+    const int len = BUFFER_FRAMES * src_frame_size;
+    SDL_AudioCVT cvt;
+    Uint8 *input;
+    Uint64 start, elapsed;
+    double seconds;
+    int i;
+
+    if (SDL_BuildAudioCVT(&cvt, src_format, src_channels, 48000, dst_format, dst_channels, 48000) < 0) {
+        SDL_Log("Couldn't build audio converter: %s\n", SDL_GetError());
+        return -1.0;
+    }
+
+    input = (Uint8 *)SDL_malloc(len);
+    cvt.buf = (Uint8 *)SDL_malloc(len * cvt.len_mult);
+    if (!input || !cvt.buf) {
+        SDL_Log("Out of memory\n");
+        SDL_free(input);
+        SDL_free(cvt.buf);
+        return -1.0;
+    }
+    for (i = 0; i < len; ++i) {
+        input[i] = (Uint8)(i * 31);
+    }
+    if (src_format == AUDIO_F32SYS) {
+        for (i = 0; i < len / (int)sizeof(float); ++i) {
+            ((float *)input)[i] = (float)((i * 31) % 200 - 100) / 100.0f;
+        }
+    }
+
+    /* Warm up the caches and let the CPU settle on its clock speed */
+    for (i = 0; i < iterations / 10 + 1; ++i) {
+        SDL_memcpy(cvt.buf, input, len);
+        cvt.len = len;
+        SDL_ConvertAudio(&cvt);
+    }
+
+    /* The conversion happens in place, so the copy back is part of every iteration */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_memcpy(cvt.buf, input, len);
+        cvt.len = len;
+        SDL_ConvertAudio(&cvt);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    seconds = (double)elapsed / SDL_GetPerformanceFrequency();
+
+    SDL_free(input);
+    SDL_free(cvt.buf);
+
+    return seconds * 1000000000.0 / ((double)iterations * BUFFER_FRAMES);
+}
+
+/* SDL picks its converters from the CPU features it reports, so masking
+   features off with SDL_HINT_CPU_FEATURE_MASK selects each implementation in turn.
+   Where SDL has no scalar type converters (x86_64, ARMv8), SSE2 or NEON is the
+   slowest variant that "-all" can get. */
+static const struct
+{
+    const char *label;
+    const char *mask;
+} variants[] = {
+    { "best", "" },
+    { "no AVX2", "-avx2" },
+    { "no SSE4.1", "-avx2,-sse41" },
+    { "scalar", "-all" }
+};
+
+static void BenchmarkVariants(SDL_AudioFormat src_format, Uint8 src_channels,
+                              SDL_AudioFormat dst_format, Uint8 dst_channels,
+                              int iterations)
+{
+    double ns[SDL_arraysize(variants)];
+    int i;
+
+    for (i = 0; i < SDL_arraysize(variants); ++i) {
+        SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, variants[i].mask);
+        ns[i] = Benchmark(src_format, src_channels, dst_format, dst_channels, iterations);
+    }
+    SDL_ResetHint(SDL_HINT_CPU_FEATURE_MASK);
+
+    SDL_Log("%-6s %d ch -> %-6s %d ch: %10.2f %10.2f %10.2f %10.2f ns/frame, %5.2fx\n",
+            FormatName(src_format), src_channels, FormatName(dst_format), dst_channels,
+            ns[0], ns[1], ns[2], ns[3], (ns[0] > 0.0) ? ns[3] / ns[0] : 0.0);
+}
+
+int main(int argc, char *argv[])
+{
+    static const SDL_AudioFormat formats[] = {
+        AUDIO_S8, AUDIO_U8, AUDIO_S16SYS, AUDIO_U16SYS, AUDIO_S32SYS
+    };
+    static const SDL_AudioFormat swapped_formats[] = {
+        AUDIO_S16LSB ^ AUDIO_S16MSB ^ AUDIO_S16SYS,
+        AUDIO_U16LSB ^ AUDIO_U16MSB ^ AUDIO_U16SYS,
+        AUDIO_S32LSB ^ AUDIO_S32MSB ^ AUDIO_S32SYS,
+        AUDIO_F32LSB ^ AUDIO_F32MSB ^ AUDIO_F32SYS
+    };
+    static const Uint8 layouts[][2] = {
+        { 1, 2 }, { 2, 1 }, { 2, 6 }, { 2, 8 }, { 6, 2 }, { 6, 8 }, { 8, 2 }, { 8, 6 }
+    };
+    int iterations = 2000;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        iterations = SDL_atoi(argv[1]);
+        if (iterations <= 0) {
+            SDL_Log("Usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("SSE: %d SSE2: %d SSE3: %d SSE4.1: %d AVX2: %d NEON: %d\n",
+            SDL_HasSSE(), SDL_HasSSE2(), SDL_HasSSE3(), SDL_HasSSE41(), SDL_HasAVX2(), SDL_HasNEON());
+    SDL_Log("%-26s %10s %10s %10s %10s           speedup\n", "",
+            variants[0].label, variants[1].label, variants[2].label, variants[3].label);
+
+    SDL_Log("Sample types:\n");
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        BenchmarkVariants(formats[i], 1, AUDIO_F32SYS, 1, iterations);
+        BenchmarkVariants(AUDIO_F32SYS, 1, formats[i], 1, iterations);
+    }
+
+    SDL_Log("Byte order:\n");
+    for (i = 0; i < SDL_arraysize(swapped_formats); ++i) {
+        BenchmarkVariants(swapped_formats[i], 1, AUDIO_F32SYS, 1, iterations);
+        BenchmarkVariants(AUDIO_F32SYS, 1, swapped_formats[i], 1, iterations);
+    }
+    BenchmarkVariants(AUDIO_S16SYS, 1, swapped_formats[0], 1, iterations);
+
+    SDL_Log("Channel layouts:\n");
+    for (i = 0; i < SDL_arraysize(layouts); ++i) {
+        BenchmarkVariants(AUDIO_F32SYS, layouts[i][0], AUDIO_F32SYS, layouts[i][1], iterations);
+    }
+
+    SDL_Quit();
+    return 0;
+}
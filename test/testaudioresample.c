@@ -0,0 +1,127 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of the resampling quality levels: throughput and signal-to-noise ratio */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define SECONDS 2
+
+static const char *quality_names[] = { "linear", "medium", "high" };
+
+static double SineSample(int frame, int rate, int freq)
+{
+    return SDL_sin((double)((Sint64)frame * freq % rate) / rate * (2.0 * M_PI));
+}
+
+static void Benchmark(SDL_AudioResamplingQuality quality, int src_rate, int dst_rate, int channels, int freq)
+{
+    const int src_frames = SECONDS * src_rate;
+    const int len = src_frames * channels * (int)sizeof(float);
+    const int edge = 1000; /* the resampler sees silence before the start of the stream */
+    SDL_AudioStream *stream;
+    float *input, *output;
+    double sum_squared_error = 0.0, sum_squared_value = 0.0;
+    double seconds;
+    Uint64 start;
+    int i, chan, outlen, frames;
+
+    stream = SDL_NewAudioStream(AUDIO_F32SYS, channels, src_rate, AUDIO_F32SYS, channels, dst_rate);
+    if (!stream || SDL_SetAudioStreamResamplingQuality(stream, quality) < 0) {
+        SDL_Log("Couldn't create audio stream: %s\n", SDL_GetError());
+        SDL_FreeAudioStream(stream);
+        return;
+    }
+
+    input = (float *)SDL_malloc(len);
+    output = (float *)SDL_malloc((size_t)SECONDS * dst_rate * channels * sizeof(float));
+    if (!input || !output) {
+        SDL_Log("Out of memory\n");
+        SDL_free(input);
+        SDL_free(output);
+        SDL_FreeAudioStream(stream);
+        return;
+    }
+    for (i = 0; i < src_frames; ++i) {
+        for (chan = 0; chan < channels; ++chan) {
+            input[(i * channels) + chan] = (float)SineSample(i, src_rate, freq);
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    SDL_AudioStreamPut(stream, input, len);
+    SDL_AudioStreamFlush(stream);
+    outlen = SDL_AudioStreamGet(stream, output, SECONDS * dst_rate * channels * (int)sizeof(float));
+    seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+
+    /* Compare the first channel with the ideal sine wave at the output rate */
+    frames = outlen / (channels * (int)sizeof(float));
+    for (i = edge; i < frames - edge; ++i) {
+        const double target = SineSample(i, dst_rate, freq);
+        const double error = target - output[i * channels];
+        sum_squared_error += error * error;
+        sum_squared_value += target * target;
+    }
+
+    SDL_Log("%-6s %6d -> %6d Hz %d ch %5d Hz: %10.2f MB/s %8.2f dB\n",
+            quality_names[quality], src_rate, dst_rate, channels, freq,
+            ((double)len / (1024.0 * 1024.0)) / seconds,
+            10.0 * SDL_log10(sum_squared_value / sum_squared_error));
+
+    SDL_free(input);
+    SDL_free(output);
+    SDL_FreeAudioStream(stream);
+}
+
+int main(int argc, char *argv[])
+{
+    static const int rates[][3] = {
+        /* source rate, destination rate, test tone */
+        { 44100, 48000, 1000 },
+        { 44100, 48000, 15000 },
+        { 48000, 44100, 1000 },
+        { 22050, 48000, 5000 },
+        { 48000, 16000, 3000 },
+        { 44100, 96000, 10000 }
+    };
+    static const int channels[] = { 1, 2, 6 };
+    int quality, i, j;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        SDL_Log("Usage: %s\n", argv[0]);
+        return 1;
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("SSE: %d NEON: %d\n", SDL_HasSSE(), SDL_HasNEON());
+
+    for (quality = SDL_AUDIO_RESAMPLING_LINEAR; quality <= SDL_AUDIO_RESAMPLING_HIGH; ++quality) {
+        for (i = 0; i < SDL_arraysize(rates); ++i) {
+            for (j = 0; j < SDL_arraysize(channels); ++j) {
+                Benchmark((SDL_AudioResamplingQuality)quality, rates[i][0], rates[i][1], channels[j], rates[i][2]);
+            }
+        }
+    }
+
+    SDL_Quit();
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of audio stream throughput (put -> get) for common conversions */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define CHUNK_FRAMES 1024
+
+static const char *FormatName(SDL_AudioFormat format)
+{
+    switch (format) {
+    case AUDIO_U8:
+        return "U8";
+    case AUDIO_S16SYS:
+        return "S16";
+    case AUDIO_S32SYS:
+        return "S32";
+    case AUDIO_F32SYS:
+        return "F32";
+    default:
+        return "???";
+    }
+}
+
+static void Benchmark(SDL_AudioFormat src_format, Uint8 src_channels, int src_rate,
+                      SDL_AudioFormat dst_format, Uint8 dst_channels, int dst_rate,
+                      SDL_bool peek, int seconds)
+{
+    const int src_frame_size = (SDL_AUDIO_BITSIZE(src_format) / 8) * src_channels;
+    const int dst_frame_size = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+    const int chunk_len = CHUNK_FRAMES * src_frame_size;
+    const int output_len = CHUNK_FRAMES * 4 * dst_frame_size;
+    const int total_len = seconds * src_rate * src_frame_size;
+    SDL_AudioStream *stream;
+    Uint8 *input, *output;
+    Uint64 start, elapsed;
+    int offset, i;
+
+    stream = SDL_NewAudioStream(src_format, src_channels, src_rate, dst_format, dst_channels, dst_rate);
+    input = (Uint8 *)SDL_calloc(1, chunk_len);
+    output = (Uint8 *)SDL_malloc(output_len);
+    if (!stream || !input || !output) {
+        SDL_Log("Couldn't create audio stream: %s\n", SDL_GetError());
+        SDL_FreeAudioStream(stream);
+        SDL_free(input);
+        SDL_free(output);
+        return;
+    }
+    for (i = 0; i < chunk_len; ++i) {
+        input[i] = (Uint8)(i * 31);
+    }
+    if (src_format == AUDIO_F32SYS) {
+        for (i = 0; i < chunk_len / (int)sizeof(float); ++i) {
+            ((float *)input)[i] = (float)((i * 31) % 200 - 100) / 100.0f;
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (offset = 0; offset < total_len; offset += chunk_len) {
+        SDL_AudioStreamPut(stream, input, chunk_len);
+        if (peek) {
+            const void *data;
+            int len;
+            while ((len = SDL_AudioStreamPeek(stream, &data)) > 0) {
+                SDL_AudioStreamCommitRead(stream, len);
+            }
+        } else {
+            while (SDL_AudioStreamGet(stream, output, output_len) > 0) {
+            }
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_Log("%s %d ch %5d Hz -> %s %d ch %5d Hz (%s): %8.2f MB/s\n",
+            FormatName(src_format), src_channels, src_rate,
+            FormatName(dst_format), dst_channels, dst_rate,
+            peek ? "peek" : "get ",
+            ((double)total_len / (1024.0 * 1024.0)) / ((double)elapsed / SDL_GetPerformanceFrequency()));
+
+    SDL_FreeAudioStream(stream);
+    SDL_free(input);
+    SDL_free(output);
+}
+
+static void BenchmarkChain(SDL_AudioFormat src_format, Uint8 src_channels, int src_rate,
+                           SDL_AudioFormat dst_format, Uint8 dst_channels, int dst_rate,
+                           int seconds)
+{
+    Benchmark(src_format, src_channels, src_rate, dst_format, dst_channels, dst_rate, SDL_FALSE, seconds);
+    Benchmark(src_format, src_channels, src_rate, dst_format, dst_channels, dst_rate, SDL_TRUE, seconds);
+}
+
+int main(int argc, char *argv[])
+{
+    int seconds = 60;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        seconds = SDL_atoi(argv[1]);
+        if (seconds <= 0) {
+            SDL_Log("Usage: %s [seconds of audio]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    BenchmarkChain(AUDIO_S16SYS, 2, 48000, AUDIO_S16SYS, 2, 48000, seconds);
+    BenchmarkChain(AUDIO_S16SYS, 2, 48000, AUDIO_F32SYS, 2, 48000, seconds);
+    BenchmarkChain(AUDIO_S16SYS, 1, 44100, AUDIO_S16SYS, 2, 44100, seconds);
+    BenchmarkChain(AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 2, 48000, seconds);
+    BenchmarkChain(AUDIO_F32SYS, 2, 48000, AUDIO_S16SYS, 2, 44100, seconds);
+    BenchmarkChain(AUDIO_F32SYS, 6, 48000, AUDIO_F32SYS, 2, 48000, seconds);
+    BenchmarkChain(AUDIO_S16SYS, 2, 48000, AUDIO_F32SYS, 6, 48000, seconds);
+    BenchmarkChain(AUDIO_S16SYS, 2, 48000, AUDIO_F32SYS, 8, 48000, seconds);
+    BenchmarkChain(AUDIO_F32SYS, 8, 48000, AUDIO_S16SYS, 2, 48000, seconds);
+
+    SDL_Quit();
+    return 0;
+}
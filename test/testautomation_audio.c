@@ -1213,6 +1213,1493 @@ int audio_resampleLoss(void)
   return TEST_COMPLETED;
 }
 
+/**
+ * \brief Check that reading an audio stream with SDL_AudioStreamPeek() and
+ * SDL_AudioStreamCommitRead() returns the same data as SDL_AudioStreamGet().
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamPeek
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamCommitRead
+ */
+int audio_streamPeekCommit(void)
+{
+  struct test_spec_t {
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    int src_rate;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+    int dst_rate;
+  } test_specs[] = {
+    { AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 2, 48000 },
+    { AUDIO_S16SYS, 2, 48000, AUDIO_F32SYS, 2, 48000 },
+    { AUDIO_F32SYS, 1, 48000, AUDIO_S16SYS, 2, 22050 },
+    { AUDIO_U8, 6, 11025, AUDIO_S16MSB, 2, 11025 },
+    { 0 }
+  };
+  const int input_len = 48000 * 2 * (int)sizeof(float);
+  Uint8 *input = (Uint8 *)SDL_malloc(input_len);
+  Uint8 *expected = NULL;
+  int spec_idx = 0;
+  int i;
+
+  SDLTest_AssertCheck(input != NULL, "Expected input buffer to be created.");
+  if (input == NULL) {
+    return TEST_ABORTED;
+  }
+  /* Valid float samples, which are just noise for the integer formats */
+  for (i = 0; i < input_len / (int)sizeof(float); ++i) {
+    ((float *)input)[i] = (float)SDLTest_RandomIntegerInRange(-32768, 32767) / 32768.0f;
+  }
+
+  for (spec_idx = 0; test_specs[spec_idx].src_rate > 0; ++spec_idx) {
+    const struct test_spec_t *spec = &test_specs[spec_idx];
+    const int src_frame_size = (SDL_AUDIO_BITSIZE(spec->src_format) / 8) * spec->src_channels;
+    const int dst_frame_size = (SDL_AUDIO_BITSIZE(spec->dst_format) / 8) * spec->dst_channels;
+    SDL_AudioStream *get_stream, *peek_stream;
+    int expected_len = 0, peeked_len = 0, offset = 0;
+    SDL_bool matches = SDL_TRUE;
+
+    get_stream = SDL_NewAudioStream(spec->src_format, spec->src_channels, spec->src_rate, spec->dst_format, spec->dst_channels, spec->dst_rate);
+    peek_stream = SDL_NewAudioStream(spec->src_format, spec->src_channels, spec->src_rate, spec->dst_format, spec->dst_channels, spec->dst_rate);
+    SDLTest_AssertPass("Call to SDL_NewAudioStream(0x%x, %i, %i, 0x%x, %i, %i)",
+                       spec->src_format, spec->src_channels, spec->src_rate,
+                       spec->dst_format, spec->dst_channels, spec->dst_rate);
+    SDLTest_AssertCheck(get_stream != NULL && peek_stream != NULL, "Expected audio streams to be created.");
+    if (get_stream == NULL || peek_stream == NULL) {
+      SDL_FreeAudioStream(get_stream);
+      SDL_FreeAudioStream(peek_stream);
+      SDL_free(input);
+      return TEST_ABORTED;
+    }
+
+    /* Put the same data into both streams in odd sized chunks */
+    while (offset < input_len) {
+      int chunk = SDLTest_RandomIntegerInRange(1, 997) * src_frame_size;
+      chunk = SDL_min(chunk, input_len - offset);
+      chunk -= chunk % src_frame_size;
+      if (chunk == 0) {
+        break;
+      }
+      if (SDL_AudioStreamPut(get_stream, input + offset, chunk) < 0 ||
+          SDL_AudioStreamPut(peek_stream, input + offset, chunk) < 0) {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected SDL_AudioStreamPut to succeed: %s", SDL_GetError());
+        break;
+      }
+      offset += chunk;
+    }
+    SDL_AudioStreamFlush(get_stream);
+    SDL_AudioStreamFlush(peek_stream);
+
+    SDLTest_AssertCheck(SDL_AudioStreamAvailable(get_stream) == SDL_AudioStreamAvailable(peek_stream),
+                        "Expected both streams to have the same amount of data available, got %i and %i.",
+                        SDL_AudioStreamAvailable(get_stream), SDL_AudioStreamAvailable(peek_stream));
+
+    expected_len = SDL_AudioStreamAvailable(get_stream);
+    expected = (Uint8 *)SDL_malloc(expected_len ? expected_len : 1);
+    SDLTest_AssertCheck(expected != NULL, "Expected output buffer to be created.");
+    if (expected == NULL) {
+      SDL_FreeAudioStream(get_stream);
+      SDL_FreeAudioStream(peek_stream);
+      SDL_free(input);
+      return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_AudioStreamGet(get_stream, expected, expected_len) == expected_len,
+                        "Expected SDL_AudioStreamGet to return %i bytes.", expected_len);
+
+    for (;;) {
+      const void *data = NULL;
+      int len = SDL_AudioStreamPeek(peek_stream, &data);
+      if (len <= 0) {
+        SDLTest_AssertCheck(len == 0 && data == NULL, "Expected SDL_AudioStreamPeek to return no data at the end of the stream.");
+        break;
+      }
+      if ((len % dst_frame_size) != 0) {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected SDL_AudioStreamPeek to return whole sample frames, got %i bytes.", len);
+        matches = SDL_FALSE;
+        break;
+      }
+      if (peeked_len + len > expected_len || SDL_memcmp(expected + peeked_len, data, len) != 0) {
+        matches = SDL_FALSE;
+        break;
+      }
+      /* Consume a single sample frame now and then */
+      if (SDLTest_RandomIntegerInRange(0, 3) == 0) {
+        len = dst_frame_size;
+      }
+      if (SDL_AudioStreamCommitRead(peek_stream, len) != len) {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected SDL_AudioStreamCommitRead to remove %i bytes.", len);
+        matches = SDL_FALSE;
+        break;
+      }
+      peeked_len += len;
+    }
+    SDLTest_AssertCheck(matches && peeked_len == expected_len,
+                        "Expected peeked data to match SDL_AudioStreamGet, %i of %i bytes matched.", peeked_len, expected_len);
+    SDLTest_AssertCheck(SDL_AudioStreamCommitRead(peek_stream, dst_frame_size + 1) == -1,
+                        "Expected SDL_AudioStreamCommitRead to reject partial sample frames.");
+
+    SDL_free(expected);
+    SDL_FreeAudioStream(get_stream);
+    SDL_FreeAudioStream(peek_stream);
+  }
+
+  SDL_free(input);
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Check that puts that leave the stream's queue off a 16 byte boundary
+ * keep the data intact and reuse the queue's packets.
+ *
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamPut
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamGet
+ */
+int audio_streamUnalignedPuts(void)
+{
+  /* Mono float output frames are 4 bytes, so none of these are a multiple of 16 bytes */
+  static const int chunk_frames[] = { 1, 3, 5, 7, 9, 13, 2, 31, 1, 6 };
+  const int input_frames = 3000;
+  const int output_len = input_frames * (int)sizeof(float);
+  Sint16 *input = (Sint16 *)SDL_malloc(input_frames * sizeof(Sint16));
+  Uint8 *expected = (Uint8 *)SDL_malloc(output_len);
+  Uint8 *output = (Uint8 *)SDL_malloc(output_len);
+  SDL_AudioStream *whole_stream, *chunked_stream;
+  int allocations, offset = 0, puts = 0, got, i;
+
+  SDLTest_AssertCheck(input != NULL && expected != NULL && output != NULL, "Expected buffers to be created.");
+  if (input == NULL || expected == NULL || output == NULL) {
+    SDL_free(input);
+    SDL_free(expected);
+    SDL_free(output);
+    return TEST_ABORTED;
+  }
+  for (i = 0; i < input_frames; ++i) {
+    input[i] = (Sint16)SDLTest_RandomIntegerInRange(-32768, 32767);
+  }
+
+  /* Same rate, so each put is converted straight into reserved space in the queue */
+  whole_stream = SDL_NewAudioStream(AUDIO_S16SYS, 1, 22050, AUDIO_F32SYS, 1, 22050);
+  chunked_stream = SDL_NewAudioStream(AUDIO_S16SYS, 1, 22050, AUDIO_F32SYS, 1, 22050);
+  SDLTest_AssertPass("Call to SDL_NewAudioStream(AUDIO_S16SYS, 1, 22050, AUDIO_F32SYS, 1, 22050)");
+  SDLTest_AssertCheck(whole_stream != NULL && chunked_stream != NULL, "Expected audio streams to be created.");
+  if (whole_stream == NULL || chunked_stream == NULL) {
+    SDL_FreeAudioStream(whole_stream);
+    SDL_FreeAudioStream(chunked_stream);
+    SDL_free(input);
+    SDL_free(expected);
+    SDL_free(output);
+    return TEST_ABORTED;
+  }
+
+  SDLTest_AssertCheck(SDL_AudioStreamPut(whole_stream, input, input_frames * (int)sizeof(Sint16)) == 0,
+                      "Expected SDL_AudioStreamPut to succeed.");
+  SDL_AudioStreamFlush(whole_stream);
+  got = SDL_AudioStreamGet(whole_stream, expected, output_len);
+  SDLTest_AssertCheck(got == output_len, "Expected SDL_AudioStreamGet to return %i bytes, got %i.", output_len, got);
+
+  allocations = SDL_GetNumAllocations();
+  while (offset < input_frames) {
+    const int frames = SDL_min(chunk_frames[puts % SDL_arraysize(chunk_frames)], input_frames - offset);
+    if (SDL_AudioStreamPut(chunked_stream, input + offset, frames * (int)sizeof(Sint16)) < 0) {
+      SDLTest_AssertCheck(SDL_FALSE, "Expected SDL_AudioStreamPut to succeed: %s", SDL_GetError());
+      break;
+    }
+    offset += frames;
+    ++puts;
+  }
+  SDL_AudioStreamFlush(chunked_stream);
+  /* 12000 bytes need one packet more than the two 4096 byte packets the queue starts with */
+  SDLTest_AssertCheck(SDL_GetNumAllocations() - allocations <= 4,
+                      "Expected %i unaligned puts to fill the queue's packets, %i new allocations.",
+                      puts, SDL_GetNumAllocations() - allocations);
+
+  got = SDL_AudioStreamGet(chunked_stream, output, output_len);
+  SDLTest_AssertCheck(got == output_len, "Expected SDL_AudioStreamGet to return %i bytes, got %i.", output_len, got);
+  SDLTest_AssertCheck(got > 0 && SDL_memcmp(expected, output, got) == 0,
+                      "Expected the output of unaligned puts to match a single put.");
+
+  SDL_FreeAudioStream(whole_stream);
+  SDL_FreeAudioStream(chunked_stream);
+  SDL_free(input);
+  SDL_free(expected);
+  SDL_free(output);
+
+  return TEST_COMPLETED;
+}
+
+/* Run a single SDL_AudioCVT conversion at the same rate, returns the converted length or -1 */
+static int convert_with_cvt(Uint8 **buf, int len, SDL_AudioFormat src_format, Uint8 src_channels, SDL_AudioFormat dst_format, Uint8 dst_channels)
+{
+  SDL_AudioCVT cvt;
+  int ret = SDL_BuildAudioCVT(&cvt, src_format, src_channels, 48000, dst_format, dst_channels, 48000);
+  if (ret <= 0) {
+    return ret < 0 ? -1 : len;
+  }
+  cvt.buf = (Uint8 *)SDL_malloc(len * cvt.len_mult);
+  if (cvt.buf == NULL) {
+    return -1;
+  }
+  SDL_memcpy(cvt.buf, *buf, len);
+  cvt.len = len;
+  if (SDL_ConvertAudio(&cvt) < 0) {
+    SDL_free(cvt.buf);
+    return -1;
+  }
+  SDL_free(*buf);
+  *buf = cvt.buf;
+  return cvt.len_cvt;
+}
+
+/**
+ * \brief Check that the single pass conversions give exactly the same results as separate format and channel conversions.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_convertAudioFused(void)
+{
+  struct test_spec_t {
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+  } test_specs[] = {
+    { AUDIO_S16SYS, 1, AUDIO_S16SYS, 2 },
+    { AUDIO_S16SYS, 2, AUDIO_F32SYS, 6 },
+    { AUDIO_S16SYS, 2, AUDIO_F32SYS, 8 },
+    { AUDIO_F32SYS, 8, AUDIO_S16SYS, 2 },
+    { 0 }
+  };
+  const int frame_counts[] = { 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 1000, 4099 };
+  int spec_idx, count_idx, i;
+
+  for (spec_idx = 0; test_specs[spec_idx].src_format != 0; ++spec_idx) {
+    const struct test_spec_t *spec = &test_specs[spec_idx];
+    const int src_frame_size = (SDL_AUDIO_BITSIZE(spec->src_format) / 8) * spec->src_channels;
+    const int dst_frame_size = (SDL_AUDIO_BITSIZE(spec->dst_format) / 8) * spec->dst_channels;
+
+    for (count_idx = 0; count_idx < SDL_arraysize(frame_counts); ++count_idx) {
+      const int num_frames = frame_counts[count_idx];
+      const int len = num_frames * src_frame_size;
+      Uint8 *expected = (Uint8 *)SDL_malloc(len);
+      SDL_AudioCVT cvt;
+      int expected_len = len;
+      int ret;
+
+      SDLTest_AssertCheck(expected != NULL, "Expected reference buffer to be created.");
+      if (expected == NULL) {
+        return TEST_ABORTED;
+      }
+
+      if (SDL_AUDIO_ISFLOAT(spec->src_format)) {
+        for (i = 0; i < len / (int)sizeof(float); ++i) {
+          /* Include out of range samples and the exact limits */
+          ((float *)expected)[i] = (i % 13 == 0) ? ((i & 1) ? 1.0f : -1.0f) : SDLTest_RandomUnitFloat() * 4.0f - 2.0f;
+        }
+      } else {
+        for (i = 0; i < len / (int)sizeof(Sint16); ++i) {
+          ((Sint16 *)expected)[i] = (i % 11 == 0) ? ((i & 1) ? SDL_MAX_SINT16 : SDL_MIN_SINT16) : SDLTest_RandomSint16();
+        }
+      }
+
+      ret = SDL_BuildAudioCVT(&cvt, spec->src_format, spec->src_channels, 48000, spec->dst_format, spec->dst_channels, 48000);
+      SDLTest_AssertCheck(ret == 1, "Expected SDL_BuildAudioCVT to succeed and conversion to be needed, got %i.", ret);
+      SDLTest_AssertCheck(cvt.len_ratio == ((double)dst_frame_size) / src_frame_size,
+                          "Expected len_ratio to be %f, got %f.", ((double)dst_frame_size) / src_frame_size, cvt.len_ratio);
+      cvt.buf = (Uint8 *)SDL_malloc(len * cvt.len_mult);
+      SDLTest_AssertCheck(cvt.buf != NULL, "Expected conversion buffer to be created.");
+      if (ret != 1 || cvt.buf == NULL) {
+        SDL_free(cvt.buf);
+        SDL_free(expected);
+        return TEST_ABORTED;
+      }
+      SDL_memcpy(cvt.buf, expected, len);
+      cvt.len = len;
+      ret = SDL_ConvertAudio(&cvt);
+      SDLTest_AssertCheck(ret == 0, "Expected SDL_ConvertAudio to succeed.");
+
+      /* Convert the format, then the channels, then the format again, like the filter chain would */
+      expected_len = convert_with_cvt(&expected, expected_len, spec->src_format, spec->src_channels, AUDIO_F32SYS, spec->src_channels);
+      if (expected_len >= 0) {
+        expected_len = convert_with_cvt(&expected, expected_len, AUDIO_F32SYS, spec->src_channels, AUDIO_F32SYS, spec->dst_channels);
+      }
+      if (expected_len >= 0) {
+        expected_len = convert_with_cvt(&expected, expected_len, AUDIO_F32SYS, spec->dst_channels, spec->dst_format, spec->dst_channels);
+      }
+      SDLTest_AssertCheck(expected_len == num_frames * dst_frame_size, "Expected reference conversion to produce %i bytes, got %i.", num_frames * dst_frame_size, expected_len);
+      SDLTest_AssertCheck(cvt.len_cvt == expected_len, "Expected converted length %i, got %i.", expected_len, cvt.len_cvt);
+      if (cvt.len_cvt == expected_len) {
+        SDLTest_AssertCheck(SDL_memcmp(cvt.buf, expected, expected_len) == 0,
+                            "Expected 0x%.4x %i channels to 0x%.4x %i channels of %i frames to match the separate conversions.",
+                            spec->src_format, spec->src_channels, spec->dst_format, spec->dst_channels, num_frames);
+      }
+
+      SDL_free(cvt.buf);
+      SDL_free(expected);
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+/* Swaps the bytes of each sample in place */
+static void _audio_swapSamples(Uint8 *buf, int len, int sample_size)
+{
+  int i, j;
+
+  for (i = 0; i + sample_size <= len; i += sample_size) {
+    for (j = 0; j < sample_size / 2; ++j) {
+      const Uint8 tmp = buf[i + j];
+      buf[i + j] = buf[i + sample_size - 1 - j];
+      buf[i + sample_size - 1 - j] = tmp;
+    }
+  }
+}
+
+/* Fills the buffer with random samples, floats are kept in [-2.0, 2.0] */
+static void _audio_fillRandom(Uint8 *buf, int len, SDL_AudioFormat format)
+{
+  int i;
+
+  if (SDL_AUDIO_ISFLOAT(format)) {
+    for (i = 0; i < len / (int)sizeof(float); ++i) {
+      ((float *)buf)[i] = (i % 13 == 0) ? ((i & 1) ? 1.0f : -1.0f) : SDLTest_RandomUnitFloat() * 4.0f - 2.0f;
+    }
+  } else {
+    for (i = 0; i < len; ++i) {
+      buf[i] = SDLTest_RandomUint8();
+    }
+  }
+}
+
+/**
+ * \brief Check the SIMD converters against converting one frame at a time, and byteswapped formats against native ones.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_convertAudioSIMD(void)
+{
+  struct test_spec_t {
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+  } test_specs[] = {
+    { AUDIO_S8, 1, AUDIO_F32SYS, 1 },
+    { AUDIO_U8, 1, AUDIO_F32SYS, 1 },
+    { AUDIO_S16SYS, 1, AUDIO_F32SYS, 1 },
+    { AUDIO_S32SYS, 1, AUDIO_F32SYS, 1 },
+    { AUDIO_F32SYS, 1, AUDIO_S8, 1 },
+    { AUDIO_F32SYS, 1, AUDIO_U8, 1 },
+    { AUDIO_F32SYS, 1, AUDIO_S16SYS, 1 },
+    { AUDIO_F32SYS, 1, AUDIO_S32SYS, 1 },
+    { AUDIO_F32SYS, 6, AUDIO_F32SYS, 2 },
+    { AUDIO_F32SYS, 8, AUDIO_F32SYS, 2 },
+    { AUDIO_F32SYS, 8, AUDIO_F32SYS, 6 },
+    { AUDIO_F32SYS, 2, AUDIO_F32SYS, 6 },
+    { AUDIO_F32SYS, 2, AUDIO_F32SYS, 8 },
+    { AUDIO_F32SYS, 6, AUDIO_F32SYS, 8 },
+    { 0 }
+  };
+  const SDL_AudioFormat swap_formats[] = { AUDIO_S16SYS, AUDIO_U16SYS, AUDIO_S32SYS, AUDIO_F32SYS };
+  const int frame_counts[] = { 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 1000, 4099 };
+  int spec_idx, format_idx, count_idx, i;
+
+  /* Whole buffers go through the SIMD blocks, single frames through the scalar leftovers */
+  for (spec_idx = 0; test_specs[spec_idx].src_format != 0; ++spec_idx) {
+    const struct test_spec_t *spec = &test_specs[spec_idx];
+    const int src_frame_size = (SDL_AUDIO_BITSIZE(spec->src_format) / 8) * spec->src_channels;
+    const int dst_frame_size = (SDL_AUDIO_BITSIZE(spec->dst_format) / 8) * spec->dst_channels;
+
+    for (count_idx = 0; count_idx < SDL_arraysize(frame_counts); ++count_idx) {
+      const int num_frames = frame_counts[count_idx];
+      const int len = num_frames * src_frame_size;
+      Uint8 *src = (Uint8 *)SDL_malloc(len);
+      Uint8 *actual = (Uint8 *)SDL_malloc(len);
+      Uint8 *expected = (Uint8 *)SDL_malloc(num_frames * dst_frame_size);
+      int actual_len, mismatched = 0;
+
+      SDLTest_AssertCheck(src && actual && expected, "Expected conversion buffers to be created.");
+      if (!src || !actual || !expected) {
+        SDL_free(src);
+        SDL_free(actual);
+        SDL_free(expected);
+        return TEST_ABORTED;
+      }
+
+      _audio_fillRandom(src, len, spec->src_format);
+      SDL_memcpy(actual, src, len);
+      actual_len = convert_with_cvt(&actual, len, spec->src_format, spec->src_channels, spec->dst_format, spec->dst_channels);
+      SDLTest_AssertCheck(actual_len == num_frames * dst_frame_size, "Expected conversion to produce %i bytes, got %i.", num_frames * dst_frame_size, actual_len);
+
+      for (i = 0; i < num_frames; ++i) {
+        Uint8 *frame = (Uint8 *)SDL_malloc(src_frame_size);
+        int frame_len = -1;
+        if (frame) {
+          SDL_memcpy(frame, src + i * src_frame_size, src_frame_size);
+          frame_len = convert_with_cvt(&frame, src_frame_size, spec->src_format, spec->src_channels, spec->dst_format, spec->dst_channels);
+        }
+        if (frame_len == dst_frame_size) {
+          SDL_memcpy(expected + i * dst_frame_size, frame, dst_frame_size);
+        } else {
+          mismatched = 1;
+        }
+        SDL_free(frame);
+      }
+      SDLTest_AssertCheck(!mismatched, "Expected single frame conversions to succeed.");
+      if (actual_len == num_frames * dst_frame_size && !mismatched) {
+        SDLTest_AssertCheck(SDL_memcmp(actual, expected, actual_len) == 0,
+                            "Expected 0x%.4x %i channels to 0x%.4x %i channels of %i frames to match converting one frame at a time.",
+                            spec->src_format, spec->src_channels, spec->dst_format, spec->dst_channels, num_frames);
+      }
+
+      SDL_free(src);
+      SDL_free(actual);
+      SDL_free(expected);
+    }
+  }
+
+  /* Foreign byte order must give the same samples as the native one */
+  for (format_idx = 0; format_idx < SDL_arraysize(swap_formats); ++format_idx) {
+    const SDL_AudioFormat format = swap_formats[format_idx];
+    const SDL_AudioFormat swapped_format = format ^ SDL_AUDIO_MASK_ENDIAN;
+    const int sample_size = SDL_AUDIO_BITSIZE(format) / 8;
+
+    for (count_idx = 0; count_idx < SDL_arraysize(frame_counts); ++count_idx) {
+      const int num_samples = frame_counts[count_idx];
+      const int len = num_samples * sample_size;
+      const int float_len = num_samples * (int)sizeof(float);
+      Uint8 *native = (Uint8 *)SDL_malloc(len);
+      Uint8 *swapped = (Uint8 *)SDL_malloc(len);
+      Uint8 *from_float = (Uint8 *)SDL_malloc(float_len);
+      Uint8 *swapped_from_float = (Uint8 *)SDL_malloc(float_len);
+      int native_len, swapped_len;
+
+      SDLTest_AssertCheck(native && swapped && from_float && swapped_from_float, "Expected conversion buffers to be created.");
+      if (!native || !swapped || !from_float || !swapped_from_float) {
+        SDL_free(native);
+        SDL_free(swapped);
+        SDL_free(from_float);
+        SDL_free(swapped_from_float);
+        return TEST_ABORTED;
+      }
+
+      _audio_fillRandom(native, len, format);
+      SDL_memcpy(swapped, native, len);
+      _audio_swapSamples(swapped, len, sample_size);
+
+      /* Just a byteswap */
+      native_len = convert_with_cvt(&native, len, format, 1, swapped_format, 1);
+      SDLTest_AssertCheck(native_len == len && SDL_memcmp(native, swapped, len) == 0,
+                          "Expected 0x%.4x to 0x%.4x of %i samples to swap the bytes.", format, swapped_format, num_samples);
+      _audio_swapSamples(native, len, sample_size);
+
+      /* To float */
+      native_len = convert_with_cvt(&native, len, format, 1, AUDIO_F32SYS, 1);
+      swapped_len = convert_with_cvt(&swapped, len, swapped_format, 1, AUDIO_F32SYS, 1);
+      SDLTest_AssertCheck(native_len == float_len && swapped_len == float_len, "Expected conversions to float to produce %i bytes, got %i and %i.", float_len, native_len, swapped_len);
+      if (native_len == float_len && swapped_len == float_len) {
+        SDLTest_AssertCheck(SDL_memcmp(native, swapped, float_len) == 0,
+                            "Expected 0x%.4x and 0x%.4x of %i samples to convert to the same floats.", format, swapped_format, num_samples);
+      }
+
+      /* From float */
+      _audio_fillRandom(from_float, float_len, AUDIO_F32SYS);
+      SDL_memcpy(swapped_from_float, from_float, float_len);
+      native_len = convert_with_cvt(&from_float, float_len, AUDIO_F32SYS, 1, format, 1);
+      swapped_len = convert_with_cvt(&swapped_from_float, float_len, AUDIO_F32SYS, 1, swapped_format, 1);
+      SDLTest_AssertCheck(native_len == len && swapped_len == len, "Expected conversions from float to produce %i bytes, got %i and %i.", len, native_len, swapped_len);
+      if (native_len == len && swapped_len == len) {
+        _audio_swapSamples(swapped_from_float, len, sample_size);
+        SDLTest_AssertCheck(SDL_memcmp(from_float, swapped_from_float, len) == 0,
+                            "Expected floats of %i samples to convert to the same 0x%.4x and 0x%.4x samples.", num_samples, format, swapped_format);
+      }
+
+      SDL_free(native);
+      SDL_free(swapped);
+      SDL_free(from_float);
+      SDL_free(swapped_from_float);
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+/* Fills the stream with a ramp that continues across callbacks */
+static void SDLCALL _audio_rampCallback(void *userdata, Uint8 *stream, int len)
+{
+  Sint16 *next = (Sint16 *)userdata;
+  Sint16 *samples = (Sint16 *)stream;
+  int i;
+
+  for (i = 0; i < len / (int)sizeof(Sint16); ++i) {
+    samples[i] = (*next)++;
+  }
+}
+
+/**
+ * \brief Render faster than real time with the disk driver and check the WAVE file it writes.
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDeviceFramesPlayed
+ */
+int audio_diskOfflineRender(void)
+{
+  const char *filename = "sdlaudio-offline.wav";
+  const Uint64 target_frames = 44100 * 10;
+  SDL_AudioSpec desired, obtained, wav_spec;
+  SDL_AudioDeviceID id;
+  Uint8 *wav_buf = NULL;
+  Uint32 wav_len = 0;
+  Sint16 next_sample = 0;
+  Uint64 frames = 0, paused_frames;
+  Uint64 start;
+  double elapsed;
+  Uint32 i;
+  int result;
+
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OFFLINE, "1");
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE, filename);
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  if (result != 0) {
+    SDLTest_Log("Disk audio driver not available: %s", SDL_GetError());
+    SDL_ResetHint(SDL_HINT_AUDIO_DISK_OFFLINE);
+    SDL_ResetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE);
+    _audioSetUp(NULL);
+    return TEST_SKIPPED;
+  }
+
+  SDL_zero(desired);
+  desired.freq = 44100;
+  desired.format = AUDIO_S16LSB;
+  desired.channels = 2;
+  desired.samples = 1024;
+  desired.callback = _audio_rampCallback;
+  desired.userdata = &next_sample;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %" SDL_PRIu32, id);
+  if (id > 1) {
+    SDLTest_AssertCheck(SDL_GetAudioDeviceFramesPlayed(id) == 0, "Validate no frames played before unpausing");
+
+    /* Ten seconds of audio should take a small fraction of that to render */
+    start = SDL_GetPerformanceCounter();
+    SDL_PauseAudioDevice(id, 0);
+    while (frames < target_frames && SDL_GetPerformanceCounter() - start < SDL_GetPerformanceFrequency() * 5) {
+      SDL_Delay(1);
+      frames = SDL_GetAudioDeviceFramesPlayed(id);
+    }
+    SDL_PauseAudioDevice(id, 1);
+    elapsed = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+    SDLTest_AssertCheck(frames >= target_frames, "Validate frames played; expected: >=%" SDL_PRIu64 ", got: %" SDL_PRIu64, target_frames, frames);
+    SDLTest_AssertCheck(elapsed < 5.0, "Validate rendering ran faster than real time; took %.3f seconds", elapsed);
+
+    /* The clock stops while paused */
+    SDL_Delay(50);
+    paused_frames = SDL_GetAudioDeviceFramesPlayed(id);
+    SDL_Delay(50);
+    frames = SDL_GetAudioDeviceFramesPlayed(id);
+    SDLTest_AssertCheck(frames == paused_frames, "Validate clock stopped while paused; expected: %" SDL_PRIu64 ", got: %" SDL_PRIu64, paused_frames, frames);
+
+    SDL_CloseAudioDevice(id);
+    SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+    if (SDL_LoadWAV(filename, &wav_spec, &wav_buf, &wav_len) == NULL) {
+      SDLTest_AssertCheck(SDL_FALSE, "Validate SDL_LoadWAV('%s') succeeded: %s", filename, SDL_GetError());
+    } else {
+      const Uint32 frame_size = sizeof(Sint16) * 2;
+      const Sint16 *samples = (const Sint16 *)wav_buf;
+      SDL_bool ramp_ok = SDL_TRUE;
+
+      SDLTest_AssertCheck(wav_spec.freq == 44100 && wav_spec.format == AUDIO_S16LSB && wav_spec.channels == 2,
+                          "Validate WAVE spec; got: %d Hz, format 0x%.4x, %d channels", wav_spec.freq, wav_spec.format, wav_spec.channels);
+      SDLTest_AssertCheck(wav_len % (obtained.samples * frame_size) == 0, "Validate WAVE holds whole buffers; got %" SDL_PRIu32 " bytes", wav_len);
+      /* Pausing can race with one buffer being written */
+      SDLTest_AssertCheck(wav_len / frame_size + obtained.samples >= frames && wav_len / frame_size <= frames + obtained.samples,
+                          "Validate WAVE length matches the clock; expected: %" SDL_PRIu64 " frames, got: %" SDL_PRIu32, frames, wav_len / frame_size);
+      for (i = 0; i < wav_len / sizeof(Sint16); ++i) {
+        if (samples[i] != (Sint16)i) {
+          ramp_ok = SDL_FALSE;
+          break;
+        }
+      }
+      SDLTest_AssertCheck(ramp_ok, "Validate WAVE contains every callback buffer in order");
+      SDL_FreeWAV(wav_buf);
+    }
+  }
+
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  SDL_ResetHint(SDL_HINT_AUDIO_DISK_OFFLINE);
+  SDL_ResetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE);
+  (void)remove(filename);
+
+  /* Restart audio again */
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+/* State shared with _audio_lockFreeCallback */
+typedef struct
+{
+  SDL_atomic_t calls;
+  SDL_atomic_t slow;
+} _audio_lockFreeState;
+
+/* Fills the stream with a constant, taking longer than the buffer plays if asked to */
+static void SDLCALL _audio_lockFreeCallback(void *userdata, Uint8 *stream, int len)
+{
+  _audio_lockFreeState *state = (_audio_lockFreeState *)userdata;
+  Sint16 *samples = (Sint16 *)stream;
+  int i;
+
+  for (i = 0; i < len / (int)sizeof(Sint16); ++i) {
+    samples[i] = 1000;
+  }
+  if (SDL_AtomicGet(&state->slow)) {
+    SDL_Delay(60);
+  }
+  SDL_AtomicAdd(&state->calls, 1);
+}
+
+/**
+ * \brief Run the audio callback without the device lock and control the device through posted commands.
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDeviceStats
+ * \sa https://wiki.libsdl.org/SDL_SetAudioDeviceVolume
+ */
+int audio_callbackLockFree(void)
+{
+  const char *filename = "sdlaudio-lockfree.wav";
+  const char *raw_filename = "sdlaudio-lockfree.raw";
+  SDL_AudioSpec desired, obtained, wav_spec;
+  SDL_AudioDeviceID id;
+  SDL_AudioDeviceStats stats;
+  _audio_lockFreeState state;
+  Uint8 *wav_buf = NULL;
+  Uint32 wav_len = 0;
+  Uint64 frames, paused_frames, start;
+  int calls;
+  int result;
+
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OFFLINE, "1");
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE, filename);
+  SDL_SetHint(SDL_HINT_AUDIO_CALLBACK_LOCKFREE, "1");
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  if (result != 0) {
+    SDLTest_Log("Disk audio driver not available: %s", SDL_GetError());
+    SDL_ResetHint(SDL_HINT_AUDIO_DISK_OFFLINE);
+    SDL_ResetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE);
+    SDL_ResetHint(SDL_HINT_AUDIO_CALLBACK_LOCKFREE);
+    _audioSetUp(NULL);
+    return TEST_SKIPPED;
+  }
+
+  SDL_zero(state);
+  SDL_zero(desired);
+  desired.freq = 44100;
+  desired.format = AUDIO_S16LSB;
+  desired.channels = 2;
+  desired.samples = 1024;
+  desired.callback = _audio_lockFreeCallback;
+  desired.userdata = &state;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %" SDL_PRIu32, id);
+  if (id > 1) {
+    result = SDL_GetAudioDeviceStats(id, NULL);
+    SDLTest_AssertCheck(result < 0, "Validate SDL_GetAudioDeviceStats(id, NULL) fails; got: %d", result);
+    result = SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_GetAudioDeviceStats() result; expected: 0, got: %d", result);
+
+    /* Holding the device lock doesn't stop the callback */
+    SDL_LockAudioDevice(id);
+    SDL_PauseAudioDevice(id, 0);
+    frames = 0;
+    start = SDL_GetPerformanceCounter();
+    while (frames < 44100 && SDL_GetPerformanceCounter() - start < SDL_GetPerformanceFrequency() * 5) {
+      SDL_Delay(1);
+      frames = SDL_GetAudioDeviceFramesPlayed(id);
+    }
+    SDL_UnlockAudioDevice(id);
+    SDLTest_AssertCheck(frames >= 44100, "Validate frames played while locked; expected: >=44100, got: %" SDL_PRIu64, frames);
+
+    /* Everything after the volume change is silent */
+    result = SDL_SetAudioDeviceVolume(id, 0);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_SetAudioDeviceVolume() result; expected: 0, got: %d", result);
+    calls = SDL_AtomicGet(&state.calls);
+    start = SDL_GetPerformanceCounter();
+    while (SDL_AtomicGet(&state.calls) < calls + 20 && SDL_GetPerformanceCounter() - start < SDL_GetPerformanceFrequency() * 5) {
+      SDL_Delay(1);
+    }
+    SDLTest_AssertCheck(SDL_AtomicGet(&state.calls) >= calls + 20, "Validate callbacks after the volume change; expected: >=%d, got: %d", calls + 20, SDL_AtomicGet(&state.calls));
+
+    SDL_PauseAudioDevice(id, 1);
+
+    /* The pause command stops the clock once the audio thread applies it */
+    SDL_Delay(50);
+    paused_frames = SDL_GetAudioDeviceFramesPlayed(id);
+    SDL_Delay(50);
+    frames = SDL_GetAudioDeviceFramesPlayed(id);
+    SDLTest_AssertCheck(frames == paused_frames, "Validate clock stopped while paused; expected: %" SDL_PRIu64 ", got: %" SDL_PRIu64, paused_frames, frames);
+
+    SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(stats.periods >= frames / obtained.samples, "Validate periods; expected: >=%" SDL_PRIu64 ", got: %" SDL_PRIu64, frames / obtained.samples, stats.periods);
+
+    SDL_CloseAudioDevice(id);
+    SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+    if (SDL_LoadWAV(filename, &wav_spec, &wav_buf, &wav_len) == NULL) {
+      SDLTest_AssertCheck(SDL_FALSE, "Validate SDL_LoadWAV('%s') succeeded: %s", filename, SDL_GetError());
+    } else {
+      const Sint16 *samples = (const Sint16 *)wav_buf;
+      const Uint32 count = wav_len / sizeof(Sint16);
+      Uint32 i, loud = 0;
+
+      while (loud < count && samples[loud] == 1000) {
+        ++loud;
+      }
+      for (i = loud; i < count; ++i) {
+        if (samples[i] != 0) {
+          break;
+        }
+      }
+      SDLTest_AssertCheck(loud >= 44100 * 2, "Validate audio before the volume change; expected: >=88200 samples, got: %" SDL_PRIu32, loud);
+      SDLTest_AssertCheck(loud % (obtained.samples * 2) == 0, "Validate volume changed between callbacks; got %" SDL_PRIu32 " samples", loud);
+      SDLTest_AssertCheck(i == count && count - loud >= 24 * obtained.samples * 2,
+                          "Validate silence after the volume change; expected: %" SDL_PRIu32 " silent samples, got: %" SDL_PRIu32, count - loud, i - loud);
+      SDL_FreeWAV(wav_buf);
+    }
+  }
+  (void)remove(filename);
+
+  /* At real time, a callback slower than the audio it produces is late and makes the device run dry */
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OFFLINE, "0");
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE, raw_filename);
+  SDL_zero(state);
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %" SDL_PRIu32, id);
+  if (id > 1) {
+    SDL_AtomicSet(&state.slow, 1);
+    SDL_PauseAudioDevice(id, 0);
+    start = SDL_GetPerformanceCounter();
+    while (SDL_AtomicGet(&state.calls) < 5 && SDL_GetPerformanceCounter() - start < SDL_GetPerformanceFrequency() * 5) {
+      SDL_Delay(1);
+    }
+    SDLTest_AssertCheck(SDL_AtomicGet(&state.calls) >= 5, "Validate slow callbacks; expected: >=5, got: %d", SDL_AtomicGet(&state.calls));
+    SDL_PauseAudioDevice(id, 1);
+
+    SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(stats.late_callbacks >= 4, "Validate late callbacks; expected: >=4, got: %" SDL_PRIu64, stats.late_callbacks);
+    SDLTest_AssertCheck(stats.underruns >= 2, "Validate underruns; expected: >=2, got: %" SDL_PRIu64, stats.underruns);
+
+    SDL_CloseAudioDevice(id);
+    SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+  }
+  (void)remove(raw_filename);
+
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  SDL_ResetHint(SDL_HINT_AUDIO_DISK_OFFLINE);
+  SDL_ResetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE);
+  SDL_ResetHint(SDL_HINT_AUDIO_CALLBACK_LOCKFREE);
+
+  /* Restart audio again */
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+/* Fills the stream with silence, taking a few milliseconds every 16th call */
+static void SDLCALL _audio_statsCallback(void *userdata, Uint8 *stream, int len)
+{
+  SDL_atomic_t *calls = (SDL_atomic_t *)userdata;
+
+  SDL_memset(stream, 0, len);
+  if ((SDL_AtomicAdd(calls, 1) % 16) == 0) {
+    SDL_Delay(3);
+  }
+}
+
+/**
+ * \brief Check the callback timing, conversion and silence statistics of an audio device.
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDeviceStats
+ * \sa https://wiki.libsdl.org/SDL_ResetAudioDeviceStats
+ */
+int audio_deviceStats(void)
+{
+  const char *filename = "sdlaudio-stats.wav";
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  SDL_AudioDeviceStats stats;
+  SDL_atomic_t calls;
+  Uint64 histogram_total = 0;
+  Uint64 start;
+  int i, result;
+
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OFFLINE, "1");
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE, filename);
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  if (result != 0) {
+    SDLTest_Log("Disk audio driver not available: %s", SDL_GetError());
+    SDL_ResetHint(SDL_HINT_AUDIO_DISK_OFFLINE);
+    SDL_ResetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE);
+    _audioSetUp(NULL);
+    return TEST_SKIPPED;
+  }
+
+  /* WAVE output is little endian, so this goes through a conversion stream */
+  SDL_AtomicSet(&calls, 0);
+  SDL_zero(desired);
+  desired.freq = 44100;
+  desired.format = AUDIO_S16MSB;
+  desired.channels = 2;
+  desired.samples = 1024;
+  desired.callback = _audio_statsCallback;
+  desired.userdata = &calls;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %" SDL_PRIu32, id);
+  if (id > 1) {
+    SDL_PauseAudioDevice(id, 0);
+    start = SDL_GetPerformanceCounter();
+    while (SDL_AtomicGet(&calls) < 64 && SDL_GetPerformanceCounter() - start < SDL_GetPerformanceFrequency() * 5) {
+      SDL_Delay(1);
+    }
+    SDL_PauseAudioDevice(id, 1);
+
+    result = SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_GetAudioDeviceStats() result; expected: 0, got: %d", result);
+    for (i = 0; i < SDL_AUDIO_STATS_HISTOGRAM_BUCKETS; ++i) {
+      histogram_total += stats.callback_histogram[i];
+    }
+    SDLTest_AssertCheck(stats.callbacks >= 64, "Validate callbacks; expected: >=64, got: %" SDL_PRIu64, stats.callbacks);
+    SDLTest_AssertCheck(histogram_total == stats.callbacks, "Validate histogram total; expected: %" SDL_PRIu64 ", got: %" SDL_PRIu64, stats.callbacks, histogram_total);
+    SDLTest_AssertCheck(stats.callback_histogram[SDL_AUDIO_STATS_HISTOGRAM_BUCKETS - 1] == 0, "Validate no callback took longer than the last bucket");
+    SDLTest_AssertCheck(stats.callback_ns_max >= 3000000, "Validate longest callback; expected: >=3000000 ns, got: %" SDL_PRIu64, stats.callback_ns_max);
+    SDLTest_AssertCheck(stats.callback_ns_total >= 4 * 3000000, "Validate total callback time; expected: >=12000000 ns, got: %" SDL_PRIu64, stats.callback_ns_total);
+    SDLTest_AssertCheck(stats.jitter_ns_max > 0, "Validate callback jitter; expected: >0, got: %" SDL_PRIu64, stats.jitter_ns_max);
+    SDLTest_AssertCheck(stats.resample_ns_total > 0, "Validate conversion time; expected: >0, got: %" SDL_PRIu64, stats.resample_ns_total);
+    SDLTest_AssertCheck(stats.silence_fills == 0, "Validate silence fills; expected: 0, got: %" SDL_PRIu64, stats.silence_fills);
+    SDLTest_AssertCheck(stats.stream_queued >= 0 && stats.stream_queued < (int)obtained.size,
+                        "Validate stream depth; expected: <%" SDL_PRIu32 " bytes, got: %d", obtained.size, stats.stream_queued);
+
+    /* The pass that was running when we paused finishes first */
+    SDL_Delay(50);
+    result = SDL_ResetAudioDeviceStats(id);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_ResetAudioDeviceStats() result; expected: 0, got: %d", result);
+    SDL_Delay(50);
+    SDL_GetAudioDeviceStats(id, &stats);
+    SDLTest_AssertCheck(stats.callbacks == 0 && stats.callback_ns_total == 0,
+                        "Validate no callbacks counted while paused; got: %" SDL_PRIu64, stats.callbacks);
+
+    SDL_CloseAudioDevice(id);
+    SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+  }
+
+  result = SDL_ResetAudioDeviceStats(id);
+  SDLTest_AssertCheck(result < 0, "Validate SDL_ResetAudioDeviceStats() fails on a closed device; got: %d", result);
+
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  SDL_ResetHint(SDL_HINT_AUDIO_DISK_OFFLINE);
+  SDL_ResetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE);
+  (void)remove(filename);
+
+  /* Restart audio again */
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+/* Puts frames of a constant sample value into an audio stream */
+static void _audio_putConstant(SDL_AudioStream *stream, SDL_AudioFormat format, int channels, int frames, float value)
+{
+  const int count = frames * channels;
+  int i;
+
+  if (format == AUDIO_F32SYS) {
+    float *buf = (float *)SDL_malloc(count * sizeof(float));
+    for (i = 0; i < count; ++i) {
+      buf[i] = value;
+    }
+    SDL_AudioStreamPut(stream, buf, count * (int)sizeof(float));
+    SDL_free(buf);
+  } else {
+    Sint16 *buf = (Sint16 *)SDL_malloc(count * sizeof(Sint16));
+    for (i = 0; i < count; ++i) {
+      buf[i] = (Sint16)(value * 32768.0f);
+    }
+    SDL_AudioStreamPut(stream, buf, count * (int)sizeof(Sint16));
+    SDL_free(buf);
+  }
+}
+
+/**
+ * \brief Mix several audio streams with their own formats and rates into one device.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BindAudioStream
+ * \sa https://wiki.libsdl.org/SDL_UnbindAudioStream
+ * \sa https://wiki.libsdl.org/SDL_SetBoundAudioStreamGain
+ */
+int audio_boundStreams(void)
+{
+  const char *filename = "sdlaudio-mix.wav";
+  const int buffer_frames = 1024;
+  SDL_AudioSpec desired, obtained, wav_spec;
+  SDL_AudioDeviceID id;
+  SDL_AudioStream *a, *b, *c, *wrong;
+  Uint8 *wav_buf = NULL;
+  Uint32 wav_len = 0;
+  Uint64 start;
+  int result;
+
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OFFLINE, "1");
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE, filename);
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  if (result != 0) {
+    SDLTest_Log("Disk audio driver not available: %s", SDL_GetError());
+    SDL_ResetHint(SDL_HINT_AUDIO_DISK_OFFLINE);
+    SDL_ResetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE);
+    _audioSetUp(NULL);
+    return TEST_SKIPPED;
+  }
+
+  /* No callback: the streams are mixed into the (empty) queue's silence */
+  SDL_zero(desired);
+  desired.freq = 44100;
+  desired.format = AUDIO_S16LSB;
+  desired.channels = 2;
+  desired.samples = (Uint16)buffer_frames;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %" SDL_PRIu32, id);
+  if (id > 1) {
+    a = SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 2, 44100);
+    b = SDL_NewAudioStream(AUDIO_S16SYS, 1, 44100, AUDIO_F32SYS, 2, 44100);
+    c = SDL_NewAudioStream(AUDIO_F32SYS, 2, 48000, AUDIO_F32SYS, 2, 44100);
+    wrong = SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, AUDIO_S16SYS, 2, 44100);
+    SDLTest_AssertCheck(a && b && c && wrong, "Validate SDL_NewAudioStream() results");
+
+    result = SDL_BindAudioStream(id, wrong);
+    SDLTest_AssertCheck(result < 0, "Validate binding a stream that doesn't produce floats fails; got: %d", result);
+    result = SDL_BindAudioStream(id, a);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_BindAudioStream() result; expected: 0, got: %d", result);
+    result = SDL_BindAudioStream(id, a);
+    SDLTest_AssertCheck(result < 0, "Validate binding a stream twice fails; got: %d", result);
+    result = SDL_BindAudioStream(id, b);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_BindAudioStream() result; expected: 0, got: %d", result);
+    result = SDL_BindAudioStream(id, c);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_BindAudioStream() result; expected: 0, got: %d", result);
+    result = SDL_SetBoundAudioStreamGain(id, wrong, 0.5f);
+    SDLTest_AssertCheck(result < 0, "Validate setting the gain of an unbound stream fails; got: %d", result);
+    result = SDL_SetBoundAudioStreamGain(id, a, -1.0f);
+    SDLTest_AssertCheck(result < 0, "Validate a negative gain fails; got: %d", result);
+
+    /* a: 8 buffers of 0.25 ramping to half gain over the first buffer,
+       b: 4 buffers of 0.125 in mono, c: 4 buffers of 0.0625 at 48000 Hz */
+    SDL_LockAudioDevice(id);
+    _audio_putConstant(a, AUDIO_S16SYS, 2, buffer_frames * 8, 0.25f);
+    _audio_putConstant(b, AUDIO_S16SYS, 1, buffer_frames * 4, 0.125f);
+    _audio_putConstant(c, AUDIO_F32SYS, 2, buffer_frames * 4 * 48000 / 44100, 0.0625f);
+    SDL_AudioStreamFlush(a);
+    SDL_AudioStreamFlush(b);
+    SDL_AudioStreamFlush(c);
+    result = SDL_SetBoundAudioStreamGain(id, a, 0.5f);
+    SDL_UnlockAudioDevice(id);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_SetBoundAudioStreamGain() result; expected: 0, got: %d", result);
+
+    SDL_PauseAudioDevice(id, 0);
+    start = SDL_GetPerformanceCounter();
+    while (SDL_GetAudioDeviceFramesPlayed(id) < (Uint64)buffer_frames * 12 && SDL_GetPerformanceCounter() - start < SDL_GetPerformanceFrequency() * 5) {
+      SDL_Delay(1);
+    }
+    SDL_PauseAudioDevice(id, 1);
+
+    /* The streams are still bound, so they're only touched with the device locked */
+    SDL_LockAudioDevice(id);
+    result = SDL_AudioStreamAvailable(a) + SDL_AudioStreamAvailable(b) + SDL_AudioStreamAvailable(c);
+    SDL_UnlockAudioDevice(id);
+    SDLTest_AssertCheck(result == 0, "Validate the bound streams drained; expected: 0 bytes left, got: %d", result);
+
+    result = SDL_UnbindAudioStream(id, b);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_UnbindAudioStream() result; expected: 0, got: %d", result);
+    result = SDL_UnbindAudioStream(id, b);
+    SDLTest_AssertCheck(result < 0, "Validate unbinding a stream twice fails; got: %d", result);
+
+    /* Closing the device unbinds the rest */
+    SDL_CloseAudioDevice(id);
+    SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    SDL_FreeAudioStream(a);
+    SDL_FreeAudioStream(b);
+    SDL_FreeAudioStream(c);
+    SDL_FreeAudioStream(wrong);
+
+    if (SDL_LoadWAV(filename, &wav_spec, &wav_buf, &wav_len) == NULL) {
+      SDLTest_AssertCheck(SDL_FALSE, "Validate SDL_LoadWAV('%s') succeeded: %s", filename, SDL_GetError());
+    } else {
+      const Sint16 *samples = (const Sint16 *)wav_buf;
+      const int frames = (int)(wav_len / (sizeof(Sint16) * 2));
+
+      SDLTest_AssertCheck(frames >= buffer_frames * 12, "Validate WAVE length; expected: >=%d frames, got: %d", buffer_frames * 12, frames);
+      if (frames >= buffer_frames * 12) {
+        const int ramp_start = samples[100 * 2];
+        const int ramp_end = samples[(buffer_frames - 100) * 2];
+        const int all = samples[(buffer_frames * 2 + 512) * 2 + 1];
+        const int a_only = samples[(buffer_frames * 6 + 512) * 2];
+        const int silent = samples[(buffer_frames * 10 + 512) * 2 + 1];
+
+        SDLTest_AssertCheck(ramp_start - ramp_end > 2500, "Validate gain ramp; got %d falling to %d", ramp_start, ramp_end);
+        SDLTest_AssertCheck(SDL_abs(all - 10240) <= 64, "Validate sum of three streams; expected: 10240, got: %d", all);
+        SDLTest_AssertCheck(SDL_abs(a_only - 4096) <= 1, "Validate remaining stream at half gain; expected: 4096, got: %d", a_only);
+        SDLTest_AssertCheck(silent == 0, "Validate silence after the streams drained; expected: 0, got: %d", silent);
+      }
+      SDL_FreeWAV(wav_buf);
+    }
+  }
+
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  SDL_ResetHint(SDL_HINT_AUDIO_DISK_OFFLINE);
+  SDL_ResetHint(SDL_HINT_AUDIO_DISK_OUTPUT_FILE);
+  (void)remove(filename);
+
+  /* Restart audio again */
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+/* Writes a little-endian value into a WAVE file being built in memory */
+static Uint8 *_audio_putLE(Uint8 *p, Uint32 value, int bytes)
+{
+  int i;
+  for (i = 0; i < bytes; ++i) {
+    *p++ = (Uint8)(value >> (i * 8));
+  }
+  return p;
+}
+
+/* Builds a WAVE file with random audio data, valid ADPCM block headers, and
+   an MS ADPCM coefficient table if needed. Returns the size of the file. */
+static size_t _audio_buildWAV(Uint8 **wav, Uint16 formattag, Uint16 channels, Uint16 bits, Uint16 blockalign, Uint32 datalen)
+{
+  const Sint16 coeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+  Uint16 extsize = 0, samplesperblock = 0;
+  Uint32 fmtlen, i;
+  Uint8 *p, *data;
+  size_t size;
+
+  if (formattag == 0x0002) { /* MS ADPCM */
+    samplesperblock = (Uint16)((blockalign - channels * 7) * 2 / channels + 2);
+    extsize = 4 + 7 * 4;
+  } else if (formattag == 0x0011) { /* IMA ADPCM */
+    samplesperblock = (Uint16)((blockalign - channels * 4) * 2 / channels + 1);
+    extsize = 2;
+  }
+  fmtlen = 18 + extsize;
+  size = 12 + 8 + fmtlen + 8 + datalen;
+  *wav = p = (Uint8 *)SDL_malloc(size);
+  if (!p) {
+    return 0;
+  }
+
+  p = _audio_putLE(p, 0x46464952, 4); /* RIFF */
+  p = _audio_putLE(p, (Uint32)size - 8, 4);
+  p = _audio_putLE(p, 0x45564157, 4); /* WAVE */
+  p = _audio_putLE(p, 0x20746D66, 4); /* fmt */
+  p = _audio_putLE(p, fmtlen, 4);
+  p = _audio_putLE(p, formattag, 2);
+  p = _audio_putLE(p, channels, 2);
+  p = _audio_putLE(p, 22050, 4);
+  p = _audio_putLE(p, 22050 * blockalign, 4);
+  p = _audio_putLE(p, blockalign, 2);
+  p = _audio_putLE(p, bits, 2);
+  p = _audio_putLE(p, extsize, 2);
+  if (formattag == 0x0002) {
+    p = _audio_putLE(p, samplesperblock, 2);
+    p = _audio_putLE(p, 7, 2);
+    for (i = 0; i < 14; ++i) {
+      p = _audio_putLE(p, (Uint16)coeffs[i], 2);
+    }
+  } else if (formattag == 0x0011) {
+    p = _audio_putLE(p, samplesperblock, 2);
+  }
+  p = _audio_putLE(p, 0x61746164, 4); /* data */
+  p = _audio_putLE(p, datalen, 4);
+
+  data = p;
+  for (i = 0; i < datalen; ++i) {
+    data[i] = (Uint8)SDLTest_RandomUint8();
+  }
+  for (i = 0; formattag == 0x0002 && i + blockalign <= datalen; i += blockalign) {
+    Uint16 c;
+    for (c = 0; c < channels; ++c) {
+      data[i + c] %= 7; /* predictor index */
+      data[i + channels + c * 2 + 1] &= 0x7f; /* positive delta */
+    }
+  }
+  for (i = 0; formattag == 0x0011 && i + blockalign <= datalen; i += blockalign) {
+    Uint16 c;
+    for (c = 0; c < channels; ++c) {
+      data[i + c * 4 + 2] %= 89; /* step index */
+      data[i + c * 4 + 3] = 0;
+    }
+  }
+  return size;
+}
+
+/**
+ * \brief Check that streamed WAVE decoding matches loading the whole file.
+ *
+ * \sa https://wiki.libsdl.org/SDL_OpenWAVStream_RW
+ * \sa https://wiki.libsdl.org/SDL_ReadWAVStream
+ */
+int audio_wavStream(void)
+{
+  struct test_wav_t {
+    const char *name;
+    Uint16 formattag;
+    Uint16 channels;
+    Uint16 bits;
+    Uint16 blockalign;
+    Uint32 datalen;
+  } test_wavs[] = {
+    { "PCM 16-bit", 0x0001, 2, 16, 4, 40000 },
+    { "PCM 24-bit", 0x0001, 2, 24, 6, 30000 },
+    { "A-law", 0x0006, 1, 8, 1, 20001 },
+    { "mu-law", 0x0007, 2, 8, 2, 20002 },
+    { "MS ADPCM", 0x0002, 2, 4, 256, 256 * 300 },
+    /* Enough blocks to be decoded on several threads by SDL_LoadWAV_RW() */
+    { "IMA ADPCM", 0x0011, 2, 4, 256, 256 * 1500 },
+    /* Truncated last block */
+    { "IMA ADPCM mono", 0x0011, 1, 4, 512, 512 * 10 + 100 },
+  };
+  const int read_sizes[] = { 13, 1000, 4097, 65536 };
+  int wav_idx, size_idx;
+
+  for (wav_idx = 0; wav_idx < SDL_arraysize(test_wavs); ++wav_idx) {
+    const struct test_wav_t *test = &test_wavs[wav_idx];
+    Uint8 *wav = NULL, *loaded = NULL, *streamed = NULL;
+    size_t wav_size = _audio_buildWAV(&wav, test->formattag, test->channels, test->bits, test->blockalign, test->datalen);
+    SDL_AudioSpec load_spec, stream_spec;
+    Uint32 load_len = 0, stream_len = 0;
+    SDL_WAVStream *stream;
+
+    SDLTest_AssertCheck(wav_size > 0, "Build %s WAVE file", test->name);
+    if (wav_size == 0) {
+      return TEST_ABORTED;
+    }
+
+    if (!SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, (int)wav_size), 1, &load_spec, &loaded, &load_len)) {
+      SDLTest_AssertCheck(SDL_FALSE, "Call to SDL_LoadWAV_RW() with %s data failed: %s", test->name, SDL_GetError());
+      SDL_free(wav);
+      continue;
+    }
+
+    stream = SDL_OpenWAVStream_RW(SDL_RWFromConstMem(wav, (int)wav_size), 1, &stream_spec, &stream_len);
+    SDLTest_AssertCheck(stream != NULL, "Call to SDL_OpenWAVStream_RW() with %s data", test->name);
+    if (stream) {
+      SDLTest_AssertCheck(stream_spec.format == load_spec.format && stream_spec.channels == load_spec.channels && stream_spec.freq == load_spec.freq,
+                          "Validate %s stream spec matches SDL_LoadWAV_RW()", test->name);
+      streamed = (Uint8 *)SDL_malloc(load_len + 65536);
+      for (size_idx = 0; streamed && size_idx < SDL_arraysize(read_sizes); ++size_idx) {
+        int total = 0, got;
+
+        SDLTest_AssertCheck(SDL_RewindWAVStream(stream) == 0, "Call to SDL_RewindWAVStream()");
+        while ((got = SDL_ReadWAVStream(stream, streamed + total, read_sizes[size_idx])) > 0) {
+          total += got;
+        }
+        SDLTest_AssertCheck(got == 0, "Validate %s stream ends without error, got %i", test->name, got);
+        SDLTest_AssertCheck((Uint32)total == load_len, "Validate %s streamed %i bytes at a time; expected: %" SDL_PRIu32 " bytes, got: %i",
+                            test->name, read_sizes[size_idx], load_len, total);
+        if ((Uint32)total == load_len) {
+          SDLTest_AssertCheck(SDL_memcmp(streamed, loaded, load_len) == 0, "Validate %s streamed data matches SDL_LoadWAV_RW()", test->name);
+        }
+      }
+      SDL_free(streamed);
+      SDL_CloseWAVStream(stream);
+    }
+
+    SDL_FreeWAV(loaded);
+    SDL_free(wav);
+  }
+
+  return TEST_COMPLETED;
+}
+
+/* Signal-to-noise ratio of a resampled sine wave, skipping the edges where the resampler sees silence */
+static double _audio_resampledSNR(const float *output, int frames, int rate, int freq, double *power)
+{
+  const int edge = 1000;
+  double sum_squared_error = 0;
+  double sum_squared_value = 0;
+  double sum_squared_output = 0;
+  int i;
+
+  for (i = edge; i < frames - edge; ++i) {
+    const double target = sine_wave_sample(i, rate, freq, 0);
+    const double error = target - output[i];
+    sum_squared_error += error * error;
+    sum_squared_value += target * target;
+    sum_squared_output += (double)output[i] * output[i];
+  }
+  if (power) {
+    *power = 10 * SDL_log10(sum_squared_output / sum_squared_value);
+  }
+  return 10 * SDL_log10(sum_squared_value / sum_squared_error);
+}
+
+/**
+ * \brief Check the resampling quality levels, selected with
+ * SDL_HINT_AUDIO_RESAMPLING_QUALITY or per stream.
+ *
+ * \sa https://wiki.libsdl.org/SDL_SetAudioStreamResamplingQuality
+ */
+int audio_resampleQuality(void)
+{
+  static const char *qualities[] = { "linear", "medium", "high" };
+  struct test_spec_t {
+    int rate_in;
+    int rate_out;
+    int freq;
+    double signal_to_noise[3];
+  } test_specs[] = {
+    { 44100, 48000, 440, { 60, 55, 80 } },
+    { 48000, 44100, 1000, { 50, 70, 80 } },
+    { 44100, 48000, 15000, { 5, 20, 75 } },
+    { 48000, 16000, 3000, { 50, 50, 80 } },
+    { 0 }
+  };
+  const int seconds = 2;
+  SDL_AudioStream *stream;
+  float *buf;
+  double power = 0;
+  double snr;
+  int spec_idx, quality, i, len;
+
+  for (spec_idx = 0; test_specs[spec_idx].rate_in > 0; ++spec_idx) {
+    const struct test_spec_t *spec = &test_specs[spec_idx];
+    const int frames_in = seconds * spec->rate_in;
+
+    for (quality = 0; quality < SDL_arraysize(qualities); ++quality) {
+      SDL_AudioCVT cvt;
+
+      SDL_SetHint(SDL_HINT_AUDIO_RESAMPLING_QUALITY, qualities[quality]);
+      if (SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, 1, spec->rate_in, AUDIO_F32SYS, 1, spec->rate_out) != 1) {
+        SDLTest_AssertCheck(SDL_FALSE, "Expected SDL_BuildAudioCVT to need a conversion.");
+        continue;
+      }
+      cvt.len = frames_in * (int)sizeof(float);
+      cvt.buf = (Uint8 *)SDL_malloc(cvt.len * cvt.len_mult);
+      SDLTest_AssertCheck(cvt.buf != NULL, "Expected input buffer to be created.");
+      if (cvt.buf == NULL) {
+        return TEST_ABORTED;
+      }
+      for (i = 0; i < frames_in; ++i) {
+        ((float *)cvt.buf)[i] = (float)sine_wave_sample(i, spec->rate_in, spec->freq, 0);
+      }
+      SDL_ConvertAudio(&cvt);
+
+      snr = _audio_resampledSNR((const float *)cvt.buf, cvt.len_cvt / (int)sizeof(float), spec->rate_out, spec->freq, NULL);
+      SDLTest_AssertCheck(snr >= spec->signal_to_noise[quality], "Resampling %i Hz from %i Hz to %i Hz at %s quality: %f dB should be no less than %f dB.",
+                          spec->freq, spec->rate_in, spec->rate_out, qualities[quality], snr, spec->signal_to_noise[quality]);
+      SDL_free(cvt.buf);
+    }
+  }
+  SDL_ResetHint(SDL_HINT_AUDIO_RESAMPLING_QUALITY);
+
+  /* Only the high quality filter is band limited when downsampling */
+  stream = SDL_NewAudioStream(AUDIO_F32SYS, 1, 48000, AUDIO_F32SYS, 1, 16000);
+  SDLTest_AssertCheck(stream != NULL, "Expected SDL_NewAudioStream to succeed.");
+  if (stream == NULL) {
+    return TEST_ABORTED;
+  }
+  SDLTest_AssertCheck(SDL_SetAudioStreamResamplingQuality(NULL, SDL_AUDIO_RESAMPLING_HIGH) == -1, "Expected an error for a NULL stream.");
+  SDLTest_AssertCheck(SDL_SetAudioStreamResamplingQuality(stream, (SDL_AudioResamplingQuality)3) == -1, "Expected an error for an invalid quality.");
+  SDLTest_AssertCheck(SDL_SetAudioStreamResamplingQuality(stream, SDL_AUDIO_RESAMPLING_HIGH) == 0, "Expected SDL_SetAudioStreamResamplingQuality to succeed.");
+
+  buf = (float *)SDL_malloc(seconds * 48000 * sizeof(float));
+  SDLTest_AssertCheck(buf != NULL, "Expected input buffer to be created.");
+  if (buf == NULL) {
+    SDL_FreeAudioStream(stream);
+    return TEST_ABORTED;
+  }
+  for (i = 0; i < seconds * 48000; ++i) {
+    buf[i] = (float)sine_wave_sample(i, 48000, 12000, 0);
+  }
+  SDL_AudioStreamPut(stream, buf, seconds * 48000 * sizeof(float));
+  SDL_AudioStreamFlush(stream);
+  len = SDL_AudioStreamGet(stream, buf, seconds * 48000 * sizeof(float));
+  SDLTest_AssertCheck(len > seconds * 15000 * (int)sizeof(float), "Expected about %i bytes, got %i.", (int)(seconds * 16000 * sizeof(float)), len);
+  _audio_resampledSNR(buf, len / (int)sizeof(float), 16000, 4000, &power);
+  SDLTest_AssertCheck(power <= -80, "12000 Hz should be filtered out when downsampling to 16000 Hz, got %f dB.", power);
+
+  /* Changing the quality in the middle of a stream keeps it going */
+  SDL_AudioStreamClear(stream);
+  for (i = 0; i < seconds * 48000; ++i) {
+    buf[i] = (float)sine_wave_sample(i, 48000, 1000, 0);
+  }
+  SDL_AudioStreamPut(stream, buf, seconds * 48000 * sizeof(float) / 2);
+  SDLTest_AssertCheck(SDL_SetAudioStreamResamplingQuality(stream, SDL_AUDIO_RESAMPLING_MEDIUM) == 0, "Expected SDL_SetAudioStreamResamplingQuality to succeed.");
+  SDL_AudioStreamPut(stream, buf + seconds * 48000 / 2, seconds * 48000 * sizeof(float) / 2);
+  SDL_AudioStreamFlush(stream);
+  len = SDL_AudioStreamGet(stream, buf, seconds * 48000 * sizeof(float));
+  SDLTest_AssertCheck(len > seconds * 15000 * (int)sizeof(float), "Expected about %i bytes, got %i.", (int)(seconds * 16000 * sizeof(float)), len);
+  snr = _audio_resampledSNR(buf, len / (int)sizeof(float), 16000, 1000, NULL);
+  SDLTest_AssertCheck(snr >= 50, "Switching quality mid-stream: %f dB should be no less than 50 dB.", snr);
+
+  SDL_free(buf);
+  SDL_FreeAudioStream(stream);
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Capture from a file with the disk driver through the lock-free capture ring
+ * and check the data, sequence numbers and timestamps.
+ *
+ * \sa https://wiki.libsdl.org/SDL_DequeueAudioTimestamped
+ */
+int audio_captureTimestamps(void)
+{
+  const char *filename = "sdlaudio-capture.raw";
+  const int samples = 1024;
+  const int file_frames = 44100 * 4;
+  SDL_AudioSpec desired, obtained;
+  SDL_AudioDeviceID id;
+  SDL_RWops *rw;
+  Sint16 buf[4096];
+  Uint64 timestamp, first_timestamp = 0, start_ns, now_ns;
+  Uint32 sequence, got, queued;
+  int first_frame = -1;
+  int i, reads, result;
+  SDL_bool data_ok = SDL_TRUE, time_ok = SDL_TRUE, gap_seen = SDL_FALSE;
+
+  /* A ramp, so every sample frame says where it was in the file */
+  rw = SDL_RWFromFile(filename, "wb");
+  SDLTest_AssertCheck(rw != NULL, "Validate capture file was created");
+  if (rw == NULL) {
+    return TEST_ABORTED;
+  }
+  for (i = 0; i < file_frames; ++i) {
+    SDL_WriteLE16(rw, (Uint16)i);
+  }
+  SDL_RWclose(rw);
+
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_AUDIO)");
+
+  SDL_SetHint(SDL_HINT_AUDIO_DISK_INPUT_FILE, filename);
+  SDL_SetHint(SDL_HINT_AUDIO_CAPTURE_LOCKFREE, "1");
+  result = SDL_AudioInit("disk");
+  SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+  if (result != 0) {
+    SDLTest_Log("Disk audio driver not available: %s", SDL_GetError());
+    SDL_ResetHint(SDL_HINT_AUDIO_DISK_INPUT_FILE);
+    SDL_ResetHint(SDL_HINT_AUDIO_CAPTURE_LOCKFREE);
+    (void)remove(filename);
+    _audioSetUp(NULL);
+    return TEST_SKIPPED;
+  }
+
+  SDL_zero(desired);
+  desired.freq = 44100;
+  desired.format = AUDIO_S16LSB;
+  desired.channels = 1;
+  desired.samples = (Uint16)samples;
+  id = SDL_OpenAudioDevice(NULL, 1, &desired, &obtained, 0);
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %" SDL_PRIu32, id);
+  if (id > 1) {
+    /* Real time capture: the data follows the file, and the timestamps follow the data */
+    start_ns = (Uint64)((double)SDL_GetPerformanceCounter() * 1000000000.0 / SDL_GetPerformanceFrequency());
+    SDL_PauseAudioDevice(id, 0);
+    for (reads = 0; reads < 300; ++reads) {
+      SDL_Delay(1);
+      got = SDL_DequeueAudioTimestamped(id, buf, sizeof(buf), &timestamp, &sequence);
+      if (got == 0) {
+        continue;
+      }
+      if (first_frame < 0) {
+        first_frame = (Uint16)buf[0];
+        first_timestamp = timestamp;
+        SDLTest_AssertCheck(timestamp + 100000000 >= start_ns, "Validate the first timestamp isn't before the device started");
+      }
+      for (i = 1; i < (int)(got / sizeof(Sint16)); ++i) {
+        if ((Uint16)buf[i] != (Uint16)(buf[0] + i)) {
+          data_ok = SDL_FALSE;
+        }
+      }
+      /* The first sample frame is in the buffer with this sequence number */
+      if ((Uint16)((Uint16)buf[0] - (Uint16)(sequence * samples)) >= samples) {
+        data_ok = SDL_FALSE;
+      }
+      /* Within 50 ms of where the sample position says it should be */
+      if (SDL_fabs((double)(Sint64)(timestamp - first_timestamp) -
+                   (double)((Uint16)buf[0] - first_frame) * 1000000000.0 / obtained.freq) > 50000000.0) {
+        time_ok = SDL_FALSE;
+      }
+      now_ns = (Uint64)((double)SDL_GetPerformanceCounter() * 1000000000.0 / SDL_GetPerformanceFrequency());
+      if (timestamp > now_ns) {
+        time_ok = SDL_FALSE;
+      }
+    }
+    SDLTest_AssertCheck(first_frame >= 0, "Validate captured audio was dequeued");
+    SDLTest_AssertCheck(data_ok, "Validate captured audio is contiguous and matches the sequence numbers");
+    SDLTest_AssertCheck(time_ok, "Validate timestamps follow the sample position");
+
+    /* Stop reading: the capture thread keeps going and drops what doesn't fit */
+    SDL_Delay(1500);
+    queued = SDL_GetQueuedAudioSize(id);
+    SDLTest_AssertCheck(queued > 0 && queued <= (Uint32)obtained.freq * sizeof(Sint16), "Validate the ring is bounded; got %" SDL_PRIu32 " bytes", queued);
+    got = SDL_DequeueAudioTimestamped(id, buf, sizeof(buf), &timestamp, &sequence);
+    for (reads = 0; got > 0 && !gap_seen && reads < 1000; ++reads) {
+      const Uint16 next_frame = (Uint16)(buf[got / sizeof(Sint16) - 1] + 1);
+      const Uint32 next_sequence = sequence + 1;
+
+      while ((got = SDL_DequeueAudioTimestamped(id, buf, sizeof(buf), &timestamp, &sequence)) == 0 && reads < 1000) {
+        SDL_Delay(1);
+        ++reads;
+      }
+      if (got > 0 && (Uint16)buf[0] != next_frame) {
+        gap_seen = SDL_TRUE;
+        SDLTest_AssertCheck(sequence > next_sequence, "Validate the sequence numbers skip the dropped buffers");
+      }
+    }
+    SDLTest_AssertCheck(gap_seen, "Validate the reads stop at the dropped buffers");
+
+    SDL_ClearQueuedAudio(id);
+    SDLTest_AssertCheck(SDL_GetQueuedAudioSize(id) <= (Uint32)obtained.size, "Validate SDL_ClearQueuedAudio() empties the ring");
+
+    SDL_CloseAudioDevice(id);
+    SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+  }
+
+  SDL_AudioQuit();
+  SDLTest_AssertPass("Call to SDL_AudioQuit()");
+  SDL_ResetHint(SDL_HINT_AUDIO_DISK_INPUT_FILE);
+  SDL_ResetHint(SDL_HINT_AUDIO_CAPTURE_LOCKFREE);
+  (void)remove(filename);
+
+  /* Restart audio again */
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1285,11 +2772,57 @@ static const SDLTest_TestCaseReference audioTest16 = {
     (SDLTest_TestCaseFp)audio_resampleLoss, "audio_resampleLoss", "Check signal-to-noise ratio and maximum error of audio resampling.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest17 = {
+    (SDLTest_TestCaseFp)audio_streamPeekCommit, "audio_streamPeekCommit", "Check that peeking an audio stream returns the same data as getting it.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest18 = {
+    (SDLTest_TestCaseFp)audio_convertAudioFused, "audio_convertAudioFused", "Check single pass conversions against separate format and channel conversions.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest19 = {
+    (SDLTest_TestCaseFp)audio_diskOfflineRender, "audio_diskOfflineRender", "Render faster than real time with the disk driver and check the WAVE file.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    (SDLTest_TestCaseFp)audio_wavStream, "audio_wavStream", "Check that streamed WAVE decoding matches loading the whole file.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    (SDLTest_TestCaseFp)audio_callbackLockFree, "audio_callbackLockFree", "Run the audio callback without the device lock and check the device statistics.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    (SDLTest_TestCaseFp)audio_deviceStats, "audio_deviceStats", "Check the callback timing, conversion and silence statistics of an audio device.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest23 = {
+    (SDLTest_TestCaseFp)audio_boundStreams, "audio_boundStreams", "Mix several audio streams with their own formats and rates into one device.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest24 = {
+    (SDLTest_TestCaseFp)audio_convertAudioSIMD, "audio_convertAudioSIMD", "Check the SIMD converters against single frames and byteswapped formats against native ones.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest25 = {
+    (SDLTest_TestCaseFp)audio_resampleQuality, "audio_resampleQuality", "Check the signal-to-noise ratio of each resampling quality, by hint and per stream.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest26 = {
+    (SDLTest_TestCaseFp)audio_captureTimestamps, "audio_captureTimestamps", "Capture through the lock-free ring and check sequence numbers and timestamps.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest27 = {
+    (SDLTest_TestCaseFp)audio_streamUnalignedPuts, "audio_streamUnalignedPuts", "Check that unaligned puts keep stream data intact and reuse the queue's packets.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, &audioTest17, &audioTest18,
+    &audioTest19, &audioTest20, &audioTest21, &audioTest22, &audioTest23, &audioTest24,
+    &audioTest25, &audioTest26, &audioTest27, NULL
 };
 
 /* Audio test suite (global) */
@@ -174,6 +174,270 @@ int events_addDelEventWatchWithUserdata(void *arg)
     return TEST_COMPLETED;
 }
 
+#define PUSH_THREADS          4
+#define PUSH_EVENTS_PER_THREAD 2000
+
+/* Restarts video and events with SDL_HINT_EVENT_INGRESS_QUEUE set to value, which is read at startup */
+static void _events_restartWithIngressQueue(const char *value)
+{
+    char *driver = SDL_strdup(SDL_GetCurrentVideoDriver());
+    int i, refs = 0, result;
+
+    SDL_VideoQuit();
+
+    /* Earlier tests may have left other subsystems holding the event loop */
+    while (SDL_WasInit(SDL_INIT_EVENTS)) {
+        SDL_QuitSubSystem(SDL_INIT_EVENTS);
+        ++refs;
+    }
+
+    SDL_SetHint(SDL_HINT_EVENT_INGRESS_QUEUE, value);
+    result = SDL_VideoInit(driver);
+    SDLTest_AssertCheck(result == 0, "Check SDL_VideoInit() succeeded with SDL_HINT_EVENT_INGRESS_QUEUE=%s", value ? value : "NULL");
+    SDL_free(driver);
+
+    for (i = 0; i < refs; ++i) {
+        SDL_InitSubSystem(SDL_INIT_EVENTS);
+    }
+}
+
+/* Counts the user events seen by the event watcher */
+static SDL_atomic_t _pushedEventsWatched;
+
+static int SDLCALL _events_countingEventWatch(void *userdata, SDL_Event *event)
+{
+    if (event->type == SDL_USEREVENT) {
+        SDL_AtomicIncRef(&_pushedEventsWatched);
+    }
+    return 0;
+}
+
+static int SDLCALL _events_pushThread(void *arg)
+{
+    SDL_Event event;
+    int i, failures = 0;
+
+    SDL_zero(event);
+    event.type = SDL_USEREVENT;
+    event.user.code = (Sint32)(intptr_t)arg;
+    for (i = 0; i < PUSH_EVENTS_PER_THREAD; ++i) {
+        event.user.data1 = (void *)(intptr_t)i;
+        if (SDL_PushEvent(&event) != 1) {
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+static void _events_pushFromThreads(void)
+{
+    SDL_Thread *threads[PUSH_THREADS];
+    int next[PUSH_THREADS];
+    SDL_Event event;
+    int i, failures, received = 0, out_of_order = 0;
+
+    /* Start with an empty queue */
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    SDL_AtomicSet(&_pushedEventsWatched, 0);
+    SDL_AddEventWatch(_events_countingEventWatch, NULL);
+    SDLTest_AssertPass("Call to SDL_AddEventWatch()");
+
+    for (i = 0; i < PUSH_THREADS; ++i) {
+        next[i] = 0;
+        threads[i] = SDL_CreateThread(_events_pushThread, "PushThread", (void *)(intptr_t)i);
+        SDLTest_AssertCheck(threads[i] != NULL, "Check SDL_CreateThread() succeeded");
+    }
+
+    /* Read while the threads are pushing */
+    while (received < PUSH_THREADS * PUSH_EVENTS_PER_THREAD) {
+        if (!SDL_WaitEventTimeout(&event, 1000)) {
+            break;
+        }
+        if (event.type != SDL_USEREVENT || event.user.code < 0 || event.user.code >= PUSH_THREADS) {
+            continue;
+        }
+        if ((intptr_t)event.user.data1 != next[event.user.code]) {
+            ++out_of_order;
+        }
+        next[event.user.code] = (int)(intptr_t)event.user.data1 + 1;
+        ++received;
+    }
+
+    failures = 0;
+    for (i = 0; i < PUSH_THREADS; ++i) {
+        int status = 0;
+        if (threads[i]) {
+            SDL_WaitThread(threads[i], &status);
+        }
+        failures += status;
+    }
+
+    SDL_DelEventWatch(_events_countingEventWatch, NULL);
+    SDLTest_AssertPass("Call to SDL_DelEventWatch()");
+
+    SDLTest_AssertCheck(failures == 0, "Check SDL_PushEvent() succeeded on every thread, %d failures", failures);
+    SDLTest_AssertCheck(received == PUSH_THREADS * PUSH_EVENTS_PER_THREAD, "Check all events were received, expected: %d, got: %d", PUSH_THREADS * PUSH_EVENTS_PER_THREAD, received);
+    SDLTest_AssertCheck(out_of_order == 0, "Check events from each thread arrived in order, %d out of order", out_of_order);
+    SDLTest_AssertCheck(SDL_AtomicGet(&_pushedEventsWatched) == received, "Check the event watcher saw every event, expected: %d, got: %d", received, SDL_AtomicGet(&_pushedEventsWatched));
+
+    while (SDL_PollEvent(&event)) {
+    }
+}
+
+/**
+ * @brief Pushes events from several threads at once and checks they all arrive in order
+ *
+ * @sa http://wiki.libsdl.org/SDL_PushEvent
+ * @sa http://wiki.libsdl.org/SDL_PollEvent
+ */
+int events_pushFromThreads(void *arg)
+{
+    _events_pushFromThreads();
+
+    _events_restartWithIngressQueue("1");
+    _events_pushFromThreads();
+    _events_restartWithIngressQueue(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/* Counts the user events the event watcher saw on a thread other than the main thread */
+static SDL_threadID _mainThreadID;
+static SDL_atomic_t _eventsWatchedOffThread;
+
+static int SDLCALL _events_threadCheckingEventWatch(void *userdata, SDL_Event *event)
+{
+    if (event->type == SDL_USEREVENT) {
+        SDL_AtomicIncRef(&_pushedEventsWatched);
+        if (SDL_ThreadID() != _mainThreadID) {
+            SDL_AtomicIncRef(&_eventsWatchedOffThread);
+        }
+    }
+    return 0;
+}
+
+static int SDLCALL _events_pushManyThread(void *arg)
+{
+    SDL_Event event;
+    int i, count = (int)(intptr_t)arg, failures = 0;
+
+    SDL_zero(event);
+    event.type = SDL_USEREVENT;
+    for (i = 0; i < count; ++i) {
+        event.user.data1 = (void *)(intptr_t)i;
+        if (SDL_PushEvent(&event) != 1) {
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+/**
+ * @brief Pushes more events from a thread than the ingress queue holds, without reading
+ *
+ * @sa http://wiki.libsdl.org/SDL_PushEvent
+ * @sa http://wiki.libsdl.org/SDL_AddEventWatch
+ */
+int events_pushOverflowFromThread(void *arg)
+{
+    const int count = 3000;
+    SDL_Thread *thread;
+    SDL_Event event;
+    int failures = 0, received = 0, out_of_order = 0;
+
+    _events_restartWithIngressQueue("1");
+
+    _mainThreadID = SDL_ThreadID();
+    SDL_AtomicSet(&_pushedEventsWatched, 0);
+    SDL_AtomicSet(&_eventsWatchedOffThread, 0);
+    SDL_AddEventWatch(_events_threadCheckingEventWatch, NULL);
+    SDLTest_AssertPass("Call to SDL_AddEventWatch()");
+
+    /* Nobody reads until the thread is done, so the queue fills up */
+    thread = SDL_CreateThread(_events_pushManyThread, "PushThread", (void *)(intptr_t)count);
+    SDLTest_AssertCheck(thread != NULL, "Check SDL_CreateThread() succeeded");
+    SDL_WaitThread(thread, &failures);
+
+    while (SDL_PollEvent(&event)) {
+        if (event.type != SDL_USEREVENT) {
+            continue;
+        }
+        if ((intptr_t)event.user.data1 != received) {
+            ++out_of_order;
+        }
+        ++received;
+    }
+
+    SDL_DelEventWatch(_events_threadCheckingEventWatch, NULL);
+    SDLTest_AssertPass("Call to SDL_DelEventWatch()");
+
+    SDLTest_AssertCheck(failures == 0, "Check SDL_PushEvent() succeeded, %d failures", failures);
+    SDLTest_AssertCheck(received == count, "Check all events were received, expected: %d, got: %d", count, received);
+    SDLTest_AssertCheck(out_of_order == 0, "Check events arrived in order, %d out of order", out_of_order);
+    SDLTest_AssertCheck(SDL_AtomicGet(&_pushedEventsWatched) == count, "Check the event watcher saw every event, expected: %d, got: %d", count, SDL_AtomicGet(&_pushedEventsWatched));
+    SDLTest_AssertCheck(SDL_AtomicGet(&_eventsWatchedOffThread) == 0, "Check the event watcher only ran on the main thread, %d calls on other threads", SDL_AtomicGet(&_eventsWatchedOffThread));
+
+    _events_restartWithIngressQueue(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks that pushing from a thread fails once the ingress queue is full
+ *
+ * @sa http://wiki.libsdl.org/SDL_PushEvent
+ */
+int events_pushFullFromThread(void *arg)
+{
+    /* The ring holds 1024 events and the overflow list 65535 */
+    const int capacity = 1024 + 65535;
+    const int extra = 100;
+    SDL_Thread *thread;
+    int failures = 0;
+
+    _events_restartWithIngressQueue("1");
+
+    thread = SDL_CreateThread(_events_pushManyThread, "PushThread", (void *)(intptr_t)(capacity + extra));
+    SDLTest_AssertCheck(thread != NULL, "Check SDL_CreateThread() succeeded");
+    SDL_WaitThread(thread, &failures);
+    SDLTest_AssertCheck(failures == extra, "Check SDL_PushEvent() failed once the queue was full, expected: %d failures, got: %d", extra, failures);
+
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+    SDLTest_AssertPass("Call to SDL_FlushEvents()");
+
+    _events_restartWithIngressQueue(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Flushes events pushed from another thread
+ *
+ * @sa http://wiki.libsdl.org/SDL_FlushEvent
+ */
+int events_flushFromThread(void *arg)
+{
+    SDL_Thread *thread;
+    int failures = 0;
+
+    _events_restartWithIngressQueue("1");
+
+    thread = SDL_CreateThread(_events_pushManyThread, "PushThread", (void *)(intptr_t)10);
+    SDLTest_AssertCheck(thread != NULL, "Check SDL_CreateThread() succeeded");
+    SDL_WaitThread(thread, &failures);
+    SDLTest_AssertCheck(failures == 0, "Check SDL_PushEvent() succeeded, %d failures", failures);
+
+    SDL_FlushEvent(SDL_USEREVENT);
+    SDLTest_AssertPass("Call to SDL_FlushEvent(SDL_USEREVENT)");
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_USEREVENT), "Check no user events are left after flushing");
+
+    _events_restartWithIngressQueue(NULL);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -189,9 +453,25 @@ static const SDLTest_TestCaseReference eventsTest3 = {
     (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest4 = {
+    (SDLTest_TestCaseFp)events_pushFromThreads, "events_pushFromThreads", "Pushes events from several threads and checks their order", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest5 = {
+    (SDLTest_TestCaseFp)events_pushOverflowFromThread, "events_pushOverflowFromThread", "Pushes more events from a thread than the ingress queue holds", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest6 = {
+    (SDLTest_TestCaseFp)events_flushFromThread, "events_flushFromThread", "Flushes events pushed from another thread", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest7 = {
+    (SDLTest_TestCaseFp)events_pushFullFromThread, "events_pushFullFromThread", "Checks that pushing from a thread fails once the ingress queue is full", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, &eventsTest5, &eventsTest6, &eventsTest7, NULL
 };
 
 /* Events test suite (global) */
@@ -238,6 +238,85 @@ int hints_setHint(void *arg)
         "callbackValue = %s, expected \"(null)\"",
         callbackValue);
 
+    /* The environment is cached, make sure changing it is still noticed */
+    SDLTest_AssertPass("Call to SDL_setenv() after SDL_GetHint()");
+    SDL_setenv(testHint, "changed", 1);
+    testValue = SDL_GetHint(testHint);
+    SDLTest_AssertCheck(
+        testValue && SDL_strcmp(testValue, "changed") == 0,
+        "testValue = %s, expected \"changed\"",
+        testValue);
+
+    return TEST_COMPLETED;
+}
+
+static SDL_atomic_t hints_setterDone;
+
+static int SDLCALL hints_setterThread(void *data)
+{
+    const char *testHint = (const char *)data;
+    int i;
+
+    for (i = 0; i < 10000; i++) {
+        SDL_SetHint(testHint, (i & 1) ? "0" : "false");
+    }
+    SDL_AtomicSet(&hints_setterDone, 1);
+    return 0;
+}
+
+/**
+ * @brief Check that hint values are shared, freed when unused, and safe to read while the hint changes
+ */
+int hints_valueLifetime(void *arg)
+{
+    const char *testHint = "SDL_AUTOMATED_TEST_HINT_LIFETIME";
+    const char *otherHint = "SDL_AUTOMATED_TEST_HINT_LIFETIME_OTHER";
+    const char *value;
+    char buffer[32];
+    SDL_Thread *thread;
+    int allocations, bad_values = 0, i;
+
+    SDL_SetHint(testHint, "shared");
+    SDL_SetHint(otherHint, "shared");
+    SDLTest_AssertCheck(
+        SDL_GetHint(testHint) == SDL_GetHint(otherHint),
+        "Verify hints with the same value share one string");
+    SDL_ResetHint(otherHint);
+    value = SDL_GetHint(testHint);
+    SDLTest_AssertCheck(
+        value && SDL_strcmp(value, "shared") == 0,
+        "Verify a shared value is unchanged after resetting the other hint, got: %s",
+        value ? value : "null");
+
+    /* Values that are no longer used are freed */
+    allocations = SDL_GetNumAllocations();
+    for (i = 0; i < 1000; i++) {
+        SDL_snprintf(buffer, sizeof(buffer), "value %d", i);
+        SDL_SetHint(testHint, buffer);
+    }
+    SDL_SetHint(testHint, "shared");
+    SDLTest_AssertCheck(
+        SDL_GetNumAllocations() == allocations,
+        "Verify old values were freed, expected %d allocations, got %d",
+        allocations, SDL_GetNumAllocations());
+    SDL_ResetHint(testHint);
+
+    /* Read the hint while another thread keeps changing it */
+    SDL_AtomicSet(&hints_setterDone, 0);
+    thread = SDL_CreateThread(hints_setterThread, "HintSetter", (void *)testHint);
+    SDLTest_AssertCheck(thread != NULL, "Verify the hint setter thread was created");
+    if (!thread) {
+        return TEST_ABORTED;
+    }
+    while (!SDL_AtomicGet(&hints_setterDone)) {
+        if (SDL_GetHintBoolean(testHint, SDL_FALSE)) {
+            ++bad_values;
+        }
+    }
+    SDL_WaitThread(thread, NULL);
+    SDLTest_AssertCheck(bad_values == 0, "Verify every value read was one that was set, got %d bad values", bad_values);
+    SDL_ResetHint(testHint);
+
     return TEST_COMPLETED;
 }
 
@@ -252,9 +331,13 @@ static const SDLTest_TestCaseReference hintsTest2 = {
     (SDLTest_TestCaseFp)hints_setHint, "hints_setHint", "Call to SDL_SetHint", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference hintsTest3 = {
+    (SDLTest_TestCaseFp)hints_valueLifetime, "hints_valueLifetime", "Check that hint values are shared, freed when unused, and safe to read while the hint changes", TEST_ENABLED
+};
+
 /* Sequence of Hints test cases */
 static const SDLTest_TestCaseReference *hintsTests[] = {
-    &hintsTest1, &hintsTest2, NULL
+    &hintsTest1, &hintsTest2, &hintsTest3, NULL
 };
 
 /* Hints test suite (global) */
@@ -69,6 +69,242 @@ TestVirtualJoystick(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * @brief Check controller mapping lookups by GUID
+ *
+ * @sa SDL_GameControllerAddMapping
+ * @sa SDL_GameControllerMappingForGUID
+ */
+static int
+TestControllerMappings(void *arg)
+{
+    const char *guid_string = "03000000d8f100002a00000010010000";
+    const char *guid_string_version = "03000000d8f100002a00000011010000";
+    const char *guid_string_crc = "03003412d8f100002a00000010010000";
+    char *mapping;
+    int num_mappings;
+
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER) == 0, "SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER)");
+
+    num_mappings = SDL_GameControllerNumMappings();
+    SDLTest_AssertCheck(num_mappings > 0, "SDL_GameControllerNumMappings() > 0, got: %d", num_mappings);
+
+#ifdef __LINUX__
+    /* A built-in mapping */
+    mapping = SDL_GameControllerMappingForGUID(SDL_JoystickGetGUIDFromString("030000005e0400008e02000010010000"));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",X360 Controller,") != NULL, "Check built-in mapping, got: %s", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+#endif
+
+    /* Mappings with a CRC have to be added first, otherwise they would replace the one without */
+    SDLTest_AssertCheck(SDL_GameControllerAddMapping("03000000d8f100002a00000010010000,Test CRC Controller,a:b0,crc:1234,") == 1, "SDL_GameControllerAddMapping() with CRC");
+    SDLTest_AssertCheck(SDL_GameControllerAddMapping("03000000d8f100002a00000010010000,Test Controller,a:b0,") == 1, "SDL_GameControllerAddMapping()");
+    SDLTest_AssertCheck(SDL_GameControllerAddMapping("03000000d8f100002a00000010010000,Test Controller,a:b1,") == 0, "SDL_GameControllerAddMapping() existing mapping");
+    SDLTest_AssertCheck(SDL_GameControllerNumMappings() == num_mappings + 2, "SDL_GameControllerNumMappings() == %d, got: %d", num_mappings + 2, SDL_GameControllerNumMappings());
+
+    mapping = SDL_GameControllerMappingForGUID(SDL_JoystickGetGUIDFromString(guid_string));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test Controller,a:b1,") != NULL, "Check exact mapping, got: %s", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    mapping = SDL_GameControllerMappingForGUID(SDL_JoystickGetGUIDFromString(guid_string_version));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test Controller,") != NULL, "Check mapping with different version, got: %s", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    mapping = SDL_GameControllerMappingForGUID(SDL_JoystickGetGUIDFromString(guid_string_crc));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test CRC Controller,") != NULL, "Check mapping with CRC, got: %s", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    mapping = SDL_GameControllerMappingForIndex(num_mappings + 1);
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test Controller,") != NULL, "SDL_GameControllerMappingForIndex(%d), got: %s", num_mappings + 1, mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Check game controller events driven by a virtual joystick
+ *
+ * @sa SDL_GameControllerOpen
+ * @sa SDL_JoystickSetVirtualButton
+ */
+static int
+TestVirtualGameController(void *arg)
+{
+    SDL_VirtualJoystickDesc desc;
+    SDL_GameController *gamecontroller;
+    SDL_Joystick *joystick;
+    char guid[33];
+    char *mapping_string;
+    int device_index;
+
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER) == 0, "SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER)");
+
+    SDL_zero(desc);
+    desc.version = SDL_VIRTUAL_JOYSTICK_DESC_VERSION;
+    desc.type = SDL_JOYSTICK_TYPE_GAMECONTROLLER;
+    desc.naxes = 3;
+    desc.nbuttons = 2;
+    desc.nhats = 1;
+    desc.name = "Virtual Test Joystick";
+    device_index = SDL_JoystickAttachVirtualEx(&desc);
+    SDLTest_AssertCheck(device_index >= 0, "SDL_JoystickAttachVirtualEx()");
+    if (device_index < 0) {
+        SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER);
+        return TEST_ABORTED;
+    }
+
+    gamecontroller = SDL_GameControllerOpen(device_index);
+    SDLTest_AssertCheck(gamecontroller != NULL, "SDL_GameControllerOpen()");
+    if (gamecontroller) {
+        joystick = SDL_GameControllerGetJoystick(gamecontroller);
+        SDLTest_AssertCheck(SDL_GameControllerFromInstanceID(SDL_JoystickInstanceID(joystick)) == gamecontroller, "SDL_GameControllerFromInstanceID()");
+
+        /* Replace the mapping, which reloads the bindings of the open controller */
+        SDL_JoystickGetGUIDString(SDL_JoystickGetGUID(joystick), guid, sizeof(guid));
+        SDL_asprintf(&mapping_string, "%s,Virtual Test Controller,a:b1,b:b0,dpup:h0.1,dpdown:h0.4,leftx:a0,x:+a2,", guid);
+        SDLTest_AssertCheck(SDL_GameControllerAddMapping(mapping_string) >= 0, "SDL_GameControllerAddMapping()");
+        SDL_free(mapping_string);
+        SDLTest_AssertCheck(SDL_strcmp(SDL_GameControllerName(gamecontroller), "Virtual Test Controller") == 0, "SDL_GameControllerName(), got: %s", SDL_GameControllerName(gamecontroller));
+
+        SDL_JoystickSetVirtualButton(joystick, 1, SDL_PRESSED);
+        SDL_GameControllerUpdate();
+        SDLTest_AssertCheck(SDL_GameControllerGetButton(gamecontroller, SDL_CONTROLLER_BUTTON_A) == SDL_PRESSED, "Button 1 pressed SDL_CONTROLLER_BUTTON_A");
+        SDLTest_AssertCheck(SDL_GameControllerGetButton(gamecontroller, SDL_CONTROLLER_BUTTON_B) == SDL_RELEASED, "Button 1 didn't press SDL_CONTROLLER_BUTTON_B");
+        SDL_JoystickSetVirtualButton(joystick, 1, SDL_RELEASED);
+        SDL_GameControllerUpdate();
+        SDLTest_AssertCheck(SDL_GameControllerGetButton(gamecontroller, SDL_CONTROLLER_BUTTON_A) == SDL_RELEASED, "Button 1 released SDL_CONTROLLER_BUTTON_A");
+
+        SDL_JoystickSetVirtualHat(joystick, 0, SDL_HAT_UP);
+        SDL_GameControllerUpdate();
+        SDLTest_AssertCheck(SDL_GameControllerGetButton(gamecontroller, SDL_CONTROLLER_BUTTON_DPAD_UP) == SDL_PRESSED, "Hat up pressed SDL_CONTROLLER_BUTTON_DPAD_UP");
+        SDL_JoystickSetVirtualHat(joystick, 0, SDL_HAT_DOWN);
+        SDL_GameControllerUpdate();
+        SDLTest_AssertCheck(SDL_GameControllerGetButton(gamecontroller, SDL_CONTROLLER_BUTTON_DPAD_UP) == SDL_RELEASED, "Hat down released SDL_CONTROLLER_BUTTON_DPAD_UP");
+        SDLTest_AssertCheck(SDL_GameControllerGetButton(gamecontroller, SDL_CONTROLLER_BUTTON_DPAD_DOWN) == SDL_PRESSED, "Hat down pressed SDL_CONTROLLER_BUTTON_DPAD_DOWN");
+
+        SDL_JoystickSetVirtualAxis(joystick, 0, 12345);
+        SDL_GameControllerUpdate();
+        SDLTest_AssertCheck(SDL_GameControllerGetAxis(gamecontroller, SDL_CONTROLLER_AXIS_LEFTX) == 12345, "SDL_GameControllerGetAxis(SDL_CONTROLLER_AXIS_LEFTX), got: %d", SDL_GameControllerGetAxis(gamecontroller, SDL_CONTROLLER_AXIS_LEFTX));
+
+        SDL_JoystickSetVirtualAxis(joystick, 2, SDL_JOYSTICK_AXIS_MAX);
+        SDL_GameControllerUpdate();
+        SDLTest_AssertCheck(SDL_GameControllerGetButton(gamecontroller, SDL_CONTROLLER_BUTTON_X) == SDL_PRESSED, "Axis 2 pressed SDL_CONTROLLER_BUTTON_X");
+        SDL_JoystickSetVirtualAxis(joystick, 2, 0);
+        SDL_GameControllerUpdate();
+        SDLTest_AssertCheck(SDL_GameControllerGetButton(gamecontroller, SDL_CONTROLLER_BUTTON_X) == SDL_RELEASED, "Axis 2 released SDL_CONTROLLER_BUTTON_X");
+
+        SDL_GameControllerClose(gamecontroller);
+        SDLTest_AssertCheck(SDL_GameControllerFromInstanceID(SDL_JoystickGetDeviceInstanceID(device_index)) == NULL, "SDL_GameControllerFromInstanceID() after close");
+    }
+    SDLTest_AssertCheck(SDL_JoystickDetachVirtual(device_index) == 0, "SDL_JoystickDetachVirtual()");
+
+    SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER);
+
+    return TEST_COMPLETED;
+}
+
+/* Returns all the mappings in index order, as SDL_GameControllerMappingForIndex() reports them */
+static char **_getControllerMappings(int *num_mappings)
+{
+    char **mappings;
+    int i;
+
+    *num_mappings = SDL_GameControllerNumMappings();
+    mappings = (char **)SDL_calloc(*num_mappings + 1, sizeof(*mappings));
+    if (mappings) {
+        for (i = 0; i < *num_mappings; ++i) {
+            mappings[i] = SDL_GameControllerMappingForIndex(i);
+        }
+    }
+    return mappings;
+}
+
+static void _freeControllerMappings(char **mappings)
+{
+    int i;
+
+    if (mappings) {
+        for (i = 0; mappings[i]; ++i) {
+            SDL_free(mappings[i]);
+        }
+        SDL_free(mappings);
+    }
+}
+
+/**
+ * @brief Check that lazily parsed built-in mappings match and enumerate like the full database
+ *
+ * @sa SDL_GameControllerMappingForGUID
+ * @sa SDL_GameControllerMappingForIndex
+ */
+static int
+TestControllerMappingOrder(void *arg)
+{
+    /* An Xbox 360 controller with a revision that isn't in the database */
+    const char *guid_string = "030000005e0400008e020000ffff0000";
+    const char *expected = NULL;
+    char **database, **mappings;
+    char *mapping;
+    int num_database, num_mappings;
+    int i;
+
+    /* Enumerating parses every built-in mapping, in database order */
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER) == 0, "SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER)");
+    database = _getControllerMappings(&num_database);
+    SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER);
+    SDLTest_AssertCheck(database != NULL, "Get all controller mappings");
+    if (!database) {
+        return TEST_ABORTED;
+    }
+
+    /* The version fallback picks the first mapping without a CRC for the versionless GUID */
+    for (i = 0; i < num_database && !expected; ++i) {
+        if (database[i] && SDL_strncmp(database[i], guid_string, 24) == 0 &&
+            SDL_strncmp(database[i] + 28, guid_string + 28, 4) == 0 &&
+            !SDL_strstr(database[i], "crc:")) {
+            expected = SDL_strchr(database[i], ',');
+        }
+    }
+
+    /* Look it up first, so only those built-in mappings get parsed, then add one */
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER) == 0, "SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER)");
+    mapping = SDL_GameControllerMappingForGUID(SDL_JoystickGetGUIDFromString(guid_string));
+    if (expected) {
+        SDLTest_AssertCheck(mapping && SDL_strcmp(SDL_strchr(mapping, ','), expected) == 0, "Check version fallback mapping, expected: %s, got: %s", expected, mapping ? mapping : "NULL");
+    } else {
+        SDLTest_AssertCheck(mapping == NULL || !SDL_strstr(mapping, ",X360 Controller,"), "Check version fallback mapping, got: %s", mapping ? mapping : "NULL");
+    }
+#ifdef __LINUX__
+    /* The first of several Xbox 360 mappings in the Linux database */
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Atari Xbox 360 Game Controller,") != NULL, "Check version fallback uses the first mapping in the database, got: %s", mapping ? mapping : "NULL");
+#endif
+    SDL_free(mapping);
+    SDLTest_AssertCheck(SDL_GameControllerAddMapping("03000000d8f100002b00000010010000,Test Order Controller,a:b0,") == 1, "SDL_GameControllerAddMapping()");
+
+    mappings = _getControllerMappings(&num_mappings);
+    SDLTest_AssertCheck(mappings != NULL && num_mappings == num_database + 1, "SDL_GameControllerNumMappings() == %d, got: %d", num_database + 1, num_mappings);
+    if (mappings && num_mappings == num_database + 1) {
+        int mismatches = 0;
+        for (i = 0; i < num_database; ++i) {
+            if (!database[i] || !mappings[i] || SDL_strcmp(database[i], mappings[i]) != 0) {
+                if (mismatches++ == 0) {
+                    SDLTest_AssertCheck(SDL_FALSE, "SDL_GameControllerMappingForIndex(%d), expected: %s, got: %s", i, database[i] ? database[i] : "NULL", mappings[i] ? mappings[i] : "NULL");
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Check built-in mappings are in database order, mismatches: %d", mismatches);
+        SDLTest_AssertCheck(mappings[num_database] && SDL_strstr(mappings[num_database], ",Test Order Controller,") != NULL, "SDL_GameControllerMappingForIndex(%d), got: %s", num_database, mappings[num_database] ? mappings[num_database] : "NULL");
+    }
+    _freeControllerMappings(mappings);
+    _freeControllerMappings(database);
+
+    SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Joystick routine test cases */
@@ -76,9 +312,24 @@ static const SDLTest_TestCaseReference joystickTest1 = {
     (SDLTest_TestCaseFp)TestVirtualJoystick, "TestVirtualJoystick", "Test virtual joystick functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference joystickTest2 = {
+    (SDLTest_TestCaseFp)TestControllerMappings, "TestControllerMappings", "Test controller mapping lookups", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference joystickTest3 = {
+    (SDLTest_TestCaseFp)TestVirtualGameController, "TestVirtualGameController", "Test game controller input from a virtual joystick", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference joystickTest4 = {
+    (SDLTest_TestCaseFp)TestControllerMappingOrder, "TestControllerMappingOrder", "Test lazily parsed controller mappings keep the database order", TEST_ENABLED
+};
+
 /* Sequence of Joystick routine test cases */
 static const SDLTest_TestCaseReference *joystickTests[] = {
     &joystickTest1,
+    &joystickTest2,
+    &joystickTest3,
+    &joystickTest4,
     NULL
 };
 
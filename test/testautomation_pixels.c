@@ -469,6 +469,281 @@ pixels_calcGammaRamp(void *arg)
   return TEST_COMPLETED;
 }
 
+/* Reference palette search, the exhaustive search SDL_MapRGBA() has to match */
+static Uint8 _findColorReference(const SDL_Palette *palette, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    unsigned int smallest = ~0U;
+    Uint8 pixel = 0;
+    int i;
+
+    for (i = 0; i < palette->ncolors; ++i) {
+        const int rd = palette->colors[i].r - r;
+        const int gd = palette->colors[i].g - g;
+        const int bd = palette->colors[i].b - b;
+        const int ad = palette->colors[i].a - a;
+        const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            pixel = (Uint8)i;
+            smallest = distance;
+        }
+    }
+    return pixel;
+}
+
+static int _checkMapRGBA(SDL_PixelFormat *format, int iterations, SDL_bool random_alpha)
+{
+    int failures = 0;
+    int i;
+
+    for (i = 0; i < iterations; ++i) {
+        const Uint8 r = SDLTest_RandomUint8();
+        const Uint8 g = SDLTest_RandomUint8();
+        const Uint8 b = SDLTest_RandomUint8();
+        const Uint8 a = random_alpha ? SDLTest_RandomUint8() : SDL_ALPHA_OPAQUE;
+        const Uint32 expected = _findColorReference(format->palette, r, g, b, a);
+        const Uint32 result = SDL_MapRGBA(format, r, g, b, a);
+        if (result != expected) {
+            if (failures++ == 0) {
+                SDLTest_AssertCheck(result == expected, "Verify SDL_MapRGBA(%u,%u,%u,%u); expected: %" SDL_PRIu32 ", got %" SDL_PRIu32, r, g, b, a, expected, result);
+            }
+        }
+    }
+    return failures;
+}
+
+/**
+ * \brief Map colors to a palettized format and compare with an exhaustive search
+ *
+ * \sa SDL_MapRGBA
+ * \sa SDL_SetPaletteColors
+ */
+int pixels_mapRGBAPalette(void *arg)
+{
+    SDL_PixelFormat *format;
+    SDL_Palette *palette;
+    SDL_Color colors[256];
+    int variation;
+    int failures;
+    int i;
+
+    format = SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertPass("Call to SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8)");
+    SDLTest_AssertCheck(format != NULL, "Verify result is not NULL");
+    palette = SDL_AllocPalette(256);
+    SDLTest_AssertPass("Call to SDL_AllocPalette(256)");
+    SDLTest_AssertCheck(palette != NULL, "Verify result is not NULL");
+    if (format == NULL || palette == NULL) {
+        SDL_FreeFormat(format);
+        SDL_FreePalette(palette);
+        return TEST_ABORTED;
+    }
+    SDL_SetPixelFormatPalette(format, palette);
+
+    for (variation = 1; variation <= 5; variation++) {
+        SDL_bool random_alpha = SDL_FALSE;
+
+        for (i = 0; i < SDL_arraysize(colors); ++i) {
+            colors[i].r = SDLTest_RandomUint8();
+            colors[i].g = SDLTest_RandomUint8();
+            colors[i].b = SDLTest_RandomUint8();
+            colors[i].a = SDL_ALPHA_OPAQUE;
+        }
+        switch (variation) {
+        /* Opaque palette, opaque lookups */
+        default:
+        case 1:
+            break;
+        /* Opaque palette, translucent lookups */
+        case 2:
+            random_alpha = SDL_TRUE;
+            break;
+        /* Palette with duplicated entries, ties must pick the lowest index */
+        case 3:
+            for (i = 128; i < SDL_arraysize(colors); ++i) {
+                colors[i] = colors[i - 128];
+            }
+            break;
+        /* Translucent palette, opaque lookups */
+        case 4:
+            for (i = 0; i < SDL_arraysize(colors); ++i) {
+                colors[i].a = SDLTest_RandomUint8();
+            }
+            break;
+        /* Translucent palette, translucent lookups */
+        case 5:
+            for (i = 0; i < SDL_arraysize(colors); ++i) {
+                colors[i].a = SDLTest_RandomUint8();
+            }
+            random_alpha = SDL_TRUE;
+            break;
+        }
+
+        SDL_SetPaletteColors(palette, colors, 0, SDL_arraysize(colors));
+        SDLTest_AssertPass("Call to SDL_SetPaletteColors(), variation %d", variation);
+        failures = _checkMapRGBA(format, 10000, random_alpha);
+        SDLTest_AssertCheck(failures == 0, "Verify SDL_MapRGBA matches exhaustive search; failures: %d", failures);
+
+        /* Every palette color must map back to an entry of the same color */
+        failures = 0;
+        for (i = 0; i < palette->ncolors; ++i) {
+            const Uint32 pixel = SDL_MapRGBA(format, colors[i].r, colors[i].g, colors[i].b, colors[i].a);
+            if (SDL_memcmp(&palette->colors[pixel], &colors[i], sizeof(colors[i])) != 0) {
+                ++failures;
+            }
+        }
+        SDLTest_AssertCheck(failures == 0, "Verify palette colors map to themselves; failures: %d", failures);
+    }
+
+    /* Colors written straight into the palette, as SDL does itself when loading BMPs */
+    for (i = 0; i < palette->ncolors; ++i) {
+        palette->colors[i].r = (Uint8)(255 - palette->colors[i].r);
+        palette->colors[i].a = SDL_ALPHA_OPAQUE;
+    }
+    failures = _checkMapRGBA(format, 10000, SDL_FALSE);
+    SDLTest_AssertCheck(failures == 0, "Verify SDL_MapRGBA sees colors written without SDL_SetPaletteColors(); failures: %d", failures);
+
+    SDL_FreePalette(palette);
+    SDL_FreeFormat(format);
+    SDLTest_AssertPass("Call to SDL_FreePalette() and SDL_FreeFormat()");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Convert truecolor surfaces to a palettized format
+ *
+ * \sa SDL_ConvertSurface
+ * \sa SDL_HINT_SURFACE_PALETTE_DITHER
+ */
+int pixels_convertToPalette(void *arg)
+{
+    const int width = 64, height = 64;
+    SDL_PixelFormat *format;
+    SDL_Palette *palette;
+    SDL_Color colors[256];
+    SDL_Surface *src, *dst;
+    int variation;
+    int i, x, y;
+
+    format = SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8);
+    palette = SDL_AllocPalette(256);
+    src = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(format && palette && src, "Verify format, palette and surface were created");
+    if (!format || !palette || !src) {
+        SDL_FreeFormat(format);
+        SDL_FreePalette(palette);
+        SDL_FreeSurface(src);
+        return TEST_ABORTED;
+    }
+
+    /* Palette colors that are exactly representable in the RGB555 lookup */
+    for (i = 0; i < SDL_arraysize(colors); ++i) {
+        const Uint8 r = (Uint8)(SDLTest_RandomIntegerInRange(0, 31) << 3);
+        const Uint8 g = (Uint8)(SDLTest_RandomIntegerInRange(0, 31) << 3);
+        const Uint8 b = (Uint8)(SDLTest_RandomIntegerInRange(0, 31) << 3);
+        colors[i].r = r | (r >> 5);
+        colors[i].g = g | (g >> 5);
+        colors[i].b = b | (b >> 5);
+        colors[i].a = SDL_ALPHA_OPAQUE;
+    }
+    SDL_SetPaletteColors(palette, colors, 0, SDL_arraysize(colors));
+    SDL_SetPixelFormatPalette(format, palette);
+
+    for (y = 0; y < height; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        for (x = 0; x < width; ++x) {
+            const SDL_Color *c = &colors[(y * width + x) % SDL_arraysize(colors)];
+            row[x] = SDL_MapRGB(src->format, c->r, c->g, c->b);
+        }
+    }
+
+    for (variation = 1; variation <= 2; variation++) {
+        int failures = 0;
+
+        SDL_SetHint(SDL_HINT_SURFACE_PALETTE_DITHER, (variation == 1) ? "none" : "ordered");
+        dst = SDL_ConvertSurface(src, format, 0);
+        SDLTest_AssertPass("Call to SDL_ConvertSurface(), dither %s", (variation == 1) ? "none" : "ordered");
+        SDLTest_AssertCheck(dst != NULL, "Verify result is not NULL");
+        if (!dst) {
+            continue;
+        }
+
+        for (y = 0; y < height; ++y) {
+            const Uint8 *row = (const Uint8 *)dst->pixels + y * dst->pitch;
+            for (x = 0; x < width; ++x) {
+                const SDL_Color *expected = &colors[(y * width + x) % SDL_arraysize(colors)];
+                const SDL_Color *got = &dst->format->palette->colors[row[x]];
+                if (variation == 1) {
+                    /* Palette colors must convert to themselves */
+                    if (got->r != expected->r || got->g != expected->g || got->b != expected->b) {
+                        ++failures;
+                    }
+                } else {
+                    /* Dithering only perturbs colors by a small amount */
+                    if (SDL_abs(got->r - expected->r) > 64 || SDL_abs(got->g - expected->g) > 64 || SDL_abs(got->b - expected->b) > 64) {
+                        ++failures;
+                    }
+                }
+            }
+        }
+        SDLTest_AssertCheck(failures == 0, "Verify converted pixels; failures: %d", failures);
+        SDL_FreeSurface(dst);
+    }
+    SDL_ResetHint(SDL_HINT_SURFACE_PALETTE_DITHER);
+
+    /* Two surfaces sharing the palette share its lookup table, which has to
+       follow palette changes between blits */
+    for (variation = 1; variation <= 2; variation++) {
+        SDL_Surface *dsts[2];
+        int failures = 0;
+        int j;
+
+        if (variation == 2) {
+            for (i = 0; i < SDL_arraysize(colors) / 2; ++i) {
+                SDL_Color tmp = colors[i];
+                colors[i] = colors[SDL_arraysize(colors) - 1 - i];
+                colors[SDL_arraysize(colors) - 1 - i] = tmp;
+            }
+            SDL_SetPaletteColors(palette, colors, 0, SDL_arraysize(colors));
+            SDLTest_AssertPass("Call to SDL_SetPaletteColors() with the colors reversed");
+        }
+        for (j = 0; j < SDL_arraysize(dsts); ++j) {
+            dsts[j] = SDL_CreateRGBSurfaceWithFormat(0, width, height, 8, SDL_PIXELFORMAT_INDEX8);
+            if (dsts[j]) {
+                SDL_SetSurfacePalette(dsts[j], palette);
+                SDL_BlitSurface(src, NULL, dsts[j], NULL);
+            }
+        }
+        SDLTest_AssertCheck(dsts[0] && dsts[1], "Verify destination surfaces were created");
+        for (j = 0; j < SDL_arraysize(dsts); ++j) {
+            if (!dsts[j]) {
+                continue;
+            }
+            for (y = 0; y < height; ++y) {
+                const Uint8 *row = (const Uint8 *)dsts[j]->pixels + y * dsts[j]->pitch;
+                for (x = 0; x < width; ++x) {
+                    const Uint32 pixel = ((const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch))[x];
+                    const SDL_Color *got = &palette->colors[row[x]];
+                    Uint8 r, g, b;
+
+                    SDL_GetRGB(pixel, src->format, &r, &g, &b);
+                    if (got->r != r || got->g != g || got->b != b) {
+                        ++failures;
+                    }
+                }
+            }
+            SDL_FreeSurface(dsts[j]);
+        }
+        SDLTest_AssertCheck(failures == 0, "Verify blits to surfaces sharing the palette, variation %d; failures: %d", variation, failures);
+    }
+
+    SDL_FreeSurface(src);
+    SDL_FreePalette(palette);
+    SDL_FreeFormat(format);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -486,9 +761,15 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_mapRGBAPalette, "pixels_mapRGBAPalette", "Call to SDL_MapRGBA with a palettized format", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest6 =
+        { (SDLTest_TestCaseFp)pixels_convertToPalette, "pixels_convertToPalette", "Call to SDL_ConvertSurface to a palettized format", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, &pixelsTest6, NULL
 };
 
 /* Pixels test suite (global) */
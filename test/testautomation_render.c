@@ -1127,6 +1127,58 @@ _clearScreen(void)
     return 0;
 }
 
+/**
+ * @brief Tests simulated vsync pacing with SDL_RenderGetVSyncStats
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderGetVSyncStats
+ */
+int render_testSimulatedVSync(void *arg)
+{
+    const int presents = 7;
+    SDL_RenderVSyncStats stats;
+    SDL_DisplayMode mode;
+    int refresh_rate = 0;
+    Uint64 start, elapsed_ns, expected_ns;
+    int i, ret;
+
+    if (SDL_GetDesktopDisplayMode(0, &mode) == 0) {
+        refresh_rate = mode.refresh_rate;
+    }
+    if (!refresh_rate) {
+        refresh_rate = 60;
+    }
+
+    /* The software renderer has no vsync of its own, so SDL simulates it */
+    SDL_RenderSetVSync(renderer, 1);
+    SDLTest_AssertPass("Call to SDL_RenderSetVSync(renderer, 1)");
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < presents; ++i) {
+        SDL_RenderPresent(renderer);
+    }
+    elapsed_ns = (SDL_GetPerformanceCounter() - start) * 1000000000 / SDL_GetPerformanceFrequency();
+    SDLTest_AssertPass("Call to SDL_RenderPresent() %d times", presents);
+
+    ret = SDL_RenderGetVSyncStats(renderer, &stats);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetVSyncStats, expected: 0, got: %i", ret);
+
+    SDL_RenderSetVSync(renderer, 0);
+
+    if (stats.frames == 0) {
+        /* The renderer provided vsync itself */
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertCheck(stats.frames == presents, "Check paced presents, expected: %d, got: %" SDL_PRIu64, presents, stats.frames);
+    SDLTest_AssertCheck(stats.missed < stats.frames, "Check missed presents, expected: <%" SDL_PRIu64 ", got: %" SDL_PRIu64, stats.frames, stats.missed);
+
+    /* Every present after the first is due at least one refresh after the previous one */
+    expected_ns = (Uint64)(presents - 1) * 1000000000 / refresh_rate;
+    SDLTest_AssertCheck(elapsed_ns + 1000 >= expected_ns, "Check elapsed time, expected: >=%" SDL_PRIu64 " ns, got: %" SDL_PRIu64 " ns", expected_ns, elapsed_ns);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Render test cases */
@@ -1161,9 +1213,13 @@ static const SDLTest_TestCaseReference renderTest7 = {
     (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED
 };
 
+static const SDLTest_TestCaseReference renderTest8 = {
+    (SDLTest_TestCaseFp)render_testSimulatedVSync, "render_testSimulatedVSync", "Tests simulated vsync pacing", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, NULL
 };
 
 /* Render test suite (global) */
@@ -798,6 +798,243 @@ int surface_testOverflow(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Fills a surface with runs of transparent, translucent and opaque pixels */
+static void _fillRLETestSurface(SDL_Surface *surface, Uint32 colorkey)
+{
+    int x, y;
+
+    for (y = 0; y < surface->h; ++y) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+        x = 0;
+        while (x < surface->w) {
+            const int run = SDLTest_RandomIntegerInRange(1, 24);
+            const int kind = SDLTest_RandomIntegerInRange(0, 3);
+            int i;
+
+            for (i = 0; i < run && x < surface->w; ++i, ++x) {
+                Uint32 pixel;
+
+                if (surface->format->BytesPerPixel == 1) {
+                    pixel = (kind == 0) ? colorkey : SDLTest_RandomIntegerInRange(0, 255);
+                    row[x] = (Uint8)pixel;
+                    continue;
+                }
+                if (kind == 0) {
+                    pixel = colorkey;
+                } else {
+                    const Uint8 a = (kind == 1) ? SDL_ALPHA_TRANSPARENT : (kind == 2) ? SDL_ALPHA_OPAQUE : SDLTest_RandomUint8();
+                    pixel = SDL_MapRGBA(surface->format, SDLTest_RandomUint8(), SDLTest_RandomUint8(), SDLTest_RandomUint8(), a);
+                }
+                ((Uint32 *)row)[x] = pixel;
+            }
+        }
+    }
+}
+
+/* The RLE blitters blend translucent pixels to 32bpp targets as
+   d + (s - d) * a / 256, rounded down, with the vector and scalar paths
+   giving identical results */
+static Uint8 _blendRLEReference(Uint8 s, Uint8 d, Uint8 a)
+{
+    return (Uint8)((d * 256 + (s - d) * a) >> 8);
+}
+
+/* Blits an RLE surface and the same surface without RLE to every destination
+   format, visiting the first format again at the end so that visit hits the
+   RLE cache. Colors may differ by up to tolerance per component, since the
+   RLE blitters round alpha blends differently. Returns the number of pixels
+   that differ by more than that. */
+static int _compareRLEBlits(SDL_Surface *rle, SDL_Surface *plain, int tolerance, const char *state)
+{
+    static const Uint32 dst_formats[] = {
+        SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888
+    };
+    const SDL_bool check_blend = (rle->format->Amask && !SDL_HasColorKey(rle)) ? SDL_TRUE : SDL_FALSE;
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    Uint8 alpha_mod = 255;
+    int total = 0;
+    int i, x, y;
+
+    SDL_GetSurfaceBlendMode(rle, &mode);
+    SDL_GetSurfaceAlphaMod(rle, &alpha_mod);
+
+    for (i = 0; i < SDL_arraysize(dst_formats); ++i) {
+        SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, rle->w, rle->h, 32, dst_formats[i]);
+        SDL_Surface *actual = SDL_CreateRGBSurfaceWithFormat(0, rle->w, rle->h, 32, dst_formats[i]);
+        const Uint8 bg_r = 40, bg_g = 80, bg_b = 160;
+        int failures = 0, blend_failures = 0;
+        int limit = tolerance;
+
+        if (!expected || !actual) {
+            SDLTest_AssertCheck(SDL_FALSE, "Create %s destination surfaces", SDL_GetPixelFormatName(dst_formats[i]));
+            SDL_FreeSurface(expected);
+            SDL_FreeSurface(actual);
+            return -1;
+        }
+        /* 16bpp targets are blended with 5 bits of alpha, one step of which is 8 */
+        if (tolerance && expected->format->BytesPerPixel == 2) {
+            limit += 8;
+        }
+        SDL_FillRect(expected, NULL, SDL_MapRGB(expected->format, bg_r, bg_g, bg_b));
+        SDL_FillRect(actual, NULL, SDL_MapRGB(actual->format, bg_r, bg_g, bg_b));
+        SDL_BlitSurface(plain, NULL, expected, NULL);
+        SDL_BlitSurface(rle, NULL, actual, NULL);
+
+        for (y = 0; y < rle->h; ++y) {
+            for (x = 0; x < rle->w; ++x) {
+                const int bpp = expected->format->BytesPerPixel;
+                Uint32 e = 0, a = 0;
+                Uint8 er, eg, eb, ar, ag, ab;
+
+                SDL_memcpy(&e, (const Uint8 *)expected->pixels + y * expected->pitch + x * bpp, bpp);
+                SDL_memcpy(&a, (const Uint8 *)actual->pixels + y * actual->pitch + x * bpp, bpp);
+                SDL_GetRGB(e, expected->format, &er, &eg, &eb);
+                SDL_GetRGB(a, actual->format, &ar, &ag, &ab);
+                if (SDL_abs(er - ar) > limit || SDL_abs(eg - ag) > limit || SDL_abs(eb - ab) > limit) {
+                    ++failures;
+                }
+
+                if (check_blend && mode == SDL_BLENDMODE_BLEND && alpha_mod == 255 && bpp == 4) {
+                    const Uint32 src = ((const Uint32 *)((const Uint8 *)plain->pixels + y * plain->pitch))[x];
+                    Uint8 sr, sg, sb, sa;
+
+                    SDL_GetRGBA(src, plain->format, &sr, &sg, &sb, &sa);
+                    if (sa != SDL_ALPHA_TRANSPARENT && sa != SDL_ALPHA_OPAQUE &&
+                        (ar != _blendRLEReference(sr, bg_r, sa) ||
+                         ag != _blendRLEReference(sg, bg_g, sa) ||
+                         ab != _blendRLEReference(sb, bg_b, sa))) {
+                        ++blend_failures;
+                    }
+                }
+            }
+        }
+        SDLTest_AssertCheck(failures == 0, "Verify RLE blit to %s %s matches a plain blit; failures: %d",
+                            SDL_GetPixelFormatName(dst_formats[i]), state, failures);
+        if (check_blend && mode == SDL_BLENDMODE_BLEND && alpha_mod == 255 && expected->format->BytesPerPixel == 4) {
+            SDLTest_AssertCheck(blend_failures == 0, "Verify RLE blend to %s %s matches the scalar formula; failures: %d",
+                                SDL_GetPixelFormatName(dst_formats[i]), state, blend_failures);
+        }
+        total += failures + blend_failures;
+        SDL_FreeSurface(expected);
+        SDL_FreeSurface(actual);
+    }
+    return total;
+}
+
+/**
+ * @brief Blits an RLE surface to several formats while changing its state, comparing with plain blits
+ *
+ * @sa http://wiki.libsdl.org/SDL_SetSurfaceRLE
+ * @sa http://wiki.libsdl.org/SDL_SetColorKey
+ * @sa http://wiki.libsdl.org/SDL_SetSurfaceAlphaMod
+ * @sa http://wiki.libsdl.org/SDL_SetSurfaceBlendMode
+ */
+int surface_testRLEBlitStateChanges(void *arg)
+{
+    SDL_Surface *rle, *plain;
+    Uint32 key1, key2;
+
+    rle = SDL_CreateRGBSurfaceWithFormat(0, 97, 31, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(rle != NULL, "Verify source surface was created");
+    if (!rle) {
+        return TEST_ABORTED;
+    }
+    key1 = SDL_MapRGBA(rle->format, 255, 0, 255, SDL_ALPHA_OPAQUE);
+    key2 = SDL_MapRGBA(rle->format, 0, 255, 0, SDL_ALPHA_OPAQUE);
+    _fillRLETestSurface(rle, key1);
+    plain = SDL_DuplicateSurface(rle);
+    SDLTest_AssertCheck(plain != NULL, "Verify SDL_DuplicateSurface() result is not NULL");
+    if (!plain) {
+        SDL_FreeSurface(rle);
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceRLE(rle, 1);
+
+    SDL_SetSurfaceBlendMode(rle, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceBlendMode(plain, SDL_BLENDMODE_NONE);
+    SDL_SetColorKey(rle, SDL_TRUE, key1);
+    SDL_SetColorKey(plain, SDL_TRUE, key1);
+    _compareRLEBlits(rle, plain, 0, "with a colorkey");
+
+    SDL_SetColorKey(rle, SDL_TRUE, key2);
+    SDL_SetColorKey(plain, SDL_TRUE, key2);
+    _compareRLEBlits(rle, plain, 0, "after changing the colorkey");
+
+    SDL_SetSurfaceBlendMode(rle, SDL_BLENDMODE_BLEND);
+    SDL_SetSurfaceBlendMode(plain, SDL_BLENDMODE_BLEND);
+    SDL_SetColorKey(rle, SDL_FALSE, 0);
+    SDL_SetColorKey(plain, SDL_FALSE, 0);
+    _compareRLEBlits(rle, plain, 2, "with per-pixel alpha");
+
+    SDL_SetSurfaceAlphaMod(rle, 128);
+    SDL_SetSurfaceAlphaMod(plain, 128);
+    _compareRLEBlits(rle, plain, 2, "after changing the alpha mod");
+
+    SDL_SetSurfaceAlphaMod(rle, 255);
+    SDL_SetSurfaceAlphaMod(plain, 255);
+    SDL_SetSurfaceBlendMode(rle, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceBlendMode(plain, SDL_BLENDMODE_NONE);
+    SDL_SetColorKey(rle, SDL_TRUE, key1);
+    SDL_SetColorKey(plain, SDL_TRUE, key1);
+    _compareRLEBlits(rle, plain, 0, "after changing the blend mode back");
+
+    SDL_FreeSurface(rle);
+    SDL_FreeSurface(plain);
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Blits a palettized RLE surface while changing its palette, comparing with plain blits
+ *
+ * @sa http://wiki.libsdl.org/SDL_SetSurfaceRLE
+ * @sa http://wiki.libsdl.org/SDL_SetPaletteColors
+ */
+int surface_testRLEBlitPaletteChanges(void *arg)
+{
+    SDL_Surface *rle, *plain;
+    SDL_Color colors[256];
+    int i;
+
+    rle = SDL_CreateRGBSurfaceWithFormat(0, 97, 31, 8, SDL_PIXELFORMAT_INDEX8);
+    plain = SDL_CreateRGBSurfaceWithFormat(0, 97, 31, 8, SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertCheck(rle && plain, "Verify source surfaces were created");
+    if (!rle || !plain) {
+        SDL_FreeSurface(rle);
+        SDL_FreeSurface(plain);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < SDL_arraysize(colors); ++i) {
+        colors[i].r = SDLTest_RandomUint8();
+        colors[i].g = SDLTest_RandomUint8();
+        colors[i].b = SDLTest_RandomUint8();
+        colors[i].a = SDL_ALPHA_OPAQUE;
+    }
+    _fillRLETestSurface(rle, 7);
+    SDL_memcpy(plain->pixels, rle->pixels, (size_t)rle->h * rle->pitch);
+    SDL_SetPaletteColors(rle->format->palette, colors, 0, SDL_arraysize(colors));
+    SDL_SetPaletteColors(plain->format->palette, colors, 0, SDL_arraysize(colors));
+    SDL_SetColorKey(rle, SDL_TRUE, 7);
+    SDL_SetColorKey(plain, SDL_TRUE, 7);
+    SDL_SetSurfaceRLE(rle, 1);
+    _compareRLEBlits(rle, plain, 0, "with a palette");
+
+    for (i = 0; i < SDL_arraysize(colors); ++i) {
+        colors[i].r = (Uint8)(255 - colors[i].r);
+        colors[i].b = (Uint8)(colors[i].b / 2);
+    }
+    SDL_SetPaletteColors(rle->format->palette, colors, 0, SDL_arraysize(colors));
+    SDL_SetPaletteColors(plain->format->palette, colors, 0, SDL_arraysize(colors));
+    _compareRLEBlits(rle, plain, 0, "after changing the palette");
+
+    SDL_SetSurfaceAlphaMod(rle, 100);
+    SDL_SetSurfaceAlphaMod(plain, 100);
+    _compareRLEBlits(rle, plain, 2, "after changing the alpha mod");
+
+    SDL_FreeSurface(rle);
+    SDL_FreeSurface(plain);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -856,11 +1093,20 @@ static const SDLTest_TestCaseReference surfaceTestOverflow = {
     surface_testOverflow, "surface_testOverflow", "Test overflow detection.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestRLEState = {
+    surface_testRLEBlitStateChanges, "surface_testRLEBlitStateChanges", "Tests RLE blits to several formats across colorkey, alpha and blend mode changes.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestRLEPalette = {
+    surface_testRLEBlitPaletteChanges, "surface_testRLEBlitPaletteChanges", "Tests palettized RLE blits to several formats across palette changes.", TEST_ENABLED
+};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, &surfaceTestRLEState,
+    &surfaceTestRLEPalette, NULL
 };
 
 /* Surface test suite (global) */
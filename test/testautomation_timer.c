@@ -102,6 +102,29 @@ int timer_delayAndGetTicks(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * @brief Call to SDL_DelayNS
+ */
+int timer_delayNS(void *arg)
+{
+    const Uint64 testDelays[] = { 0, 1, 50000, 500000, 2500000, 20000000 };
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    Uint64 start, elapsed;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(testDelays); i++) {
+        start = SDL_GetPerformanceCounter();
+        SDL_DelayNS(testDelays[i]);
+        SDLTest_AssertPass("Call to SDL_DelayNS(%" SDL_PRIu64 ")", testDelays[i]);
+        elapsed = ((SDL_GetPerformanceCounter() - start) * 1000000000) / freq;
+
+        /* Never early; how late it is depends on the system, see testtimer */
+        SDLTest_AssertCheck(elapsed + (1000000000 / freq) >= testDelays[i], "Check elapsed time, expected: >=%" SDL_PRIu64 ", got: %" SDL_PRIu64, testDelays[i], elapsed);
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* Test callback */
 Uint32 SDLCALL _timerTestCallback(Uint32 interval, void *param)
 {
@@ -190,8 +213,12 @@ static const SDLTest_TestCaseReference timerTest4 = {
 };
 
 /* Sequence of Timer test cases */
+static const SDLTest_TestCaseReference timerTest5 = {
+    (SDLTest_TestCaseFp)timer_delayNS, "timer_delayNS", "Call to SDL_DelayNS", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference *timerTests[] = {
-    &timerTest1, &timerTest2, &timerTest3, &timerTest4, NULL
+    &timerTest1, &timerTest2, &timerTest3, &timerTest4, &timerTest5, NULL
 };
 
 /* Timer test suite (global) */
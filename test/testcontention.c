@@ -0,0 +1,246 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks mutexes, semaphores and condition variables under contention
+   and measures how fast they are, to compare the thread backends.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define NUM_THREADS    4
+#define NUM_LOCKS      200000
+#define NUM_PINGS      20000
+#define NUM_ITEMS      100000
+#define QUEUE_SIZE     16
+
+static SDL_mutex *mutex;
+static SDL_sem *ping;
+static SDL_sem *pong;
+static SDL_cond *not_empty;
+static SDL_cond *not_full;
+
+static int counter;
+static int queue[QUEUE_SIZE];
+static int queue_head;
+static int queue_count;
+
+static double SecondsSince(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+}
+
+static int SDLCALL LockThread(void *data)
+{
+    int i;
+
+    for (i = 0; i < NUM_LOCKS; ++i) {
+        SDL_LockMutex(mutex);
+        ++counter;
+        SDL_UnlockMutex(mutex);
+    }
+    return 0;
+}
+
+static int TestMutex(void)
+{
+    SDL_Thread *threads[NUM_THREADS];
+    Uint64 start;
+    double seconds;
+    int i;
+
+    counter = 0;
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < NUM_THREADS; ++i) {
+        threads[i] = SDL_CreateThread(LockThread, "LockThread", NULL);
+    }
+    for (i = 0; i < NUM_THREADS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    seconds = SecondsSince(start);
+
+    if (counter != NUM_THREADS * NUM_LOCKS) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Mutex let %d increments through, expected %d\n", counter, NUM_THREADS * NUM_LOCKS);
+        return 1;
+    }
+    SDL_Log("Contended mutex, %d threads: %8.2f ns per lock\n", NUM_THREADS, seconds * 1000000000.0 / (NUM_THREADS * NUM_LOCKS));
+    return 0;
+}
+
+static int SDLCALL PongThread(void *data)
+{
+    int i;
+
+    for (i = 0; i < NUM_PINGS; ++i) {
+        SDL_SemWait(ping);
+        SDL_SemPost(pong);
+    }
+    return 0;
+}
+
+static int TestSemaphore(void)
+{
+    SDL_Thread *thread;
+    Uint64 start;
+    double seconds;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    thread = SDL_CreateThread(PongThread, "PongThread", NULL);
+    for (i = 0; i < NUM_PINGS; ++i) {
+        SDL_SemPost(ping);
+        SDL_SemWait(pong);
+    }
+    SDL_WaitThread(thread, NULL);
+    seconds = SecondsSince(start);
+
+    if (SDL_SemValue(ping) != 0 || SDL_SemValue(pong) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Semaphores weren't drained\n");
+        return 1;
+    }
+    SDL_Log("Semaphore ping-pong:             %8.2f us per round trip\n", seconds * 1000000.0 / NUM_PINGS);
+    return 0;
+}
+
+static int SDLCALL ConsumerThread(void *data)
+{
+    Sint64 *sum = (Sint64 *)data;
+    int i;
+
+    for (i = 0; i < NUM_ITEMS / 2; ++i) {
+        SDL_LockMutex(mutex);
+        while (queue_count == 0) {
+            SDL_CondWait(not_empty, mutex);
+        }
+        *sum += queue[queue_head];
+        queue_head = (queue_head + 1) % QUEUE_SIZE;
+        --queue_count;
+        SDL_CondSignal(not_full);
+        SDL_UnlockMutex(mutex);
+    }
+    return 0;
+}
+
+static int TestCondition(void)
+{
+    SDL_Thread *threads[2];
+    Sint64 sums[2] = { 0, 0 };
+    Uint64 start;
+    double seconds;
+    int i;
+
+    queue_head = 0;
+    queue_count = 0;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < 2; ++i) {
+        threads[i] = SDL_CreateThread(ConsumerThread, "ConsumerThread", &sums[i]);
+    }
+    for (i = 1; i <= NUM_ITEMS; ++i) {
+        SDL_LockMutex(mutex);
+        while (queue_count == QUEUE_SIZE) {
+            SDL_CondWait(not_full, mutex);
+        }
+        queue[(queue_head + queue_count) % QUEUE_SIZE] = i;
+        ++queue_count;
+        SDL_CondSignal(not_empty);
+        SDL_UnlockMutex(mutex);
+    }
+    for (i = 0; i < 2; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    seconds = SecondsSince(start);
+
+    if (sums[0] + sums[1] != (Sint64)NUM_ITEMS * (NUM_ITEMS + 1) / 2) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Items were lost between producer and consumers\n");
+        return 1;
+    }
+    SDL_Log("Condition variable queue:        %8.2f ns per item\n", seconds * 1000000000.0 / NUM_ITEMS);
+    return 0;
+}
+
+static int TestTimeouts(void)
+{
+    Uint64 start;
+    double seconds;
+    int result;
+
+    start = SDL_GetPerformanceCounter();
+    result = SDL_SemWaitTimeout(ping, 50);
+    seconds = SecondsSince(start);
+    if (result != SDL_MUTEX_TIMEDOUT || seconds < 0.045) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Semaphore wait returned %d after %.3f seconds\n", result, seconds);
+        return 1;
+    }
+
+    SDL_LockMutex(mutex);
+    SDL_LockMutex(mutex);
+    start = SDL_GetPerformanceCounter();
+    result = SDL_CondWaitTimeout(not_empty, mutex, 50);
+    seconds = SecondsSince(start);
+    if (SDL_UnlockMutex(mutex) < 0 || SDL_UnlockMutex(mutex) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Mutex wasn't relocked recursively after waiting\n");
+        return 1;
+    }
+    if (result != SDL_MUTEX_TIMEDOUT || seconds < 0.045) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Condition wait returned %d after %.3f seconds\n", result, seconds);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int result;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        SDL_Log("Usage: %s\n", argv[0]);
+        return 1;
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    mutex = SDL_CreateMutex();
+    ping = SDL_CreateSemaphore(0);
+    pong = SDL_CreateSemaphore(0);
+    not_empty = SDL_CreateCond();
+    not_full = SDL_CreateCond();
+
+    SDL_Log("Running on %d CPUs\n", SDL_GetCPUCount());
+    result = TestMutex();
+    if (result == 0) {
+        result = TestSemaphore();
+    }
+    if (result == 0) {
+        result = TestCondition();
+    }
+    if (result == 0) {
+        result = TestTimeouts();
+    }
+
+    SDL_DestroyCond(not_full);
+    SDL_DestroyCond(not_empty);
+    SDL_DestroySemaphore(pong);
+    SDL_DestroySemaphore(ping);
+    SDL_DestroyMutex(mutex);
+
+    SDL_Quit();
+    return result;
+}
@@ -0,0 +1,125 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for game controller initialization and mapping database lookups */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+static double Elapsed(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+static void MakeGUIDString(int index, char *guid, size_t size)
+{
+    /* USB bus, a fake vendor and a product per entry */
+    (void)SDL_snprintf(guid, size, "03000000%02x%02x0000%02x%02x000000010000",
+                       0xf0 + ((index >> 16) & 0x0f), 0xfe,
+                       index & 0xff, (index >> 8) & 0xff);
+}
+
+/* Build a mapping file in the same format as the community database */
+static char *CreateMappingDatabase(int num_mappings, size_t *size)
+{
+    const size_t line_size = 256;
+    char *db = (char *)SDL_malloc(num_mappings * line_size + 1);
+    char *line = db;
+    int i;
+
+    if (!db) {
+        return NULL;
+    }
+    for (i = 0; i < num_mappings; ++i) {
+        char guid[33];
+
+        MakeGUIDString(i, guid, sizeof(guid));
+        line += SDL_snprintf(line, line_size, "%s,Benchmark Controller %d,a:b0,b:b1,back:b6,leftx:a0,lefty:a1,start:b7,x:b2,y:b3,platform:%s,\n",
+                             guid, i, SDL_GetPlatform());
+    }
+    *size = (size_t)(line - db);
+    return db;
+}
+
+int main(int argc, char *argv[])
+{
+    int num_mappings = 5000;
+    int iterations = 10;
+    char *db;
+    size_t db_size;
+    Uint64 start;
+    int i, added;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_mappings = SDL_atoi(argv[1]);
+        if (num_mappings <= 0) {
+            SDL_Log("Usage: %s [number of mappings]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    db = CreateMappingDatabase(num_mappings, &db_size);
+    if (!db) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_Quit();
+        return 1;
+    }
+
+    /* Startup with the built-in mappings */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        if (SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize game controllers: %s\n", SDL_GetError());
+            SDL_free(db);
+            SDL_Quit();
+            return 1;
+        }
+        SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER);
+    }
+    SDL_Log("SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER): %8.3f ms\n", Elapsed(start) / iterations);
+
+    /* Startup with a large mapping database */
+    SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER);
+    start = SDL_GetPerformanceCounter();
+    added = SDL_GameControllerAddMappingsFromRW(SDL_RWFromConstMem(db, (int)db_size), 1);
+    SDL_Log("Adding %d mappings: %8.3f ms\n", added, Elapsed(start));
+
+    /* Lookups, both hits and misses */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_mappings * 2; ++i) {
+        char guid[33];
+
+        MakeGUIDString(i, guid, sizeof(guid));
+        SDL_free(SDL_GameControllerMappingForGUID(SDL_JoystickGetGUIDFromString(guid)));
+    }
+    SDL_Log("SDL_GameControllerMappingForGUID(): %8.3f us\n", Elapsed(start) * 1000.0 / (num_mappings * 2));
+
+    start = SDL_GetPerformanceCounter();
+    i = SDL_GameControllerNumMappings();
+    SDL_Log("SDL_GameControllerNumMappings() = %d: %8.3f ms\n", i, Elapsed(start));
+
+    SDL_QuitSubSystem(SDL_INIT_GAMECONTROLLER);
+
+    SDL_free(db);
+    SDL_Quit();
+    return 0;
+}
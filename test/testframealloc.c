@@ -0,0 +1,193 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Counts the heap allocations made while rendering a frame with the software renderer */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define WIDTH         640
+#define HEIGHT        480
+#define NUM_RECTS     200
+#define NUM_POINTS    500
+#define NUM_LINES     100
+#define WARMUP_FRAMES 10
+#define NUM_FRAMES    100
+
+static SDL_malloc_func real_malloc;
+static SDL_calloc_func real_calloc;
+static SDL_realloc_func real_realloc;
+static SDL_free_func real_free;
+static SDL_atomic_t heap_calls;
+
+static void *SDLCALL counting_malloc(size_t size)
+{
+    SDL_AtomicIncRef(&heap_calls);
+    return real_malloc(size);
+}
+
+static void *SDLCALL counting_calloc(size_t nmemb, size_t size)
+{
+    SDL_AtomicIncRef(&heap_calls);
+    return real_calloc(nmemb, size);
+}
+
+static void *SDLCALL counting_realloc(void *mem, size_t size)
+{
+    SDL_AtomicIncRef(&heap_calls);
+    return real_realloc(mem, size);
+}
+
+static void DrawFrame(SDL_Renderer *renderer, SDL_Texture *texture, int frame)
+{
+    SDL_Rect rects[NUM_RECTS];
+    SDL_Point points[NUM_POINTS];
+    SDL_Point lines[NUM_LINES];
+    SDL_Vertex verts[3];
+    SDL_Rect dst;
+    int i;
+
+    for (i = 0; i < NUM_RECTS; ++i) {
+        rects[i].x = (i * 37 + frame) % WIDTH;
+        rects[i].y = (i * 53) % HEIGHT;
+        rects[i].w = 8 + i % 16;
+        rects[i].h = 8 + i % 12;
+    }
+    for (i = 0; i < NUM_POINTS; ++i) {
+        points[i].x = (i * 13 + frame) % WIDTH;
+        points[i].y = (i * 7) % HEIGHT;
+    }
+    for (i = 0; i < NUM_LINES; ++i) {
+        lines[i].x = (i * 71 + frame) % WIDTH;
+        lines[i].y = (i * 29) % HEIGHT;
+    }
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+
+    SDL_SetRenderDrawColor(renderer, 200, 100, 50, 255);
+    SDL_RenderFillRects(renderer, rects, NUM_RECTS);
+    SDL_RenderDrawPoints(renderer, points, NUM_POINTS);
+    SDL_RenderDrawLines(renderer, lines, NUM_LINES);
+
+    /* Scaled drawing goes through the rect and Bresenham paths */
+    SDL_RenderSetScale(renderer, 2.0f, 2.0f);
+    SDL_RenderDrawPoints(renderer, points, NUM_POINTS);
+    SDL_RenderDrawLines(renderer, lines, NUM_LINES);
+    SDL_RenderSetScale(renderer, 1.0f, 1.0f);
+
+    /* Blended triangles use an intermediate surface */
+    SDL_zeroa(verts);
+    verts[0].position.x = 10.0f;
+    verts[0].position.y = 10.0f;
+    verts[1].position.x = 300.0f;
+    verts[1].position.y = 40.0f;
+    verts[2].position.x = 150.0f;
+    verts[2].position.y = 250.0f;
+    for (i = 0; i < 3; ++i) {
+        verts[i].color.r = 255;
+        verts[i].color.g = (Uint8)(i * 100);
+        verts[i].color.b = 128;
+        verts[i].color.a = 128;
+    }
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(renderer, NULL, verts, 3, NULL, 0);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+
+    /* Rotated copies need scaled, masked and rotated temporaries */
+    dst.x = 200;
+    dst.y = 150;
+    dst.w = 96;
+    dst.h = 64;
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_RenderCopyEx(renderer, texture, NULL, &dst, frame * 3.0, NULL, SDL_FLIP_NONE);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+    SDL_RenderCopyEx(renderer, texture, NULL, &dst, frame * -5.0, NULL, SDL_FLIP_HORIZONTAL);
+
+    SDL_RenderPresent(renderer);
+}
+
+int main(int argc, char *argv[])
+{
+    SDL_Surface *target, *image;
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    Uint64 start;
+    double seconds;
+    int i, calls, before, after;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        SDL_Log("Usage: %s\n", argv[0]);
+        return 1;
+    }
+
+    SDL_GetMemoryFunctions(&real_malloc, &real_calloc, &real_realloc, &real_free);
+    SDL_SetMemoryFunctions(counting_malloc, counting_calloc, counting_realloc, real_free);
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    target = SDL_CreateRGBSurfaceWithFormat(0, WIDTH, HEIGHT, 0, SDL_PIXELFORMAT_ARGB8888);
+    image = SDL_CreateRGBSurfaceWithFormat(0, 48, 32, 0, SDL_PIXELFORMAT_RGB565);
+    if (!target || !image) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces: %s\n", SDL_GetError());
+        return 1;
+    }
+    SDL_FillRect(image, NULL, SDL_MapRGB(image->format, 50, 150, 250));
+
+    renderer = SDL_CreateSoftwareRenderer(target);
+    if (!renderer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create renderer: %s\n", SDL_GetError());
+        return 1;
+    }
+    texture = SDL_CreateTextureFromSurface(renderer, image);
+    if (!texture) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create texture: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    for (i = 0; i < WARMUP_FRAMES; ++i) {
+        DrawFrame(renderer, texture, i);
+    }
+
+    before = SDL_GetNumAllocations();
+    SDL_AtomicSet(&heap_calls, 0);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < NUM_FRAMES; ++i) {
+        DrawFrame(renderer, texture, WARMUP_FRAMES + i);
+    }
+    seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+    calls = SDL_AtomicGet(&heap_calls);
+    after = SDL_GetNumAllocations();
+
+    SDL_Log("%.1f heap allocations per frame, %.3f ms per frame\n",
+            (double)calls / NUM_FRAMES, seconds * 1000.0 / NUM_FRAMES);
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(image);
+    SDL_FreeSurface(target);
+    SDL_Quit();
+
+    if (after != before) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d allocations are still live after drawing\n", after - before);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Microbenchmark for hint lookups and the render paths that query hints */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+static double Elapsed(Uint64 start, int iterations)
+{
+    Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+    return (double)elapsed * 1000000000.0 / SDL_GetPerformanceFrequency() / iterations;
+}
+
+static void BenchmarkGetHint(int num_hints, int iterations)
+{
+    static int hints_set = 0;
+    const char *value = NULL;
+    Uint64 start;
+    int i;
+
+    /* Fill the hint store with unrelated hints */
+    for (; hints_set < num_hints; ++hints_set) {
+        char name[64];
+        (void)SDL_snprintf(name, sizeof(name), "SDL_TESTHINTS_FILLER_%d", hints_set);
+        SDL_SetHint(name, "1");
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        value = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+    }
+    SDL_Log("SDL_GetHint() with %4d hints set: %8.1f ns (%s)\n",
+            num_hints, Elapsed(start, iterations), value ? value : "NULL");
+}
+
+static void BenchmarkRenderer(int iterations)
+{
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, 256, 256, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Renderer *renderer = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+    Uint64 start;
+    int i;
+
+    if (!renderer) {
+        SDL_Log("Couldn't create software renderer: %s\n", SDL_GetError());
+        SDL_FreeSurface(surface);
+        return;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_DestroyTexture(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 1, 1));
+    }
+    SDL_Log("SDL_CreateTexture() + SDL_DestroyTexture(): %8.1f ns\n", Elapsed(start, iterations));
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_RenderDrawLine(renderer, 0, i & 0xff, 255, 255 - (i & 0xff));
+        if ((i & 0xff) == 0xff) {
+            SDL_RenderPresent(renderer);
+        }
+    }
+    SDL_Log("SDL_RenderDrawLine(): %8.1f ns\n", Elapsed(start, iterations));
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+}
+
+int main(int argc, char *argv[])
+{
+    int iterations = 1000000;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        iterations = SDL_atoi(argv[1]);
+        if (iterations <= 0) {
+            SDL_Log("Usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+
+    BenchmarkGetHint(0, iterations);
+    BenchmarkGetHint(16, iterations);
+    BenchmarkGetHint(256, iterations);
+
+    BenchmarkRenderer(iterations / 10);
+
+    SDL_Quit();
+    return 0;
+}
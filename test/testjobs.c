@@ -0,0 +1,223 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks the job system and measures how it scales with the number of workers */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define NESTED_JOBS   64
+#define NESTED_CHILDREN 64
+
+typedef struct
+{
+    double *values;
+    int work;
+} LoopData;
+
+static SDL_atomic_t counter;
+
+static double Compute(int item, int work)
+{
+    double value = (double)item;
+    int i;
+
+    for (i = 0; i < work; ++i) {
+        value = SDL_sqrt(value + (double)i);
+    }
+    return value;
+}
+
+static void SDLCALL LoopFunction(void *data, int start, int end)
+{
+    LoopData *loop = (LoopData *)data;
+    int i;
+
+    for (i = start; i < end; ++i) {
+        loop->values[i] = Compute(i, loop->work);
+    }
+}
+
+static void SDLCALL CountJob(void *data)
+{
+    SDL_AtomicIncRef(&counter);
+}
+
+static void SDLCALL NestedJob(void *data)
+{
+    SDL_JobGroup *group = SDL_CreateJobGroup();
+    int i;
+
+    for (i = 0; i < NESTED_CHILDREN; ++i) {
+        SDL_SubmitJob(group, CountJob, NULL);
+    }
+    SDL_DestroyJobGroup(group);
+}
+
+static int CheckJobs(void)
+{
+    LoopData loop;
+    SDL_JobGroup *group;
+    int count = 100000, grains[] = { 0, 1, 7, 100000, 1000000 };
+    int i, j;
+
+    loop.values = (double *)SDL_malloc(count * sizeof(double));
+    if (!loop.values) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        return 1;
+    }
+    loop.work = 4;
+
+    for (i = 0; i < SDL_arraysize(grains); ++i) {
+        for (j = 0; j < count; ++j) {
+            loop.values[j] = -1.0;
+        }
+        if (SDL_ParallelFor(count, grains[i], LoopFunction, &loop) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ParallelFor() failed: %s\n", SDL_GetError());
+            SDL_free(loop.values);
+            return 1;
+        }
+        for (j = 0; j < count; ++j) {
+            if (loop.values[j] != Compute(j, loop.work)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ParallelFor() with grain %d missed item %d\n", grains[i], j);
+                SDL_free(loop.values);
+                return 1;
+            }
+        }
+    }
+    SDL_free(loop.values);
+
+    /* More jobs than fit in a queue, some of them queueing and waiting on jobs of their own */
+    SDL_AtomicSet(&counter, 0);
+    group = SDL_CreateJobGroup();
+    if (!group) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateJobGroup() failed: %s\n", SDL_GetError());
+        return 1;
+    }
+    for (i = 0; i < 5000; ++i) {
+        SDL_SubmitJob(group, CountJob, NULL);
+    }
+    for (i = 0; i < NESTED_JOBS; ++i) {
+        SDL_SubmitJob(group, NestedJob, NULL);
+    }
+    SDL_DestroyJobGroup(group);
+
+    if (SDL_AtomicGet(&counter) != 5000 + NESTED_JOBS * NESTED_CHILDREN) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Ran %d jobs, expected %d\n", SDL_AtomicGet(&counter), 5000 + NESTED_JOBS * NESTED_CHILDREN);
+        return 1;
+    }
+    return 0;
+}
+
+static void SDLCALL SlowJob(void *data)
+{
+    SDL_Delay(1);
+    SDL_AtomicIncRef(&counter);
+}
+
+/* Quits SDL with jobs still queued, which must run them all */
+static int CheckQuitWithPendingJobs(void)
+{
+    SDL_JobGroup *group;
+    int i;
+
+    SDL_AtomicSet(&counter, 0);
+    group = SDL_CreateJobGroup();
+    if (!group) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateJobGroup() failed: %s\n", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+    for (i = 0; i < 200; ++i) {
+        SDL_SubmitJob(group, SlowJob, NULL);
+    }
+    for (i = 0; i < NESTED_JOBS; ++i) {
+        SDL_SubmitJob(group, NestedJob, NULL);
+    }
+    SDL_Quit();
+
+    /* This returns right away if SDL_Quit() completed the group */
+    SDL_WaitJobGroup(group);
+    SDL_DestroyJobGroup(group);
+
+    if (SDL_AtomicGet(&counter) != 200 + NESTED_JOBS * NESTED_CHILDREN) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Quit() ran %d jobs, expected %d\n", SDL_AtomicGet(&counter), 200 + NESTED_JOBS * NESTED_CHILDREN);
+        return 1;
+    }
+    return 0;
+}
+
+static void Benchmark(int count, int work)
+{
+    LoopData loop;
+    Uint64 start;
+    double seconds;
+
+    loop.values = (double *)SDL_malloc(count * sizeof(double));
+    if (!loop.values) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        return;
+    }
+    loop.work = work;
+
+    start = SDL_GetPerformanceCounter();
+    SDL_ParallelFor(count, 0, LoopFunction, &loop);
+    seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+
+    SDL_Log("%3d workers, %7d items x %3d: %8.2f ms, %10.0f items/s\n",
+            SDL_GetNumJobWorkers(), count, work, seconds * 1000.0, count / seconds);
+
+    SDL_free(loop.values);
+}
+
+int main(int argc, char *argv[])
+{
+    int max_workers, workers, count = 200000;
+    char hint[16];
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        count = SDL_atoi(argv[1]);
+        if (count <= 0) {
+            SDL_Log("Usage: %s [items]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    max_workers = SDL_max(SDL_GetCPUCount(), 2);
+    for (workers = 0; workers <= max_workers; workers = workers ? workers * 2 : 1) {
+        if (SDL_Init(0) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+            return 1;
+        }
+
+        /* The job system reads this when it starts, and SDL_Quit() stops it */
+        (void)SDL_snprintf(hint, sizeof(hint), "%d", workers);
+        SDL_SetHint(SDL_HINT_JOB_WORKERS, hint);
+
+        if (CheckJobs() != 0) {
+            SDL_Quit();
+            return 1;
+        }
+        Benchmark(count, 10);
+        Benchmark(count / 100, 1000);
+
+        if (CheckQuitWithPendingJobs() != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,204 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks the lock statistics and measures what they cost */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define NUM_THREADS 4
+#define NUM_LOCKS   50
+
+static SDL_mutex *mutex;
+static SDL_SpinLock spinlock;
+static SDL_sem *sem;
+
+static int SDLCALL LockThread(void *data)
+{
+    int i;
+
+    for (i = 0; i < NUM_LOCKS; ++i) {
+        SDL_LockMutex(mutex);
+        SDL_Delay(1);
+        SDL_UnlockMutex(mutex);
+
+        SDL_AtomicLock(&spinlock);
+        SDL_AtomicUnlock(&spinlock);
+    }
+    return 0;
+}
+
+static int SDLCALL PostThread(void *data)
+{
+    SDL_Delay(20);
+    SDL_SemPost(sem);
+    return 0;
+}
+
+static SDL_bool IsWaitLockType(SDL_LockType type)
+{
+    return (type == SDL_LOCKTYPE_SEMAPHORE || type == SDL_LOCKTYPE_CONDITION) ? SDL_TRUE : SDL_FALSE;
+}
+
+static const SDL_LockStats *FindLockStats(const SDL_LockStats *stats, int count, const char *name)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        if (SDL_strcmp(stats[i].name, name) == 0) {
+            return &stats[i];
+        }
+    }
+    return NULL;
+}
+
+static int CheckLockStats(void)
+{
+    SDL_Thread *threads[NUM_THREADS];
+    SDL_LockStats stats[64];
+    const SDL_LockStats *entry;
+    SDL_Event event;
+    int i, count;
+
+    mutex = SDL_CreateMutex();
+    sem = SDL_CreateSemaphore(0);
+    SDL_SetLockName(mutex, "testlockstats mutex");
+    SDL_SetLockName(&spinlock, "testlockstats spinlock");
+    SDL_SetLockName(sem, "testlockstats semaphore");
+
+    for (i = 0; i < NUM_THREADS; ++i) {
+        threads[i] = SDL_CreateThread(LockThread, "LockThread", NULL);
+    }
+    for (i = 0; i < NUM_THREADS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+
+    /* A long wait for a signal, which isn't contention */
+    threads[0] = SDL_CreateThread(PostThread, "PostThread", NULL);
+    SDL_SemWait(sem);
+    SDL_WaitThread(threads[0], NULL);
+
+    /* Make some use of the event queue as well */
+    SDL_zero(event);
+    event.type = SDL_USEREVENT;
+    for (i = 0; i < 10; ++i) {
+        SDL_PushEvent(&event);
+    }
+    while (SDL_PollEvent(&event)) {
+    }
+
+    count = SDL_GetLockStats(stats, SDL_arraysize(stats));
+    SDL_LogLockStats(10);
+
+    for (i = 1; i < count; ++i) {
+        if (IsWaitLockType(stats[i - 1].type) && !IsWaitLockType(stats[i].type)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Semaphore and condition variable waits aren't listed last\n");
+            return 1;
+        }
+        if (IsWaitLockType(stats[i - 1].type) == IsWaitLockType(stats[i].type) &&
+            stats[i].wait_ns > stats[i - 1].wait_ns) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Lock statistics aren't sorted by wait time\n");
+            return 1;
+        }
+    }
+
+    entry = FindLockStats(stats, count, "testlockstats mutex");
+    if (!entry || entry->type != SDL_LOCKTYPE_MUTEX || entry->acquisitions != NUM_THREADS * NUM_LOCKS) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Mutex acquisitions weren't counted\n");
+        return 1;
+    }
+    if (entry->contended == 0 || entry->wait_ns == 0 || entry->max_wait_ns > entry->wait_ns || !entry->holder[0]) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Mutex contention wasn't counted\n");
+        return 1;
+    }
+
+    entry = FindLockStats(stats, count, "testlockstats spinlock");
+    if (!entry || entry->type != SDL_LOCKTYPE_SPINLOCK || entry->acquisitions != NUM_THREADS * NUM_LOCKS) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Spinlock acquisitions weren't counted\n");
+        return 1;
+    }
+
+    entry = FindLockStats(stats, count, "testlockstats semaphore");
+    if (!entry || entry->type != SDL_LOCKTYPE_SEMAPHORE || entry->contended != 1 || entry->holder[0]) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Semaphore wait wasn't counted as a wait\n");
+        return 1;
+    }
+
+    if (!FindLockStats(stats, count, "SDL_EventQ.lock")) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The event queue lock wasn't named\n");
+        return 1;
+    }
+
+    SDL_ResetLockStats();
+    count = SDL_GetLockStats(stats, SDL_arraysize(stats));
+    if (FindLockStats(stats, count, "testlockstats mutex")) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Lock statistics weren't reset\n");
+        return 1;
+    }
+
+    SDL_DestroySemaphore(sem);
+    SDL_DestroyMutex(mutex);
+    return 0;
+}
+
+static void Benchmark(const char *enabled, int iterations)
+{
+    Uint64 start;
+    double seconds;
+    int i;
+
+    SDL_SetHint(SDL_HINT_LOCK_STATS, enabled);
+    mutex = SDL_CreateMutex();
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_LockMutex(mutex);
+        SDL_UnlockMutex(mutex);
+    }
+    seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+
+    SDL_Log("Uncontended lock and unlock with statistics %s: %6.2f ns\n",
+            SDL_GetHintBoolean(SDL_HINT_LOCK_STATS, SDL_FALSE) ? "on " : "off",
+            seconds * 1000000000.0 / iterations);
+
+    SDL_DestroyMutex(mutex);
+}
+
+int main(int argc, char *argv[])
+{
+    int result;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        SDL_Log("Usage: %s\n", argv[0]);
+        return 1;
+    }
+
+    SDL_SetHint(SDL_HINT_LOCK_STATS, "1");
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    result = CheckLockStats();
+    if (result == 0) {
+        Benchmark("0", 1000000);
+        Benchmark("1", 1000000);
+    }
+
+    SDL_Quit();
+    return result;
+}
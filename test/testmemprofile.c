@@ -0,0 +1,175 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks the heap profiler and measures what it costs */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define NUM_BLOCKS 1000
+#define BLOCK_SIZE 100
+#define NUM_EVENTS 5000
+
+static int CheckMemoryStats(void)
+{
+    SDL_MemoryStats stats[SDL_NUM_MEMORY_TAGS];
+    SDL_Surface *surface;
+    SDL_Renderer *renderer;
+    SDL_AudioStream *stream;
+    SDL_Event event;
+    void *blocks[NUM_BLOCKS];
+    Uint64 app_bytes;
+    int i;
+
+    if (SDL_GetMemoryStats(NULL, 0) != SDL_NUM_MEMORY_TAGS) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Wrong number of memory tags\n");
+        return 1;
+    }
+
+    for (i = 0; i < NUM_BLOCKS; ++i) {
+        blocks[i] = SDL_malloc(BLOCK_SIZE);
+    }
+    blocks[0] = SDL_realloc(blocks[0], 2 * BLOCK_SIZE);
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 256, 256, 0, SDL_PIXELFORMAT_ARGB8888);
+    renderer = SDL_CreateSoftwareRenderer(surface);
+    stream = SDL_NewAudioStream(AUDIO_S16, 2, 22050, AUDIO_F32, 2, 48000);
+    if (!surface || !renderer || !stream) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create test objects: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_zero(event);
+    event.type = SDL_USEREVENT;
+    for (i = 0; i < NUM_EVENTS; ++i) {
+        SDL_PushEvent(&event);
+    }
+    while (SDL_PollEvent(&event)) {
+    }
+
+    SDL_GetMemoryStats(stats, SDL_arraysize(stats));
+    SDL_LogMemoryStats();
+
+    for (i = 0; i < SDL_NUM_MEMORY_TAGS; ++i) {
+        if (stats[i].tag != (SDL_MemoryTag)i || !stats[i].name || stats[i].peak_bytes < stats[i].live_bytes) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Bad statistics for memory tag %d\n", i);
+            return 1;
+        }
+    }
+
+    app_bytes = (NUM_BLOCKS + 1) * BLOCK_SIZE;
+    if (stats[SDL_MEMORY_TAG_APPLICATION].live_bytes != app_bytes ||
+        stats[SDL_MEMORY_TAG_APPLICATION].live_allocations != NUM_BLOCKS ||
+        stats[SDL_MEMORY_TAG_APPLICATION].allocations != NUM_BLOCKS + 1) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Application allocations weren't counted: %" SDL_PRIu64 " bytes in %" SDL_PRIu64 " blocks\n",
+                     stats[SDL_MEMORY_TAG_APPLICATION].live_bytes, stats[SDL_MEMORY_TAG_APPLICATION].live_allocations);
+        return 1;
+    }
+    if (stats[SDL_MEMORY_TAG_VIDEO].live_bytes < 256 * 256 * 4) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The surface wasn't charged to video\n");
+        return 1;
+    }
+    if (stats[SDL_MEMORY_TAG_RENDER].live_bytes == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The renderer wasn't charged to render\n");
+        return 1;
+    }
+    if (stats[SDL_MEMORY_TAG_AUDIO].live_bytes == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The audio stream wasn't charged to audio\n");
+        return 1;
+    }
+    if (stats[SDL_MEMORY_TAG_EVENTS].allocations == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The event queue wasn't charged to events\n");
+        return 1;
+    }
+
+    for (i = 0; i < NUM_BLOCKS; ++i) {
+        SDL_free(blocks[i]);
+    }
+    SDL_FreeAudioStream(stream);
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+
+    /* The allocation rate is measured over a second */
+    SDL_Delay(1100);
+
+    SDL_GetMemoryStats(stats, SDL_arraysize(stats));
+    if (stats[SDL_MEMORY_TAG_APPLICATION].live_bytes != 0 ||
+        stats[SDL_MEMORY_TAG_APPLICATION].peak_bytes != app_bytes) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Application frees weren't counted\n");
+        return 1;
+    }
+    if (stats[SDL_MEMORY_TAG_AUDIO].live_bytes != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The audio stream wasn't freed\n");
+        return 1;
+    }
+    if (stats[SDL_MEMORY_TAG_APPLICATION].allocations_per_second <= 0.0f) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The allocation rate wasn't measured\n");
+        return 1;
+    }
+
+    SDL_ResetMemoryStats();
+    SDL_GetMemoryStats(stats, SDL_arraysize(stats));
+    if (stats[SDL_MEMORY_TAG_APPLICATION].peak_bytes != 0 || stats[SDL_MEMORY_TAG_APPLICATION].allocations != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Memory statistics weren't reset\n");
+        return 1;
+    }
+    return 0;
+}
+
+static void Benchmark(const char *enabled, int iterations)
+{
+    Uint64 start;
+    double seconds;
+    int i;
+
+    SDL_SetHint(SDL_HINT_MEMORY_PROFILE, enabled);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_free(SDL_malloc(BLOCK_SIZE));
+    }
+    seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+
+    SDL_Log("SDL_malloc and SDL_free with profiling %s: %6.2f ns\n",
+            SDL_GetHintBoolean(SDL_HINT_MEMORY_PROFILE, SDL_FALSE) ? "on " : "off",
+            seconds * 1000000000.0 / iterations);
+}
+
+int main(int argc, char *argv[])
+{
+    int result;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        SDL_Log("Usage: %s\n", argv[0]);
+        return 1;
+    }
+
+    SDL_SetHint(SDL_HINT_MEMORY_PROFILE, "1");
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    result = CheckMemoryStats();
+    if (result == 0) {
+        Benchmark("0", 1000000);
+        Benchmark("1", 1000000);
+    }
+
+    SDL_Quit();
+    return result;
+}
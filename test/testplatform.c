@@ -413,6 +413,81 @@ int TestCPUInfo(SDL_bool verbose)
     return 0;
 }
 
+int TestCPUTopology(SDL_bool verbose)
+{
+    static const char *core_types[] = { "", " performance", " efficiency" };
+    SDL_CPUTopology topology;
+    SDL_LogicalCPU *cpus;
+    int i, num_cpus;
+
+    if (SDL_GetCPUTopology(&topology) < 0) {
+        if (verbose) {
+            SDL_Log("SDL_GetCPUTopology() failed: %s\n", SDL_GetError());
+        }
+        return 1;
+    }
+    num_cpus = SDL_GetLogicalCPUs(NULL, 0);
+    if (num_cpus != topology.num_cpus || topology.num_cores < 1 || topology.num_cores > num_cpus ||
+        topology.num_packages < 1 || topology.num_numa_nodes < 1) {
+        if (verbose) {
+            SDL_Log("CPU topology is inconsistent\n");
+        }
+        return 1;
+    }
+
+    cpus = (SDL_LogicalCPU *)SDL_malloc(num_cpus * sizeof(*cpus));
+    if (!cpus) {
+        return 1;
+    }
+    SDL_GetLogicalCPUs(cpus, num_cpus);
+
+    if (verbose) {
+        SDL_Log("CPU topology: %d CPUs, %d cores, %d packages, %d NUMA nodes\n",
+                topology.num_cpus, topology.num_cores, topology.num_packages, topology.num_numa_nodes);
+        SDL_Log("CPU caches: L1d %d KB, L2 %d KB, L3 %d KB\n",
+                topology.l1d_cache_size / 1024, topology.l2_cache_size / 1024, topology.l3_cache_size / 1024);
+        for (i = 0; i < num_cpus; ++i) {
+            SDL_Log("CPU %d: core %d, package %d, NUMA node %d%s\n", cpus[i].id, cpus[i].core,
+                    cpus[i].package, cpus[i].numa_node, core_types[cpus[i].core_type]);
+        }
+    }
+    for (i = 0; i < num_cpus; ++i) {
+        if (cpus[i].core >= topology.num_cores || cpus[i].package >= topology.num_packages ||
+            cpus[i].numa_node >= topology.num_numa_nodes) {
+            if (verbose) {
+                SDL_Log("CPU %d is outside the topology\n", cpus[i].id);
+            }
+            SDL_free(cpus);
+            return 1;
+        }
+    }
+
+    /* Pin this thread to the last CPU and then let it go again */
+    if (SDL_GetThreadAffinity(NULL, 0) < 0) {
+        if (verbose) {
+            SDL_Log("Thread affinity isn't supported: %s\n", SDL_GetError());
+        }
+    } else {
+        int cpu = -1;
+
+        if (SDL_SetThreadAffinity(&cpus[num_cpus - 1].id, 1) < 0 ||
+            SDL_GetThreadAffinity(&cpu, 1) != 1 || cpu != cpus[num_cpus - 1].id ||
+            SDL_SetThreadAffinity(NULL, 0) < 0 || SDL_GetThreadAffinity(NULL, 0) < 1) {
+            if (verbose) {
+                SDL_Log("Thread affinity wasn't set: %s\n", SDL_GetError());
+            }
+            SDL_free(cpus);
+            return 1;
+        }
+        if (verbose) {
+            SDL_Log("Thread affinity can be set\n");
+        }
+    }
+
+    SDL_free(cpus);
+    return 0;
+}
+
 int TestAssertions(SDL_bool verbose)
 {
     SDL_assert(1);
@@ -460,6 +535,7 @@ int main(int argc, char *argv[])
     status += TestEndian(verbose);
     status += Test64Bit(verbose);
     status += TestCPUInfo(verbose);
+    status += TestCPUTopology(verbose);
     status += TestAssertions(verbose);
 
     return status;
@@ -0,0 +1,191 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple benchmark comparing RLE accelerated blits against plain
+   colorkey and alpha blits
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define SPRITE_SIZE 128
+#define TARGET_SIZE 512
+
+/* Build a sprite with a mix of transparent, opaque and translucent runs */
+static SDL_Surface *CreateSprite(Uint32 format, SDL_bool alpha)
+{
+    SDL_Surface *sprite;
+    int x, y;
+
+    sprite = SDL_CreateRGBSurfaceWithFormat(0, SPRITE_SIZE, SPRITE_SIZE, 32, format);
+    if (!sprite) {
+        return NULL;
+    }
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)sprite->pixels + y * sprite->pitch);
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            int dx = x - SPRITE_SIZE / 2;
+            int dy = y - SPRITE_SIZE / 2;
+            int d2 = dx * dx + dy * dy;
+            Uint8 a;
+
+            if (d2 > (SPRITE_SIZE / 2) * (SPRITE_SIZE / 2)) {
+                a = 0;
+            } else if (alpha && d2 > (SPRITE_SIZE / 3) * (SPRITE_SIZE / 3)) {
+                a = 128;
+            } else {
+                a = 255;
+            }
+            if (!alpha && a == 0) {
+                row[x] = SDL_MapRGBA(sprite->format, 255, 0, 255, 255);
+            } else {
+                row[x] = SDL_MapRGBA(sprite->format, (Uint8)(x * 2), (Uint8)(y * 2), (Uint8)(x + y), a);
+            }
+        }
+    }
+    if (alpha) {
+        SDL_SetSurfaceBlendMode(sprite, SDL_BLENDMODE_BLEND);
+    } else {
+        SDL_SetColorKey(sprite, SDL_TRUE, SDL_MapRGB(sprite->format, 255, 0, 255));
+    }
+    return sprite;
+}
+
+static double RunBlits(SDL_Surface *sprite, SDL_Surface *target, int iterations)
+{
+    Uint64 start, elapsed;
+    SDL_Rect dst;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        /* Walk across the target, including partially clipped positions */
+        dst.x = (i * 37) % (TARGET_SIZE + SPRITE_SIZE) - SPRITE_SIZE / 2;
+        dst.y = (i * 53) % (TARGET_SIZE + SPRITE_SIZE) - SPRITE_SIZE / 2;
+        dst.w = SPRITE_SIZE;
+        dst.h = SPRITE_SIZE;
+        SDL_BlitSurface(sprite, NULL, target, &dst);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    return (double)elapsed * 1000000.0 / SDL_GetPerformanceFrequency() / iterations;
+}
+
+static void Benchmark(const char *name, SDL_bool alpha, Uint32 target_format, int iterations)
+{
+    SDL_Surface *sprite = CreateSprite(SDL_PIXELFORMAT_ARGB8888, alpha);
+    SDL_Surface *target = SDL_CreateRGBSurfaceWithFormat(0, TARGET_SIZE, TARGET_SIZE, 32, target_format);
+    double plain, rle;
+
+    if (!sprite || !target) {
+        SDL_Log("Couldn't create surfaces: %s\n", SDL_GetError());
+        SDL_FreeSurface(sprite);
+        SDL_FreeSurface(target);
+        return;
+    }
+
+    SDL_SetSurfaceRLE(sprite, 0);
+    plain = RunBlits(sprite, target, iterations);
+
+    SDL_SetSurfaceRLE(sprite, 1);
+    RunBlits(sprite, target, 1); /* encode outside the timed loop */
+    rle = RunBlits(sprite, target, iterations);
+
+    SDL_Log("%-10s -> %-24s plain: %8.2f us  RLE: %8.2f us  (%.2fx)\n",
+            name, SDL_GetPixelFormatName(target_format), plain, rle, plain / rle);
+
+    SDL_FreeSurface(sprite);
+    SDL_FreeSurface(target);
+}
+
+/* Alternate between two targets, which is what the RLE encoding cache is for */
+static double RunAlternatingBlits(SDL_Surface *sprite, SDL_Surface *targets[2], int iterations)
+{
+    Uint64 start, elapsed;
+    SDL_Rect dst;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        dst.x = (i * 37) % (TARGET_SIZE + SPRITE_SIZE) - SPRITE_SIZE / 2;
+        dst.y = (i * 53) % (TARGET_SIZE + SPRITE_SIZE) - SPRITE_SIZE / 2;
+        dst.w = SPRITE_SIZE;
+        dst.h = SPRITE_SIZE;
+        SDL_BlitSurface(sprite, NULL, targets[i & 1], &dst);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    return (double)elapsed * 1000000.0 / SDL_GetPerformanceFrequency() / iterations;
+}
+
+static void BenchmarkAlternating(const char *name, SDL_bool alpha, Uint32 format1, Uint32 format2, int iterations)
+{
+    SDL_Surface *sprite = CreateSprite(SDL_PIXELFORMAT_ARGB8888, alpha);
+    SDL_Surface *targets[2];
+    double plain, rle;
+
+    targets[0] = SDL_CreateRGBSurfaceWithFormat(0, TARGET_SIZE, TARGET_SIZE, 32, format1);
+    targets[1] = SDL_CreateRGBSurfaceWithFormat(0, TARGET_SIZE, TARGET_SIZE, 32, format2);
+    if (!sprite || !targets[0] || !targets[1]) {
+        SDL_Log("Couldn't create surfaces: %s\n", SDL_GetError());
+        SDL_FreeSurface(sprite);
+        SDL_FreeSurface(targets[0]);
+        SDL_FreeSurface(targets[1]);
+        return;
+    }
+
+    SDL_SetSurfaceRLE(sprite, 0);
+    plain = RunAlternatingBlits(sprite, targets, iterations);
+
+    SDL_SetSurfaceRLE(sprite, 1);
+    RunAlternatingBlits(sprite, targets, 2); /* encode for both targets outside the timed loop */
+    rle = RunAlternatingBlits(sprite, targets, iterations);
+
+    SDL_Log("%-10s -> %s / %s  plain: %8.2f us  RLE: %8.2f us  (%.2fx)\n",
+            name, SDL_GetPixelFormatName(format1), SDL_GetPixelFormatName(format2), plain, rle, plain / rle);
+
+    SDL_FreeSurface(sprite);
+    SDL_FreeSurface(targets[0]);
+    SDL_FreeSurface(targets[1]);
+}
+
+int main(int argc, char *argv[])
+{
+    int iterations = 10000;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        iterations = SDL_atoi(argv[1]);
+        if (iterations <= 0) {
+            SDL_Log("Usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    Benchmark("colorkey", SDL_FALSE, SDL_PIXELFORMAT_ARGB8888, iterations);
+    Benchmark("colorkey", SDL_FALSE, SDL_PIXELFORMAT_RGB565, iterations);
+    Benchmark("alpha", SDL_TRUE, SDL_PIXELFORMAT_ARGB8888, iterations);
+    Benchmark("alpha", SDL_TRUE, SDL_PIXELFORMAT_XRGB8888, iterations);
+    Benchmark("alpha", SDL_TRUE, SDL_PIXELFORMAT_RGB565, iterations);
+    BenchmarkAlternating("colorkey", SDL_FALSE, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, iterations);
+    BenchmarkAlternating("alpha", SDL_TRUE, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, iterations);
+
+    SDL_Quit();
+    return 0;
+}
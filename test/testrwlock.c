@@ -0,0 +1,202 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks the read/write lock and compares it with a mutex under read-heavy contention */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define TABLE_SIZE  64
+#define MAX_THREADS 16
+
+typedef enum
+{
+    LOCK_MUTEX,
+    LOCK_RWLOCK
+} LockType;
+
+/* The writer keeps every entry of the table equal, so readers can spot torn updates */
+static int table[TABLE_SIZE];
+static LockType lock_type;
+static SDL_mutex *mutex;
+static SDL_RWLock *rwlock;
+static SDL_atomic_t stop;
+static SDL_atomic_t errors;
+static int iterations;
+
+static void LockShared(void)
+{
+    if (lock_type == LOCK_MUTEX) {
+        SDL_LockMutex(mutex);
+    } else {
+        SDL_LockRWLockForReading(rwlock);
+    }
+}
+
+static void LockExclusive(void)
+{
+    if (lock_type == LOCK_MUTEX) {
+        SDL_LockMutex(mutex);
+    } else {
+        SDL_LockRWLockForWriting(rwlock);
+    }
+}
+
+static void Unlock(void)
+{
+    if (lock_type == LOCK_MUTEX) {
+        SDL_UnlockMutex(mutex);
+    } else {
+        SDL_UnlockRWLock(rwlock);
+    }
+}
+
+static int SDLCALL ReaderThread(void *data)
+{
+    int i, j, sum;
+
+    for (i = 0; i < iterations; ++i) {
+        LockShared();
+        sum = 0;
+        for (j = 0; j < TABLE_SIZE; ++j) {
+            sum += table[j];
+        }
+        if (sum != table[0] * TABLE_SIZE) {
+            SDL_AtomicIncRef(&errors);
+        }
+        Unlock();
+    }
+    return 0;
+}
+
+static int SDLCALL WriterThread(void *data)
+{
+    int j;
+
+    while (!SDL_AtomicGet(&stop)) {
+        LockExclusive();
+        for (j = 0; j < TABLE_SIZE; ++j) {
+            ++table[j];
+        }
+        Unlock();
+        SDL_Delay(1);
+    }
+    return 0;
+}
+
+static int CheckTryLock(void)
+{
+    if (SDL_TryLockRWLockForReading(rwlock) != 0 ||
+        SDL_TryLockRWLockForReading(rwlock) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't share the lock between readers\n");
+        return 1;
+    }
+    if (SDL_TryLockRWLockForWriting(rwlock) != SDL_MUTEX_TIMEDOUT) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Locked for writing while locked for reading\n");
+        return 1;
+    }
+    SDL_UnlockRWLock(rwlock);
+    SDL_UnlockRWLock(rwlock);
+
+    if (SDL_TryLockRWLockForWriting(rwlock) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't lock an unlocked lock for writing\n");
+        return 1;
+    }
+    if (SDL_TryLockRWLockForReading(rwlock) != SDL_MUTEX_TIMEDOUT) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Locked for reading while locked for writing\n");
+        return 1;
+    }
+    SDL_UnlockRWLock(rwlock);
+    return 0;
+}
+
+static int Benchmark(LockType type, int num_readers)
+{
+    SDL_Thread *readers[MAX_THREADS];
+    SDL_Thread *writer;
+    Uint64 start;
+    double seconds;
+    int i;
+
+    lock_type = type;
+    SDL_AtomicSet(&stop, 0);
+    SDL_AtomicSet(&errors, 0);
+
+    writer = SDL_CreateThread(WriterThread, "Writer", NULL);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_readers; ++i) {
+        readers[i] = SDL_CreateThread(ReaderThread, "Reader", NULL);
+    }
+    for (i = 0; i < num_readers; ++i) {
+        SDL_WaitThread(readers[i], NULL);
+    }
+    seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+    SDL_AtomicSet(&stop, 1);
+    SDL_WaitThread(writer, NULL);
+
+    SDL_Log("%-6s %2d readers: %8.2f ms, %12.0f reads/s\n",
+            type == LOCK_MUTEX ? "mutex" : "rwlock", num_readers,
+            seconds * 1000.0, (double)iterations * num_readers / seconds);
+
+    if (SDL_AtomicGet(&errors) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d reads saw a partially written table\n", SDL_AtomicGet(&errors));
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    int num_readers, max_readers, result = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    iterations = 100000;
+    if (argc > 1) {
+        iterations = SDL_atoi(argv[1]);
+        if (iterations <= 0) {
+            SDL_Log("Usage: %s [iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    mutex = SDL_CreateMutex();
+    rwlock = SDL_CreateRWLock();
+    if (!mutex || !rwlock) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create locks: %s\n", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+
+    result = CheckTryLock();
+
+    max_readers = SDL_clamp(SDL_GetCPUCount() * 2, 2, MAX_THREADS);
+    for (num_readers = 1; result == 0 && num_readers <= max_readers; num_readers *= 2) {
+        result = Benchmark(LOCK_MUTEX, num_readers);
+        if (result == 0) {
+            result = Benchmark(LOCK_RWLOCK, num_readers);
+        }
+    }
+
+    SDL_DestroyRWLock(rwlock);
+    SDL_DestroyMutex(mutex);
+    SDL_Quit();
+    return result;
+}
@@ -66,6 +66,121 @@ callback(Uint32 interval, void *param)
     return interval;
 }
 
+typedef struct
+{
+    Uint64 interval;
+    Uint64 start;
+    Uint64 last;
+    Uint64 last_deadline;
+    int count;
+    int target;
+    int skipped;
+    Uint64 late_sum;
+    Uint64 late_max;
+    Uint64 jitter_sum;
+    Uint64 jitter_max;
+    SDL_atomic_t done;
+} PeriodicStats;
+
+static Uint64 CounterToNS(Uint64 counter)
+{
+    return (Uint64)((double)counter * 1000000000.0 / SDL_GetPerformanceFrequency());
+}
+
+static Uint64 SDLCALL
+periodic(Uint64 interval, void *param)
+{
+    PeriodicStats *stats = (PeriodicStats *)param;
+    const Uint64 now = CounterToNS(SDL_GetPerformanceCounter() - stats->start);
+    /* Deadlines stay on multiples of the interval from when the timer was added */
+    const Uint64 deadline = (now / interval) * interval;
+    const Uint64 late = now - deadline;
+
+    ++stats->count;
+    stats->late_sum += late;
+    stats->late_max = SDL_max(stats->late_max, late);
+    if (stats->count > 1) {
+        const Uint64 period = now - stats->last;
+        const Uint64 jitter = (period > interval) ? (period - interval) : (interval - period);
+        stats->jitter_sum += jitter;
+        stats->jitter_max = SDL_max(stats->jitter_max, jitter);
+        if (deadline > stats->last_deadline + interval) {
+            stats->skipped += (int)((deadline - stats->last_deadline) / interval) - 1;
+        }
+    }
+    stats->last = now;
+    stats->last_deadline = deadline;
+
+    if (stats->count == stats->target) {
+        SDL_AtomicSet(&stats->done, 1);
+        return 0;
+    }
+    return interval;
+}
+
+static int benchmark_periodic_timer(Uint64 interval, int count)
+{
+    PeriodicStats stats;
+    Uint32 timeout;
+    SDL_TimerID id;
+
+    SDL_zero(stats);
+    stats.interval = interval;
+    stats.target = count;
+    stats.start = SDL_GetPerformanceCounter();
+    id = SDL_AddTimerNS(interval, periodic, &stats);
+    if (!id) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create nanosecond timer: %s\n", SDL_GetError());
+        return 1;
+    }
+    timeout = SDL_GetTicks() + 10000;
+    while (!SDL_AtomicGet(&stats.done)) {
+        if (SDL_TICKS_PASSED(SDL_GetTicks(), timeout)) {
+            SDL_RemoveTimer(id);
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Periodic timer only ran %d of %d times\n", stats.count, count);
+            return 1;
+        }
+        SDL_Delay(10);
+    }
+
+    SDL_Log("Periodic %" SDL_PRIu64 " ns timer, %d calls: latency avg %" SDL_PRIu64 " ns max %" SDL_PRIu64 " ns, jitter avg %" SDL_PRIu64 " ns max %" SDL_PRIu64 " ns, %d deadlines skipped\n",
+            interval, count, stats.late_sum / count, stats.late_max,
+            stats.jitter_sum / (count - 1), stats.jitter_max, stats.skipped);
+    return 0;
+}
+
+#define NUM_ONESHOT_TIMERS 1000
+
+static SDL_atomic_t oneshots;
+
+static Uint64 SDLCALL
+oneshot(Uint64 interval, void *param)
+{
+    SDL_AtomicIncRef(&oneshots);
+    return 0;
+}
+
+static int benchmark_timer_adds(void)
+{
+    Uint64 start, now;
+    int i;
+
+    SDL_AtomicSet(&oneshots, 0);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < NUM_ONESHOT_TIMERS; ++i) {
+        SDL_AddTimerNS(1000000 + i * 10000, oneshot, NULL);
+    }
+    now = SDL_GetPerformanceCounter();
+    SDL_Log("Adding %d timers took %" SDL_PRIu64 " ns each\n", NUM_ONESHOT_TIMERS, CounterToNS(now - start) / NUM_ONESHOT_TIMERS);
+
+    SDL_Delay(100);
+    if (SDL_AtomicGet(&oneshots) != NUM_ONESHOT_TIMERS) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only %d of %d one-shot timers fired\n", SDL_AtomicGet(&oneshots), NUM_ONESHOT_TIMERS);
+        return 1;
+    }
+    return 0;
+}
+
 int main(int argc, char *argv[])
 {
     int i;
@@ -198,6 +313,28 @@ int main(int argc, char *argv[])
     now32 = SDL_GetTicks();
     SDL_Log("Delay 1 second = %d ms in ticks, %d ms in ticks64, %f ms according to performance counter\n", (int)(now32 - start32), (int)(now64 - start64), (double)((now - start) * 1000) / SDL_GetPerformanceFrequency());
 
+    for (i = 0; i < 4; ++i) {
+        const Uint64 delay_ns = (Uint64)250000 << (2 * i);
+        Uint64 late_max = 0;
+        int j;
+
+        for (j = 0; j < 20; ++j) {
+            start = SDL_GetPerformanceCounter();
+            SDL_DelayNS(delay_ns);
+            now = SDL_GetPerformanceCounter();
+            late_max = SDL_max(late_max, (now - start) * 1000000000 / SDL_GetPerformanceFrequency() - delay_ns);
+        }
+        SDL_Log("DelayNS %" SDL_PRIu64 " ns: at most %" SDL_PRIu64 " ns late over 20 calls\n", delay_ns, late_max);
+    }
+
+    return_code |= benchmark_periodic_timer(1000000, 1000);
+    return_code |= benchmark_periodic_timer(250000, 4000);
+    SDL_SetHint(SDL_HINT_TIMER_SLACK, "500");
+    SDL_Log("With %s microseconds of timer slack:\n", SDL_GetHint(SDL_HINT_TIMER_SLACK));
+    return_code |= benchmark_periodic_timer(1000000, 1000);
+    SDL_SetHint(SDL_HINT_TIMER_SLACK, NULL);
+    return_code |= benchmark_timer_adds();
+
     if (run_interactive_tests) {
         return_code |= test_sdl_delay_within_bounds();
     }